@@ -24,6 +24,13 @@ LOCAL_MODULE     := png
 LOCAL_LDLIBS     := -lz
 LOCAL_SRC_FILES  := $(png_sources:%=libpng-1.5.7/%)
 
+# The NEON row filters are ARMv7 assembly. pngrutil.c only selects them when
+# the CPU reports NEON, so armeabi-v7a devices without it still work.
+ifeq ($(TARGET_ARCH_ABI),armeabi-v7a)
+LOCAL_CFLAGS     += -DPNG_ARM_NEON
+LOCAL_SRC_FILES  += libpng-1.5.7/arm/filter_neon.S
+endif
+
 include $(BUILD_STATIC_LIBRARY)
 
 # Now build libhpdf
@@ -66,6 +73,7 @@ hpdf_sources := hpdf_3dmeasure.c \
                 hpdf_gstate.c \
                 hpdf_image.c \
                 hpdf_image_ccitt.c \
+                hpdf_image_loader.c \
                 hpdf_image_png.c \
                 hpdf_info.c \
                 hpdf_list.c \
@@ -76,6 +84,7 @@ hpdf_sources := hpdf_3dmeasure.c \
                 hpdf_number.c \
                 hpdf_objects.c \
                 hpdf_outline.c \
+                hpdf_page_builder.c \
                 hpdf_page_label.c \
                 hpdf_page_operator.c \
                 hpdf_pages.c \
@@ -88,7 +97,8 @@ hpdf_sources := hpdf_3dmeasure.c \
                 hpdf_xref.c
 
 jni_sources := org_libharu_PdfDocument.c \
-               org_libharu_PdfPage.c
+               org_libharu_PdfPage.c \
+               org_libharu_PdfTextLayout.c
 
 LOCAL_C_INCLUDES := \
     $(LOCAL_PATH)/libpng-1.5.7 \
@@ -96,7 +106,10 @@ LOCAL_C_INCLUDES := \
     $(LOCAL_PATH)/libhpdf-2.3.0RC2/src \
     $(LOCAL_PATH)
 
-LOCAL_LDLIBS    := -lz  -lm -llog
+# 64-bit file offsets. Below API level 24, 32-bit ABIs have no 64-bit
+# fseeko/ftello, and hpdf_conf.h falls back to fseek/ftell there.
+LOCAL_CFLAGS    := -D_FILE_OFFSET_BITS=64
+LOCAL_LDLIBS    := -lz  -lm -llog -ljnigraphics
 LOCAL_MODULE    := hpdf
 LOCAL_SRC_FILES := $(hpdf_sources:%=libhpdf-2.3.0RC2/src/%) $(jni_sources)
 
@@ -1 +1,5 @@
-APP_ABI := armeabi armeabi-v7a x86
+APP_ABI := armeabi armeabi-v7a arm64-v8a x86 x86_64
+
+# libjnigraphics, which PdfPage uses to read bitmaps, first ships in API
+# level 8. The 64-bit ABIs are built against API level 21 regardless.
+APP_PLATFORM := android-8
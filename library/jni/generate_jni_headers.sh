@@ -2,3 +2,4 @@
 
 javah -classpath ../bin/classes/ org.libharu.PdfDocument
 javah -classpath ../bin/classes/ org.libharu.PdfPage
+javah -classpath ../bin/classes/ org.libharu.PdfTextLayout
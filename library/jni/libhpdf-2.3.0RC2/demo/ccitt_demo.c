@@ -0,0 +1,252 @@
+/*
+ * << Haru Free PDF Library >> -- ccitt_demo.c
+ *
+ * Copyright (c) 1999-2006 Takeshi Kanno <takeshi_kanno@est.hi-ho.ne.jp>
+ *
+ * Permission to use, copy, modify, distribute and sell this software
+ * and its documentation for any purpose is hereby granted without fee,
+ * provided that the above copyright notice appear in all copies and
+ * that both that copyright notice and this permission notice appear
+ * in supporting documentation.
+ * It is provided "as is" without express or implied warranty.
+ *
+ */
+
+/*
+ *  Measures the CCITT G4 encoder with 300 dpi A4 bilevel pages of text
+ *  like content, random noise and a few large shapes. Each page is loaded
+ *  with HPDF_Image_LoadRaw1BitImageFromMem, which encodes it, and the time
+ *  per page is printed with a checksum of the saved document, so that the
+ *  output of two builds can be compared.
+ *
+ *  usage: ccitt_demo [pages-per-kind]
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include <setjmp.h>
+#include "hpdf.h"
+
+jmp_buf env;
+
+#ifdef HPDF_DLL
+void  __stdcall
+#else
+void
+#endif
+error_handler  (HPDF_STATUS   error_no,
+                HPDF_STATUS   detail_no,
+                void         *user_data)
+{
+    printf ("ERROR: error_no=%04X, detail_no=%u\n", (HPDF_UINT)error_no,
+                (HPDF_UINT)detail_no);
+    longjmp(env, 1);
+}
+
+
+#define PAGE_WIDTH      2480
+#define PAGE_HEIGHT     3508
+#define LINE_WIDTH      ((PAGE_WIDTH + 7) / 8)
+
+
+static HPDF_UINT32 seed;
+
+static HPDF_UINT32
+next_random (void)
+{
+    seed = seed * 1103515245u + 12345u;
+    return seed >> 8;
+}
+
+
+static void
+fill_rect  (HPDF_BYTE  *bits,
+            int         x0,
+            int         y0,
+            int         x1,
+            int         y1)
+{
+    int x;
+    int y;
+
+    for (y = y0; y < y1 && y < PAGE_HEIGHT; y++)
+        for (x = x0; x < x1 && x < PAGE_WIDTH; x++)
+            bits[y * LINE_WIDTH + x / 8] |= (HPDF_BYTE)(0x80 >> (x % 8));
+}
+
+
+/* lines of glyphs made of a few strokes, with spaces between words */
+static void
+draw_text  (HPDF_BYTE  *bits)
+{
+    int y;
+
+    for (y = 240; y + 32 < PAGE_HEIGHT - 240; y += 50) {
+        int x = 200;
+
+        while (x + 20 < PAGE_WIDTH - 200) {
+            int strokes = 2 + next_random () % 3;
+
+            if (next_random () % 6 == 0) {
+                x += 22;
+                continue;
+            }
+
+            while (strokes-- > 0) {
+                if (next_random () % 2)
+                    fill_rect (bits, x + next_random () % 14, y,
+                            x + 4 + next_random () % 14, y + 32);
+                else {
+                    int sy = y + next_random () % 28;
+
+                    fill_rect (bits, x, sy, x + 18, sy + 4);
+                }
+            }
+            x += 22;
+        }
+    }
+}
+
+
+static void
+draw_noise  (HPDF_BYTE  *bits)
+{
+    int i;
+
+    for (i = 0; i < LINE_WIDTH * PAGE_HEIGHT; i++)
+        bits[i] = (HPDF_BYTE)next_random ();
+}
+
+
+/* a frame, a few bars and a filled circle */
+static void
+draw_shapes  (HPDF_BYTE  *bits)
+{
+    int r = 700;
+    int cx = PAGE_WIDTH / 2;
+    int cy = PAGE_HEIGHT / 2;
+    int y;
+    int i;
+
+    fill_rect (bits, 100, 100, PAGE_WIDTH - 100, 140);
+    fill_rect (bits, 100, PAGE_HEIGHT - 140, PAGE_WIDTH - 100,
+            PAGE_HEIGHT - 100);
+    fill_rect (bits, 100, 100, 140, PAGE_HEIGHT - 100);
+    fill_rect (bits, PAGE_WIDTH - 140, 100, PAGE_WIDTH - 100,
+            PAGE_HEIGHT - 100);
+
+    for (i = 0; i < 5; i++)
+        fill_rect (bits, 300 + i * 400, 300, 500 + i * 400, 900);
+
+    for (y = -r; y <= r; y++) {
+        int w = 0;
+
+        while ((w + 1) * (w + 1) + y * y <= r * r)
+            w++;
+        fill_rect (bits, cx - w, cy + y, cx + w, cy + y + 1);
+    }
+}
+
+
+static HPDF_UINT32
+checksum  (HPDF_Doc  pdf)
+{
+    HPDF_BYTE buf[4096];
+    HPDF_UINT32 a = 1;
+    HPDF_UINT32 b = 0;
+
+    HPDF_ResetStream (pdf);
+    for (;;) {
+        HPDF_UINT32 len = sizeof (buf);
+        HPDF_UINT32 i;
+
+        HPDF_ReadFromStream (pdf, buf, &len);
+        if (len == 0)
+            break;
+
+        for (i = 0; i < len; i++) {
+            a = (a + buf[i]) % 65521;
+            b = (b + a) % 65521;
+        }
+    }
+
+    return (b << 16) | a;
+}
+
+
+static int
+run_kind  (const char  *name,
+           void       (*draw) (HPDF_BYTE *),
+           int          pages)
+{
+    HPDF_Doc  pdf;
+    HPDF_BYTE *bits;
+    double seconds = 0;
+    int i;
+
+    bits = (HPDF_BYTE *)malloc (LINE_WIDTH * PAGE_HEIGHT);
+    if (!bits)
+        return 1;
+
+    pdf = HPDF_New (error_handler, NULL);
+    if (!pdf) {
+        free (bits);
+        return 1;
+    }
+
+    if (setjmp(env)) {
+        HPDF_Free (pdf);
+        free (bits);
+        return 1;
+    }
+
+    seed = 1;
+    memset (bits, 0, LINE_WIDTH * PAGE_HEIGHT);
+    draw (bits);
+
+    for (i = 0; i < pages; i++) {
+        HPDF_Page page = HPDF_AddPage (pdf);
+        HPDF_Image image;
+        clock_t start = clock ();
+
+        image = HPDF_Image_LoadRaw1BitImageFromMem (pdf, bits, PAGE_WIDTH,
+                PAGE_HEIGHT, LINE_WIDTH, HPDF_TRUE, HPDF_TRUE);
+        seconds += (double)(clock () - start) / CLOCKS_PER_SEC;
+
+        HPDF_Page_DrawImage (page, image, 0, 0, HPDF_Page_GetWidth (page),
+                HPDF_Page_GetHeight (page));
+    }
+
+    HPDF_SaveToStream (pdf);
+
+    printf ("%-12s %9.2f  %10u  %08X\n", name, seconds * 1000 / pages,
+            HPDF_GetStreamSize (pdf), checksum (pdf));
+
+    HPDF_Free (pdf);
+    free (bits);
+
+    return 0;
+}
+
+
+int
+main (int argc, char **argv)
+{
+    int pages = (argc > 1) ? atoi (argv[1]) : 20;
+
+    if (pages < 1) {
+        printf ("usage: ccitt_demo [pages-per-kind]\n");
+        return 1;
+    }
+
+    printf ("content      ms/page     size (B)  checksum\n");
+
+    if (run_kind ("text-like", draw_text, pages) ||
+            run_kind ("noise", draw_noise, pages) ||
+            run_kind ("shapes", draw_shapes, pages))
+        return 1;
+
+    return 0;
+}
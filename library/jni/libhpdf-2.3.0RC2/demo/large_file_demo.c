@@ -0,0 +1,230 @@
+/*
+ * << Haru Free PDF Library >> -- large_file_demo.c
+ *
+ * Copyright (c) 1999-2006 Takeshi Kanno <takeshi_kanno@est.hi-ho.ne.jp>
+ *
+ * Permission to use, copy, modify, distribute and sell this software
+ * and its documentation for any purpose is hereby granted without fee,
+ * provided that the above copyright notice appear in all copies and
+ * that both that copyright notice and this permission notice appear
+ * in supporting documentation.
+ * It is provided "as is" without express or implied warranty.
+ *
+ */
+
+/*
+ *  Saves a document of more than 4 GB. Its pages show one large raw image
+ *  file, which is loaded many times. A memory budget moves the image data
+ *  to temporary files, so the document is not held in memory. The program
+ *  then follows the cross-reference table of the saved file, and fails if
+ *  an object past 4 GB is not found at its offset. Both files are removed
+ *  afterwards, since they take about 5 GB of disk space.
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <setjmp.h>
+#include "hpdf.h"
+
+#if defined(_MSC_VER)
+#define FSEEK_64    _fseeki64
+#define FTELL_64    _ftelli64
+typedef __int64     off_64;
+#else
+#define FSEEK_64    fseeko
+#define FTELL_64    ftello
+typedef off_t       off_64;
+#endif
+
+jmp_buf env;
+
+#ifdef HPDF_DLL
+void  __stdcall
+#else
+void
+#endif
+error_handler  (HPDF_STATUS   error_no,
+                HPDF_STATUS   detail_no,
+                void         *user_data)
+{
+    printf ("ERROR: error_no=%04X, detail_no=%u\n", (HPDF_UINT)error_no,
+                (HPDF_UINT)detail_no);
+    longjmp(env, 1);
+}
+
+
+#define IMAGE_WIDTH     4096
+#define IMAGE_HEIGHT    4096
+#define NUM_PAGES       100
+#define LIMIT_4GB       ((off_64)1 << 32)
+#define MEMORY_BUDGET   (64 * 1024 * 1024)
+
+
+static int
+write_raw_image  (const char  *fname)
+{
+    FILE *fp = fopen (fname, "wb");
+    unsigned char row[IMAGE_WIDTH * 3];
+    int x;
+    int y;
+
+    if (!fp)
+        return 0;
+
+    for (y = 0; y < IMAGE_HEIGHT; y++) {
+        for (x = 0; x < IMAGE_WIDTH; x++) {
+            row[x * 3] = (unsigned char)x;
+            row[x * 3 + 1] = (unsigned char)y;
+            row[x * 3 + 2] = (unsigned char)(x ^ y);
+        }
+
+        if (fwrite (row, 1, sizeof (row), fp) != sizeof (row)) {
+            fclose (fp);
+            return 0;
+        }
+    }
+
+    return fclose (fp) == 0;
+}
+
+
+/* returns the number of objects found past 4 GB, or -1 when an object is
+ * not where the cross-reference table says */
+static int
+check_xref  (const char  *fname)
+{
+    FILE *fp = fopen (fname, "rb");
+    char buf[64];
+    char *p;
+    off_64 xref;
+    unsigned long first;
+    unsigned long count;
+    int found = 0;
+
+    if (!fp)
+        return -1;
+
+    /* the offset of the table follows startxref at the end of the file */
+    if (FSEEK_64 (fp, -(off_64)(sizeof (buf) - 1), SEEK_END) != 0)
+        goto Fail;
+
+    memset (buf, 0, sizeof (buf));
+    if (fread (buf, 1, sizeof (buf) - 1, fp) == 0 ||
+            (p = strstr (buf, "startxref")) == NULL)
+        goto Fail;
+
+    xref = (off_64)strtoull (p + 9, NULL, 10);
+    if (FSEEK_64 (fp, xref, SEEK_SET) != 0 ||
+            !fgets (buf, sizeof (buf), fp) || strncmp (buf, "xref", 4) != 0)
+        goto Fail;
+
+    /* each section starts with its first object number and its size */
+    while (fgets (buf, sizeof (buf), fp) &&
+            sscanf (buf, "%lu %lu", &first, &count) == 2) {
+        unsigned long i;
+
+        for (i = 0; i < count; i++) {
+            char entry[21];
+            char head[32];
+            char obj[32];
+            off_64 offset;
+            off_64 next;
+
+            if (fread (entry, 1, 20, fp) != 20)
+                goto Fail;
+
+            entry[20] = 0;
+            offset = (off_64)strtoull (entry, NULL, 10);
+            if (entry[17] != 'n' || offset < LIMIT_4GB)
+                continue;
+
+            /* look the object up and come back to the table */
+            next = FTELL_64 (fp);
+            sprintf (obj, "%lu 0 obj", first + i);
+            memset (head, 0, sizeof (head));
+            if (FSEEK_64 (fp, offset, SEEK_SET) != 0 ||
+                    fread (head, 1, strlen (obj), fp) != strlen (obj) ||
+                    strcmp (head, obj) != 0)
+                goto Fail;
+
+            found++;
+
+            if (FSEEK_64 (fp, next, SEEK_SET) != 0)
+                goto Fail;
+        }
+    }
+
+    fclose (fp);
+
+    return found;
+
+Fail:
+    fclose (fp);
+
+    return -1;
+}
+
+
+int main (int argc, char **argv)
+{
+    HPDF_Doc  pdf;
+    char fname[256];
+    char raw_fname[256];
+    int found;
+    int i;
+
+    strcpy (fname, argv[0]);
+    strcat (fname, ".pdf");
+    strcpy (raw_fname, argv[0]);
+    strcat (raw_fname, ".raw");
+
+    if (!write_raw_image (raw_fname)) {
+        printf ("error: cannot write %s\n", raw_fname);
+        return 1;
+    }
+
+    pdf = HPDF_New (error_handler, NULL);
+    if (!pdf) {
+        printf ("error: cannot create PdfDoc object\n");
+        remove (raw_fname);
+        return 1;
+    }
+
+    if (setjmp(env)) {
+        HPDF_Free (pdf);
+        remove (raw_fname);
+        remove (fname);
+        return 1;
+    }
+
+    /* keep at most 64 MB of image data in memory */
+    HPDF_SetMemoryBudget (pdf, MEMORY_BUDGET, NULL);
+
+    for (i = 0; i < NUM_PAGES; i++) {
+        HPDF_Page page = HPDF_AddPage (pdf);
+        HPDF_Image image = HPDF_LoadRawImageFromFile (pdf, raw_fname,
+                IMAGE_WIDTH, IMAGE_HEIGHT, HPDF_CS_DEVICE_RGB);
+
+        HPDF_Page_DrawImage (page, image, 50, 250, 500, 500);
+    }
+
+    /* save the document to a file */
+    HPDF_SaveToFile (pdf, fname);
+
+    /* clean up */
+    HPDF_Free (pdf);
+
+    found = check_xref (fname);
+
+    remove (raw_fname);
+    remove (fname);
+
+    if (found <= 0) {
+        printf ("error: %s\n", found < 0 ? "an object is not at its offset" :
+                "no object was written past 4 GB");
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,169 @@
+/*
+ * << Haru Free PDF Library >> -- number_demo.c
+ *
+ * Copyright (c) 1999-2006 Takeshi Kanno <takeshi_kanno@est.hi-ho.ne.jp>
+ *
+ * Permission to use, copy, modify, distribute and sell this software
+ * and its documentation for any purpose is hereby granted without fee,
+ * provided that the above copyright notice appear in all copies and
+ * that both that copyright notice and this permission notice appear
+ * in supporting documentation.
+ * It is provided "as is" without express or implied warranty.
+ *
+ */
+
+/*
+ *  Measures the functions which format the numbers of page descriptions
+ *  and cross-reference tables, and prints the time they take for the
+ *  same pseudo-random values. A few values are checked against the text
+ *  the library has always written for them first.
+ *
+ *  usage: number_demo [conversions]
+ *
+ *  The functions are internal to the library, so the program is linked
+ *  to the static library.
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include "hpdf.h"
+#include "hpdf_utils.h"
+
+
+typedef struct {
+    HPDF_REAL   val;
+    const char *text;
+} real_case_t;
+
+
+static const real_case_t real_cases[] = {
+    { 0.0f, "0" },
+    { 1.0f, "1" },
+    { -1.5f, "-1.5" },
+    { 0.25f, "0.25" },
+    { 595.276f, "595.276" },
+    { -12345.12305f, "-12345.12305" },
+    { 32767.0f, "32767" },
+    { 100000.0f, "32767" }
+};
+
+
+static int
+check_values (void)
+{
+    char buf[HPDF_INT64_LEN + 1];
+    char *eptr = buf + sizeof (buf) - 1;
+    unsigned int i;
+    int failed = 0;
+
+    for (i = 0; i < sizeof (real_cases) / sizeof (real_cases[0]); i++) {
+        HPDF_FToA (buf, real_cases[i].val, eptr);
+        if (strcmp (buf, real_cases[i].text) != 0) {
+            printf ("ERROR: FToA wrote \"%s\" instead of \"%s\"\n", buf,
+                    real_cases[i].text);
+            failed = 1;
+        }
+    }
+
+    /* clamped to HPDF_LIMIT_MIN_INT */
+    HPDF_IToA (buf, -2147483647 - 1, eptr);
+    if (strcmp (buf, "-2147483647") != 0) {
+        printf ("ERROR: IToA wrote \"%s\"\n", buf);
+        failed = 1;
+    }
+
+    HPDF_UInt64ToA (buf, (HPDF_UINT64)4294967296u * 3 + 7, eptr);
+    if (strcmp (buf, "12884901895") != 0) {
+        printf ("ERROR: UInt64ToA wrote \"%s\"\n", buf);
+        failed = 1;
+    }
+
+    return failed;
+}
+
+
+/* same values on every run, spread like coordinates on a page */
+static HPDF_UINT32 seed;
+
+static HPDF_UINT32
+next_random (void)
+{
+    seed = seed * 1103515245u + 12345u;
+    return seed >> 8;
+}
+
+
+static double
+seconds_since (clock_t start)
+{
+    return (double)(clock () - start) / CLOCKS_PER_SEC;
+}
+
+
+int
+main (int argc, char **argv)
+{
+    long conversions = (argc > 1) ? atol (argv[1]) : 20000000;
+    char buf[HPDF_INT64_LEN + 1];
+    char *eptr = buf + sizeof (buf) - 1;
+    HPDF_UINT sum = 0;
+    clock_t start;
+    long i;
+
+    if (conversions < 1) {
+        printf ("usage: number_demo [conversions]\n");
+        return 1;
+    }
+
+    if (check_values ())
+        return 1;
+
+    printf ("function         seconds  ns/conversion\n");
+
+    seed = 1;
+    start = clock ();
+    for (i = 0; i < conversions; i++) {
+        HPDF_REAL val = (HPDF_REAL)(next_random () % 1200000) / 1000 - 300;
+
+        sum += (HPDF_UINT)(HPDF_FToA (buf, val, eptr) - buf);
+    }
+    printf ("FToA          %9.2f  %13.1f\n", seconds_since (start),
+            seconds_since (start) * 1e9 / conversions);
+
+    seed = 1;
+    start = clock ();
+    for (i = 0; i < conversions; i++) {
+        HPDF_REAL val = (HPDF_REAL)(next_random () % 1200000) / 1000 - 300;
+
+        sum += (HPDF_UINT)(HPDF_FToA2 (buf, val, 2, eptr) - buf);
+    }
+    printf ("FToA2 (2)     %9.2f  %13.1f\n", seconds_since (start),
+            seconds_since (start) * 1e9 / conversions);
+
+    seed = 1;
+    start = clock ();
+    for (i = 0; i < conversions; i++) {
+        HPDF_INT32 val = (HPDF_INT32)(next_random () % 2000000) - 1000000;
+
+        sum += (HPDF_UINT)(HPDF_IToA (buf, val, eptr) - buf);
+    }
+    printf ("IToA          %9.2f  %13.1f\n", seconds_since (start),
+            seconds_since (start) * 1e9 / conversions);
+
+    seed = 1;
+    start = clock ();
+    for (i = 0; i < conversions; i++) {
+        HPDF_UINT64 val = (HPDF_UINT64)next_random () * 997;
+
+        sum += (HPDF_UINT)(HPDF_UInt64ToA (buf, val, eptr) - buf);
+    }
+    printf ("UInt64ToA     %9.2f  %13.1f\n", seconds_since (start),
+            seconds_since (start) * 1e9 / conversions);
+
+    /* the lengths are summed, so that no conversion is left out */
+    printf ("characters written: %u\n", sum);
+
+    return 0;
+}
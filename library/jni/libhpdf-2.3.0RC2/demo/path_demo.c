@@ -0,0 +1,173 @@
+/*
+ * << Haru Free PDF Library >> -- path_demo.c
+ *
+ * Copyright (c) 1999-2006 Takeshi Kanno <takeshi_kanno@est.hi-ho.ne.jp>
+ *
+ * Permission to use, copy, modify, distribute and sell this software
+ * and its documentation for any purpose is hereby granted without fee,
+ * provided that the above copyright notice appear in all copies and
+ * that both that copyright notice and this permission notice appear
+ * in supporting documentation.
+ * It is provided "as is" without express or implied warranty.
+ *
+ */
+
+/*
+ *  Draws paths with HPDF_Page_Polyline, HPDF_Page_Polygon and
+ *  HPDF_Page_PathFromArrays. The last paths are curves off the page made
+ *  of the longest numbers the library writes. Short lines in front of
+ *  them shift the curves, so that each byte of the buffer of the bulk
+ *  path functions is once the start of a curve. The program fails if the
+ *  saved document does not hold all of the curves.
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+#include <setjmp.h>
+#include "hpdf.h"
+
+jmp_buf env;
+
+#ifdef HPDF_DLL
+void  __stdcall
+#else
+void
+#endif
+error_handler  (HPDF_STATUS   error_no,
+                HPDF_STATUS   detail_no,
+                void         *user_data)
+{
+    printf ("ERROR: error_no=%04X, detail_no=%u\n", (HPDF_UINT)error_no,
+                (HPDF_UINT)detail_no);
+    longjmp(env, 1);
+}
+
+
+#define NUM_CURVES      60
+#define NUM_SHIFTS      80
+#define FAR_COORD       -12345.12305f
+
+
+static HPDF_UINT
+count_operators  (HPDF_Doc     pdf,
+                  const char  *op)
+{
+    HPDF_UINT32 size = HPDF_GetStreamSize (pdf);
+    HPDF_BYTE *buf = malloc (size + 1);
+    HPDF_UINT count = 0;
+    HPDF_UINT32 len = size;
+    char *p;
+
+    if (!buf)
+        return 0;
+
+    HPDF_ResetStream (pdf);
+    HPDF_ReadFromStream (pdf, buf, &len);
+    buf[len] = 0;
+
+    for (p = (char *)buf; (p = strstr (p, op)) != NULL; p++)
+        count++;
+
+    free (buf);
+
+    return count;
+}
+
+
+int main (int argc, char **argv)
+{
+    HPDF_Doc  pdf;
+    HPDF_Page page;
+    char fname[256];
+    HPDF_Point star[10];
+    HPDF_Point wave[200];
+    char ops[1 + NUM_SHIFTS + NUM_CURVES];
+    HPDF_REAL coords[2 + NUM_SHIFTS * 2 + NUM_CURVES * 6];
+    HPDF_UINT curves;
+    int shift;
+    int i;
+
+    strcpy (fname, argv[0]);
+    strcat (fname, ".pdf");
+
+    pdf = HPDF_New (error_handler, NULL);
+    if (!pdf) {
+        printf ("error: cannot create PdfDoc object\n");
+        return 1;
+    }
+
+    if (setjmp(env)) {
+        HPDF_Free (pdf);
+        return 1;
+    }
+
+    page = HPDF_AddPage (pdf);
+
+    /* a star as one polygon */
+    for (i = 0; i < 10; i++) {
+        double r = (i % 2) ? 40 : 100;
+        double a = i * 3.141592 / 5;
+
+        star[i].x = (HPDF_REAL)(200 + r * sin (a));
+        star[i].y = (HPDF_REAL)(600 + r * cos (a));
+    }
+    HPDF_Page_SetRGBFill (page, 1.0, 0.8, 0);
+    HPDF_Page_Polygon (page, star, 10);
+    HPDF_Page_FillStroke (page);
+
+    /* a wave as one polyline */
+    for (i = 0; i < 200; i++) {
+        wave[i].x = (HPDF_REAL)(50 + i * 2.5);
+        wave[i].y = (HPDF_REAL)(400 + 50 * sin (i / 10.0));
+    }
+    HPDF_Page_Polyline (page, wave, 200);
+    HPDF_Page_Stroke (page);
+
+    /* curves off the page, made of the longest numbers. each line
+     * "10 0 l" takes 7 bytes, so the curves start at every offset. */
+    for (shift = 0; shift < NUM_SHIFTS; shift++) {
+        HPDF_REAL *c = coords;
+
+        ops[0] = 'm';
+        *c++ = FAR_COORD;
+        *c++ = FAR_COORD;
+
+        for (i = 1; i <= shift; i++) {
+            ops[i] = 'l';
+            *c++ = 10;
+            *c++ = 0;
+        }
+
+        for (i = 0; i < NUM_CURVES; i++) {
+            int j;
+
+            ops[1 + shift + i] = 'c';
+            for (j = 0; j < 6; j++)
+                *c++ = FAR_COORD;
+        }
+
+        HPDF_Page_PathFromArrays (page, ops, 1 + shift + NUM_CURVES, coords,
+                (HPDF_UINT)(c - coords));
+        HPDF_Page_EndPath (page);
+    }
+
+    /* count the curves in the saved document */
+    HPDF_SaveToStream (pdf);
+    curves = count_operators (pdf, " c\012");
+    if (curves != NUM_SHIFTS * NUM_CURVES) {
+        printf ("error: %u curves were written instead of %u\n", curves,
+                NUM_SHIFTS * NUM_CURVES);
+        HPDF_Free (pdf);
+        return 1;
+    }
+
+    /* save the document to a file */
+    HPDF_SaveToFile (pdf, fname);
+
+    /* clean up */
+    HPDF_Free (pdf);
+
+    return 0;
+}
@@ -0,0 +1,146 @@
+/*
+ * << Haru Free PDF Library >> -- text_rect_demo.c
+ *
+ * Copyright (c) 1999-2006 Takeshi Kanno <takeshi_kanno@est.hi-ho.ne.jp>
+ *
+ * Permission to use, copy, modify, distribute and sell this software
+ * and its documentation for any purpose is hereby granted without fee,
+ * provided that the above copyright notice appear in all copies and
+ * that both that copyright notice and this permission notice appear
+ * in supporting documentation.
+ * It is provided "as is" without express or implied warranty.
+ *
+ */
+
+/*
+ *  Prints a justified paragraph with HPDF_Page_TextRect while the
+ *  redundant graphics state operators are left out. The justified lines
+ *  are spread with the character spacing, and the last line has to be
+ *  printed with the spacing it had before. The program fails if the
+ *  saved document does not set it back.
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <setjmp.h>
+#include "hpdf.h"
+
+jmp_buf env;
+
+#ifdef HPDF_DLL
+void  __stdcall
+#else
+void
+#endif
+error_handler  (HPDF_STATUS   error_no,
+                HPDF_STATUS   detail_no,
+                void         *user_data)
+{
+    printf ("ERROR: error_no=%04X, detail_no=%u\n", (HPDF_UINT)error_no,
+                (HPDF_UINT)detail_no);
+    longjmp(env, 1);
+}
+
+
+static const char *text =
+    "aaa bbb ccc ddd eee fff ggg hhh iii jjj kkk lll mmm nnn ooo ppp "
+    "qqq rrr sss ttt uuu vvv www xxx yyy zzz aaa bbb ccc ddd eee fff "
+    "ggg hhh iii jjj kkk lll mmm nnn";
+
+
+/* compares the operand of the last Tc in front of the last line */
+static int
+check_last_line  (HPDF_Doc     pdf,
+                  const char  *char_space)
+{
+    HPDF_UINT32 size = HPDF_GetStreamSize (pdf);
+    HPDF_BYTE *buf = malloc (size + 1);
+    HPDF_UINT32 len = size;
+    char *last_line = NULL;
+    char *last_tc = NULL;
+    char *operand;
+    char *p;
+    int ok = 0;
+
+    if (!buf)
+        return 0;
+
+    HPDF_ResetStream (pdf);
+    HPDF_ReadFromStream (pdf, buf, &len);
+    buf[len] = 0;
+
+    for (p = (char *)buf; (p = strstr (p, " '\012")) != NULL; p++)
+        last_line = p;
+
+    for (p = (char *)buf; (p = strstr (p, " Tc\012")) != NULL &&
+            p < last_line; p++)
+        last_tc = p;
+
+    if (last_tc) {
+        operand = last_tc;
+        while (operand > (char *)buf && operand[-1] != '\012')
+            operand--;
+
+        ok = (size_t)(last_tc - operand) == strlen (char_space) &&
+                strncmp (operand, char_space, strlen (char_space)) == 0;
+    }
+
+    free (buf);
+
+    return ok;
+}
+
+
+int main (int argc, char **argv)
+{
+    HPDF_Doc  pdf;
+    HPDF_Page page;
+    HPDF_Font font;
+    char fname[256];
+
+    strcpy (fname, argv[0]);
+    strcat (fname, ".pdf");
+
+    pdf = HPDF_New (error_handler, NULL);
+    if (!pdf) {
+        printf ("error: cannot create PdfDoc object\n");
+        return 1;
+    }
+
+    if (setjmp(env)) {
+        HPDF_Free (pdf);
+        return 1;
+    }
+
+    /* pages added from now on leave out redundant operators */
+    HPDF_SetOptimizeContent (pdf, HPDF_TRUE);
+
+    font = HPDF_GetFont (pdf, "Helvetica", NULL);
+    page = HPDF_AddPage (pdf);
+
+    HPDF_Page_Rectangle (page, 50, 650, 200, 150);
+    HPDF_Page_Stroke (page);
+
+    HPDF_Page_BeginText (page);
+    HPDF_Page_SetFontAndSize (page, font, 10);
+    HPDF_Page_TextRect (page, 50, 800, 250, 650, text, HPDF_TALIGN_JUSTIFY,
+            NULL);
+    HPDF_Page_EndText (page);
+
+    HPDF_SaveToStream (pdf);
+    if (!check_last_line (pdf, "0")) {
+        printf ("error: the last line is printed with the spacing of the "
+                "justified lines\n");
+        HPDF_Free (pdf);
+        return 1;
+    }
+
+    /* save the document to a file */
+    HPDF_SaveToFile (pdf, fname);
+
+    /* clean up */
+    HPDF_Free (pdf);
+
+    return 0;
+}
@@ -0,0 +1,208 @@
+/*
+ * << Haru Free PDF Library >> -- thread_demo.c
+ *
+ * Copyright (c) 1999-2006 Takeshi Kanno <takeshi_kanno@est.hi-ho.ne.jp>
+ *
+ * Permission to use, copy, modify, distribute and sell this software
+ * and its documentation for any purpose is hereby granted without fee,
+ * provided that the above copyright notice appear in all copies and
+ * that both that copyright notice and this permission notice appear
+ * in supporting documentation.
+ * It is provided "as is" without express or implied warranty.
+ *
+ */
+
+/*
+ *  Builds independent documents on several threads at once, one document
+ *  per thread at a time, and prints how many documents per second are
+ *  built with 1, 2, 4 ... threads. Every document must come out with the
+ *  same size as the one built first.
+ *
+ *  usage: thread_demo [max-threads [documents-per-thread]]
+ *
+ *  To look for data races, configure the build with
+ *  -DCMAKE_C_FLAGS=-fsanitize=thread and run it with a few documents.
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <pthread.h>
+#include <sys/time.h>
+#include "hpdf.h"
+
+typedef struct {
+    pthread_t   thread;
+    int         documents;
+    HPDF_UINT32 expected_size;
+    int         failed;
+} job_t;
+
+
+void
+error_handler (HPDF_STATUS   error_no,
+               HPDF_STATUS   detail_no,
+               void         *user_data)
+{
+    job_t *job = (job_t *)user_data;
+
+    /* other threads are running, so the error is only recorded. */
+    printf ("ERROR: error_no=%04X, detail_no=%u\n", (HPDF_UINT)error_no,
+                (HPDF_UINT)detail_no);
+    job->failed = 1;
+}
+
+
+static const char *text =
+    "The quick brown fox jumps over the lazy dog. "
+    "Zw\xc3\xb6lf Boxk\xc3\xa4mpfer jagen Viktor quer \xc3\xbc"
+    "ber den gro\xc3\x9f" "en Sylter Deich.";
+
+
+static HPDF_UINT32
+build_document (job_t *job)
+{
+    HPDF_Doc  pdf;
+    HPDF_Font font;
+    HPDF_Font ttfont;
+    HPDF_Image image;
+    HPDF_UINT32 size = 0;
+    int i;
+    int j;
+
+    pdf = HPDF_New (error_handler, job);
+    if (!pdf) {
+        job->failed = 1;
+        return 0;
+    }
+
+    HPDF_SetCompressionMode (pdf, HPDF_COMP_ALL);
+    HPDF_UseUTFEncodings (pdf);
+
+    font = HPDF_GetFont (pdf, "Helvetica", NULL);
+    ttfont = HPDF_GetFont (pdf, HPDF_LoadTTFontFromFile (pdf,
+                "ttfont/PenguinAttack.ttf", HPDF_TRUE), "UTF-8");
+    image = HPDF_LoadPngImageFromFile (pdf, "pngsuite/basn6a08.png");
+
+    for (i = 0; i < 10 && !job->failed; i++) {
+        HPDF_Page page = HPDF_AddPage (pdf);
+        HPDF_REAL height = HPDF_Page_GetHeight (page);
+
+        HPDF_Page_BeginText (page);
+        HPDF_Page_SetFontAndSize (page, font, 10);
+        for (j = 0; j < 40; j++)
+            HPDF_Page_TextOut (page, 50, height - 50 - j * 14, text);
+
+        HPDF_Page_SetFontAndSize (page, ttfont, 12);
+        HPDF_Page_TextOut (page, 50, 150, text);
+        HPDF_Page_EndText (page);
+
+        for (j = 0; j < 20; j++) {
+            HPDF_Page_SetRGBStroke (page, j / 20.0f, 0.2f, 0.5f);
+            HPDF_Page_Rectangle (page, 300 + j * 5, 50 + j * 5, 100, 60);
+            HPDF_Page_Stroke (page);
+        }
+
+        HPDF_Page_DrawImage (page, image, 450, 50, 64, 64);
+    }
+
+    /* save into memory, so that the disk is not measured. */
+    if (!job->failed && HPDF_SaveToStream (pdf) == HPDF_OK)
+        size = HPDF_GetStreamSize (pdf);
+
+    HPDF_Free (pdf);
+
+    return size;
+}
+
+
+static void *
+run_job (void *arg)
+{
+    job_t *job = (job_t *)arg;
+    int i;
+
+    for (i = 0; i < job->documents && !job->failed; i++) {
+        if (build_document (job) != job->expected_size) {
+            printf ("ERROR: the size of a document differs\n");
+            job->failed = 1;
+        }
+    }
+
+    return NULL;
+}
+
+
+static double
+now (void)
+{
+    struct timeval tv;
+
+    gettimeofday (&tv, NULL);
+    return tv.tv_sec + tv.tv_usec / 1000000.0;
+}
+
+
+int
+main (int argc, char **argv)
+{
+    int max_threads = (argc > 1) ? atoi (argv[1]) : 4;
+    int documents = (argc > 2) ? atoi (argv[2]) : 20;
+    double base_rate = 0;
+    job_t first;
+    job_t *jobs;
+    int threads;
+    int failed = 0;
+
+    if (max_threads < 1 || documents < 1) {
+        printf ("usage: thread_demo [max-threads [documents-per-thread]]\n");
+        return 1;
+    }
+
+    memset (&first, 0, sizeof (first));
+    first.expected_size = build_document (&first);
+    if (first.failed || first.expected_size == 0)
+        return 1;
+
+    jobs = (job_t *)malloc (sizeof (job_t) * max_threads);
+    if (!jobs)
+        return 1;
+
+    printf ("threads  documents  seconds  documents/s  speedup\n");
+
+    for (threads = 1; threads <= max_threads && !failed; threads *= 2) {
+        double start;
+        double seconds;
+        double rate;
+        int i;
+
+        memset (jobs, 0, sizeof (job_t) * threads);
+
+        start = now ();
+        for (i = 0; i < threads; i++) {
+            jobs[i].documents = documents;
+            jobs[i].expected_size = first.expected_size;
+            if (pthread_create (&jobs[i].thread, NULL, run_job, &jobs[i])) {
+                printf ("ERROR: cannot create a thread\n");
+                return 1;
+            }
+        }
+
+        for (i = 0; i < threads; i++) {
+            pthread_join (jobs[i].thread, NULL);
+            failed |= jobs[i].failed;
+        }
+        seconds = now () - start;
+
+        rate = threads * documents / seconds;
+        if (threads == 1)
+            base_rate = rate;
+
+        printf ("%7d  %9d  %7.2f  %11.1f  %7.2f\n", threads,
+                threads * documents, seconds, rate, rate / base_rate);
+    }
+
+    free (jobs);
+
+    return failed;
+}
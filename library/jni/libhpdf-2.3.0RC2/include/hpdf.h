@@ -77,6 +77,8 @@ typedef HPDF_HANDLE   HPDF_Dict;
 typedef HPDF_HANDLE   HPDF_EmbeddedFile;
 typedef HPDF_HANDLE   HPDF_OutputIntent;
 typedef HPDF_HANDLE   HPDF_Xref;
+typedef HPDF_HANDLE   HPDF_TextLayout;
+typedef HPDF_HANDLE   HPDF_PageBuilder;
 
 #else
 
@@ -99,6 +101,12 @@ HPDF_EXPORT(const char *)
 HPDF_GetVersion  (void);
 
 
+/* documents may be built on different threads at the same time, each by
+ * one thread at a time; they share nothing but the predefined encoders,
+ * which are not modified once built. the error handler of a document is
+ * called on the thread which uses it. when the library is built with
+ * LIBHPDF_HAVE_NOTHREADS, only one thread may use it at a time.
+ */
 HPDF_EXPORT(HPDF_Doc)
 HPDF_NewEx  (HPDF_Error_Handler   user_error_fn,
              HPDF_Alloc_Func      user_alloc_fn,
@@ -136,6 +144,10 @@ HPDF_EXPORT(void)
 HPDF_FreeDocAll  (HPDF_Doc  pdf);
 
 
+HPDF_EXPORT(HPDF_STATUS)
+HPDF_SetTemplate  (HPDF_Doc  pdf);
+
+
 HPDF_EXPORT(HPDF_STATUS)
 HPDF_SaveToStream  (HPDF_Doc   pdf);
 
@@ -163,6 +175,17 @@ HPDF_SaveToFile  (HPDF_Doc     pdf,
                   const char  *file_name);
 
 
+HPDF_EXPORT(HPDF_STATUS)
+HPDF_SetWriteBufferSize  (HPDF_Doc    pdf,
+                          HPDF_UINT   size);
+
+
+HPDF_EXPORT(HPDF_STATUS)
+HPDF_SetMemoryBudget  (HPDF_Doc     pdf,
+                       HPDF_UINT32  limit,
+                       const char   *tmp_dir);
+
+
 HPDF_EXPORT(HPDF_STATUS)
 HPDF_GetError  (HPDF_Doc   pdf);
 
@@ -240,6 +263,49 @@ HPDF_InsertPage  (HPDF_Doc    pdf,
                   HPDF_Page   page);
 
 
+/* a page builder makes pages of pdf apart from it, so that the pages of
+ * one document can be drawn on several threads at once. each thread
+ * draws the pages of its own builder, which have their own memory and
+ * object numbers, and HPDF_PageBuilder_Commit adds them after the last
+ * page of pdf, in the order the builders are committed in.
+ *
+ * HPDF_PageBuilder_New and HPDF_PageBuilder_Commit are called on the
+ * thread which uses pdf. in between, the builder and its pages may be
+ * used on any one thread. the fonts, images and extended graphics states
+ * drawn on them must be loaded into pdf beforehand, and pdf must not be
+ * saved while they are drawn on. the errors of a builder are passed to
+ * the error handler of pdf from its commit on; until then they are got
+ * with HPDF_PageBuilder_GetError. a builder which is not committed must
+ * be freed with HPDF_PageBuilder_Free before pdf is freed.
+ */
+HPDF_EXPORT(HPDF_PageBuilder)
+HPDF_PageBuilder_New  (HPDF_Doc  pdf);
+
+
+HPDF_EXPORT(HPDF_Page)
+HPDF_PageBuilder_AddPage  (HPDF_PageBuilder  builder);
+
+
+/* ends the pages of builder and compresses their contents on the calling
+ * thread, rather than on the thread which saves the document. nothing can
+ * be drawn on the pages afterwards.
+ */
+HPDF_EXPORT(HPDF_STATUS)
+HPDF_PageBuilder_Finish  (HPDF_PageBuilder  builder);
+
+
+HPDF_EXPORT(HPDF_STATUS)
+HPDF_PageBuilder_GetError  (HPDF_PageBuilder  builder);
+
+
+HPDF_EXPORT(HPDF_STATUS)
+HPDF_PageBuilder_Commit  (HPDF_PageBuilder  builder);
+
+
+HPDF_EXPORT(void)
+HPDF_PageBuilder_Free  (HPDF_PageBuilder  builder);
+
+
 HPDF_EXPORT(HPDF_STATUS)
 HPDF_Page_SetWidth  (HPDF_Page   page,
                      HPDF_REAL   value);
@@ -279,6 +345,17 @@ HPDF_LoadType1FontFromFile  (HPDF_Doc     pdf,
                              const char  *data_file_name);
 
 
+/*
+ * Writes the metrics of a Type1 font loaded by HPDF_LoadType1FontFromFile
+ * to a binary file, which HPDF_LoadType1FontFromFile accepts in place of
+ * the AFM file and loads without parsing it.
+ */
+HPDF_EXPORT(HPDF_STATUS)
+HPDF_SaveType1FontMetrics  (HPDF_Doc     pdf,
+                            const char  *font_name,
+                            const char  *file_name);
+
+
 HPDF_EXPORT(HPDF_FontDef)
 HPDF_GetTTFontDefFromFile (HPDF_Doc     pdf,
                            const char  *file_name,
@@ -747,11 +824,28 @@ HPDF_LoadPngImageFromFile (HPDF_Doc      pdf,
                            const char    *filename);
 
 
+/* the ...Async image loading functions return the image as soon as its
+ * data has been copied, and decode, encode and compress it on worker
+ * threads of the document (see HPDF_SetImageLoadThreads). The image may
+ * be drawn right away; its data is waited for when the document is saved
+ * or HPDF_Image_WaitLoad is called, which also reports errors in it.
+ */
+HPDF_EXPORT(HPDF_Image)
+HPDF_LoadPngImageFromMemAsync  (HPDF_Doc     pdf,
+                         const HPDF_BYTE    *buffer,
+                               HPDF_UINT     size);
+
+
 HPDF_EXPORT(HPDF_Image)
 HPDF_LoadPngImageFromFile2 (HPDF_Doc      pdf,
                             const char    *filename);
 
 
+/* only the header of the file is read here. the image data is read from
+ * the file whenever the document is saved, so the file must stay in place
+ * and unchanged until then. a file which has been removed or whose size
+ * has changed makes the save fail with HPDF_INVALID_IMAGE or a file error.
+ */
 HPDF_EXPORT(HPDF_Image)
 HPDF_LoadJpegImageFromFile (HPDF_Doc      pdf,
                             const char    *filename);
@@ -775,6 +869,20 @@ HPDF_Image_LoadRaw1BitImageFromMem  (HPDF_Doc           pdf,
                           HPDF_BOOL          top_is_first);
 
 
+HPDF_EXPORT(HPDF_Image)
+HPDF_Image_LoadRaw1BitImageFromMemAsync  (HPDF_Doc           pdf,
+                                          const HPDF_BYTE   *buf,
+                                          HPDF_UINT          width,
+                                          HPDF_UINT          height,
+                                          HPDF_UINT          line_width,
+                                          HPDF_BOOL          black_is1,
+                                          HPDF_BOOL          top_is_first);
+
+
+/* only the size of the file is checked here. as with
+ * HPDF_LoadJpegImageFromFile, the pixels are read from the file whenever
+ * the document is saved, so the file must stay unchanged until then.
+ */
 HPDF_EXPORT(HPDF_Image)
 HPDF_LoadRawImageFromFile  (HPDF_Doc           pdf,
                             const char         *filename,
@@ -791,10 +899,38 @@ HPDF_LoadRawImageFromMem  (HPDF_Doc           pdf,
                            HPDF_ColorSpace    color_space,
                            HPDF_UINT          bits_per_component);
 
+
+HPDF_EXPORT(HPDF_Image)
+HPDF_LoadRawImageFromMemAsync  (HPDF_Doc           pdf,
+                                const HPDF_BYTE   *buf,
+                                HPDF_UINT          width,
+                                HPDF_UINT          height,
+                                HPDF_ColorSpace    color_space,
+                                HPDF_UINT          bits_per_component);
+
+
+HPDF_EXPORT(HPDF_STATUS)
+HPDF_Image_WaitLoad  (HPDF_Image  image);
+
+
+HPDF_EXPORT(HPDF_Image)
+HPDF_LoadPixelImageFromMem  (HPDF_Doc           pdf,
+                             const HPDF_BYTE   *pixels,
+                             HPDF_UINT          width,
+                             HPDF_UINT          height,
+                             HPDF_UINT          stride,
+                             HPDF_PixelFormat   format);
+
 HPDF_EXPORT(HPDF_STATUS)
 HPDF_Image_AddSMask  (HPDF_Image    image,
                       HPDF_Image    smask);
 
+HPDF_EXPORT(HPDF_STATUS)
+HPDF_Image_Downsample  (HPDF_Image  image,
+                        HPDF_REAL   width,
+                        HPDF_REAL   height,
+                        HPDF_REAL   dpi);
+
 HPDF_EXPORT(HPDF_Point)
 HPDF_Image_GetSize (HPDF_Image  image);
 
@@ -883,6 +1019,69 @@ HPDF_SetCompressionMode  (HPDF_Doc    pdf,
                           HPDF_UINT   mode);
 
 
+/* sets the number of decimal places (0 to 5) written for coordinates
+ * and other real values in the page descriptions of pages added
+ * afterwards.
+ */
+HPDF_EXPORT(HPDF_STATUS)
+HPDF_SetRealPrecision  (HPDF_Doc    pdf,
+                        HPDF_UINT   precision);
+
+
+/* when optimize is HPDF_TRUE, the page descriptions of pages added
+ * afterwards leave out the operators which set a graphics state or text
+ * state parameter to the value it already has.
+ */
+HPDF_EXPORT(HPDF_STATUS)
+HPDF_SetOptimizeContent  (HPDF_Doc    pdf,
+                          HPDF_BOOL   optimize);
+
+
+/* when share is HPDF_TRUE, pages added afterwards have no resource
+ * dictionary of their own. they inherit one from the root pages object,
+ * in which the fonts, images and extended graphics states of all of them
+ * are registered.
+ */
+HPDF_EXPORT(HPDF_STATUS)
+HPDF_SetShareResources  (HPDF_Doc    pdf,
+                         HPDF_BOOL   share);
+
+
+/* when cache is HPDF_TRUE, saving keeps the serialized bytes of images,
+ * embedded fonts and finished page contents, and the following saves
+ * write them again instead of compressing the objects anew. it is meant
+ * for documents which are saved more than once. the data of images which
+ * are read from their files or loaded lazily is never kept.
+ */
+HPDF_EXPORT(HPDF_STATUS)
+HPDF_SetCacheObjects  (HPDF_Doc    pdf,
+                       HPDF_BOOL   cache);
+
+
+/* sets the resolution (pixels per inch) which wrappers that load and draw
+ * an image in one call pass to HPDF_Image_Downsample. 0, the default,
+ * keeps images at their full resolution.
+ */
+HPDF_EXPORT(HPDF_STATUS)
+HPDF_SetImageResolution  (HPDF_Doc    pdf,
+                          HPDF_REAL   dpi);
+
+
+HPDF_EXPORT(HPDF_REAL)
+HPDF_GetImageResolution  (HPDF_Doc    pdf);
+
+
+/* sets the number of worker threads used by the asynchronous image
+ * loading functions; 0, the default, starts one for each online
+ * processor. The threads are started by the first image loaded
+ * asynchronously into a document, so a new value applies from the next
+ * document.
+ */
+HPDF_EXPORT(HPDF_STATUS)
+HPDF_SetImageLoadThreads  (HPDF_Doc    pdf,
+                           HPDF_UINT   threads);
+
+
 /*--------------------------------------------------------------------------*/
 /*----- font ---------------------------------------------------------------*/
 
@@ -951,6 +1150,16 @@ HPDF_EXPORT(HPDF_ExtGState)
 HPDF_CreateExtGState  (HPDF_Doc  pdf);
 
 
+/* returns a read-only extended graphics state with the given values. the
+ * same object is returned for the same values, and pages refer to it by
+ * the same resource name. */
+HPDF_EXPORT(HPDF_ExtGState)
+HPDF_GetExtGState  (HPDF_Doc        pdf,
+                    HPDF_REAL       alpha_stroke,
+                    HPDF_REAL       alpha_fill,
+                    HPDF_BlendMode  bmode);
+
+
 HPDF_EXPORT(HPDF_STATUS)
 HPDF_ExtGState_SetAlphaStroke  (HPDF_ExtGState   ext_gstate,
                                 HPDF_REAL        value);
@@ -983,6 +1192,30 @@ HPDF_Page_MeasureText  (HPDF_Page    page,
                         HPDF_REAL   *real_width);
 
 
+HPDF_EXPORT(HPDF_TextLayout)
+HPDF_Page_LayoutText  (HPDF_Page    page,
+                       const char  *text,
+                       HPDF_UINT    len,
+                       HPDF_REAL    width);
+
+
+HPDF_EXPORT(HPDF_UINT)
+HPDF_TextLayout_GetLineCount  (HPDF_TextLayout  layout);
+
+
+HPDF_EXPORT(HPDF_TextLine)
+HPDF_TextLayout_GetLine  (HPDF_TextLayout  layout,
+                          HPDF_UINT        index);
+
+
+HPDF_EXPORT(const char*)
+HPDF_TextLayout_GetText  (HPDF_TextLayout  layout);
+
+
+HPDF_EXPORT(void)
+HPDF_TextLayout_Free  (HPDF_TextLayout  layout);
+
+
 HPDF_EXPORT(HPDF_REAL)
 HPDF_Page_GetWidth  (HPDF_Page   page);
 
@@ -1240,6 +1473,28 @@ HPDF_Page_Rectangle  (HPDF_Page  page,
                       HPDF_REAL  height);
 
 
+/* m l l ... */
+HPDF_EXPORT(HPDF_STATUS)
+HPDF_Page_Polyline  (HPDF_Page          page,
+                     const HPDF_Point  *points,
+                     HPDF_UINT          num_points);
+
+
+/* m l l ... h */
+HPDF_EXPORT(HPDF_STATUS)
+HPDF_Page_Polygon  (HPDF_Page          page,
+                    const HPDF_Point  *points,
+                    HPDF_UINT          num_points);
+
+
+HPDF_EXPORT(HPDF_STATUS)
+HPDF_Page_PathFromArrays  (HPDF_Page         page,
+                           const char       *ops,
+                           HPDF_UINT         num_ops,
+                           const HPDF_REAL  *coords,
+                           HPDF_UINT         num_coords);
+
+
 /*--- Path painting operator ---------------------------------------------*/
 
 /* S */
@@ -1524,6 +1779,18 @@ HPDF_Page_TextRect  (HPDF_Page            page,
                      HPDF_UINT           *len);
 
 
+HPDF_EXPORT(HPDF_STATUS)
+HPDF_Page_ShowTextLayout  (HPDF_Page            page,
+                           HPDF_TextLayout      layout,
+                           HPDF_UINT            first_line,
+                           HPDF_REAL            left,
+                           HPDF_REAL            top,
+                           HPDF_REAL            right,
+                           HPDF_REAL            bottom,
+                           HPDF_TextAlignment   align,
+                           HPDF_UINT           *next_line);
+
+
 HPDF_EXPORT(HPDF_STATUS)
 HPDF_Page_SetSlideShow  (HPDF_Page              page,
                          HPDF_TransitionStyle   type,
@@ -38,13 +38,34 @@
 #define HPDF_FREAD                  fread
 #define HPDF_FWRITE                 fwrite
 #define HPDF_FFLUSH                 fflush
+#if defined(_MSC_VER) && _MSC_VER >= 1400
+#define HPDF_FSEEK                  _fseeki64
+#define HPDF_FTELL                  _ftelli64
+#define HPDF_FOFF                   __int64
+#elif defined(_WIN32) || defined(UNDER_CE)
 #define HPDF_FSEEK                  fseek
 #define HPDF_FTELL                  ftell
+#define HPDF_FOFF                   long
+#elif defined(__ANDROID__) && !defined(__LP64__) && \
+        (!defined(__ANDROID_API__) || __ANDROID_API__ < 24)
+/* 32-bit bionic only has fseeko and ftello with a 64-bit off_t from API
+ * level 24 on, and with _FILE_OFFSET_BITS=64 does not declare them below
+ * it. files are still opened for large file access there, so files of
+ * more than 2 GB can be written, but not seeked in. */
+#define HPDF_FSEEK                  fseek
+#define HPDF_FTELL                  ftell
+#define HPDF_FOFF                   long
+#else
+#define HPDF_FSEEK                  fseeko
+#define HPDF_FTELL                  ftello
+#define HPDF_FOFF                   off_t
+#endif
 #define HPDF_FEOF                   feof
 #define HPDF_FERROR                 ferror
 #define HPDF_MALLOC                 malloc
 #define HPDF_FREE                   free
 #define HPDF_FILEP                  FILE*
+#define HPDF_TMPFILE                tmpfile
 #define HPDF_TIME                   time
 #define HPDF_PRINTF                 printf
 #define HPDF_SIN                    sin
@@ -56,6 +77,16 @@
 /* default buffer size of memory-stream-object */
 #define HPDF_STREAM_BUF_SIZ         4096
 
+/* default buffer size of write-combining buffer of file-writer */
+#define HPDF_WRITE_BUF_SIZ          262144
+
+/* block size used to copy file-backed streams to the output */
+#define HPDF_FILE_COPY_BUF_SIZ      65536
+
+/* number of images which may wait for each worker thread of the
+ * asynchronous image loader before loading another one blocks */
+#define HPDF_IMAGE_LOAD_QUEUE_SIZ   2
+
 /* default array size of list-object */
 #define HPDF_DEF_ITEMS_PER_BLOCK    20
 
@@ -76,9 +107,10 @@
 #define HPDF_MIN_MPOOL_BUF_SIZ      256
 #define HPDF_MAX_MPOOL_BUF_SIZ      1048576
 
-/* alignment size of memory-pool-object
+/* alignment size of memory-pool-object. the objects hold pointers,
+ * doubles and the locks of pthreads, which must be aligned.
  */
-#define HPDF_ALIGN_SIZ              sizeof int;
+#define HPDF_ALIGN_SIZ              8
 
 
 #endif /* _HPDF_CONF_H */
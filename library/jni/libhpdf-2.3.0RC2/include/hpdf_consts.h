@@ -34,10 +34,18 @@
 #define HPDF_SHORT_BUF_SIZ          32
 #define HPDF_REAL_LEN               11
 #define HPDF_INT_LEN                11
+#define HPDF_INT64_LEN              20
 #define HPDF_TEXT_DEFAULT_LEN       256
 #define HPDF_UNICODE_HEADER_LEN     2
 #define HPDF_DATE_TIME_STR_LEN      23
 
+/* number of decimal places written for real values */
+#define HPDF_DEF_REAL_PRECISION     5
+#define HPDF_MAX_REAL_PRECISION     5
+
+/* number of worker threads of the asynchronous image loader */
+#define HPDF_MAX_IMAGE_LOAD_THREADS 64
+
 /* length of each item defined in PDF */
 #define HPDF_BYTE_OFFSET_LEN        10
 #define HPDF_OBJ_ID_LEN             7
@@ -124,6 +132,9 @@
 #define HPDF_LIMIT_MAX_CID             65535
 #define HPDF_MAX_GENERATION_NUM        65535
 
+/* largest byte offset which fits in HPDF_BYTE_OFFSET_LEN digits */
+#define HPDF_LIMIT_MAX_BYTE_OFFSET     ((HPDF_UINT64)999999999 * 10 + 9)
+
 #define HPDF_MIN_PAGE_HEIGHT           3
 #define HPDF_MIN_PAGE_WIDTH            3
 #define HPDF_MAX_PAGE_HEIGHT           14400
@@ -20,6 +20,7 @@
 #define _HPDF_DOC_H
 
 #define HPDF_SIG_BYTES 0x41504446L
+#define HPDF_PAGE_BUILDER_SIG_BYTES 0x50424C44L
 
 #include "hpdf_catalog.h"
 #include "hpdf_image.h"
@@ -33,6 +34,34 @@ extern "C" {
 
 #define HPDF_VER_DEFAULT  HPDF_VER_12
 
+/*
+ *  HPDF_DocTemplate
+ *
+ *  A document frozen by HPDF_SetTemplate, together with the state of the
+ *  document it is cloned into by HPDF_NewDoc. The objects of its xref are
+ *  serialized, except the ones a clone can change, which are copied.
+ */
+
+typedef struct _HPDF_DocTemplate_Rec  *HPDF_DocTemplate;
+
+typedef struct _HPDF_DocTemplate_Rec {
+    HPDF_Xref            xref;
+    HPDF_Catalog         catalog;
+    HPDF_Outline         outlines;
+    HPDF_Dict            info;
+    HPDF_Pages           cur_pages;
+    HPDF_Page            cur_page;
+    HPDF_List            page_list;
+    HPDF_ExtGStateTable  ext_gstate_table;
+    HPDF_PDFVer          pdf_version;
+    HPDF_UINT            page_per_pages;
+    HPDF_UINT            cur_page_num;
+    HPDF_Encoder         cur_encoder;
+    HPDF_Encoder         def_encoder;
+    HPDF_List            page_builders;
+} HPDF_DocTemplate_Rec;
+
+
 typedef struct _HPDF_Doc_Rec {
     HPDF_UINT32     sig_bytes;
     HPDF_PDFVer     pdf_version;
@@ -58,11 +87,34 @@ typedef struct _HPDF_Doc_Rec {
     /* list for loaded encodings */
     HPDF_List         encoder_list;
 
+    /* when the memory-pool is used, the content of the document is
+     * allocated after doc_mark, and is released by rewinding to it when
+     * the next document is created. cache_grown is set when fontdefs or
+     * encoders, which are kept, were loaded after the mark. */
+    HPDF_MPool_Mark_Rec  doc_mark;
+    HPDF_BOOL         cache_grown;
+
     HPDF_Encoder      cur_encoder;
 
+    /* interned extended graphics states, created on first use */
+    HPDF_ExtGStateTable  ext_gstate_table;
+
     /* default compression mode */
     HPDF_BOOL         compression_mode;
 
+    /* decimal places of real values in page descriptions */
+    HPDF_UINT         real_precision;
+    HPDF_BOOL         optimize_content;
+
+    /* whether pages added use the resources of the root pages object */
+    HPDF_BOOL         share_resources;
+
+    /* whether saving keeps the serialized bytes of final objects */
+    HPDF_BOOL         cache_objects;
+
+    /* resolution images are downsampled to when drawn, 0 for none */
+    HPDF_REAL         image_resolution;
+
     HPDF_BOOL         encrypt_on;
     HPDF_EncryptDict  encrypt_dict;
 
@@ -73,11 +125,64 @@ typedef struct _HPDF_Doc_Rec {
 
     /* buffer for saving into memory stream */
     HPDF_Stream       stream;
+
+    /* size of write-combining buffer used when saving into a file */
+    HPDF_UINT         write_buf_siz;
+
+    /* memory budget of the stream objects of the document */
+    HPDF_StreamBudget_Rec  stream_budget;
+
+    /* worker threads of the asynchronous image loading functions. the
+     * loader is started by the first of them and stopped with the
+     * document. */
+    HPDF_UINT         image_load_threads;
+    HPDF_ImageLoader  image_loader;
+
+    /* template which new documents are cloned from */
+    HPDF_DocTemplate  tmpl;
+
+    /* page builders whose pages were added to the document. they are
+     * freed after the xref, which frees the objects allocated from them. */
+    HPDF_List         page_builders;
 } HPDF_Doc_Rec;
 
 typedef struct _HPDF_Doc_Rec  *HPDF_Doc;
 
 
+/*
+ *  HPDF_PageBuilder
+ *
+ *  Pages made apart from a document, so that several threads can draw
+ *  pages of the same document at once. A builder has a memory manager,
+ *  an error object and an xref of its own, in which the objects of its
+ *  pages get provisional numbers. HPDF_PageBuilder_Commit moves them to
+ *  the xref of the document; the builder then belongs to the document,
+ *  since the objects are allocated from its memory manager and report
+ *  errors to its error object.
+ */
+
+typedef struct _HPDF_PageBuilder_Rec  *HPDF_PageBuilder;
+
+typedef struct _HPDF_PageBuilder_Rec {
+    HPDF_UINT32       sig_bytes;
+    HPDF_Doc          pdf;
+    HPDF_MMgr         mmgr;
+    HPDF_Error_Rec    error;
+    HPDF_Xref         xref;
+    HPDF_List         page_list;
+    HPDF_BOOL         committed;
+
+    /* settings of the document when the builder was made */
+    HPDF_UINT         compression_mode;
+    HPDF_UINT         real_precision;
+    HPDF_BOOL         optimize_content;
+} HPDF_PageBuilder_Rec;
+
+
+void
+HPDF_PageBuilder_FreeAll  (HPDF_List  builders);
+
+
 HPDF_Encoder
 HPDF_Doc_FindEncoder (HPDF_Doc         pdf,
                       const char  *encoding_name);
@@ -98,6 +203,10 @@ HPDF_BOOL
 HPDF_Doc_Validate  (HPDF_Doc  pdf);
 
 
+HPDF_ImageLoader
+HPDF_Doc_GetImageLoader  (HPDF_Doc  pdf);
+
+
 /*----- page handling -------------------------------------------------------*/
 
 HPDF_Pages
@@ -119,6 +119,9 @@ typedef struct  _HPDF_Encoder_Rec {
     HPDF_Encoder_Write_Func         write_fn;
     HPDF_Encoder_Free_Func          free_fn;
     HPDF_Encoder_Init_Func          init_fn;
+
+    /* owned by HPDF_Encoder_GetShared, HPDF_Encoder_Free ignores it. */
+    HPDF_BOOL                       shared;
     /*
     char                         lang_code[3];
     char                         country_code[3];
@@ -158,6 +161,12 @@ HPDF_Encoder_ToUnicode  (HPDF_Encoder     encoder,
 void
 HPDF_Encoder_Free  (HPDF_Encoder  encoder);
 
+
+HPDF_Encoder
+HPDF_Encoder_GetShared  (HPDF_MMgr               mmgr,
+                         const char             *encoding_name,
+                         HPDF_Encoder_Init_Func  init_fn);
+
 /*-- HPDF_BasicEncoder ----------------------------------*/
 
 
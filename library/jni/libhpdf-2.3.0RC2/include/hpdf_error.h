@@ -145,6 +145,9 @@ extern "C" {
 #define HPDF_INVALID_U3D_DATA                     0x1083
 #define HPDF_NAME_CANNOT_GET_NAMES                0x1084
 #define HPDF_INVALID_ICC_COMPONENT_NUM            0x1085
+#define HPDF_STREAM_OFFSET_OUT_OF_RANGE           0x1086
+#define HPDF_TEMPLATE_CANNOT_ENCRYPT              0x1087
+#define HPDF_INVALID_PAGE_BUILDER                 0x1088
 
 /*---------------------------------------------------------------------------*/
 
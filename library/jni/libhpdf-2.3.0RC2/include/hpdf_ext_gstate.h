@@ -33,6 +33,61 @@ HPDF_BOOL
 HPDF_ExtGState_Validate  (HPDF_ExtGState  ext_gstate);
 
 
+/*----- interned extended graphics states ----------------------------------*/
+
+/*
+ *  The table holds one read-only extended graphics state object for each
+ *  combination of values requested from a document. An object from the
+ *  table has its entry as attr, and is registered under the name of the
+ *  entry in the resources of every page which uses it.
+ */
+
+typedef struct _HPDF_ExtGStateEntry_Rec  *HPDF_ExtGStateEntry;
+
+typedef struct _HPDF_ExtGStateEntry_Rec {
+    HPDF_REAL            alpha_stroke;
+    HPDF_REAL            alpha_fill;
+    HPDF_BlendMode       bmode;
+    HPDF_UINT            hash;
+    char                 name[HPDF_INT_LEN + 3];
+    HPDF_ExtGState       obj;
+    HPDF_ExtGStateEntry  next;
+} HPDF_ExtGStateEntry_Rec;
+
+typedef struct _HPDF_ExtGStateTable_Rec  *HPDF_ExtGStateTable;
+
+typedef struct _HPDF_ExtGStateTable_Rec {
+    HPDF_MMgr             mmgr;
+    HPDF_UINT             count;
+    HPDF_UINT             size;
+    HPDF_ExtGStateEntry  *buckets;
+} HPDF_ExtGStateTable_Rec;
+
+
+HPDF_ExtGStateTable
+HPDF_ExtGStateTable_New  (HPDF_MMgr  mmgr);
+
+
+void
+HPDF_ExtGStateTable_Free  (HPDF_ExtGStateTable  table);
+
+
+HPDF_ExtGStateTable
+HPDF_ExtGStateTable_Copy  (HPDF_ExtGStateTable  src);
+
+
+HPDF_ExtGState
+HPDF_ExtGStateTable_Get  (HPDF_ExtGStateTable  table,
+                          HPDF_Xref            xref,
+                          HPDF_REAL            alpha_stroke,
+                          HPDF_REAL            alpha_fill,
+                          HPDF_BlendMode       bmode);
+
+
+const char*
+HPDF_ExtGState_GetSharedName  (HPDF_ExtGState  ext_gstate);
+
+
 #ifdef __cplusplus
 }
 #endif /* __cplusplus */
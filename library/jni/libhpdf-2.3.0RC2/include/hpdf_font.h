@@ -107,6 +107,14 @@ HPDF_Type0Font_New  (HPDF_MMgr        mmgr,
 HPDF_BOOL
 HPDF_Font_Validate  (HPDF_Font font);
 
+
+void
+HPDF_Font_LockWidths  (HPDF_Font  font);
+
+
+void
+HPDF_Font_UnlockWidths  (HPDF_Font  font);
+
 #ifdef __cplusplus
 }
 #endif /* __cplusplus */
@@ -20,6 +20,11 @@
 
 #include "hpdf_objects.h"
 
+#if !defined(LIBHPDF_HAVE_NOTHREADS) && !defined(_WIN32)
+#include <pthread.h>
+#define HPDF_FONTDEF_LOCK
+#endif
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -116,6 +121,12 @@ typedef struct _HPDF_FontDef_Rec {
 
     HPDF_BOOL                valid;
     void                    *attr;
+
+#ifdef HPDF_FONTDEF_LOCK
+    /* held while the widths of the fontdef and of the fonts based on it
+     * are got, which marks the characters used. */
+    pthread_mutex_t          lock;
+#endif
 } HPDF_FontDef_Rec;
 
 
@@ -123,6 +134,18 @@ void
 HPDF_FontDef_Free  (HPDF_FontDef  fontdef);
 
 
+void
+HPDF_FontDef_InitLock  (HPDF_FontDef  fontdef);
+
+
+void
+HPDF_FontDef_Lock  (HPDF_FontDef  fontdef);
+
+
+void
+HPDF_FontDef_Unlock  (HPDF_FontDef  fontdef);
+
+
 void
 HPDF_FontDef_Cleanup  (HPDF_FontDef  fontdef);
 
@@ -186,6 +209,11 @@ HPDF_Type1FontDef_GetWidth  (HPDF_FontDef  fontdef,
                              HPDF_UNICODE  unicode);
 
 
+HPDF_STATUS
+HPDF_Type1FontDef_SaveMetrics  (HPDF_FontDef  fontdef,
+                                HPDF_Stream   stream);
+
+
 HPDF_FontDef
 HPDF_Base14FontDef_New  (HPDF_MMgr        mmgr,
                          const char  *font_name);
@@ -59,21 +59,47 @@ typedef struct _HPDF_GState_Rec {
     HPDF_REAL               font_size;
     HPDF_WritingMode        writing_mode;
 
-    HPDF_GState             prev;
     HPDF_UINT               depth;
 } HPDF_GState_Rec;
 
+
+/*
+ *  The graphics states of a page are kept in one array, ordered by depth.
+ *  Saving the graphics state copies the current entry into the next one,
+ *  restoring it steps back, so neither allocates once the array is large
+ *  enough. The array grows up to HPDF_LIMIT_MAX_GSTATE entries and is
+ *  freed with the page.
+ */
+
+typedef struct _HPDF_GStateStack_Rec  *HPDF_GStateStack;
+
+typedef struct _HPDF_GStateStack_Rec {
+    HPDF_GState             states;
+    HPDF_UINT               size;
+} HPDF_GStateStack_Rec;
+
 /*----------------------------------------------------------------------------*/
 /*----------------------------------------------------------------------------*/
 
 HPDF_GState
-HPDF_GState_New  (HPDF_MMgr    mmgr,
-                  HPDF_GState  current);
+HPDF_GStateStack_Init  (HPDF_MMgr         mmgr,
+                        HPDF_GStateStack  stack);
 
 
 HPDF_GState
-HPDF_GState_Free  (HPDF_MMgr    mmgr,
-                   HPDF_GState  gstate);
+HPDF_GStateStack_Push  (HPDF_MMgr         mmgr,
+                        HPDF_GStateStack  stack,
+                        HPDF_GState       current);
+
+
+HPDF_GState
+HPDF_GStateStack_Pop  (HPDF_GStateStack  stack,
+                       HPDF_GState       current);
+
+
+void
+HPDF_GStateStack_Free  (HPDF_MMgr         mmgr,
+                        HPDF_GStateStack  stack);
 
 #ifdef __cplusplus
 }
@@ -19,6 +19,7 @@
 #define _HPDF_IMAGE_H
 
 #include "hpdf_objects.h"
+#include "hpdf_image_loader.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -35,6 +36,17 @@ HPDF_Image_Load1BitImageFromMem  (HPDF_MMgr  mmgr,
                           );
 
 
+HPDF_Image
+HPDF_Image_Load1BitImageFromMemAsync  (HPDF_ImageLoader   loader,
+                                       HPDF_MMgr          mmgr,
+                                       const HPDF_BYTE   *buf,
+                                       HPDF_Xref          xref,
+                                       HPDF_UINT          width,
+                                       HPDF_UINT          height,
+                                       HPDF_UINT          line_width,
+                                       HPDF_BOOL          top_is_first);
+
+
 #ifndef LIBHPDF_HAVE_NOPNGLIB
 
 HPDF_Image
@@ -43,6 +55,15 @@ HPDF_Image_LoadPngImage  (HPDF_MMgr        mmgr,
                           HPDF_Xref        xref,
                           HPDF_BOOL        delayed_loading);
 
+
+HPDF_Image
+HPDF_Image_LoadPngImageAsync  (HPDF_ImageLoader   loader,
+                               HPDF_MMgr          mmgr,
+                               const HPDF_BYTE   *buf,
+                               HPDF_UINT          size,
+                               HPDF_Xref          xref,
+                               HPDF_UINT          filter);
+
 #endif
 
 HPDF_Image
@@ -56,6 +77,21 @@ HPDF_Image_LoadJpegImageFromMem  (HPDF_MMgr        mmgr,
                                   HPDF_UINT        size,
                                   HPDF_Xref        xref);
 
+HPDF_Image
+HPDF_Image_LoadJpegImageFromFile  (HPDF_MMgr    mmgr,
+                                   const char  *filename,
+                                   HPDF_Xref    xref);
+
+
+HPDF_Image
+HPDF_Image_LoadRawImageFromFile  (HPDF_MMgr          mmgr,
+                                  const char        *filename,
+                                  HPDF_Xref          xref,
+                                  HPDF_UINT          width,
+                                  HPDF_UINT          height,
+                                  HPDF_ColorSpace    color_space);
+
+
 HPDF_Image
 HPDF_Image_LoadRawImage  (HPDF_MMgr          mmgr,
                           HPDF_Stream        stream,
@@ -75,6 +111,27 @@ HPDF_Image_LoadRawImageFromMem  (HPDF_MMgr          mmgr,
                                  HPDF_UINT          bits_per_component);
 
 
+HPDF_Image
+HPDF_Image_LoadRawImageFromMemAsync  (HPDF_ImageLoader   loader,
+                                      HPDF_MMgr          mmgr,
+                                      const HPDF_BYTE   *buf,
+                                      HPDF_Xref          xref,
+                                      HPDF_UINT          width,
+                                      HPDF_UINT          height,
+                                      HPDF_ColorSpace    color_space,
+                                      HPDF_UINT          bits_per_component);
+
+
+HPDF_Image
+HPDF_Image_LoadPixelImageFromMem  (HPDF_MMgr          mmgr,
+                                   const HPDF_BYTE   *pixels,
+                                   HPDF_Xref          xref,
+                                   HPDF_UINT          width,
+                                   HPDF_UINT          height,
+                                   HPDF_UINT          stride,
+                                   HPDF_PixelFormat   format);
+
+
 HPDF_BOOL
 HPDF_Image_Validate (HPDF_Image  image);
 
@@ -0,0 +1,110 @@
+/*
+ * << Haru Free PDF Library >> -- hpdf_image_loader.h
+ *
+ * URL: http://libharu.org
+ *
+ * Copyright (c) 1999-2006 Takeshi Kanno <takeshi_kanno@est.hi-ho.ne.jp>
+ * Copyright (c) 2007-2009 Antony Dovgal <tony@daylessday.org>
+ *
+ * Permission to use, copy, modify, distribute and sell this software
+ * and its documentation for any purpose is hereby granted without fee,
+ * provided that the above copyright notice appear in all copies and
+ * that both that copyright notice and this permission notice appear
+ * in supporting documentation.
+ * It is provided "as is" without express or implied warranty.
+ *
+ */
+
+#ifndef _HPDF_IMAGE_LOADER_H
+#define _HPDF_IMAGE_LOADER_H
+
+#include "hpdf_objects.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*----------------------------------------------------------------------------*/
+/*----- HPDF_ImageLoader -----------------------------------------------------*/
+
+/*
+ *  An image loader is a pool of worker threads which decode and encode
+ *  the data of images loaded by the asynchronous image loading
+ *  functions. The image dictionary is created on the calling thread;
+ *  the data is produced by an HPDF_ImageJob and is copied into the
+ *  stream of the image when the image is written or waited for.
+ *
+ *  A job owns a memory manager and an error object of its own, so that
+ *  the worker never touches the objects of the document. It belongs
+ *  to the calling thread until it is submitted, to the worker while it
+ *  runs, and to the calling thread again once it is done.
+ */
+
+#define HPDF_IMAGE_JOB_QUEUED     0
+#define HPDF_IMAGE_JOB_RUNNING    1
+#define HPDF_IMAGE_JOB_DONE       2
+
+typedef struct _HPDF_ImageLoader_Rec  *HPDF_ImageLoader;
+
+typedef struct _HPDF_ImageJob_Rec  *HPDF_ImageJob;
+
+typedef HPDF_STATUS
+(*HPDF_ImageJob_Func)  (HPDF_ImageJob  job);
+
+typedef struct _HPDF_ImageJob_Rec {
+    HPDF_ImageJob_Func  func;
+    HPDF_ImageJob       next;
+    HPDF_ImageLoader    loader;
+    HPDF_UINT           state;
+
+    HPDF_Error_Rec      error;
+    HPDF_MMgr           mmgr;
+
+    /* copy of the source data. it is freed as soon as the job has run. */
+    HPDF_Stream         src;
+
+    /* parameters of the source data */
+    HPDF_UINT           width;
+    HPDF_UINT           height;
+    HPDF_UINT           line_width;
+    HPDF_BOOL           top_is_first;
+    HPDF_UINT           filter;
+
+    /* image data and soft-mask data produced by the job */
+    HPDF_Stream         data;
+    HPDF_Stream         smask;
+} HPDF_ImageJob_Rec;
+
+
+HPDF_ImageLoader
+HPDF_ImageLoader_New  (HPDF_MMgr  mmgr,
+                       HPDF_UINT  threads);
+
+
+void
+HPDF_ImageLoader_Free  (HPDF_ImageLoader  loader);
+
+
+HPDF_ImageJob
+HPDF_ImageJob_New  (HPDF_MMgr            mmgr,
+                    HPDF_ImageJob_Func   func,
+                    const HPDF_BYTE     *buf,
+                    HPDF_UINT            size);
+
+
+void
+HPDF_ImageJob_Free  (HPDF_MMgr      mmgr,
+                     HPDF_ImageJob  job);
+
+
+void
+HPDF_ImageLoader_Submit  (HPDF_ImageLoader  loader,
+                          HPDF_Dict         image,
+                          HPDF_ImageJob     job);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* _HPDF_IMAGE_LOADER_H */
+
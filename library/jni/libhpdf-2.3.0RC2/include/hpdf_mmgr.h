@@ -35,6 +35,15 @@ typedef struct  _HPDF_MPool_Node_Rec {
 } HPDF_MPool_Node_Rec;
 
 
+/*  position in the memory-pool. memory allocated after a mark can be
+ *  released at once by rewinding the memory-pool to it.
+ */
+typedef struct  _HPDF_MPool_Mark_Rec {
+    HPDF_MPool_Node  node;
+    HPDF_UINT        used_size;
+} HPDF_MPool_Mark_Rec;
+
+
 typedef struct  _HPDF_MMgr_Rec  *HPDF_MMgr;
 
 typedef struct  _HPDF_MMgr_Rec {
@@ -44,6 +53,10 @@ typedef struct  _HPDF_MMgr_Rec {
     HPDF_MPool_Node   mpool;
     HPDF_UINT         buf_size;
 
+    /* nodes released by rewinding, which are used again before new
+     * nodes are allocated */
+    HPDF_MPool_Node   spare;
+
 #ifdef HPDF_MEM_DEBUG
     HPDF_UINT         alloc_cnt;
     HPDF_UINT         free_cnt;
@@ -77,6 +90,22 @@ void
 HPDF_FreeMem  (HPDF_MMgr  mmgr,
                void       *aptr);
 
+
+void
+HPDF_MMgr_GetMark  (HPDF_MMgr            mmgr,
+                    HPDF_MPool_Mark_Rec  *mark);
+
+
+/*  HPDF_MMgr_Rewind
+ *
+ *  release all the memory allocated after the mark. the nodes of the
+ *  default size are kept for the following allocations. it does nothing
+ *  unless mmgr is using memory-pool.
+ */
+void
+HPDF_MMgr_Rewind  (HPDF_MMgr                  mmgr,
+                   const HPDF_MPool_Mark_Rec  *mark);
+
 #ifdef __cplusplus
 }
 #endif /* __cplusplus */
@@ -35,6 +35,12 @@ extern "C" {
 #define  HPDF_OTYPE_ANY               (HPDF_OTYPE_DIRECT | HPDF_OTYPE_INDIRECT)
 #define  HPDF_OTYPE_HIDDEN            0x10000000
 
+/* if HPDF_OTYPE_FINAL bit is set, the object is not changed any more,
+ * except by appending to its stream. the xref keeps its serialized form
+ * after it is first written, and writes that in its place.
+ */
+#define  HPDF_OTYPE_FINAL             0x20000000
+
 #define  HPDF_OCLASS_UNKNOWN          0x0001
 #define  HPDF_OCLASS_NULL             0x0002
 #define  HPDF_OCLASS_BOOLEAN          0x0003
@@ -503,6 +509,18 @@ HPDF_Dict_RemoveElement  (HPDF_Dict        dict,
                           const char  *key);
 
 
+HPDF_STATUS
+HPDF_Dict_CopyFrom  (HPDF_Dict  dict,
+                     HPDF_Dict  src,
+                     HPDF_Xref  xref);
+
+
+void*
+HPDF_Obj_Copy  (HPDF_MMgr  mmgr,
+                void       *obj,
+                HPDF_Xref  xref);
+
+
 /*---------------------------------------------------------------------------*/
 /*----- HPDF_ProxyObject ----------------------------------------------------*/
 
@@ -529,9 +547,20 @@ typedef struct _HPDF_XrefEntry_Rec  *HPDF_XrefEntry;
 
 typedef struct _HPDF_XrefEntry_Rec {
       char    entry_typ;
-      HPDF_UINT    byte_offset;
+      HPDF_UINT64  byte_offset;
       HPDF_UINT16  gen_no;
       void*        obj;
+
+      /* serialized value of obj, which is written in its place when set.
+       * a shared entry borrows obj and the bytes from the xref of a
+       * template, which frees them. */
+      HPDF_BYTE    *cache;
+      HPDF_UINT    cache_len;
+      HPDF_BOOL    shared;
+
+      /* size of the stream of obj when it was serialized. the bytes of a
+       * stream which has grown since are discarded. */
+      HPDF_UINT64  cache_stream_size;
 } HPDF_XrefEntry_Rec;
 
 
@@ -540,9 +569,21 @@ typedef struct _HPDF_Xref_Rec {
       HPDF_Error   error;
       HPDF_UINT32  start_offset;
       HPDF_List    entries;
-      HPDF_UINT    addr;
+      HPDF_UINT64  addr;
       HPDF_Xref    prev;
       HPDF_Dict    trailer;
+
+      /* memory budget which new stream objects are registered to */
+      HPDF_StreamBudget  stream_budget;
+
+      /* whether HPDF_Xref_WriteToStream keeps the serialized bytes of the
+       * final objects it writes, for the next save */
+      HPDF_BOOL    cache_objects;
+
+      /* encryption key which the serialized objects were encrypted with.
+       * cache_key_len is 0 when they are not encrypted. */
+      HPDF_BYTE    cache_key[HPDF_ENCRYPT_KEY_MAX];
+      HPDF_UINT    cache_key_len;
 } HPDF_Xref_Rec;
 
 
@@ -560,6 +601,23 @@ HPDF_Xref_Add  (HPDF_Xref  xref,
                 void       *obj);
 
 
+HPDF_STATUS
+HPDF_Xref_AddShared  (HPDF_Xref       xref,
+                      HPDF_XrefEntry  src);
+
+
+HPDF_STATUS
+HPDF_Xref_Append  (HPDF_Xref  xref,
+                   HPDF_Xref  src);
+
+
+HPDF_STATUS
+HPDF_Xref_CacheEntry  (HPDF_Xref       xref,
+                       HPDF_XrefEntry  entry,
+                       HPDF_Stream     tmp,
+                       HPDF_Encrypt    e);
+
+
 HPDF_XrefEntry
 HPDF_Xref_GetEntry  (HPDF_Xref  xref,
                      HPDF_UINT  index);
@@ -56,6 +56,7 @@ typedef struct _HPDF_PageAttr_Rec {
     HPDF_Dict          xobjects;
     HPDF_Dict          ext_gstates;
     HPDF_GState        gstate;
+    HPDF_GStateStack_Rec  gstate_stack;
     HPDF_Point         str_pos;
     HPDF_Point         cur_pos;
     HPDF_Point         text_pos;
@@ -65,10 +66,40 @@ typedef struct _HPDF_PageAttr_Rec {
     HPDF_Stream        stream;
     HPDF_Xref          xref;
     HPDF_UINT          compression_mode;
+    HPDF_BOOL          optimize_content;
+
+    /* memory manager of the document which the fonts, images and
+     * extended graphics states drawn on the page belong to. it is not
+     * the one of the page when the page is made by a page builder. */
+    HPDF_MMgr          doc_mmgr;
 	HPDF_PDFVer       *ver; 
 } HPDF_PageAttr_Rec;
 
 
+/*----------------------------------------------------------------------------*/
+/*----- HPDF_TextLayout ------------------------------------------------------*/
+
+typedef struct _HPDF_TextLayout_Rec  *HPDF_TextLayout;
+
+typedef struct _HPDF_TextLayout_Rec {
+    HPDF_MMgr          mmgr;
+    HPDF_Error         error;
+
+    /* the text state the lines were measured with */
+    HPDF_Font          font;
+    HPDF_REAL          font_size;
+    HPDF_REAL          char_space;
+    HPDF_REAL          word_space;
+    HPDF_REAL          width;
+
+    char              *text;
+    HPDF_UINT          text_len;
+    HPDF_TextLine     *lines;
+    HPDF_UINT          num_lines;
+    HPDF_UINT          lines_siz;
+} HPDF_TextLayout_Rec;
+
+
 /*----------------------------------------------------------------------------*/
 /*----- HPDF_Page ------------------------------------------------------------*/
 
@@ -118,6 +149,31 @@ HPDF_Page_SetFilter  (HPDF_Page    page,
                       HPDF_UINT    filter);
 
 
+void
+HPDF_Page_SetRealPrecision  (HPDF_Page    page,
+                             HPDF_UINT    precision);
+
+
+void
+HPDF_Page_SetOptimizeContent  (HPDF_Page    page,
+                               HPDF_BOOL    optimize);
+
+
+HPDF_STATUS
+HPDF_Page_InheritResources  (HPDF_Page   page,
+                             HPDF_Pages  pages);
+
+
+HPDF_STATUS
+HPDF_Page_InitCopy  (HPDF_Page  page,
+                     HPDF_Page  src,
+                     HPDF_Xref  xref);
+
+
+HPDF_STATUS
+HPDF_Page_Finish  (HPDF_Page  page);
+
+
 HPDF_STATUS
 HPDF_Page_CheckState  (HPDF_Page  page,
                        HPDF_UINT  mode);
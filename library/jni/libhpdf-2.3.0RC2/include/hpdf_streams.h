@@ -20,6 +20,8 @@
 #ifndef _HPDF_STREAMS_H
 #define _HPDF_STREAMS_H
 
+#include "hpdf_conf.h"
+#include "hpdf_consts.h"
 #include "hpdf_list.h"
 #include "hpdf_encrypt.h"
 
@@ -44,6 +46,9 @@ typedef enum _HPDF_StreamType {
 #define HPDF_STREAM_FILTER_DCT_DECODE    0x0800
 #define HPDF_STREAM_FILTER_CCITT_DECODE  0x1000
 
+/* the data is stored already encoded with the filters above */
+#define HPDF_STREAM_FILTER_ENCODED       0x8000
+
 typedef enum _HPDF_WhenceMode {
     HPDF_SEEK_SET = 0,
     HPDF_SEEK_CUR,
@@ -66,11 +71,11 @@ typedef HPDF_STATUS
 
 typedef HPDF_STATUS
 (*HPDF_Stream_Seek_Func)  (HPDF_Stream      stream,
-                           HPDF_INT         pos,
+                           HPDF_INT64       pos,
                            HPDF_WhenceMode  mode);
 
 
-typedef HPDF_INT32
+typedef HPDF_INT64
 (*HPDF_Stream_Tell_Func)  (HPDF_Stream      stream);
 
 
@@ -78,10 +83,29 @@ typedef void
 (*HPDF_Stream_Free_Func)  (HPDF_Stream  stream);
 
 
-typedef HPDF_UINT32
+typedef HPDF_UINT64
 (*HPDF_Stream_Size_Func)  (HPDF_Stream  stream);
 
 
+/*
+ *  HPDF_StreamBudget
+ *
+ *  Memory budget shared by the memory-streams of a document. When the
+ *  buffers of the registered memory-streams exceed limit bytes, the least
+ *  recently written streams are moved into temporary files.
+ */
+
+typedef struct _HPDF_StreamBudget_Rec  *HPDF_StreamBudget;
+
+typedef struct _HPDF_StreamBudget_Rec {
+    HPDF_UINT32  limit;
+    HPDF_UINT32  used;
+    HPDF_Stream  head;      /* most recently written stream */
+    HPDF_Stream  tail;      /* least recently written stream */
+    char         tmp_dir[HPDF_TMP_BUF_SIZ];
+} HPDF_StreamBudget_Rec;
+
+
 typedef struct _HPDF_MemStreamAttr_Rec  *HPDF_MemStreamAttr;
 
 
@@ -93,6 +117,18 @@ typedef struct _HPDF_MemStreamAttr_Rec {
     HPDF_UINT  r_ptr_idx;
     HPDF_UINT  r_pos;
     HPDF_BYTE  *r_ptr;
+
+    /* budget which the stream is registered to, and links of its list */
+    HPDF_StreamBudget  budget;
+    HPDF_Stream        prev;
+    HPDF_Stream        next;
+
+    /* temporary file holding the data after the stream was spilled.
+     * r_ptr_idx and r_pos keep addressing it in units of buf_siz.
+     * spill_at_end is set while the file position is at its end, where
+     * writes go without seeking first. */
+    HPDF_FILEP         spill_fp;
+    HPDF_BOOL          spill_at_end;
 } HPDF_MemStreamAttr_Rec;
 
 
@@ -101,7 +137,7 @@ typedef struct _HPDF_Stream_Rec {
     HPDF_StreamType           type;
     HPDF_MMgr                 mmgr;
     HPDF_Error                error;
-    HPDF_UINT                 size;
+    HPDF_UINT64               size;
     HPDF_Stream_Write_Func    write_fn;
     HPDF_Stream_Read_Func     read_fn;
     HPDF_Stream_Seek_Func     seek_fn;
@@ -109,6 +145,14 @@ typedef struct _HPDF_Stream_Rec {
     HPDF_Stream_Tell_Func     tell_fn;
     HPDF_Stream_Size_Func     size_fn;
     void*                     attr;
+
+    /* number of decimal places written by HPDF_Stream_WriteReal */
+    HPDF_UINT                 real_precision;
+
+    /* write-combining buffer (see HPDF_Stream_SetWriteBuffer) */
+    HPDF_BYTE                 *wbuf;
+    HPDF_UINT                 wbuf_siz;
+    HPDF_UINT                 wbuf_len;
 } HPDF_Stream_Rec;
 
 
@@ -142,6 +186,19 @@ void
 HPDF_MemStream_FreeData  (HPDF_Stream  stream);
 
 
+void
+HPDF_MemStream_SetBudget  (HPDF_Stream        stream,
+                           HPDF_StreamBudget  budget);
+
+
+HPDF_BOOL
+HPDF_MemStream_IsSpilled  (HPDF_Stream  stream);
+
+
+void
+HPDF_MemStream_CheckBudget  (HPDF_StreamBudget  budget);
+
+
 HPDF_STATUS
 HPDF_Stream_WriteToStream  (HPDF_Stream   src,
                             HPDF_Stream   dst,
@@ -225,13 +282,13 @@ HPDF_Stream_ReadLn  (HPDF_Stream  stream,
                      HPDF_UINT    *size);
 
 
-HPDF_INT32
+HPDF_INT64
 HPDF_Stream_Tell  (HPDF_Stream  stream);
 
 
 HPDF_STATUS
 HPDF_Stream_Seek  (HPDF_Stream      stream,
-                   HPDF_INT         pos,
+                   HPDF_INT64       pos,
                    HPDF_WhenceMode  mode);
 
 
@@ -239,13 +296,18 @@ HPDF_BOOL
 HPDF_Stream_EOF  (HPDF_Stream  stream);
 
 
-HPDF_UINT32
+HPDF_UINT64
 HPDF_Stream_Size  (HPDF_Stream  stream);
 
 HPDF_STATUS
 HPDF_Stream_Flush  (HPDF_Stream  stream);
 
 
+HPDF_STATUS
+HPDF_Stream_SetWriteBuffer  (HPDF_Stream  stream,
+                             HPDF_UINT    buf_siz);
+
+
 HPDF_STATUS
 HPDF_Stream_WriteEscapeName  (HPDF_Stream      stream,
                               const char  *value);
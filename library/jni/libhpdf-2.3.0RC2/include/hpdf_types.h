@@ -51,6 +51,17 @@ typedef  signed int          HPDF_INT32;
 typedef  unsigned int        HPDF_UINT32;
 
 
+/*  64bit integer types
+ */
+#ifdef _MSC_VER
+typedef  signed __int64      HPDF_INT64;
+typedef  unsigned __int64    HPDF_UINT64;
+#else
+typedef  signed long long    HPDF_INT64;
+typedef  unsigned long long  HPDF_UINT64;
+#endif
+
+
 /*  16bit integer types
  */
 typedef  signed short        HPDF_INT16;
@@ -203,6 +214,28 @@ typedef struct _HPDF_TextWidth {
 } HPDF_TextWidth;
 
 
+/*---------------------------------------------------------------------------*/
+/*------ text layout line ---------------------------------------------------*/
+
+typedef struct _HPDF_TextLine {
+    /* byte offset of the line in the text of the layout */
+    HPDF_UINT start;
+
+    /* number of bytes shown (trailing white space is not included) */
+    HPDF_UINT len;
+
+    /* byte offset of the next line */
+    HPDF_UINT next;
+
+    HPDF_REAL width;
+    HPDF_UINT numchars;
+    HPDF_UINT numspace;
+
+    /* the line ends a paragraph, so it is not justified */
+    HPDF_BOOL line_break;
+} HPDF_TextLine;
+
+
 /*---------------------------------------------------------------------------*/
 /*------ dash mode ----------------------------------------------------------*/
 
@@ -243,6 +276,23 @@ typedef enum _HPDF_ColorSpace {
     HPDF_CS_EOF
 } HPDF_ColorSpace;
 
+/*---------------------------------------------------------------------------*/
+/*----- HPDF_PixelFormat ----------------------------------------------------*/
+
+/*
+ *  Layouts of uncompressed pixel buffers accepted by
+ *  HPDF_LoadPixelImageFromMem. RGBA8888 stores the bytes R, G, B, A in
+ *  that order; RGB565 stores each pixel as a little-endian 16-bit word
+ *  with red in the high bits (the Android Bitmap layouts).
+ */
+typedef enum _HPDF_PixelFormat {
+    HPDF_PIXEL_RGB888 = 0,
+    HPDF_PIXEL_RGBA8888,
+    HPDF_PIXEL_RGBA8888_PREMUL,
+    HPDF_PIXEL_RGB565,
+    HPDF_PIXEL_EOF
+} HPDF_PixelFormat;
+
 /*---------------------------------------------------------------------------*/
 /*----- HPDF_RGBColor struct ------------------------------------------------*/
 
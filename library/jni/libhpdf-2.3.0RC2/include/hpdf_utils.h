@@ -41,16 +41,29 @@ HPDF_IToA  (char*  s,
 
 char*
 HPDF_IToA2  (char    *s,
-             HPDF_UINT32  val,
+             HPDF_UINT64  val,
              HPDF_UINT    len);
 
 
+char*
+HPDF_UInt64ToA  (char         *s,
+                 HPDF_UINT64  val,
+                 char         *eptr);
+
+
 char*
 HPDF_FToA  (char  *s,
             HPDF_REAL  val,
             char  *eptr);
 
 
+char*
+HPDF_FToA2  (char       *s,
+             HPDF_REAL   val,
+             HPDF_UINT   precision,
+             char       *eptr);
+
+
 HPDF_BYTE*
 HPDF_MemCpy  (HPDF_BYTE*        out,
               const HPDF_BYTE*  in,
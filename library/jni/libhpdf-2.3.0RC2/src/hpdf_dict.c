@@ -81,6 +81,9 @@ HPDF_DictStream_New  (HPDF_MMgr  mmgr,
     if (!obj->stream)
         return NULL;
 
+    if (xref->stream_budget)
+        HPDF_MemStream_SetBudget (obj->stream, xref->stream_budget);
+
     return obj;
 }
 
@@ -234,7 +237,7 @@ HPDF_Dict_Write  (HPDF_Dict     dict,
         return ret;
 
     if (dict->stream) {
-        HPDF_UINT32 strptr;
+        HPDF_UINT64 strptr;
         HPDF_Number length;
 
         /* get "length" element */
@@ -263,7 +266,12 @@ HPDF_Dict_Write  (HPDF_Dict     dict,
                         dict->filter, e)) != HPDF_OK)
             return ret;
 
-        HPDF_Number_SetValue (length, stream->size - strptr);
+        /* the length is written as a number object */
+        if (stream->size - strptr > HPDF_LIMIT_MAX_INT)
+            return HPDF_SetError (dict->error,
+                    HPDF_STREAM_OFFSET_OUT_OF_RANGE, 0);
+
+        HPDF_Number_SetValue (length, (HPDF_INT32)(stream->size - strptr));
 
         ret = HPDF_Stream_WriteStr (stream, "\012endstream");
     }
@@ -516,3 +524,42 @@ HPDF_Dict_GetKeyByObj (HPDF_Dict  dict,
     return NULL;
 }
 
+
+
+/*
+ *  HPDF_Dict_CopyFrom
+ *
+ *  Copies the class, the write functions and the elements of src into
+ *  dict, which is empty. The stream, the attributes and the free function
+ *  of src are not copied.
+ */
+HPDF_STATUS
+HPDF_Dict_CopyFrom  (HPDF_Dict  dict,
+                     HPDF_Dict  src,
+                     HPDF_Xref  xref)
+{
+    HPDF_UINT i;
+    HPDF_STATUS ret;
+
+    HPDF_PTRACE((" HPDF_Dict_CopyFrom\n"));
+
+    dict->header.obj_class = src->header.obj_class;
+    dict->before_write_fn = src->before_write_fn;
+    dict->write_fn = src->write_fn;
+    dict->after_write_fn = src->after_write_fn;
+    dict->filter = src->filter;
+
+    for (i = 0; i < src->list->count; i++) {
+        HPDF_DictElement element =
+                (HPDF_DictElement)HPDF_List_ItemAt (src->list, i);
+        void *value = HPDF_Obj_Copy (dict->mmgr, element->value, xref);
+
+        if (!value)
+            return HPDF_Error_GetCode (dict->error);
+
+        if ((ret = HPDF_Dict_Add (dict, element->key, value)) != HPDF_OK)
+            return ret;
+    }
+
+    return HPDF_OK;
+}
@@ -57,6 +57,14 @@ static void
 CleanupFontDefList (HPDF_Doc  pdf);
 
 
+static HPDF_STATUS
+CloneTemplate  (HPDF_Doc  pdf);
+
+
+static void
+FreeTemplate  (HPDF_Doc  pdf);
+
+
 static HPDF_Dict
 GetInfo  (HPDF_Doc  pdf);
 
@@ -106,6 +114,19 @@ HPDF_Doc_Validate  (HPDF_Doc  pdf)
 }
 
 
+HPDF_ImageLoader
+HPDF_Doc_GetImageLoader  (HPDF_Doc  pdf)
+{
+    HPDF_PTRACE ((" HPDF_Doc_GetImageLoader\n"));
+
+    if (!pdf->image_loader)
+        pdf->image_loader = HPDF_ImageLoader_New (pdf->mmgr,
+                pdf->image_load_threads);
+
+    return pdf->image_loader;
+}
+
+
 HPDF_EXPORT(HPDF_BOOL)
 HPDF_HasDoc  (HPDF_Doc  pdf)
 {
@@ -169,6 +190,8 @@ HPDF_NewEx  (HPDF_Error_Handler    user_error_fn,
     pdf->mmgr = mmgr;
     pdf->pdf_version = HPDF_VER_13;
     pdf->compression_mode = HPDF_COMP_NONE;
+    pdf->real_precision = HPDF_DEF_REAL_PRECISION;
+    pdf->write_buf_siz = HPDF_WRITE_BUF_SIZ;
 
     /* copy the data of temporary-error object to the one which is
        included in pdf_doc object */
@@ -222,16 +245,6 @@ HPDF_NewDoc  (HPDF_Doc  pdf)
 
     HPDF_FreeDoc (pdf);
 
-    pdf->xref = HPDF_Xref_New (pdf->mmgr, 0);
-    if (!pdf->xref)
-        return HPDF_CheckError (&pdf->error);
-
-    pdf->trailer = pdf->xref->trailer;
-
-    pdf->font_mgr = HPDF_List_New (pdf->mmgr, HPDF_DEF_ITEMS_PER_BLOCK);
-    if (!pdf->font_mgr)
-        return HPDF_CheckError (&pdf->error);
-
     if (!pdf->fontdef_list) {
         pdf->fontdef_list = HPDF_List_New (pdf->mmgr,
                 HPDF_DEF_ITEMS_PER_BLOCK);
@@ -246,6 +259,34 @@ HPDF_NewDoc  (HPDF_Doc  pdf)
             return HPDF_CheckError (&pdf->error);
     }
 
+    /* nothing allocated after the mark is used any more, unless it is a
+     * fontdef or an encoder loaded by the previous document. in that case
+     * the memory is kept and the mark is moved after it. */
+    if (pdf->doc_mark.node && !pdf->cache_grown)
+        HPDF_MMgr_Rewind (pdf->mmgr, &pdf->doc_mark);
+    else {
+        HPDF_MMgr_GetMark (pdf->mmgr, &pdf->doc_mark);
+        pdf->cache_grown = HPDF_FALSE;
+    }
+
+    pdf->xref = HPDF_Xref_New (pdf->mmgr, 0);
+    if (!pdf->xref)
+        return HPDF_CheckError (&pdf->error);
+
+    pdf->trailer = pdf->xref->trailer;
+
+    pdf->stream_budget.used = 0;
+    pdf->stream_budget.head = NULL;
+    pdf->stream_budget.tail = NULL;
+    pdf->xref->stream_budget = &pdf->stream_budget;
+
+    pdf->font_mgr = HPDF_List_New (pdf->mmgr, HPDF_DEF_ITEMS_PER_BLOCK);
+    if (!pdf->font_mgr)
+        return HPDF_CheckError (&pdf->error);
+
+    if (pdf->tmpl)
+        return CloneTemplate (pdf);
+
     pdf->catalog = HPDF_Catalog_New (pdf->mmgr, pdf->xref);
     if (!pdf->catalog)
         return HPDF_CheckError (&pdf->error);
@@ -282,6 +323,23 @@ HPDF_FreeDoc  (HPDF_Doc  pdf)
            pdf->xref = NULL;
         }
 
+        if (pdf->page_builders) {
+            HPDF_PageBuilder_FreeAll (pdf->page_builders);
+            pdf->page_builders = NULL;
+        }
+
+        if (pdf->ext_gstate_table) {
+            HPDF_ExtGStateTable_Free (pdf->ext_gstate_table);
+            pdf->ext_gstate_table = NULL;
+        }
+
+        /* the images of the document, which cancel or wait for their
+         * jobs, are freed with the xref */
+        if (pdf->image_loader) {
+            HPDF_ImageLoader_Free (pdf->image_loader);
+            pdf->image_loader = NULL;
+        }
+
         if (pdf->font_mgr) {
             HPDF_List_Free (pdf->font_mgr);
             pdf->font_mgr = NULL;
@@ -330,19 +388,287 @@ HPDF_FreeDocAll  (HPDF_Doc  pdf)
     if (HPDF_Doc_Validate (pdf)) {
         HPDF_FreeDoc (pdf);
 
+        /* the fonts of the template refer to the fontdefs. */
+        if (pdf->tmpl)
+            FreeTemplate (pdf);
+
         if (pdf->fontdef_list)
             FreeFontDefList (pdf);
 
         if (pdf->encoder_list)
             FreeEncoderList (pdf);
 
+        /* the lists are created again before the next mark. */
+        pdf->doc_mark.node = NULL;
+
         pdf->compression_mode = HPDF_COMP_NONE;
+        pdf->real_precision = HPDF_DEF_REAL_PRECISION;
+        pdf->optimize_content = HPDF_FALSE;
+        pdf->share_resources = HPDF_FALSE;
+        pdf->cache_objects = HPDF_FALSE;
+        pdf->image_resolution = 0;
+        pdf->image_load_threads = 0;
 
         HPDF_Error_Reset (&pdf->error);
     }
 }
 
 
+/*
+ *  IsTemplateCopy
+ *
+ *  Whether obj is one of the objects of a template which are copied into
+ *  the documents cloned from it, because the functions of the library can
+ *  change them. The other objects are shared in their serialized form.
+ */
+static HPDF_BOOL
+IsTemplateCopy  (HPDF_Doc  pdf,
+                 void      *obj)
+{
+    HPDF_Obj_Header *header = (HPDF_Obj_Header *)obj;
+
+    if (obj == pdf->info)
+        return HPDF_TRUE;
+
+    switch (header->obj_class) {
+        case HPDF_OCLASS_DICT | HPDF_OSUBCLASS_CATALOG:
+        case HPDF_OCLASS_DICT | HPDF_OSUBCLASS_PAGES:
+        case HPDF_OCLASS_DICT | HPDF_OSUBCLASS_PAGE:
+        case HPDF_OCLASS_DICT | HPDF_OSUBCLASS_OUTLINE:
+        case HPDF_OCLASS_DICT | HPDF_OSUBCLASS_NAMEDICT:
+        case HPDF_OCLASS_DICT | HPDF_OSUBCLASS_NAMETREE:
+            return HPDF_TRUE;
+        default:
+            return HPDF_FALSE;
+    }
+}
+
+
+/*
+ *  HPDF_SetTemplate
+ *
+ *  Freezes the current document as the template of the documents created
+ *  afterwards by HPDF_NewDoc, and replaces it with the first of them.
+ *
+ *  The objects of the template are serialized once. A new document shares
+ *  them and writes their bytes, so that images, fonts and the contents of
+ *  the pages are neither loaded nor compressed again. The catalog, the
+ *  page tree, the pages, the outlines and the info dictionary are copied
+ *  instead, so that pages and outlines can be added to them. Drawing on a
+ *  page of the template appends to a new contents stream of the copy.
+ *
+ *  Handles of pages, fonts and images obtained before the call belong to
+ *  the template and can not be used with the new documents; the pages are
+ *  got again with HPDF_GetPageByIndex. A template can not be encrypted.
+ *  It is freed by HPDF_FreeDocAll.
+ */
+HPDF_EXPORT(HPDF_STATUS)
+HPDF_SetTemplate  (HPDF_Doc  pdf)
+{
+    HPDF_DocTemplate tmpl;
+    HPDF_Stream tmp;
+    HPDF_STATUS ret = HPDF_OK;
+    HPDF_UINT i;
+
+    HPDF_PTRACE ((" HPDF_SetTemplate\n"));
+
+    if (!HPDF_HasDoc (pdf))
+        return HPDF_INVALID_DOCUMENT;
+
+    if (pdf->tmpl)
+        return HPDF_RaiseError (&pdf->error, HPDF_INVALID_DOCUMENT_STATE, 0);
+
+    if (pdf->encrypt_on)
+        return HPDF_RaiseError (&pdf->error, HPDF_TEMPLATE_CANNOT_ENCRYPT, 0);
+
+    tmp = HPDF_MemStream_New (pdf->mmgr, HPDF_STREAM_BUF_SIZ);
+    if (!tmp)
+        return HPDF_CheckError (&pdf->error);
+
+    /* serialize the objects in the order they are saved in, so that the
+     * objects written before one, such as the page whose contents it is,
+     * have completed it. */
+    for (i = 1; i < pdf->xref->entries->count; i++) {
+        HPDF_XrefEntry entry = HPDF_Xref_GetEntry (pdf->xref, i);
+        HPDF_Dict dict = (HPDF_Dict)entry->obj;
+
+        if (IsTemplateCopy (pdf, entry->obj)) {
+            HPDF_MemStream_FreeData (tmp);
+            ret = HPDF_Obj_WriteValue (entry->obj, tmp, NULL);
+        } else {
+            ret = HPDF_Xref_CacheEntry (pdf->xref, entry, tmp, NULL);
+
+            /* the data of a stream is only kept in its serialized form. */
+            if (ret == HPDF_OK && (dict->header.obj_class & HPDF_OCLASS_ANY)
+                    == HPDF_OCLASS_DICT && dict->stream)
+                HPDF_MemStream_FreeData (dict->stream);
+        }
+
+        if (ret != HPDF_OK)
+            break;
+    }
+
+    HPDF_Stream_Free (tmp);
+
+    if (ret != HPDF_OK)
+        return HPDF_CheckError (&pdf->error);
+
+    tmpl = HPDF_GetMem (pdf->mmgr, sizeof (HPDF_DocTemplate_Rec));
+    if (!tmpl)
+        return HPDF_CheckError (&pdf->error);
+
+    tmpl->xref = pdf->xref;
+    tmpl->catalog = pdf->catalog;
+    tmpl->outlines = pdf->outlines;
+    tmpl->info = pdf->info;
+    tmpl->cur_pages = pdf->cur_pages;
+    tmpl->cur_page = pdf->cur_page;
+    tmpl->page_list = pdf->page_list;
+    tmpl->ext_gstate_table = pdf->ext_gstate_table;
+    tmpl->pdf_version = pdf->pdf_version;
+    tmpl->page_per_pages = pdf->page_per_pages;
+    tmpl->cur_page_num = pdf->cur_page_num;
+    tmpl->cur_encoder = pdf->cur_encoder;
+    tmpl->def_encoder = pdf->def_encoder;
+    tmpl->page_builders = pdf->page_builders;
+
+    /* the pages of the template can not be drawn on any more. */
+    for (i = 0; i < tmpl->page_list->count; i++) {
+        HPDF_Page page = HPDF_List_ItemAt (tmpl->page_list, i);
+
+        ((HPDF_PageAttr)page->attr)->gmode = 0;
+    }
+
+    pdf->tmpl = tmpl;
+    pdf->xref = NULL;
+    pdf->page_list = NULL;
+    pdf->ext_gstate_table = NULL;
+    pdf->page_builders = NULL;
+
+    /* the template is kept when the memory-pool is rewound, since the
+     * mark of the next document is taken after it. */
+    pdf->doc_mark.node = NULL;
+
+    return HPDF_NewDoc (pdf);
+}
+
+
+static void*
+GetClone  (HPDF_Doc  pdf,
+           void      *obj)
+{
+    HPDF_Obj_Header *header = (HPDF_Obj_Header *)obj;
+
+    if (!obj)
+        return NULL;
+
+    return HPDF_Xref_GetEntry (pdf->xref, header->obj_id & 0x00FFFFFF)->obj;
+}
+
+
+/*
+ *  CloneTemplate
+ *
+ *  Fills the new document of pdf, whose xref is empty, with a clone of
+ *  the template. The objects keep their numbers, so that the serialized
+ *  objects of the template, which are shared, refer to the copies.
+ */
+static HPDF_STATUS
+CloneTemplate  (HPDF_Doc  pdf)
+{
+    HPDF_DocTemplate tmpl = pdf->tmpl;
+    HPDF_Xref src = tmpl->xref;
+    HPDF_UINT i;
+
+    HPDF_PTRACE ((" CloneTemplate\n"));
+
+    /* all the objects are added before the copies are filled, which
+     * refer to each other. */
+    for (i = 1; i < src->entries->count; i++) {
+        HPDF_XrefEntry entry = HPDF_Xref_GetEntry (src, i);
+        HPDF_STATUS ret;
+
+        if (entry->cache)
+            ret = HPDF_Xref_AddShared (pdf->xref, entry);
+        else
+            ret = HPDF_Xref_Add (pdf->xref, HPDF_Dict_New (pdf->mmgr));
+
+        if (ret != HPDF_OK)
+            return HPDF_CheckError (&pdf->error);
+    }
+
+    for (i = 1; i < src->entries->count; i++) {
+        HPDF_XrefEntry entry = HPDF_Xref_GetEntry (src, i);
+        HPDF_Dict obj = (HPDF_Dict)entry->obj;
+        HPDF_Dict copy;
+
+        if (entry->cache)
+            continue;
+
+        copy = (HPDF_Dict)HPDF_Xref_GetEntry (pdf->xref, i)->obj;
+        if (HPDF_Dict_CopyFrom (copy, obj, pdf->xref) != HPDF_OK)
+            return HPDF_CheckError (&pdf->error);
+
+        if (obj->header.obj_class == (HPDF_OCLASS_DICT | HPDF_OSUBCLASS_PAGE)
+                && HPDF_Page_InitCopy (copy, obj, pdf->xref) != HPDF_OK)
+            return HPDF_CheckError (&pdf->error);
+    }
+
+    pdf->page_list = HPDF_List_New (pdf->mmgr, HPDF_DEF_PAGE_LIST_NUM);
+    if (!pdf->page_list)
+        return HPDF_CheckError (&pdf->error);
+
+    for (i = 0; i < tmpl->page_list->count; i++) {
+        HPDF_Page page = GetClone (pdf, HPDF_List_ItemAt (tmpl->page_list, i));
+
+        if (HPDF_List_Add (pdf->page_list, page) != HPDF_OK)
+            return HPDF_CheckError (&pdf->error);
+    }
+
+    if (tmpl->ext_gstate_table) {
+        pdf->ext_gstate_table =
+                HPDF_ExtGStateTable_Copy (tmpl->ext_gstate_table);
+        if (!pdf->ext_gstate_table)
+            return HPDF_CheckError (&pdf->error);
+    }
+
+    pdf->catalog = GetClone (pdf, tmpl->catalog);
+    pdf->root_pages = HPDF_Catalog_GetRoot (pdf->catalog);
+    pdf->outlines = GetClone (pdf, tmpl->outlines);
+    pdf->info = GetClone (pdf, tmpl->info);
+    pdf->cur_pages = GetClone (pdf, tmpl->cur_pages);
+    pdf->cur_page = GetClone (pdf, tmpl->cur_page);
+    pdf->pdf_version = tmpl->pdf_version;
+    pdf->page_per_pages = tmpl->page_per_pages;
+    pdf->cur_page_num = tmpl->cur_page_num;
+    pdf->cur_encoder = tmpl->cur_encoder;
+    pdf->def_encoder = tmpl->def_encoder;
+
+    return HPDF_OK;
+}
+
+
+static void
+FreeTemplate  (HPDF_Doc  pdf)
+{
+    HPDF_DocTemplate tmpl = pdf->tmpl;
+
+    HPDF_PTRACE ((" FreeTemplate\n"));
+
+    HPDF_Xref_Free (tmpl->xref);
+    HPDF_List_Free (tmpl->page_list);
+
+    if (tmpl->page_builders)
+        HPDF_PageBuilder_FreeAll (tmpl->page_builders);
+
+    if (tmpl->ext_gstate_table)
+        HPDF_ExtGStateTable_Free (tmpl->ext_gstate_table);
+
+    HPDF_FreeMem (pdf->mmgr, tmpl);
+    pdf->tmpl = NULL;
+}
+
+
 HPDF_EXPORT(HPDF_STATUS)
 HPDF_SetPagesConfiguration  (HPDF_Doc    pdf,
                              HPDF_UINT   page_per_pages)
@@ -435,6 +761,10 @@ HPDF_SetPassword  (HPDF_Doc          pdf,
     if (!HPDF_HasDoc (pdf))
         return HPDF_DOC_INVALID_OBJECT;
 
+    /* the shared objects of a template are not encrypted. */
+    if (pdf->tmpl)
+        return HPDF_RaiseError (&pdf->error, HPDF_TEMPLATE_CANNOT_ENCRYPT, 0);
+
     if (!pdf->encrypt_dict) {
         pdf->encrypt_dict = HPDF_EncryptDict_New (pdf->mmgr, pdf->xref);
 
@@ -611,6 +941,8 @@ InternalSaveToStream  (HPDF_Doc      pdf,
     if ((ret = PrepareTrailer (pdf)) != HPDF_OK)
         return ret;
 
+    pdf->xref->cache_objects = pdf->cache_objects;
+
     /* prepare encription */
     if (pdf->encrypt_on) {
         HPDF_Encrypt e= HPDF_EncryptDict_GetAttr (pdf->encrypt_dict);
@@ -697,7 +1029,7 @@ HPDF_GetStreamSize  (HPDF_Doc   pdf)
     if (!HPDF_Stream_Validate (pdf->stream))
         return 0;
 
-    return HPDF_Stream_Size(pdf->stream);
+    return (HPDF_UINT32)HPDF_Stream_Size(pdf->stream);
 }
 
 
@@ -757,7 +1089,9 @@ HPDF_SaveToFile  (HPDF_Doc     pdf,
     if (!stream)
         return HPDF_CheckError (&pdf->error);
 
-    InternalSaveToStream (pdf, stream);
+    if (HPDF_Stream_SetWriteBuffer (stream, pdf->write_buf_siz) == HPDF_OK &&
+            InternalSaveToStream (pdf, stream) == HPDF_OK)
+        HPDF_Stream_Flush (stream);
 
     HPDF_Stream_Free (stream);
 
@@ -845,7 +1179,7 @@ HPDF_Doc_SetCurrentPage  (HPDF_Doc    pdf,
         return HPDF_SetError (&pdf->error, HPDF_INVALID_PAGE, 0);
 
     /* check whether the page belong to the pdf */
-    if (pdf->mmgr != page->mmgr)
+    if (pdf->mmgr != ((HPDF_PageAttr)page->attr)->doc_mmgr)
         return HPDF_SetError (&pdf->error, HPDF_INVALID_PAGE, 0);
 
     pdf->cur_page = page;
@@ -885,6 +1219,13 @@ HPDF_AddPage  (HPDF_Doc  pdf)
         return NULL;
     }
 
+    if (pdf->share_resources &&
+            (ret = HPDF_Page_InheritResources (page, pdf->root_pages))
+            != HPDF_OK) {
+        HPDF_RaiseError (&pdf->error, ret, 0);
+        return NULL;
+    }
+
     if ((ret = HPDF_List_Add (pdf->page_list, page)) != HPDF_OK) {
         HPDF_RaiseError (&pdf->error, ret, 0);
         return NULL;
@@ -895,6 +1236,9 @@ HPDF_AddPage  (HPDF_Doc  pdf)
     if (pdf->compression_mode & HPDF_COMP_TEXT)
         HPDF_Page_SetFilter (page, HPDF_STREAM_FILTER_FLATE_DECODE);
 
+    HPDF_Page_SetRealPrecision (page, pdf->real_precision);
+    HPDF_Page_SetOptimizeContent (page, pdf->optimize_content);
+
     pdf->cur_page_num++;
 
     return page;
@@ -952,7 +1296,7 @@ HPDF_InsertPage  (HPDF_Doc    pdf,
     }
 
     /* check whether the page belong to the pdf */
-    if (pdf->mmgr != target->mmgr) {
+    if (pdf->mmgr != ((HPDF_PageAttr)target->attr)->doc_mmgr) {
         HPDF_RaiseError (&pdf->error, HPDF_INVALID_PAGE, 0);
         return NULL;
     }
@@ -968,6 +1312,13 @@ HPDF_InsertPage  (HPDF_Doc    pdf,
         return NULL;
     }
 
+    if (pdf->share_resources &&
+            (ret = HPDF_Page_InheritResources (page, pdf->root_pages))
+            != HPDF_OK) {
+        HPDF_RaiseError (&pdf->error, ret, 0);
+        return NULL;
+    }
+
     if ((ret = HPDF_List_Insert (pdf->page_list, target, page)) != HPDF_OK) {
         HPDF_RaiseError (&pdf->error, ret, 0);
         return NULL;
@@ -976,6 +1327,9 @@ HPDF_InsertPage  (HPDF_Doc    pdf,
     if (pdf->compression_mode & HPDF_COMP_TEXT)
         HPDF_Page_SetFilter (page, HPDF_STREAM_FILTER_FLATE_DECODE);
 
+    HPDF_Page_SetRealPrecision (page, pdf->real_precision);
+    HPDF_Page_SetOptimizeContent (page, pdf->optimize_content);
+
     return page;
 }
 
@@ -1045,6 +1399,8 @@ HPDF_Doc_FindFontDef  (HPDF_Doc          pdf,
 
         if (HPDF_StrCmp (font_name, def->base_font) == 0) {
             if (def->type == HPDF_FONTDEF_TYPE_UNINITIALIZED) {
+                pdf->cache_grown = HPDF_TRUE;
+
                 if (!def->init_fn ||
                     def->init_fn (def) != HPDF_OK)
                     return NULL;
@@ -1074,6 +1430,8 @@ HPDF_Doc_RegisterFontDef  (HPDF_Doc       pdf,
         return HPDF_SetError (&pdf->error, HPDF_DUPLICATE_REGISTRATION, 0);
     }
 
+    pdf->cache_grown = HPDF_TRUE;
+
     if ((ret = HPDF_List_Add (pdf->fontdef_list, fontdef)) != HPDF_OK) {
         HPDF_FontDef_Free (fontdef);
         return HPDF_SetError (&pdf->error, ret, 0);
@@ -1104,6 +1462,8 @@ HPDF_GetFontDef  (HPDF_Doc          pdf,
         if (!def)
             return NULL;
 
+        pdf->cache_grown = HPDF_TRUE;
+
         if ((ret = HPDF_List_Add (pdf->fontdef_list, def)) != HPDF_OK) {
             HPDF_FontDef_Free (def);
             HPDF_RaiseError (&pdf->error, ret, 0);
@@ -1132,11 +1492,24 @@ HPDF_Doc_FindEncoder  (HPDF_Doc         pdf,
 
         if (HPDF_StrCmp (encoding_name, encoder->name) == 0) {
 
-            /* if encoder is uninitialize, call init_fn() */
+            /* if encoder is uninitialize, replace it with the shared encoder
+             * built by its init_fn().
+             */
             if (encoder->type == HPDF_ENCODER_TYPE_UNINITIALIZED) {
-                if (!encoder->init_fn ||
-                    encoder->init_fn (encoder) != HPDF_OK)
+                HPDF_Encoder shared;
+
+                if (!encoder->init_fn)
                     return NULL;
+
+                pdf->cache_grown = HPDF_TRUE;
+                shared = HPDF_Encoder_GetShared (pdf->mmgr, encoder->name,
+                        encoder->init_fn);
+                if (!shared)
+                    return NULL;
+
+                list->obj[i] = shared;
+                HPDF_Encoder_Free (encoder);
+                encoder = shared;
             }
 
             return encoder;
@@ -1162,6 +1535,8 @@ HPDF_Doc_RegisterEncoder  (HPDF_Doc       pdf,
         return HPDF_SetError (&pdf->error, HPDF_DUPLICATE_REGISTRATION, 0);
     }
 
+    pdf->cache_grown = HPDF_TRUE;
+
     if ((ret = HPDF_List_Add (pdf->encoder_list, encoder)) != HPDF_OK) {
         HPDF_Encoder_Free (encoder);
         return HPDF_SetError (&pdf->error, ret, 0);
@@ -1186,13 +1561,15 @@ HPDF_GetEncoder  (HPDF_Doc         pdf,
     encoder = HPDF_Doc_FindEncoder (pdf, encoding_name);
 
     if (!encoder) {
-        encoder = HPDF_BasicEncoder_New (pdf->mmgr, encoding_name);
+        encoder = HPDF_Encoder_GetShared (pdf->mmgr, encoding_name, NULL);
 
         if (!encoder) {
             HPDF_CheckError (&pdf->error);
             return NULL;
         }
 
+        pdf->cache_grown = HPDF_TRUE;
+
         if ((ret = HPDF_List_Add (pdf->encoder_list, encoder)) != HPDF_OK) {
             HPDF_Encoder_Free (encoder);
             HPDF_RaiseError (&pdf->error, ret, 0);
@@ -1431,6 +1808,40 @@ HPDF_LoadType1FontFromFile  (HPDF_Doc     pdf,
 }
 
 
+HPDF_EXPORT(HPDF_STATUS)
+HPDF_SaveType1FontMetrics  (HPDF_Doc     pdf,
+                            const char  *font_name,
+                            const char  *file_name)
+{
+    HPDF_FontDef def;
+    HPDF_Stream stream;
+
+    HPDF_PTRACE ((" HPDF_SaveType1FontMetrics\n"));
+
+    if (!HPDF_HasDoc (pdf))
+        return HPDF_INVALID_DOCUMENT;
+
+    def = HPDF_Doc_FindFontDef (pdf, font_name);
+    if (!def)
+        return HPDF_RaiseError (&pdf->error, HPDF_INVALID_FONT_NAME, 0);
+
+    if (def->type != HPDF_FONTDEF_TYPE_TYPE1 ||
+            ((HPDF_Type1FontDefAttr)def->attr)->is_base14font)
+        return HPDF_RaiseError (&pdf->error, HPDF_INVALID_FONTDEF_TYPE, 0);
+
+    stream = HPDF_FileWriter_New (pdf->mmgr, file_name);
+    if (!stream)
+        return HPDF_CheckError (&pdf->error);
+
+    if (HPDF_Type1FontDef_SaveMetrics (def, stream) == HPDF_OK)
+        HPDF_Stream_Flush (stream);
+
+    HPDF_Stream_Free (stream);
+
+    return HPDF_CheckError (&pdf->error);
+}
+
+
 static const char*
 LoadType1FontFromStream  (HPDF_Doc      pdf,
                           HPDF_Stream   afmdata,
@@ -1452,6 +1863,8 @@ LoadType1FontFromStream  (HPDF_Doc      pdf,
             return NULL;
         }
 
+        pdf->cache_grown = HPDF_TRUE;
+
         if (HPDF_List_Add (pdf->fontdef_list, def) != HPDF_OK) {
             HPDF_FontDef_Free (def);
             return NULL;
@@ -1532,6 +1945,8 @@ LoadTTFontFromStream (HPDF_Doc         pdf,
             return NULL;
         }
 
+        pdf->cache_grown = HPDF_TRUE;
+
         if (HPDF_List_Add (pdf->fontdef_list, def) != HPDF_OK) {
             HPDF_FontDef_Free (def);
             return NULL;
@@ -1611,6 +2026,8 @@ LoadTTFontFromStream2 (HPDF_Doc         pdf,
             return NULL;
         }
 
+        pdf->cache_grown = HPDF_TRUE;
+
         if (HPDF_List_Add (pdf->fontdef_list, def) != HPDF_OK) {
             HPDF_FontDef_Free (def);
             return NULL;
@@ -1647,7 +2064,6 @@ HPDF_LoadRawImageFromFile  (HPDF_Doc          pdf,
                             HPDF_UINT         height,
                             HPDF_ColorSpace   color_space)
 {
-    HPDF_Stream imagedata;
     HPDF_Image image;
 
     HPDF_PTRACE ((" HPDF_LoadRawImageFromFile\n"));
@@ -1655,17 +2071,8 @@ HPDF_LoadRawImageFromFile  (HPDF_Doc          pdf,
     if (!HPDF_HasDoc (pdf))
         return NULL;
 
-    /* create file stream */
-    imagedata = HPDF_FileReader_New (pdf->mmgr, filename);
-
-    if (HPDF_Stream_Validate (imagedata))
-        image = HPDF_Image_LoadRawImage (pdf->mmgr, imagedata, pdf->xref, width,
-                    height, color_space);
-    else
-        image = NULL;
-
-    /* destroy file stream */
-    HPDF_Stream_Free (imagedata);
+    image = HPDF_Image_LoadRawImageFromFile (pdf->mmgr, filename, pdf->xref,
+                width, height, color_space);
 
     if (!image)
         HPDF_CheckError (&pdf->error);
@@ -1710,11 +2117,79 @@ HPDF_LoadRawImageFromMem  (HPDF_Doc           pdf,
 }
 
 
+HPDF_EXPORT(HPDF_Image)
+HPDF_LoadRawImageFromMemAsync  (HPDF_Doc           pdf,
+                                const HPDF_BYTE   *buf,
+                                HPDF_UINT          width,
+                                HPDF_UINT          height,
+                                HPDF_ColorSpace    color_space,
+                                HPDF_UINT          bits_per_component)
+{
+    HPDF_Image image;
+
+    HPDF_PTRACE ((" HPDF_LoadRawImageFromMemAsync\n"));
+
+    if (!HPDF_HasDoc (pdf))
+        return NULL;
+
+    if (color_space == HPDF_CS_DEVICE_GRAY && bits_per_component == 1) {
+        return HPDF_Image_LoadRaw1BitImageFromMemAsync (pdf, buf, width,
+                height, (width+7)/8, HPDF_TRUE, HPDF_TRUE);
+    }
+
+    /* without compression, the data is only copied */
+    if (!(pdf->compression_mode & HPDF_COMP_IMAGE))
+        return HPDF_LoadRawImageFromMem (pdf, buf, width, height, color_space,
+                bits_per_component);
+
+    image = HPDF_Image_LoadRawImageFromMemAsync (HPDF_Doc_GetImageLoader (pdf),
+                pdf->mmgr, buf, pdf->xref, width, height, color_space,
+                bits_per_component);
+
+    if (!image)
+        HPDF_CheckError (&pdf->error);
+
+    return image;
+}
+
+
+HPDF_EXPORT(HPDF_Image)
+HPDF_LoadPixelImageFromMem  (HPDF_Doc           pdf,
+                             const HPDF_BYTE   *pixels,
+                             HPDF_UINT          width,
+                             HPDF_UINT          height,
+                             HPDF_UINT          stride,
+                             HPDF_PixelFormat   format)
+{
+    HPDF_Image image;
+
+    HPDF_PTRACE ((" HPDF_LoadPixelImageFromMem\n"));
+
+    if (!HPDF_HasDoc (pdf))
+        return NULL;
+
+    image = HPDF_Image_LoadPixelImageFromMem (pdf->mmgr, pixels, pdf->xref,
+                width, height, stride, format);
+
+    if (!image)
+        HPDF_CheckError (&pdf->error);
+
+    if (image && pdf->compression_mode & HPDF_COMP_IMAGE) {
+        HPDF_Dict smask = HPDF_Dict_GetItem (image, "SMask", HPDF_OCLASS_DICT);
+
+        image->filter = HPDF_STREAM_FILTER_FLATE_DECODE;
+        if (smask)
+            smask->filter = HPDF_STREAM_FILTER_FLATE_DECODE;
+    }
+
+    return image;
+}
+
+
 HPDF_EXPORT(HPDF_Image)
 HPDF_LoadJpegImageFromFile  (HPDF_Doc     pdf,
                              const char  *filename)
 {
-    HPDF_Stream imagedata;
     HPDF_Image image;
 
     HPDF_PTRACE ((" HPDF_LoadJpegImageFromFile\n"));
@@ -1722,16 +2197,7 @@ HPDF_LoadJpegImageFromFile  (HPDF_Doc     pdf,
     if (!HPDF_HasDoc (pdf))
         return NULL;
 
-    /* create file stream */
-    imagedata = HPDF_FileReader_New (pdf->mmgr, filename);
-
-    if (HPDF_Stream_Validate (imagedata))
-        image = HPDF_Image_LoadJpegImage (pdf->mmgr, imagedata, pdf->xref);
-    else
-        image = NULL;
-
-    /* destroy file stream */
-    HPDF_Stream_Free (imagedata);
+    image = HPDF_Image_LoadJpegImageFromFile (pdf->mmgr, filename, pdf->xref);
 
     if (!image)
         HPDF_CheckError (&pdf->error);
@@ -2118,6 +2584,45 @@ HPDF_CreateExtGState  (HPDF_Doc  pdf)
 }
 
 
+HPDF_EXPORT(HPDF_ExtGState)
+HPDF_GetExtGState  (HPDF_Doc        pdf,
+                    HPDF_REAL       alpha_stroke,
+                    HPDF_REAL       alpha_fill,
+                    HPDF_BlendMode  bmode)
+{
+    HPDF_ExtGState ext_gstate;
+
+    HPDF_PTRACE ((" HPDF_GetExtGState\n"));
+
+    if (!HPDF_HasDoc (pdf))
+        return NULL;
+
+    if (alpha_stroke < 0 || alpha_stroke > 1.0f ||
+            alpha_fill < 0 || alpha_fill > 1.0f ||
+            (int)bmode < 0 || (int)bmode >= (int)HPDF_BM_EOF) {
+        HPDF_RaiseError (&pdf->error, HPDF_EXT_GSTATE_OUT_OF_RANGE, 0);
+        return NULL;
+    }
+
+    if (!pdf->ext_gstate_table) {
+        pdf->ext_gstate_table = HPDF_ExtGStateTable_New (pdf->mmgr);
+        if (!pdf->ext_gstate_table) {
+            HPDF_CheckError (&pdf->error);
+            return NULL;
+        }
+    }
+
+    pdf->pdf_version = HPDF_VER_14;
+
+    ext_gstate = HPDF_ExtGStateTable_Get (pdf->ext_gstate_table, pdf->xref,
+            alpha_stroke, alpha_fill, bmode);
+    if (!ext_gstate)
+        HPDF_CheckError (&pdf->error);
+
+    return ext_gstate;
+}
+
+
 HPDF_EXPORT(HPDF_STATUS)
 HPDF_SetCompressionMode  (HPDF_Doc    pdf,
                           HPDF_UINT   mode)
@@ -2141,6 +2646,158 @@ HPDF_SetCompressionMode  (HPDF_Doc    pdf,
 }
 
 
+HPDF_EXPORT(HPDF_STATUS)
+HPDF_SetRealPrecision  (HPDF_Doc    pdf,
+                        HPDF_UINT   precision)
+{
+    HPDF_PTRACE ((" HPDF_SetRealPrecision\n"));
+
+    if (!HPDF_Doc_Validate (pdf))
+        return HPDF_INVALID_DOCUMENT;
+
+    if (precision > HPDF_MAX_REAL_PRECISION)
+        return HPDF_RaiseError (&pdf->error, HPDF_INVALID_PARAMETER, 0);
+
+    pdf->real_precision = precision;
+
+    return HPDF_OK;
+}
+
+
+HPDF_EXPORT(HPDF_STATUS)
+HPDF_SetOptimizeContent  (HPDF_Doc    pdf,
+                          HPDF_BOOL   optimize)
+{
+    HPDF_PTRACE ((" HPDF_SetOptimizeContent\n"));
+
+    if (!HPDF_Doc_Validate (pdf))
+        return HPDF_INVALID_DOCUMENT;
+
+    pdf->optimize_content = optimize;
+
+    return HPDF_OK;
+}
+
+
+HPDF_EXPORT(HPDF_STATUS)
+HPDF_SetShareResources  (HPDF_Doc    pdf,
+                         HPDF_BOOL   share)
+{
+    HPDF_PTRACE ((" HPDF_SetShareResources\n"));
+
+    if (!HPDF_Doc_Validate (pdf))
+        return HPDF_INVALID_DOCUMENT;
+
+    pdf->share_resources = share;
+
+    return HPDF_OK;
+}
+
+
+HPDF_EXPORT(HPDF_STATUS)
+HPDF_SetCacheObjects  (HPDF_Doc    pdf,
+                       HPDF_BOOL   cache)
+{
+    HPDF_PTRACE ((" HPDF_SetCacheObjects\n"));
+
+    if (!HPDF_Doc_Validate (pdf))
+        return HPDF_INVALID_DOCUMENT;
+
+    pdf->cache_objects = cache;
+
+    return HPDF_OK;
+}
+
+
+HPDF_EXPORT(HPDF_STATUS)
+HPDF_SetImageResolution  (HPDF_Doc    pdf,
+                          HPDF_REAL   dpi)
+{
+    HPDF_PTRACE ((" HPDF_SetImageResolution\n"));
+
+    if (!HPDF_Doc_Validate (pdf))
+        return HPDF_INVALID_DOCUMENT;
+
+    if (dpi < 0)
+        return HPDF_RaiseError (&pdf->error, HPDF_INVALID_PARAMETER, 0);
+
+    pdf->image_resolution = dpi;
+
+    return HPDF_OK;
+}
+
+
+HPDF_EXPORT(HPDF_REAL)
+HPDF_GetImageResolution  (HPDF_Doc    pdf)
+{
+    HPDF_PTRACE ((" HPDF_GetImageResolution\n"));
+
+    if (!HPDF_Doc_Validate (pdf))
+        return 0;
+
+    return pdf->image_resolution;
+}
+
+
+HPDF_EXPORT(HPDF_STATUS)
+HPDF_SetImageLoadThreads  (HPDF_Doc    pdf,
+                           HPDF_UINT   threads)
+{
+    HPDF_PTRACE ((" HPDF_SetImageLoadThreads\n"));
+
+    if (!HPDF_Doc_Validate (pdf))
+        return HPDF_INVALID_DOCUMENT;
+
+    if (threads > HPDF_MAX_IMAGE_LOAD_THREADS)
+        return HPDF_RaiseError (&pdf->error, HPDF_INVALID_PARAMETER, 0);
+
+    pdf->image_load_threads = threads;
+
+    return HPDF_OK;
+}
+
+
+HPDF_EXPORT(HPDF_STATUS)
+HPDF_SetWriteBufferSize  (HPDF_Doc    pdf,
+                          HPDF_UINT   size)
+{
+    HPDF_PTRACE ((" HPDF_SetWriteBufferSize\n"));
+
+    if (!HPDF_Doc_Validate (pdf))
+        return HPDF_INVALID_DOCUMENT;
+
+    pdf->write_buf_siz = size;
+
+    return HPDF_OK;
+}
+
+
+HPDF_EXPORT(HPDF_STATUS)
+HPDF_SetMemoryBudget  (HPDF_Doc     pdf,
+                       HPDF_UINT32  limit,
+                       const char   *tmp_dir)
+{
+    HPDF_PTRACE ((" HPDF_SetMemoryBudget\n"));
+
+    if (!HPDF_Doc_Validate (pdf))
+        return HPDF_INVALID_DOCUMENT;
+
+    if (tmp_dir) {
+        if (HPDF_StrLen (tmp_dir, HPDF_TMP_BUF_SIZ) >= HPDF_TMP_BUF_SIZ - 1)
+            return HPDF_RaiseError (&pdf->error, HPDF_INVALID_PARAMETER, 0);
+
+        HPDF_StrCpy (pdf->stream_budget.tmp_dir, tmp_dir,
+                pdf->stream_budget.tmp_dir + HPDF_TMP_BUF_SIZ - 1);
+    } else
+        pdf->stream_budget.tmp_dir[0] = 0;
+
+    pdf->stream_budget.limit = limit;
+    HPDF_MemStream_CheckBudget (&pdf->stream_budget);
+
+    return HPDF_OK;
+}
+
+
 HPDF_EXPORT(HPDF_STATUS)
 HPDF_GetError  (HPDF_Doc   pdf)
 {
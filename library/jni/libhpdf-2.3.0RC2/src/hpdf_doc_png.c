@@ -68,6 +68,38 @@ HPDF_LoadPngImageFromMem  (HPDF_Doc     pdf,
 }
 
 
+/* asynchronous version of HPDF_LoadPngImageFromMem */
+HPDF_EXPORT(HPDF_Image)
+HPDF_LoadPngImageFromMemAsync  (HPDF_Doc     pdf,
+                         const HPDF_BYTE    *buffer,
+                               HPDF_UINT     size)
+{
+    HPDF_Image image;
+
+    HPDF_PTRACE ((" HPDF_LoadPngImageFromMemAsync\n"));
+
+    if (!HPDF_HasDoc (pdf))
+        return NULL;
+
+#ifndef LIBHPDF_HAVE_NOPNGLIB
+    image = HPDF_Image_LoadPngImageAsync (HPDF_Doc_GetImageLoader (pdf),
+                pdf->mmgr, buffer, size, pdf->xref,
+                (pdf->compression_mode & HPDF_COMP_IMAGE) ?
+                HPDF_STREAM_FILTER_FLATE_DECODE : HPDF_STREAM_FILTER_NONE);
+#else
+    HPDF_SetError (&pdf->error, HPDF_UNSUPPORTED_FUNC, 0);
+    HPDF_UNUSED (buffer);
+    HPDF_UNUSED (size);
+    image = NULL;
+#endif /* LIBHPDF_HAVE_NOPNGLIB */
+
+    if (!image)
+        HPDF_CheckError (&pdf->error);
+
+    return image;
+}
+
+
 HPDF_EXPORT(HPDF_Image)
 HPDF_LoadPngImageFromFile  (HPDF_Doc     pdf,
                             const char  *filename)
@@ -20,6 +20,11 @@
 #include "hpdf_encoder.h"
 #include "hpdf.h"
 
+#if !defined(LIBHPDF_HAVE_NOTHREADS) && !defined(_WIN32)
+#include <pthread.h>
+#define HPDF_SHARED_ENCODERS
+#endif
+
 typedef struct _HPDF_UnicodeGryphPair {
     HPDF_UNICODE     unicode;
     const char  *gryph_name;
@@ -2378,7 +2383,8 @@ HPDF_Encoder_Free  (HPDF_Encoder  encoder)
 {
     HPDF_PTRACE ((" HPDF_Encoder_Free\n"));
 
-    if (!encoder)
+    /* shared encoders live until the process exits. */
+    if (!encoder || encoder->shared)
         return;
 
     if (encoder->free_fn)
@@ -2387,6 +2393,117 @@ HPDF_Encoder_Free  (HPDF_Encoder  encoder)
 }
 
 
+/*
+ *  An encoder is never modified once it is initialized, so each predefined
+ *  encoder is built once per process and the same object is referenced by
+ *  every document which uses it. The encoders are keyed by name and init_fn,
+ *  and are allocated from a memory manager of their own.
+ *
+ *  When the library is built without threads, there is no lock to protect
+ *  the shared encoders and a new encoder is built for each document instead.
+ */
+
+#ifdef HPDF_SHARED_ENCODERS
+
+static pthread_mutex_t  shared_encoders_lock = PTHREAD_MUTEX_INITIALIZER;
+static HPDF_Error_Rec   shared_encoders_error;
+static HPDF_MMgr        shared_encoders_mmgr;
+static HPDF_List        shared_encoders;
+
+#endif /* HPDF_SHARED_ENCODERS */
+
+
+static HPDF_Encoder
+NewEncoder  (HPDF_MMgr               mmgr,
+             const char             *encoding_name,
+             HPDF_Encoder_Init_Func  init_fn)
+{
+    HPDF_Encoder encoder;
+
+    if (!init_fn)
+        return HPDF_BasicEncoder_New (mmgr, encoding_name);
+
+    encoder = HPDF_CMapEncoder_New (mmgr, (char *)encoding_name, init_fn);
+    if (encoder && init_fn (encoder) != HPDF_OK) {
+        HPDF_Encoder_Free (encoder);
+        return NULL;
+    }
+
+    return encoder;
+}
+
+
+HPDF_Encoder
+HPDF_Encoder_GetShared  (HPDF_MMgr               mmgr,
+                         const char             *encoding_name,
+                         HPDF_Encoder_Init_Func  init_fn)
+{
+#ifdef HPDF_SHARED_ENCODERS
+    HPDF_Encoder encoder = NULL;
+    HPDF_STATUS error_no = HPDF_OK;
+    HPDF_STATUS detail_no = HPDF_OK;
+    HPDF_UINT i;
+
+    HPDF_PTRACE ((" HPDF_Encoder_GetShared\n"));
+
+    pthread_mutex_lock (&shared_encoders_lock);
+
+    if (!shared_encoders_mmgr) {
+        HPDF_Error_Init (&shared_encoders_error, NULL);
+        shared_encoders_mmgr = HPDF_MMgr_New (&shared_encoders_error, 0,
+                NULL, NULL);
+        if (shared_encoders_mmgr)
+            shared_encoders = HPDF_List_New (shared_encoders_mmgr,
+                    HPDF_DEF_ITEMS_PER_BLOCK);
+    }
+
+    if (shared_encoders) {
+        for (i = 0; i < shared_encoders->count; i++) {
+            HPDF_Encoder item = (HPDF_Encoder)HPDF_List_ItemAt (shared_encoders,
+                    i);
+
+            if (item->init_fn == init_fn &&
+                    HPDF_StrCmp (item->name, encoding_name) == 0) {
+                encoder = item;
+                break;
+            }
+        }
+
+        if (!encoder) {
+            encoder = NewEncoder (shared_encoders_mmgr, encoding_name, init_fn);
+
+            if (encoder && HPDF_List_Add (shared_encoders, encoder) != HPDF_OK) {
+                HPDF_Encoder_Free (encoder);
+                encoder = NULL;
+            }
+
+            if (encoder)
+                encoder->shared = HPDF_TRUE;
+        }
+    }
+
+    if (!encoder) {
+        error_no = HPDF_Error_GetCode (&shared_encoders_error);
+        detail_no = HPDF_Error_GetDetailCode (&shared_encoders_error);
+        if (error_no == HPDF_OK)
+            error_no = HPDF_FAILD_TO_ALLOC_MEM;
+        HPDF_Error_Reset (&shared_encoders_error);
+    }
+
+    pthread_mutex_unlock (&shared_encoders_lock);
+
+    if (!encoder)
+        HPDF_SetError (mmgr->error, error_no, detail_no);
+
+    return encoder;
+#else
+    HPDF_PTRACE ((" HPDF_Encoder_GetShared\n"));
+
+    return NewEncoder (mmgr, encoding_name, init_fn);
+#endif /* HPDF_SHARED_ENCODERS */
+}
+
+
 const char*
 HPDF_UnicodeToGryphName  (HPDF_UNICODE  unicode)
 {
@@ -151,3 +151,233 @@ HPDF_ExtGState_SetStrokeAdjustment  (HPDF_ExtGState   ext_gstate,
 }
 */
 
+
+
+/*----- interned extended graphics states ----------------------------------*/
+
+#define HPDF_EXT_GSTATE_TABLE_INIT_SIZE   16
+
+static HPDF_UINT
+HashValues  (HPDF_REAL       alpha_stroke,
+             HPDF_REAL       alpha_fill,
+             HPDF_BlendMode  bmode)
+{
+    HPDF_UINT h = (HPDF_UINT)(alpha_stroke * 65535.0f);
+
+    h = h * 31 + (HPDF_UINT)(alpha_fill * 65535.0f);
+    h = h * 31 + (HPDF_UINT)bmode;
+
+    return h ^ (h >> 16);
+}
+
+
+HPDF_ExtGStateTable
+HPDF_ExtGStateTable_New  (HPDF_MMgr  mmgr)
+{
+    HPDF_ExtGStateTable table;
+    HPDF_UINT size = sizeof (HPDF_ExtGStateEntry) *
+            HPDF_EXT_GSTATE_TABLE_INIT_SIZE;
+
+    HPDF_PTRACE ((" HPDF_ExtGStateTable_New\n"));
+
+    table = HPDF_GetMem (mmgr, sizeof (HPDF_ExtGStateTable_Rec));
+    if (!table)
+        return NULL;
+
+    table->buckets = HPDF_GetMem (mmgr, size);
+    if (!table->buckets) {
+        HPDF_FreeMem (mmgr, table);
+        return NULL;
+    }
+
+    HPDF_MemSet (table->buckets, 0, size);
+    table->mmgr = mmgr;
+    table->count = 0;
+    table->size = HPDF_EXT_GSTATE_TABLE_INIT_SIZE;
+
+    return table;
+}
+
+
+void
+HPDF_ExtGStateTable_Free  (HPDF_ExtGStateTable  table)
+{
+    HPDF_UINT i;
+
+    HPDF_PTRACE ((" HPDF_ExtGStateTable_Free\n"));
+
+    if (!table)
+        return;
+
+    /* the objects belong to the xref. */
+    for (i = 0; i < table->size; i++) {
+        HPDF_ExtGStateEntry entry = table->buckets[i];
+
+        while (entry) {
+            HPDF_ExtGStateEntry next = entry->next;
+
+            HPDF_FreeMem (table->mmgr, entry);
+            entry = next;
+        }
+    }
+
+    HPDF_FreeMem (table->mmgr, table->buckets);
+    HPDF_FreeMem (table->mmgr, table);
+}
+
+
+static HPDF_STATUS
+GrowTable  (HPDF_ExtGStateTable  table)
+{
+    HPDF_UINT new_size = table->size * 2;
+    HPDF_UINT size = sizeof (HPDF_ExtGStateEntry) * new_size;
+    HPDF_ExtGStateEntry *buckets;
+    HPDF_UINT i;
+
+    buckets = HPDF_GetMem (table->mmgr, size);
+    if (!buckets)
+        return table->mmgr->error->error_no;
+
+    HPDF_MemSet (buckets, 0, size);
+
+    for (i = 0; i < table->size; i++) {
+        HPDF_ExtGStateEntry entry = table->buckets[i];
+
+        while (entry) {
+            HPDF_ExtGStateEntry next = entry->next;
+            HPDF_UINT idx = entry->hash & (new_size - 1);
+
+            entry->next = buckets[idx];
+            buckets[idx] = entry;
+            entry = next;
+        }
+    }
+
+    HPDF_FreeMem (table->mmgr, table->buckets);
+    table->buckets = buckets;
+    table->size = new_size;
+
+    return HPDF_OK;
+}
+
+
+/*
+ *  HPDF_ExtGStateTable_Copy
+ *
+ *  Creates a table with the entries of src, so that a document cloned
+ *  from a template uses the states of the template again, and names the
+ *  states it adds after them.
+ */
+HPDF_ExtGStateTable
+HPDF_ExtGStateTable_Copy  (HPDF_ExtGStateTable  src)
+{
+    HPDF_ExtGStateTable table;
+    HPDF_UINT i;
+
+    HPDF_PTRACE ((" HPDF_ExtGStateTable_Copy\n"));
+
+    table = HPDF_ExtGStateTable_New (src->mmgr);
+    if (!table)
+        return NULL;
+
+    for (i = 0; i < src->size; i++) {
+        HPDF_ExtGStateEntry entry = src->buckets[i];
+
+        while (entry) {
+            HPDF_ExtGStateEntry copy;
+            HPDF_UINT idx;
+
+            if (table->count >= table->size && GrowTable (table) != HPDF_OK)
+                break;
+
+            copy = HPDF_GetMem (table->mmgr, sizeof (HPDF_ExtGStateEntry_Rec));
+            if (!copy)
+                break;
+
+            *copy = *entry;
+            idx = copy->hash & (table->size - 1);
+            copy->next = table->buckets[idx];
+            table->buckets[idx] = copy;
+            table->count++;
+
+            entry = entry->next;
+        }
+
+        if (entry) {
+            HPDF_ExtGStateTable_Free (table);
+            return NULL;
+        }
+    }
+
+    return table;
+}
+
+
+HPDF_ExtGState
+HPDF_ExtGStateTable_Get  (HPDF_ExtGStateTable  table,
+                          HPDF_Xref            xref,
+                          HPDF_REAL            alpha_stroke,
+                          HPDF_REAL            alpha_fill,
+                          HPDF_BlendMode       bmode)
+{
+    HPDF_UINT hash = HashValues (alpha_stroke, alpha_fill, bmode);
+    HPDF_ExtGStateEntry entry = table->buckets[hash & (table->size - 1)];
+    HPDF_ExtGState obj;
+    HPDF_STATUS ret = HPDF_OK;
+    char *ptr;
+
+    HPDF_PTRACE ((" HPDF_ExtGStateTable_Get\n"));
+
+    while (entry) {
+        if (entry->hash == hash && entry->alpha_stroke == alpha_stroke &&
+                entry->alpha_fill == alpha_fill && entry->bmode == bmode)
+            return entry->obj;
+        entry = entry->next;
+    }
+
+    if (table->count >= table->size && GrowTable (table) != HPDF_OK)
+        return NULL;
+
+    obj = HPDF_ExtGState_New (table->mmgr, xref);
+    if (!obj)
+        return NULL;
+
+    ret += HPDF_Dict_AddReal (obj, "CA", alpha_stroke);
+    ret += HPDF_Dict_AddReal (obj, "ca", alpha_fill);
+    ret += HPDF_Dict_AddName (obj, "BM", HPDF_BM_NAMES[(int)bmode]);
+    if (ret != HPDF_OK)
+        return NULL;
+
+    entry = HPDF_GetMem (table->mmgr, sizeof (HPDF_ExtGStateEntry_Rec));
+    if (!entry)
+        return NULL;
+
+    entry->alpha_stroke = alpha_stroke;
+    entry->alpha_fill = alpha_fill;
+    entry->bmode = bmode;
+    entry->hash = hash;
+    entry->obj = obj;
+
+    ptr = (char *)HPDF_StrCpy (entry->name, "GS",
+            entry->name + sizeof (entry->name) - 1);
+    HPDF_IToA (ptr, table->count + 1, entry->name + sizeof (entry->name) - 1);
+
+    entry->next = table->buckets[hash & (table->size - 1)];
+    table->buckets[hash & (table->size - 1)] = entry;
+    table->count++;
+
+    /* the object is shared, so it can not be changed any more. */
+    obj->header.obj_class = (HPDF_OSUBCLASS_EXT_GSTATE_R | HPDF_OCLASS_DICT);
+    obj->attr = entry;
+
+    return obj;
+}
+
+
+const char*
+HPDF_ExtGState_GetSharedName  (HPDF_ExtGState  ext_gstate)
+{
+    HPDF_ExtGStateEntry entry = (HPDF_ExtGStateEntry)ext_gstate->attr;
+
+    return entry ? entry->name : NULL;
+}
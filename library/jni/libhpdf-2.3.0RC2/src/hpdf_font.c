@@ -19,6 +19,28 @@
 #include "hpdf_utils.h"
 #include "hpdf.h"
 
+/*
+ *  Measuring text marks the characters it uses in the font and in its
+ *  fontdef, so that only their widths and glyphs are written. Pages made
+ *  by page builders on other threads measure text with the fonts of the
+ *  document at the same time, so the width functions are called with the
+ *  lock of the fontdef held. Documents do not share fontdefs, so the
+ *  documents built on other threads do not wait for each other.
+ */
+
+void
+HPDF_Font_LockWidths  (HPDF_Font  font)
+{
+    HPDF_FontDef_Lock (((HPDF_FontAttr)font->attr)->fontdef);
+}
+
+
+void
+HPDF_Font_UnlockWidths  (HPDF_Font  font)
+{
+    HPDF_FontDef_Unlock (((HPDF_FontAttr)font->attr)->fontdef);
+}
+
 
 HPDF_EXPORT(HPDF_TextWidth)
 HPDF_Font_TextWidth  (HPDF_Font        font,
@@ -45,7 +67,9 @@ HPDF_Font_TextWidth  (HPDF_Font        font,
         return tw;
     }
 
+    HPDF_Font_LockWidths (font);
     tw = attr->text_width_fn (font, text, len);
+    HPDF_Font_UnlockWidths (font);
 
     return tw;
 }
@@ -63,6 +87,7 @@ HPDF_Font_MeasureText (HPDF_Font          font,
                        HPDF_REAL         *real_width)
 {
     HPDF_FontAttr attr;
+    HPDF_UINT ret;
 
     HPDF_PTRACE ((" HPDF_Font_MeasureText\n"));
 
@@ -81,8 +106,12 @@ HPDF_Font_MeasureText (HPDF_Font          font,
         return 0;
     }
 
-    return attr->measure_text_fn (font, text, len, width, font_size,
+    HPDF_Font_LockWidths (font);
+    ret = attr->measure_text_fn (font, text, len, width, font_size,
                             char_space, word_space, wordwrap, real_width);
+    HPDF_Font_UnlockWidths (font);
+
+    return ret;
 }
 
 
@@ -136,7 +165,13 @@ HPDF_Font_GetUnicodeWidth  (HPDF_Font       font,
     if (fontdef->type == HPDF_FONTDEF_TYPE_TYPE1) {
         return HPDF_Type1FontDef_GetWidth (fontdef, code);
     } else if (fontdef->type == HPDF_FONTDEF_TYPE_TRUETYPE) {
-        return HPDF_TTFontDef_GetCharWidth (fontdef, code);
+        HPDF_INT16 width;
+
+        HPDF_Font_LockWidths (font);
+        width = HPDF_TTFontDef_GetCharWidth (fontdef, code);
+        HPDF_Font_UnlockWidths (font);
+
+        return width;
     } else if (fontdef->type == HPDF_FONTDEF_TYPE_CID) {
         HPDF_CMapEncoderAttr encoder_attr =
             (HPDF_CMapEncoderAttr)attr->encoder->attr;
@@ -54,7 +54,8 @@ UINT16ToHex  (char     *s,
 
 
 static HPDF_Dict
-CreateCMap  (HPDF_Encoder   encoder,
+CreateCMap  (HPDF_MMgr      mmgr,
+             HPDF_Encoder   encoder,
              HPDF_Xref      xref);
 
 
@@ -132,7 +133,7 @@ HPDF_Type0Font_New  (HPDF_MMgr        mmgr,
     if (fontdef->type == HPDF_FONTDEF_TYPE_CID) {
         ret += HPDF_Dict_AddName (font, "Encoding", encoder->name);
     } else {
-        attr->cmap_stream = CreateCMap (encoder, xref);
+        attr->cmap_stream = CreateCMap (mmgr, encoder, xref);
 
         if (attr->cmap_stream) {
             ret += HPDF_Dict_Add (font, "Encoding", attr->cmap_stream);
@@ -509,6 +510,7 @@ CIDFontType2_BeforeWrite_Func  (HPDF_Dict obj)
             ret += HPDF_Dict_AddNumber (font_data, "Length3", 0);
 
             font_data->filter = obj->filter;
+            font_data->header.obj_id |= HPDF_OTYPE_FINAL;
 
             if (ret != HPDF_OK)
                 return HPDF_Error_GetCode (obj->error);
@@ -803,11 +805,12 @@ UINT16ToHex  (char     *s,
 
 
 static HPDF_Dict
-CreateCMap  (HPDF_Encoder   encoder,
+CreateCMap  (HPDF_MMgr      mmgr,
+             HPDF_Encoder   encoder,
              HPDF_Xref      xref)
 {
     HPDF_STATUS ret = HPDF_OK;
-    HPDF_Dict cmap = HPDF_DictStream_New (encoder->mmgr, xref);
+    HPDF_Dict cmap = HPDF_DictStream_New (mmgr, xref);
     HPDF_CMapEncoderAttr attr = (HPDF_CMapEncoderAttr)encoder->attr;
     char buf[HPDF_TMP_BUF_SIZ];
     char *pbuf;
@@ -822,16 +825,16 @@ CreateCMap  (HPDF_Encoder   encoder,
     ret += HPDF_Dict_AddName (cmap, "Type", "CMap");
     ret += HPDF_Dict_AddName (cmap, "CMapName", encoder->name);
 
-    sysinfo = HPDF_Dict_New (encoder->mmgr);
+    sysinfo = HPDF_Dict_New (mmgr);
     if (!sysinfo)
         return NULL;
 
     if (HPDF_Dict_Add (cmap, "CIDSystemInfo", sysinfo) != HPDF_OK)
         return NULL;
 
-    ret += HPDF_Dict_Add (sysinfo, "Registry", HPDF_String_New (encoder->mmgr,
+    ret += HPDF_Dict_Add (sysinfo, "Registry", HPDF_String_New (mmgr,
                     attr->registry, NULL));
-    ret += HPDF_Dict_Add (sysinfo, "Ordering", HPDF_String_New (encoder->mmgr,
+    ret += HPDF_Dict_Add (sysinfo, "Ordering", HPDF_String_New (mmgr,
                     attr->ordering, NULL));
     ret += HPDF_Dict_AddNumber (sysinfo, "Supplement", attr->suppliment);
     ret += HPDF_Dict_AddNumber (cmap, "WMode",
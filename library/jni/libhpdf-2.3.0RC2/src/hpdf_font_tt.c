@@ -216,6 +216,7 @@ CreateDescriptor  (HPDF_Font  font)
             ret += HPDF_Dict_AddNumber (font_data, "Length3", 0);
 
             font_data->filter = font->filter;
+            font_data->header.obj_id |= HPDF_OTYPE_FINAL;
         }
 
         if (ret != HPDF_OK)
@@ -211,6 +211,7 @@ Type1Font_CreateDescriptor  (HPDF_MMgr  mmgr,
                     def_attr->length3);
 
             font_data->filter = font->filter;
+            font_data->header.obj_id |= HPDF_OTYPE_FINAL;
         }
 
         if (ret != HPDF_OK)
@@ -43,9 +43,41 @@ HPDF_FontDef_Free (HPDF_FontDef  fontdef)
 
     if (fontdef->free_fn)
         fontdef->free_fn (fontdef);
+
+#ifdef HPDF_FONTDEF_LOCK
+    pthread_mutex_destroy (&fontdef->lock);
+#endif
+
     HPDF_FreeMem (fontdef->mmgr, fontdef);
 }
 
+
+void
+HPDF_FontDef_InitLock  (HPDF_FontDef  fontdef)
+{
+#ifdef HPDF_FONTDEF_LOCK
+    pthread_mutex_init (&fontdef->lock, NULL);
+#endif
+}
+
+
+void
+HPDF_FontDef_Lock  (HPDF_FontDef  fontdef)
+{
+#ifdef HPDF_FONTDEF_LOCK
+    pthread_mutex_lock (&fontdef->lock);
+#endif
+}
+
+
+void
+HPDF_FontDef_Unlock  (HPDF_FontDef  fontdef)
+{
+#ifdef HPDF_FONTDEF_LOCK
+    pthread_mutex_unlock (&fontdef->lock);
+#endif
+}
+
 HPDF_BOOL
 HPDF_FontDef_Validate (HPDF_FontDef  fontdef)
 {
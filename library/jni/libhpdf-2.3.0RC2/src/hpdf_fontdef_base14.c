@@ -19,6 +19,10 @@
 #include "hpdf_utils.h"
 #include "hpdf_fontdef.h"
 
+/* the entries of each table are sorted by unicode, so that
+ * HPDF_Type1FontDef_GetWidth can look them up without sorting them first.
+ */
+
 static const HPDF_CharData CHAR_DATA_COURIER[316] = {
     {32, 0x0020, 600},
     {33, 0x0021, 600},
@@ -27,7 +31,7 @@ static const HPDF_CharData CHAR_DATA_COURIER[316] = {
     {36, 0x0024, 600},
     {37, 0x0025, 600},
     {38, 0x0026, 600},
-    {39, 0x2019, 600},
+    {169, 0x0027, 600},
     {40, 0x0028, 600},
     {41, 0x0029, 600},
     {42, 0x002A, 600},
@@ -84,7 +88,7 @@ static const HPDF_CharData CHAR_DATA_COURIER[316] = {
     {93, 0x005D, 600},
     {94, 0x005E, 600},
     {95, 0x005F, 600},
-    {96, 0x2018, 600},
+    {193, 0x0060, 600},
     {97, 0x0061, 600},
     {98, 0x0062, 600},
     {99, 0x0063, 600},
@@ -118,223 +122,223 @@ static const HPDF_CharData CHAR_DATA_COURIER[316] = {
     {161, 0x00A1, 600},
     {162, 0x00A2, 600},
     {163, 0x00A3, 600},
-    {164, 0x2044, 600},
+    {168, 0x00A4, 600},
     {165, 0x00A5, 600},
-    {166, 0x0192, 600},
+    {-1, 0x00A6, 600},
     {167, 0x00A7, 600},
-    {168, 0x00A4, 600},
-    {169, 0x0027, 600},
-    {170, 0x201C, 600},
+    {200, 0x00A8, 600},
+    {-1, 0x00A9, 600},
+    {227, 0x00AA, 600},
     {171, 0x00AB, 600},
-    {172, 0x2039, 600},
-    {173, 0x203A, 600},
-    {174, 0xFB01, 600},
-    {175, 0xFB02, 600},
-    {177, 0x2013, 600},
-    {178, 0x2020, 600},
-    {179, 0x2021, 600},
-    {180, 0x00B7, 600},
+    {-1, 0x00AC, 600},
+    {-1, 0x00AE, 600},
+    {197, 0x00AF, 600},
+    {-1, 0x00B0, 600},
+    {-1, 0x00B1, 600},
+    {-1, 0x00B2, 600},
+    {-1, 0x00B3, 600},
+    {194, 0x00B4, 600},
+    {-1, 0x00B5, 600},
     {182, 0x00B6, 600},
-    {183, 0x2022, 600},
-    {184, 0x201A, 600},
-    {185, 0x201E, 600},
-    {186, 0x201D, 600},
+    {180, 0x00B7, 600},
+    {203, 0x00B8, 600},
+    {-1, 0x00B9, 600},
+    {235, 0x00BA, 600},
     {187, 0x00BB, 600},
-    {188, 0x2026, 600},
-    {189, 0x2030, 600},
+    {-1, 0x00BC, 600},
+    {-1, 0x00BD, 600},
+    {-1, 0x00BE, 600},
     {191, 0x00BF, 600},
-    {193, 0x0060, 600},
-    {194, 0x00B4, 600},
-    {195, 0x02C6, 600},
-    {196, 0x02DC, 600},
-    {197, 0x00AF, 600},
-    {198, 0x02D8, 600},
-    {199, 0x02D9, 600},
-    {200, 0x00A8, 600},
-    {202, 0x02DA, 600},
-    {203, 0x00B8, 600},
-    {205, 0x02DD, 600},
-    {206, 0x02DB, 600},
-    {207, 0x02C7, 600},
-    {208, 0x2014, 600},
+    {-1, 0x00C0, 600},
+    {-1, 0x00C1, 600},
+    {-1, 0x00C2, 600},
+    {-1, 0x00C3, 600},
+    {-1, 0x00C4, 600},
+    {-1, 0x00C5, 600},
     {225, 0x00C6, 600},
-    {227, 0x00AA, 600},
-    {232, 0x0141, 600},
+    {-1, 0x00C7, 600},
+    {-1, 0x00C8, 600},
+    {-1, 0x00C9, 600},
+    {-1, 0x00CA, 600},
+    {-1, 0x00CB, 600},
+    {-1, 0x00CC, 600},
+    {-1, 0x00CD, 600},
+    {-1, 0x00CE, 600},
+    {-1, 0x00CF, 600},
+    {-1, 0x00D0, 600},
+    {-1, 0x00D1, 600},
+    {-1, 0x00D2, 600},
+    {-1, 0x00D3, 600},
+    {-1, 0x00D4, 600},
+    {-1, 0x00D5, 600},
+    {-1, 0x00D6, 600},
+    {-1, 0x00D7, 600},
     {233, 0x00D8, 600},
-    {234, 0x0152, 600},
-    {235, 0x00BA, 600},
-    {241, 0x00E6, 600},
-    {245, 0x0131, 600},
-    {248, 0x0142, 600},
-    {249, 0x00F8, 600},
-    {250, 0x0153, 600},
+    {-1, 0x00D9, 600},
+    {-1, 0x00DA, 600},
+    {-1, 0x00DB, 600},
+    {-1, 0x00DC, 600},
+    {-1, 0x00DD, 600},
+    {-1, 0x00DE, 600},
     {251, 0x00DF, 600},
-    {-1, 0x00CF, 600},
+    {-1, 0x00E0, 600},
+    {-1, 0x00E1, 600},
+    {-1, 0x00E2, 600},
+    {-1, 0x00E3, 600},
+    {-1, 0x00E4, 600},
+    {-1, 0x00E5, 600},
+    {241, 0x00E6, 600},
+    {-1, 0x00E7, 600},
+    {-1, 0x00E8, 600},
     {-1, 0x00E9, 600},
-    {-1, 0x0103, 600},
-    {-1, 0x0171, 600},
-    {-1, 0x011B, 600},
-    {-1, 0x0178, 600},
+    {-1, 0x00EA, 600},
+    {-1, 0x00EB, 600},
+    {-1, 0x00EC, 600},
+    {-1, 0x00ED, 600},
+    {-1, 0x00EE, 600},
+    {-1, 0x00EF, 600},
+    {-1, 0x00F0, 600},
+    {-1, 0x00F1, 600},
+    {-1, 0x00F2, 600},
+    {-1, 0x00F3, 600},
+    {-1, 0x00F4, 600},
+    {-1, 0x00F5, 600},
+    {-1, 0x00F6, 600},
     {-1, 0x00F7, 600},
-    {-1, 0x00DD, 600},
-    {-1, 0x00C2, 600},
-    {-1, 0x00E1, 600},
-    {-1, 0x00DB, 600},
+    {249, 0x00F8, 600},
+    {-1, 0x00F9, 600},
+    {-1, 0x00FA, 600},
+    {-1, 0x00FB, 600},
+    {-1, 0x00FC, 600},
     {-1, 0x00FD, 600},
-    {-1, 0x0219, 600},
-    {-1, 0x00EA, 600},
-    {-1, 0x016E, 600},
-    {-1, 0x00DC, 600},
+    {-1, 0x00FE, 600},
+    {-1, 0x00FF, 600},
+    {-1, 0x0100, 600},
+    {-1, 0x0101, 600},
+    {-1, 0x0102, 600},
+    {-1, 0x0103, 600},
+    {-1, 0x0104, 600},
     {-1, 0x0105, 600},
-    {-1, 0x00DA, 600},
-    {-1, 0x0173, 600},
-    {-1, 0x00CB, 600},
+    {-1, 0x0106, 600},
+    {-1, 0x0107, 600},
+    {-1, 0x010C, 600},
+    {-1, 0x010D, 600},
+    {-1, 0x010E, 600},
+    {-1, 0x010F, 600},
     {-1, 0x0110, 600},
-    {-1, 0xF6C3, 600},
-    {-1, 0x00A9, 600},
+    {-1, 0x0111, 600},
     {-1, 0x0112, 600},
-    {-1, 0x010D, 600},
-    {-1, 0x00E5, 600},
-    {-1, 0x0145, 600},
-    {-1, 0x013A, 600},
-    {-1, 0x00E0, 600},
-    {-1, 0x0162, 600},
-    {-1, 0x0106, 600},
-    {-1, 0x00E3, 600},
+    {-1, 0x0113, 600},
     {-1, 0x0116, 600},
-    {-1, 0x0161, 600},
-    {-1, 0x015F, 600},
-    {-1, 0x00ED, 600},
-    {-1, 0x25CA, 600},
-    {-1, 0x0158, 600},
+    {-1, 0x0117, 600},
+    {-1, 0x0118, 600},
+    {-1, 0x0119, 600},
+    {-1, 0x011A, 600},
+    {-1, 0x011B, 600},
+    {-1, 0x011E, 600},
+    {-1, 0x011F, 600},
     {-1, 0x0122, 600},
-    {-1, 0x00FB, 600},
-    {-1, 0x00E2, 600},
-    {-1, 0x0100, 600},
-    {-1, 0x0159, 600},
-    {-1, 0x00E7, 600},
-    {-1, 0x017B, 600},
-    {-1, 0x00DE, 600},
+    {-1, 0x0123, 600},
+    {-1, 0x012A, 600},
+    {-1, 0x012B, 600},
+    {-1, 0x012E, 600},
+    {-1, 0x012F, 600},
+    {-1, 0x0130, 600},
+    {245, 0x0131, 600},
+    {-1, 0x0136, 600},
+    {-1, 0x0137, 600},
+    {-1, 0x0139, 600},
+    {-1, 0x013A, 600},
+    {-1, 0x013B, 600},
+    {-1, 0x013C, 600},
+    {-1, 0x013D, 600},
+    {-1, 0x013E, 600},
+    {232, 0x0141, 600},
+    {248, 0x0142, 600},
+    {-1, 0x0143, 600},
+    {-1, 0x0144, 600},
+    {-1, 0x0145, 600},
+    {-1, 0x0146, 600},
+    {-1, 0x0147, 600},
+    {-1, 0x0148, 600},
     {-1, 0x014C, 600},
+    {-1, 0x014D, 600},
+    {-1, 0x0150, 600},
+    {-1, 0x0151, 600},
+    {234, 0x0152, 600},
+    {250, 0x0153, 600},
     {-1, 0x0154, 600},
+    {-1, 0x0155, 600},
+    {-1, 0x0156, 600},
+    {-1, 0x0157, 600},
+    {-1, 0x0158, 600},
+    {-1, 0x0159, 600},
     {-1, 0x015A, 600},
-    {-1, 0x010F, 600},
-    {-1, 0x016A, 600},
-    {-1, 0x016F, 600},
-    {-1, 0x00B3, 600},
-    {-1, 0x00D2, 600},
-    {-1, 0x00C0, 600},
-    {-1, 0x0102, 600},
-    {-1, 0x00D7, 600},
-    {-1, 0x00FA, 600},
+    {-1, 0x015B, 600},
+    {-1, 0x015E, 600},
+    {-1, 0x015F, 600},
+    {-1, 0x0160, 600},
+    {-1, 0x0161, 600},
+    {-1, 0x0162, 600},
+    {-1, 0x0163, 600},
     {-1, 0x0164, 600},
-    {-1, 0x2202, 600},
-    {-1, 0x00FF, 600},
-    {-1, 0x0143, 600},
-    {-1, 0x00EE, 600},
-    {-1, 0x00CA, 600},
-    {-1, 0x00E4, 600},
-    {-1, 0x00EB, 600},
-    {-1, 0x0107, 600},
-    {-1, 0x0144, 600},
+    {-1, 0x0165, 600},
+    {-1, 0x016A, 600},
     {-1, 0x016B, 600},
-    {-1, 0x0147, 600},
-    {-1, 0x00CD, 600},
-    {-1, 0x00B1, 600},
-    {-1, 0x00A6, 600},
-    {-1, 0x00AE, 600},
-    {-1, 0x011E, 600},
-    {-1, 0x0130, 600},
-    {-1, 0x2211, 600},
-    {-1, 0x00C8, 600},
-    {-1, 0x0155, 600},
-    {-1, 0x014D, 600},
-    {-1, 0x0179, 600},
-    {-1, 0x017D, 600},
-    {-1, 0x2265, 600},
-    {-1, 0x00D0, 600},
-    {-1, 0x00C7, 600},
-    {-1, 0x013C, 600},
-    {-1, 0x0165, 600},
-    {-1, 0x0119, 600},
+    {-1, 0x016E, 600},
+    {-1, 0x016F, 600},
+    {-1, 0x0170, 600},
+    {-1, 0x0171, 600},
     {-1, 0x0172, 600},
-    {-1, 0x00C1, 600},
-    {-1, 0x00C4, 600},
-    {-1, 0x00E8, 600},
+    {-1, 0x0173, 600},
+    {-1, 0x0178, 600},
+    {-1, 0x0179, 600},
     {-1, 0x017A, 600},
-    {-1, 0x012F, 600},
-    {-1, 0x00D3, 600},
-    {-1, 0x00F3, 600},
-    {-1, 0x0101, 600},
-    {-1, 0x015B, 600},
-    {-1, 0x00EF, 600},
-    {-1, 0x00D4, 600},
-    {-1, 0x00D9, 600},
+    {-1, 0x017B, 600},
+    {-1, 0x017C, 600},
+    {-1, 0x017D, 600},
+    {-1, 0x017E, 600},
+    {166, 0x0192, 600},
+    {-1, 0x0218, 600},
+    {-1, 0x0219, 600},
+    {195, 0x02C6, 600},
+    {207, 0x02C7, 600},
+    {198, 0x02D8, 600},
+    {199, 0x02D9, 600},
+    {202, 0x02DA, 600},
+    {206, 0x02DB, 600},
+    {196, 0x02DC, 600},
+    {205, 0x02DD, 600},
     {-1, 0x0394, 600},
-    {-1, 0x00FE, 600},
-    {-1, 0x00B2, 600},
-    {-1, 0x00D6, 600},
-    {-1, 0x00B5, 600},
-    {-1, 0x00EC, 600},
-    {-1, 0x0151, 600},
-    {-1, 0x0118, 600},
-    {-1, 0x0111, 600},
-    {-1, 0x00BE, 600},
-    {-1, 0x015E, 600},
-    {-1, 0x013E, 600},
-    {-1, 0x0136, 600},
-    {-1, 0x0139, 600},
+    {177, 0x2013, 600},
+    {208, 0x2014, 600},
+    {96, 0x2018, 600},
+    {39, 0x2019, 600},
+    {184, 0x201A, 600},
+    {170, 0x201C, 600},
+    {186, 0x201D, 600},
+    {185, 0x201E, 600},
+    {178, 0x2020, 600},
+    {179, 0x2021, 600},
+    {183, 0x2022, 600},
+    {188, 0x2026, 600},
+    {189, 0x2030, 600},
+    {172, 0x2039, 600},
+    {173, 0x203A, 600},
+    {164, 0x2044, 600},
+    {-1, 0x20AC, 600},
     {-1, 0x2122, 600},
-    {-1, 0x0117, 600},
-    {-1, 0x00CC, 600},
-    {-1, 0x012A, 600},
-    {-1, 0x013D, 600},
-    {-1, 0x00BD, 600},
-    {-1, 0x2264, 600},
-    {-1, 0x00F4, 600},
-    {-1, 0x00F1, 600},
-    {-1, 0x0170, 600},
-    {-1, 0x00C9, 600},
-    {-1, 0x0113, 600},
-    {-1, 0x011F, 600},
-    {-1, 0x00BC, 600},
-    {-1, 0x0160, 600},
-    {-1, 0x0218, 600},
-    {-1, 0x0150, 600},
-    {-1, 0x00B0, 600},
-    {-1, 0x00F2, 600},
-    {-1, 0x010C, 600},
-    {-1, 0x00F9, 600},
-    {-1, 0x221A, 600},
-    {-1, 0x010E, 600},
-    {-1, 0x0157, 600},
-    {-1, 0x00D1, 600},
-    {-1, 0x00F5, 600},
-    {-1, 0x0156, 600},
-    {-1, 0x013B, 600},
-    {-1, 0x00C3, 600},
-    {-1, 0x0104, 600},
-    {-1, 0x00C5, 600},
-    {-1, 0x00D5, 600},
-    {-1, 0x017C, 600},
-    {-1, 0x011A, 600},
-    {-1, 0x012E, 600},
-    {-1, 0x0137, 600},
+    {-1, 0x2202, 600},
+    {-1, 0x2211, 600},
     {-1, 0x2212, 600},
-    {-1, 0x00CE, 600},
-    {-1, 0x0148, 600},
-    {-1, 0x0163, 600},
-    {-1, 0x00AC, 600},
-    {-1, 0x00F6, 600},
-    {-1, 0x00FC, 600},
+    {-1, 0x221A, 600},
     {-1, 0x2260, 600},
-    {-1, 0x0123, 600},
-    {-1, 0x00F0, 600},
-    {-1, 0x017E, 600},
-    {-1, 0x0146, 600},
-    {-1, 0x00B9, 600},
-    {-1, 0x012B, 600},
-    {-1, 0x20AC, 600},
+    {-1, 0x2264, 600},
+    {-1, 0x2265, 600},
+    {-1, 0x25CA, 600},
+    {-1, 0xF6C3, 600},
+    {174, 0xFB01, 600},
+    {175, 0xFB02, 600},
     {-1, 0xFFFF, 0}
     };
 
@@ -346,7 +350,7 @@ static const HPDF_CharData CHAR_DATA_COURIER_BOLD[316] = {
     {36, 0x0024, 600},
     {37, 0x0025, 600},
     {38, 0x0026, 600},
-    {39, 0x2019, 600},
+    {169, 0x0027, 600},
     {40, 0x0028, 600},
     {41, 0x0029, 600},
     {42, 0x002A, 600},
@@ -403,7 +407,7 @@ static const HPDF_CharData CHAR_DATA_COURIER_BOLD[316] = {
     {93, 0x005D, 600},
     {94, 0x005E, 600},
     {95, 0x005F, 600},
-    {96, 0x2018, 600},
+    {193, 0x0060, 600},
     {97, 0x0061, 600},
     {98, 0x0062, 600},
     {99, 0x0063, 600},
@@ -437,223 +441,223 @@ static const HPDF_CharData CHAR_DATA_COURIER_BOLD[316] = {
     {161, 0x00A1, 600},
     {162, 0x00A2, 600},
     {163, 0x00A3, 600},
-    {164, 0x2044, 600},
+    {168, 0x00A4, 600},
     {165, 0x00A5, 600},
-    {166, 0x0192, 600},
+    {-1, 0x00A6, 600},
     {167, 0x00A7, 600},
-    {168, 0x00A4, 600},
-    {169, 0x0027, 600},
-    {170, 0x201C, 600},
+    {200, 0x00A8, 600},
+    {-1, 0x00A9, 600},
+    {227, 0x00AA, 600},
     {171, 0x00AB, 600},
-    {172, 0x2039, 600},
-    {173, 0x203A, 600},
-    {174, 0xFB01, 600},
-    {175, 0xFB02, 600},
-    {177, 0x2013, 600},
-    {178, 0x2020, 600},
-    {179, 0x2021, 600},
-    {180, 0x00B7, 600},
+    {-1, 0x00AC, 600},
+    {-1, 0x00AE, 600},
+    {197, 0x00AF, 600},
+    {-1, 0x00B0, 600},
+    {-1, 0x00B1, 600},
+    {-1, 0x00B2, 600},
+    {-1, 0x00B3, 600},
+    {194, 0x00B4, 600},
+    {-1, 0x00B5, 600},
     {182, 0x00B6, 600},
-    {183, 0x2022, 600},
-    {184, 0x201A, 600},
-    {185, 0x201E, 600},
-    {186, 0x201D, 600},
+    {180, 0x00B7, 600},
+    {203, 0x00B8, 600},
+    {-1, 0x00B9, 600},
+    {235, 0x00BA, 600},
     {187, 0x00BB, 600},
-    {188, 0x2026, 600},
-    {189, 0x2030, 600},
+    {-1, 0x00BC, 600},
+    {-1, 0x00BD, 600},
+    {-1, 0x00BE, 600},
     {191, 0x00BF, 600},
-    {193, 0x0060, 600},
-    {194, 0x00B4, 600},
-    {195, 0x02C6, 600},
-    {196, 0x02DC, 600},
-    {197, 0x00AF, 600},
-    {198, 0x02D8, 600},
-    {199, 0x02D9, 600},
-    {200, 0x00A8, 600},
-    {202, 0x02DA, 600},
-    {203, 0x00B8, 600},
-    {205, 0x02DD, 600},
-    {206, 0x02DB, 600},
-    {207, 0x02C7, 600},
-    {208, 0x2014, 600},
+    {-1, 0x00C0, 600},
+    {-1, 0x00C1, 600},
+    {-1, 0x00C2, 600},
+    {-1, 0x00C3, 600},
+    {-1, 0x00C4, 600},
+    {-1, 0x00C5, 600},
     {225, 0x00C6, 600},
-    {227, 0x00AA, 600},
-    {232, 0x0141, 600},
-    {233, 0x00D8, 600},
-    {234, 0x0152, 600},
-    {235, 0x00BA, 600},
-    {241, 0x00E6, 600},
-    {245, 0x0131, 600},
-    {248, 0x0142, 600},
-    {249, 0x00F8, 600},
-    {250, 0x0153, 600},
-    {251, 0x00DF, 600},
+    {-1, 0x00C7, 600},
+    {-1, 0x00C8, 600},
+    {-1, 0x00C9, 600},
+    {-1, 0x00CA, 600},
+    {-1, 0x00CB, 600},
+    {-1, 0x00CC, 600},
+    {-1, 0x00CD, 600},
+    {-1, 0x00CE, 600},
     {-1, 0x00CF, 600},
-    {-1, 0x00E9, 600},
-    {-1, 0x0103, 600},
-    {-1, 0x0171, 600},
-    {-1, 0x011B, 600},
-    {-1, 0x0178, 600},
-    {-1, 0x00F7, 600},
-    {-1, 0x00DD, 600},
-    {-1, 0x00C2, 600},
-    {-1, 0x00E1, 600},
+    {-1, 0x00D0, 600},
+    {-1, 0x00D1, 600},
+    {-1, 0x00D2, 600},
+    {-1, 0x00D3, 600},
+    {-1, 0x00D4, 600},
+    {-1, 0x00D5, 600},
+    {-1, 0x00D6, 600},
+    {-1, 0x00D7, 600},
+    {233, 0x00D8, 600},
+    {-1, 0x00D9, 600},
+    {-1, 0x00DA, 600},
     {-1, 0x00DB, 600},
-    {-1, 0x00FD, 600},
-    {-1, 0x0219, 600},
-    {-1, 0x00EA, 600},
-    {-1, 0x016E, 600},
     {-1, 0x00DC, 600},
-    {-1, 0x0105, 600},
-    {-1, 0x00DA, 600},
-    {-1, 0x0173, 600},
-    {-1, 0x00CB, 600},
-    {-1, 0x0110, 600},
-    {-1, 0xF6C3, 600},
-    {-1, 0x00A9, 600},
-    {-1, 0x0112, 600},
-    {-1, 0x010D, 600},
-    {-1, 0x00E5, 600},
-    {-1, 0x0145, 600},
-    {-1, 0x013A, 600},
+    {-1, 0x00DD, 600},
+    {-1, 0x00DE, 600},
+    {251, 0x00DF, 600},
     {-1, 0x00E0, 600},
-    {-1, 0x0162, 600},
-    {-1, 0x0106, 600},
+    {-1, 0x00E1, 600},
+    {-1, 0x00E2, 600},
     {-1, 0x00E3, 600},
-    {-1, 0x0116, 600},
-    {-1, 0x0161, 600},
-    {-1, 0x015F, 600},
+    {-1, 0x00E4, 600},
+    {-1, 0x00E5, 600},
+    {241, 0x00E6, 600},
+    {-1, 0x00E7, 600},
+    {-1, 0x00E8, 600},
+    {-1, 0x00E9, 600},
+    {-1, 0x00EA, 600},
+    {-1, 0x00EB, 600},
+    {-1, 0x00EC, 600},
     {-1, 0x00ED, 600},
-    {-1, 0x25CA, 600},
-    {-1, 0x0158, 600},
-    {-1, 0x0122, 600},
+    {-1, 0x00EE, 600},
+    {-1, 0x00EF, 600},
+    {-1, 0x00F0, 600},
+    {-1, 0x00F1, 600},
+    {-1, 0x00F2, 600},
+    {-1, 0x00F3, 600},
+    {-1, 0x00F4, 600},
+    {-1, 0x00F5, 600},
+    {-1, 0x00F6, 600},
+    {-1, 0x00F7, 600},
+    {249, 0x00F8, 600},
+    {-1, 0x00F9, 600},
+    {-1, 0x00FA, 600},
     {-1, 0x00FB, 600},
-    {-1, 0x00E2, 600},
+    {-1, 0x00FC, 600},
+    {-1, 0x00FD, 600},
+    {-1, 0x00FE, 600},
+    {-1, 0x00FF, 600},
     {-1, 0x0100, 600},
-    {-1, 0x0159, 600},
-    {-1, 0x00E7, 600},
-    {-1, 0x017B, 600},
-    {-1, 0x00DE, 600},
-    {-1, 0x014C, 600},
-    {-1, 0x0154, 600},
-    {-1, 0x015A, 600},
-    {-1, 0x010F, 600},
-    {-1, 0x016A, 600},
-    {-1, 0x016F, 600},
-    {-1, 0x00B3, 600},
-    {-1, 0x00D2, 600},
-    {-1, 0x00C0, 600},
+    {-1, 0x0101, 600},
     {-1, 0x0102, 600},
-    {-1, 0x00D7, 600},
-    {-1, 0x00FA, 600},
-    {-1, 0x0164, 600},
-    {-1, 0x2202, 600},
-    {-1, 0x00FF, 600},
-    {-1, 0x0143, 600},
-    {-1, 0x00EE, 600},
-    {-1, 0x00CA, 600},
-    {-1, 0x00E4, 600},
-    {-1, 0x00EB, 600},
+    {-1, 0x0103, 600},
+    {-1, 0x0104, 600},
+    {-1, 0x0105, 600},
+    {-1, 0x0106, 600},
     {-1, 0x0107, 600},
-    {-1, 0x0144, 600},
-    {-1, 0x016B, 600},
-    {-1, 0x0147, 600},
-    {-1, 0x00CD, 600},
-    {-1, 0x00B1, 600},
-    {-1, 0x00A6, 600},
-    {-1, 0x00AE, 600},
-    {-1, 0x011E, 600},
-    {-1, 0x0130, 600},
-    {-1, 0x2211, 600},
-    {-1, 0x00C8, 600},
-    {-1, 0x0155, 600},
-    {-1, 0x014D, 600},
-    {-1, 0x0179, 600},
-    {-1, 0x017D, 600},
-    {-1, 0x2265, 600},
-    {-1, 0x00D0, 600},
-    {-1, 0x00C7, 600},
-    {-1, 0x013C, 600},
-    {-1, 0x0165, 600},
+    {-1, 0x010C, 600},
+    {-1, 0x010D, 600},
+    {-1, 0x010E, 600},
+    {-1, 0x010F, 600},
+    {-1, 0x0110, 600},
+    {-1, 0x0111, 600},
+    {-1, 0x0112, 600},
+    {-1, 0x0113, 600},
+    {-1, 0x0116, 600},
+    {-1, 0x0117, 600},
+    {-1, 0x0118, 600},
     {-1, 0x0119, 600},
-    {-1, 0x0172, 600},
-    {-1, 0x00C1, 600},
-    {-1, 0x00C4, 600},
-    {-1, 0x00E8, 600},
-    {-1, 0x017A, 600},
+    {-1, 0x011A, 600},
+    {-1, 0x011B, 600},
+    {-1, 0x011E, 600},
+    {-1, 0x011F, 600},
+    {-1, 0x0122, 600},
+    {-1, 0x0123, 600},
+    {-1, 0x012A, 600},
+    {-1, 0x012B, 600},
+    {-1, 0x012E, 600},
     {-1, 0x012F, 600},
-    {-1, 0x00D3, 600},
-    {-1, 0x00F3, 600},
-    {-1, 0x0101, 600},
-    {-1, 0x015B, 600},
-    {-1, 0x00EF, 600},
-    {-1, 0x00D4, 600},
-    {-1, 0x00D9, 600},
-    {-1, 0x0394, 600},
-    {-1, 0x00FE, 600},
-    {-1, 0x00B2, 600},
-    {-1, 0x00D6, 600},
-    {-1, 0x00B5, 600},
-    {-1, 0x00EC, 600},
-    {-1, 0x0151, 600},
-    {-1, 0x0118, 600},
-    {-1, 0x0111, 600},
-    {-1, 0x00BE, 600},
-    {-1, 0x015E, 600},
-    {-1, 0x013E, 600},
+    {-1, 0x0130, 600},
+    {245, 0x0131, 600},
     {-1, 0x0136, 600},
+    {-1, 0x0137, 600},
     {-1, 0x0139, 600},
-    {-1, 0x2122, 600},
-    {-1, 0x0117, 600},
-    {-1, 0x00CC, 600},
-    {-1, 0x012A, 600},
+    {-1, 0x013A, 600},
+    {-1, 0x013B, 600},
+    {-1, 0x013C, 600},
     {-1, 0x013D, 600},
-    {-1, 0x00BD, 600},
-    {-1, 0x2264, 600},
-    {-1, 0x00F4, 600},
-    {-1, 0x00F1, 600},
-    {-1, 0x0170, 600},
-    {-1, 0x00C9, 600},
-    {-1, 0x0113, 600},
-    {-1, 0x011F, 600},
-    {-1, 0x00BC, 600},
-    {-1, 0x0160, 600},
-    {-1, 0x0218, 600},
+    {-1, 0x013E, 600},
+    {232, 0x0141, 600},
+    {248, 0x0142, 600},
+    {-1, 0x0143, 600},
+    {-1, 0x0144, 600},
+    {-1, 0x0145, 600},
+    {-1, 0x0146, 600},
+    {-1, 0x0147, 600},
+    {-1, 0x0148, 600},
+    {-1, 0x014C, 600},
+    {-1, 0x014D, 600},
     {-1, 0x0150, 600},
-    {-1, 0x00B0, 600},
-    {-1, 0x00F2, 600},
-    {-1, 0x010C, 600},
-    {-1, 0x00F9, 600},
-    {-1, 0x221A, 600},
-    {-1, 0x010E, 600},
-    {-1, 0x0157, 600},
-    {-1, 0x00D1, 600},
-    {-1, 0x00F5, 600},
+    {-1, 0x0151, 600},
+    {234, 0x0152, 600},
+    {250, 0x0153, 600},
+    {-1, 0x0154, 600},
+    {-1, 0x0155, 600},
     {-1, 0x0156, 600},
-    {-1, 0x013B, 600},
-    {-1, 0x00C3, 600},
-    {-1, 0x0104, 600},
-    {-1, 0x00C5, 600},
-    {-1, 0x00D5, 600},
-    {-1, 0x017C, 600},
-    {-1, 0x011A, 600},
-    {-1, 0x012E, 600},
-    {-1, 0x0137, 600},
-    {-1, 0x2212, 600},
-    {-1, 0x00CE, 600},
-    {-1, 0x0148, 600},
+    {-1, 0x0157, 600},
+    {-1, 0x0158, 600},
+    {-1, 0x0159, 600},
+    {-1, 0x015A, 600},
+    {-1, 0x015B, 600},
+    {-1, 0x015E, 600},
+    {-1, 0x015F, 600},
+    {-1, 0x0160, 600},
+    {-1, 0x0161, 600},
+    {-1, 0x0162, 600},
     {-1, 0x0163, 600},
-    {-1, 0x00AC, 600},
-    {-1, 0x00F6, 600},
-    {-1, 0x00FC, 600},
-    {-1, 0x2260, 600},
-    {-1, 0x0123, 600},
-    {-1, 0x00F0, 600},
+    {-1, 0x0164, 600},
+    {-1, 0x0165, 600},
+    {-1, 0x016A, 600},
+    {-1, 0x016B, 600},
+    {-1, 0x016E, 600},
+    {-1, 0x016F, 600},
+    {-1, 0x0170, 600},
+    {-1, 0x0171, 600},
+    {-1, 0x0172, 600},
+    {-1, 0x0173, 600},
+    {-1, 0x0178, 600},
+    {-1, 0x0179, 600},
+    {-1, 0x017A, 600},
+    {-1, 0x017B, 600},
+    {-1, 0x017C, 600},
+    {-1, 0x017D, 600},
     {-1, 0x017E, 600},
-    {-1, 0x0146, 600},
-    {-1, 0x00B9, 600},
-    {-1, 0x012B, 600},
+    {166, 0x0192, 600},
+    {-1, 0x0218, 600},
+    {-1, 0x0219, 600},
+    {195, 0x02C6, 600},
+    {207, 0x02C7, 600},
+    {198, 0x02D8, 600},
+    {199, 0x02D9, 600},
+    {202, 0x02DA, 600},
+    {206, 0x02DB, 600},
+    {196, 0x02DC, 600},
+    {205, 0x02DD, 600},
+    {-1, 0x0394, 600},
+    {177, 0x2013, 600},
+    {208, 0x2014, 600},
+    {96, 0x2018, 600},
+    {39, 0x2019, 600},
+    {184, 0x201A, 600},
+    {170, 0x201C, 600},
+    {186, 0x201D, 600},
+    {185, 0x201E, 600},
+    {178, 0x2020, 600},
+    {179, 0x2021, 600},
+    {183, 0x2022, 600},
+    {188, 0x2026, 600},
+    {189, 0x2030, 600},
+    {172, 0x2039, 600},
+    {173, 0x203A, 600},
+    {164, 0x2044, 600},
     {-1, 0x20AC, 600},
+    {-1, 0x2122, 600},
+    {-1, 0x2202, 600},
+    {-1, 0x2211, 600},
+    {-1, 0x2212, 600},
+    {-1, 0x221A, 600},
+    {-1, 0x2260, 600},
+    {-1, 0x2264, 600},
+    {-1, 0x2265, 600},
+    {-1, 0x25CA, 600},
+    {-1, 0xF6C3, 600},
+    {174, 0xFB01, 600},
+    {175, 0xFB02, 600},
     {-1, 0xFFFF, 0}
     };
 
@@ -665,7 +669,7 @@ static const HPDF_CharData CHAR_DATA_COURIER_BOLD_OBLIQUE[316] = {
     {36, 0x0024, 600},
     {37, 0x0025, 600},
     {38, 0x0026, 600},
-    {39, 0x2019, 600},
+    {169, 0x0027, 600},
     {40, 0x0028, 600},
     {41, 0x0029, 600},
     {42, 0x002A, 600},
@@ -722,7 +726,7 @@ static const HPDF_CharData CHAR_DATA_COURIER_BOLD_OBLIQUE[316] = {
     {93, 0x005D, 600},
     {94, 0x005E, 600},
     {95, 0x005F, 600},
-    {96, 0x2018, 600},
+    {193, 0x0060, 600},
     {97, 0x0061, 600},
     {98, 0x0062, 600},
     {99, 0x0063, 600},
@@ -756,223 +760,223 @@ static const HPDF_CharData CHAR_DATA_COURIER_BOLD_OBLIQUE[316] = {
     {161, 0x00A1, 600},
     {162, 0x00A2, 600},
     {163, 0x00A3, 600},
-    {164, 0x2044, 600},
+    {168, 0x00A4, 600},
     {165, 0x00A5, 600},
-    {166, 0x0192, 600},
+    {-1, 0x00A6, 600},
     {167, 0x00A7, 600},
-    {168, 0x00A4, 600},
-    {169, 0x0027, 600},
-    {170, 0x201C, 600},
+    {200, 0x00A8, 600},
+    {-1, 0x00A9, 600},
+    {227, 0x00AA, 600},
     {171, 0x00AB, 600},
-    {172, 0x2039, 600},
-    {173, 0x203A, 600},
-    {174, 0xFB01, 600},
-    {175, 0xFB02, 600},
-    {177, 0x2013, 600},
-    {178, 0x2020, 600},
-    {179, 0x2021, 600},
-    {180, 0x00B7, 600},
+    {-1, 0x00AC, 600},
+    {-1, 0x00AE, 600},
+    {197, 0x00AF, 600},
+    {-1, 0x00B0, 600},
+    {-1, 0x00B1, 600},
+    {-1, 0x00B2, 600},
+    {-1, 0x00B3, 600},
+    {194, 0x00B4, 600},
+    {-1, 0x00B5, 600},
     {182, 0x00B6, 600},
-    {183, 0x2022, 600},
-    {184, 0x201A, 600},
-    {185, 0x201E, 600},
-    {186, 0x201D, 600},
+    {180, 0x00B7, 600},
+    {203, 0x00B8, 600},
+    {-1, 0x00B9, 600},
+    {235, 0x00BA, 600},
     {187, 0x00BB, 600},
-    {188, 0x2026, 600},
-    {189, 0x2030, 600},
+    {-1, 0x00BC, 600},
+    {-1, 0x00BD, 600},
+    {-1, 0x00BE, 600},
     {191, 0x00BF, 600},
-    {193, 0x0060, 600},
-    {194, 0x00B4, 600},
-    {195, 0x02C6, 600},
-    {196, 0x02DC, 600},
-    {197, 0x00AF, 600},
-    {198, 0x02D8, 600},
-    {199, 0x02D9, 600},
-    {200, 0x00A8, 600},
-    {202, 0x02DA, 600},
-    {203, 0x00B8, 600},
-    {205, 0x02DD, 600},
-    {206, 0x02DB, 600},
-    {207, 0x02C7, 600},
-    {208, 0x2014, 600},
+    {-1, 0x00C0, 600},
+    {-1, 0x00C1, 600},
+    {-1, 0x00C2, 600},
+    {-1, 0x00C3, 600},
+    {-1, 0x00C4, 600},
+    {-1, 0x00C5, 600},
     {225, 0x00C6, 600},
-    {227, 0x00AA, 600},
-    {232, 0x0141, 600},
+    {-1, 0x00C7, 600},
+    {-1, 0x00C8, 600},
+    {-1, 0x00C9, 600},
+    {-1, 0x00CA, 600},
+    {-1, 0x00CB, 600},
+    {-1, 0x00CC, 600},
+    {-1, 0x00CD, 600},
+    {-1, 0x00CE, 600},
+    {-1, 0x00CF, 600},
+    {-1, 0x00D0, 600},
+    {-1, 0x00D1, 600},
+    {-1, 0x00D2, 600},
+    {-1, 0x00D3, 600},
+    {-1, 0x00D4, 600},
+    {-1, 0x00D5, 600},
+    {-1, 0x00D6, 600},
+    {-1, 0x00D7, 600},
     {233, 0x00D8, 600},
-    {234, 0x0152, 600},
-    {235, 0x00BA, 600},
-    {241, 0x00E6, 600},
-    {245, 0x0131, 600},
-    {248, 0x0142, 600},
-    {249, 0x00F8, 600},
-    {250, 0x0153, 600},
+    {-1, 0x00D9, 600},
+    {-1, 0x00DA, 600},
+    {-1, 0x00DB, 600},
+    {-1, 0x00DC, 600},
+    {-1, 0x00DD, 600},
+    {-1, 0x00DE, 600},
     {251, 0x00DF, 600},
-    {-1, 0x00CF, 600},
+    {-1, 0x00E0, 600},
+    {-1, 0x00E1, 600},
+    {-1, 0x00E2, 600},
+    {-1, 0x00E3, 600},
+    {-1, 0x00E4, 600},
+    {-1, 0x00E5, 600},
+    {241, 0x00E6, 600},
+    {-1, 0x00E7, 600},
+    {-1, 0x00E8, 600},
     {-1, 0x00E9, 600},
-    {-1, 0x0103, 600},
-    {-1, 0x0171, 600},
-    {-1, 0x011B, 600},
-    {-1, 0x0178, 600},
+    {-1, 0x00EA, 600},
+    {-1, 0x00EB, 600},
+    {-1, 0x00EC, 600},
+    {-1, 0x00ED, 600},
+    {-1, 0x00EE, 600},
+    {-1, 0x00EF, 600},
+    {-1, 0x00F0, 600},
+    {-1, 0x00F1, 600},
+    {-1, 0x00F2, 600},
+    {-1, 0x00F3, 600},
+    {-1, 0x00F4, 600},
+    {-1, 0x00F5, 600},
+    {-1, 0x00F6, 600},
     {-1, 0x00F7, 600},
-    {-1, 0x00DD, 600},
-    {-1, 0x00C2, 600},
-    {-1, 0x00E1, 600},
-    {-1, 0x00DB, 600},
+    {249, 0x00F8, 600},
+    {-1, 0x00F9, 600},
+    {-1, 0x00FA, 600},
+    {-1, 0x00FB, 600},
+    {-1, 0x00FC, 600},
     {-1, 0x00FD, 600},
-    {-1, 0x0219, 600},
-    {-1, 0x00EA, 600},
-    {-1, 0x016E, 600},
-    {-1, 0x00DC, 600},
+    {-1, 0x00FE, 600},
+    {-1, 0x00FF, 600},
+    {-1, 0x0100, 600},
+    {-1, 0x0101, 600},
+    {-1, 0x0102, 600},
+    {-1, 0x0103, 600},
+    {-1, 0x0104, 600},
     {-1, 0x0105, 600},
-    {-1, 0x00DA, 600},
-    {-1, 0x0173, 600},
-    {-1, 0x00CB, 600},
+    {-1, 0x0106, 600},
+    {-1, 0x0107, 600},
+    {-1, 0x010C, 600},
+    {-1, 0x010D, 600},
+    {-1, 0x010E, 600},
+    {-1, 0x010F, 600},
     {-1, 0x0110, 600},
-    {-1, 0xF6C3, 600},
-    {-1, 0x00A9, 600},
+    {-1, 0x0111, 600},
     {-1, 0x0112, 600},
-    {-1, 0x010D, 600},
-    {-1, 0x00E5, 600},
-    {-1, 0x0145, 600},
-    {-1, 0x013A, 600},
-    {-1, 0x00E0, 600},
-    {-1, 0x0162, 600},
-    {-1, 0x0106, 600},
-    {-1, 0x00E3, 600},
+    {-1, 0x0113, 600},
     {-1, 0x0116, 600},
-    {-1, 0x0161, 600},
-    {-1, 0x015F, 600},
-    {-1, 0x00ED, 600},
-    {-1, 0x25CA, 600},
-    {-1, 0x0158, 600},
+    {-1, 0x0117, 600},
+    {-1, 0x0118, 600},
+    {-1, 0x0119, 600},
+    {-1, 0x011A, 600},
+    {-1, 0x011B, 600},
+    {-1, 0x011E, 600},
+    {-1, 0x011F, 600},
     {-1, 0x0122, 600},
-    {-1, 0x00FB, 600},
-    {-1, 0x00E2, 600},
-    {-1, 0x0100, 600},
-    {-1, 0x0159, 600},
-    {-1, 0x00E7, 600},
-    {-1, 0x017B, 600},
-    {-1, 0x00DE, 600},
+    {-1, 0x0123, 600},
+    {-1, 0x012A, 600},
+    {-1, 0x012B, 600},
+    {-1, 0x012E, 600},
+    {-1, 0x012F, 600},
+    {-1, 0x0130, 600},
+    {245, 0x0131, 600},
+    {-1, 0x0136, 600},
+    {-1, 0x0137, 600},
+    {-1, 0x0139, 600},
+    {-1, 0x013A, 600},
+    {-1, 0x013B, 600},
+    {-1, 0x013C, 600},
+    {-1, 0x013D, 600},
+    {-1, 0x013E, 600},
+    {232, 0x0141, 600},
+    {248, 0x0142, 600},
+    {-1, 0x0143, 600},
+    {-1, 0x0144, 600},
+    {-1, 0x0145, 600},
+    {-1, 0x0146, 600},
+    {-1, 0x0147, 600},
+    {-1, 0x0148, 600},
     {-1, 0x014C, 600},
+    {-1, 0x014D, 600},
+    {-1, 0x0150, 600},
+    {-1, 0x0151, 600},
+    {234, 0x0152, 600},
+    {250, 0x0153, 600},
     {-1, 0x0154, 600},
+    {-1, 0x0155, 600},
+    {-1, 0x0156, 600},
+    {-1, 0x0157, 600},
+    {-1, 0x0158, 600},
+    {-1, 0x0159, 600},
     {-1, 0x015A, 600},
-    {-1, 0x010F, 600},
-    {-1, 0x016A, 600},
-    {-1, 0x016F, 600},
-    {-1, 0x00B3, 600},
-    {-1, 0x00D2, 600},
-    {-1, 0x00C0, 600},
-    {-1, 0x0102, 600},
-    {-1, 0x00D7, 600},
-    {-1, 0x00FA, 600},
+    {-1, 0x015B, 600},
+    {-1, 0x015E, 600},
+    {-1, 0x015F, 600},
+    {-1, 0x0160, 600},
+    {-1, 0x0161, 600},
+    {-1, 0x0162, 600},
+    {-1, 0x0163, 600},
     {-1, 0x0164, 600},
-    {-1, 0x2202, 600},
-    {-1, 0x00FF, 600},
-    {-1, 0x0143, 600},
-    {-1, 0x00EE, 600},
-    {-1, 0x00CA, 600},
-    {-1, 0x00E4, 600},
-    {-1, 0x00EB, 600},
-    {-1, 0x0107, 600},
-    {-1, 0x0144, 600},
+    {-1, 0x0165, 600},
+    {-1, 0x016A, 600},
     {-1, 0x016B, 600},
-    {-1, 0x0147, 600},
-    {-1, 0x00CD, 600},
-    {-1, 0x00B1, 600},
-    {-1, 0x00A6, 600},
-    {-1, 0x00AE, 600},
-    {-1, 0x011E, 600},
-    {-1, 0x0130, 600},
-    {-1, 0x2211, 600},
-    {-1, 0x00C8, 600},
-    {-1, 0x0155, 600},
-    {-1, 0x014D, 600},
-    {-1, 0x0179, 600},
-    {-1, 0x017D, 600},
-    {-1, 0x2265, 600},
-    {-1, 0x00D0, 600},
-    {-1, 0x00C7, 600},
-    {-1, 0x013C, 600},
-    {-1, 0x0165, 600},
-    {-1, 0x0119, 600},
+    {-1, 0x016E, 600},
+    {-1, 0x016F, 600},
+    {-1, 0x0170, 600},
+    {-1, 0x0171, 600},
     {-1, 0x0172, 600},
-    {-1, 0x00C1, 600},
-    {-1, 0x00C4, 600},
-    {-1, 0x00E8, 600},
+    {-1, 0x0173, 600},
+    {-1, 0x0178, 600},
+    {-1, 0x0179, 600},
     {-1, 0x017A, 600},
-    {-1, 0x012F, 600},
-    {-1, 0x00D3, 600},
-    {-1, 0x00F3, 600},
-    {-1, 0x0101, 600},
-    {-1, 0x015B, 600},
-    {-1, 0x00EF, 600},
-    {-1, 0x00D4, 600},
-    {-1, 0x00D9, 600},
+    {-1, 0x017B, 600},
+    {-1, 0x017C, 600},
+    {-1, 0x017D, 600},
+    {-1, 0x017E, 600},
+    {166, 0x0192, 600},
+    {-1, 0x0218, 600},
+    {-1, 0x0219, 600},
+    {195, 0x02C6, 600},
+    {207, 0x02C7, 600},
+    {198, 0x02D8, 600},
+    {199, 0x02D9, 600},
+    {202, 0x02DA, 600},
+    {206, 0x02DB, 600},
+    {196, 0x02DC, 600},
+    {205, 0x02DD, 600},
     {-1, 0x0394, 600},
-    {-1, 0x00FE, 600},
-    {-1, 0x00B2, 600},
-    {-1, 0x00D6, 600},
-    {-1, 0x00B5, 600},
-    {-1, 0x00EC, 600},
-    {-1, 0x0151, 600},
-    {-1, 0x0118, 600},
-    {-1, 0x0111, 600},
-    {-1, 0x00BE, 600},
-    {-1, 0x015E, 600},
-    {-1, 0x013E, 600},
-    {-1, 0x0136, 600},
-    {-1, 0x0139, 600},
+    {177, 0x2013, 600},
+    {208, 0x2014, 600},
+    {96, 0x2018, 600},
+    {39, 0x2019, 600},
+    {184, 0x201A, 600},
+    {170, 0x201C, 600},
+    {186, 0x201D, 600},
+    {185, 0x201E, 600},
+    {178, 0x2020, 600},
+    {179, 0x2021, 600},
+    {183, 0x2022, 600},
+    {188, 0x2026, 600},
+    {189, 0x2030, 600},
+    {172, 0x2039, 600},
+    {173, 0x203A, 600},
+    {164, 0x2044, 600},
+    {-1, 0x20AC, 600},
     {-1, 0x2122, 600},
-    {-1, 0x0117, 600},
-    {-1, 0x00CC, 600},
-    {-1, 0x012A, 600},
-    {-1, 0x013D, 600},
-    {-1, 0x00BD, 600},
-    {-1, 0x2264, 600},
-    {-1, 0x00F4, 600},
-    {-1, 0x00F1, 600},
-    {-1, 0x0170, 600},
-    {-1, 0x00C9, 600},
-    {-1, 0x0113, 600},
-    {-1, 0x011F, 600},
-    {-1, 0x00BC, 600},
-    {-1, 0x0160, 600},
-    {-1, 0x0218, 600},
-    {-1, 0x0150, 600},
-    {-1, 0x00B0, 600},
-    {-1, 0x00F2, 600},
-    {-1, 0x010C, 600},
-    {-1, 0x00F9, 600},
-    {-1, 0x221A, 600},
-    {-1, 0x010E, 600},
-    {-1, 0x0157, 600},
-    {-1, 0x00D1, 600},
-    {-1, 0x00F5, 600},
-    {-1, 0x0156, 600},
-    {-1, 0x013B, 600},
-    {-1, 0x00C3, 600},
-    {-1, 0x0104, 600},
-    {-1, 0x00C5, 600},
-    {-1, 0x00D5, 600},
-    {-1, 0x017C, 600},
-    {-1, 0x011A, 600},
-    {-1, 0x012E, 600},
-    {-1, 0x0137, 600},
+    {-1, 0x2202, 600},
+    {-1, 0x2211, 600},
     {-1, 0x2212, 600},
-    {-1, 0x00CE, 600},
-    {-1, 0x0148, 600},
-    {-1, 0x0163, 600},
-    {-1, 0x00AC, 600},
-    {-1, 0x00F6, 600},
-    {-1, 0x00FC, 600},
+    {-1, 0x221A, 600},
     {-1, 0x2260, 600},
-    {-1, 0x0123, 600},
-    {-1, 0x00F0, 600},
-    {-1, 0x017E, 600},
-    {-1, 0x0146, 600},
-    {-1, 0x00B9, 600},
-    {-1, 0x012B, 600},
-    {-1, 0x20AC, 600},
+    {-1, 0x2264, 600},
+    {-1, 0x2265, 600},
+    {-1, 0x25CA, 600},
+    {-1, 0xF6C3, 600},
+    {174, 0xFB01, 600},
+    {175, 0xFB02, 600},
     {-1, 0xFFFF, 0}
     };
 
@@ -984,7 +988,7 @@ static const HPDF_CharData CHAR_DATA_COURIER_OBLIQUE[316] = {
     {36, 0x0024, 600},
     {37, 0x0025, 600},
     {38, 0x0026, 600},
-    {39, 0x2019, 600},
+    {169, 0x0027, 600},
     {40, 0x0028, 600},
     {41, 0x0029, 600},
     {42, 0x002A, 600},
@@ -1041,7 +1045,7 @@ static const HPDF_CharData CHAR_DATA_COURIER_OBLIQUE[316] = {
     {93, 0x005D, 600},
     {94, 0x005E, 600},
     {95, 0x005F, 600},
-    {96, 0x2018, 600},
+    {193, 0x0060, 600},
     {97, 0x0061, 600},
     {98, 0x0062, 600},
     {99, 0x0063, 600},
@@ -1075,223 +1079,223 @@ static const HPDF_CharData CHAR_DATA_COURIER_OBLIQUE[316] = {
     {161, 0x00A1, 600},
     {162, 0x00A2, 600},
     {163, 0x00A3, 600},
-    {164, 0x2044, 600},
+    {168, 0x00A4, 600},
     {165, 0x00A5, 600},
-    {166, 0x0192, 600},
+    {-1, 0x00A6, 600},
     {167, 0x00A7, 600},
-    {168, 0x00A4, 600},
-    {169, 0x0027, 600},
-    {170, 0x201C, 600},
+    {200, 0x00A8, 600},
+    {-1, 0x00A9, 600},
+    {227, 0x00AA, 600},
     {171, 0x00AB, 600},
-    {172, 0x2039, 600},
-    {173, 0x203A, 600},
-    {174, 0xFB01, 600},
-    {175, 0xFB02, 600},
-    {177, 0x2013, 600},
-    {178, 0x2020, 600},
-    {179, 0x2021, 600},
-    {180, 0x00B7, 600},
+    {-1, 0x00AC, 600},
+    {-1, 0x00AE, 600},
+    {197, 0x00AF, 600},
+    {-1, 0x00B0, 600},
+    {-1, 0x00B1, 600},
+    {-1, 0x00B2, 600},
+    {-1, 0x00B3, 600},
+    {194, 0x00B4, 600},
+    {-1, 0x00B5, 600},
     {182, 0x00B6, 600},
-    {183, 0x2022, 600},
-    {184, 0x201A, 600},
-    {185, 0x201E, 600},
-    {186, 0x201D, 600},
+    {180, 0x00B7, 600},
+    {203, 0x00B8, 600},
+    {-1, 0x00B9, 600},
+    {235, 0x00BA, 600},
     {187, 0x00BB, 600},
-    {188, 0x2026, 600},
-    {189, 0x2030, 600},
+    {-1, 0x00BC, 600},
+    {-1, 0x00BD, 600},
+    {-1, 0x00BE, 600},
     {191, 0x00BF, 600},
-    {193, 0x0060, 600},
-    {194, 0x00B4, 600},
-    {195, 0x02C6, 600},
-    {196, 0x02DC, 600},
-    {197, 0x00AF, 600},
-    {198, 0x02D8, 600},
-    {199, 0x02D9, 600},
-    {200, 0x00A8, 600},
-    {202, 0x02DA, 600},
-    {203, 0x00B8, 600},
-    {205, 0x02DD, 600},
-    {206, 0x02DB, 600},
-    {207, 0x02C7, 600},
-    {208, 0x2014, 600},
+    {-1, 0x00C0, 600},
+    {-1, 0x00C1, 600},
+    {-1, 0x00C2, 600},
+    {-1, 0x00C3, 600},
+    {-1, 0x00C4, 600},
+    {-1, 0x00C5, 600},
     {225, 0x00C6, 600},
-    {227, 0x00AA, 600},
-    {232, 0x0141, 600},
-    {233, 0x00D8, 600},
-    {234, 0x0152, 600},
-    {235, 0x00BA, 600},
-    {241, 0x00E6, 600},
-    {245, 0x0131, 600},
-    {248, 0x0142, 600},
-    {249, 0x00F8, 600},
-    {250, 0x0153, 600},
-    {251, 0x00DF, 600},
+    {-1, 0x00C7, 600},
+    {-1, 0x00C8, 600},
+    {-1, 0x00C9, 600},
+    {-1, 0x00CA, 600},
+    {-1, 0x00CB, 600},
+    {-1, 0x00CC, 600},
+    {-1, 0x00CD, 600},
+    {-1, 0x00CE, 600},
     {-1, 0x00CF, 600},
-    {-1, 0x00E9, 600},
-    {-1, 0x0103, 600},
-    {-1, 0x0171, 600},
-    {-1, 0x011B, 600},
-    {-1, 0x0178, 600},
-    {-1, 0x00F7, 600},
-    {-1, 0x00DD, 600},
-    {-1, 0x00C2, 600},
-    {-1, 0x00E1, 600},
+    {-1, 0x00D0, 600},
+    {-1, 0x00D1, 600},
+    {-1, 0x00D2, 600},
+    {-1, 0x00D3, 600},
+    {-1, 0x00D4, 600},
+    {-1, 0x00D5, 600},
+    {-1, 0x00D6, 600},
+    {-1, 0x00D7, 600},
+    {233, 0x00D8, 600},
+    {-1, 0x00D9, 600},
+    {-1, 0x00DA, 600},
     {-1, 0x00DB, 600},
-    {-1, 0x00FD, 600},
-    {-1, 0x0219, 600},
-    {-1, 0x00EA, 600},
-    {-1, 0x016E, 600},
     {-1, 0x00DC, 600},
-    {-1, 0x0105, 600},
-    {-1, 0x00DA, 600},
-    {-1, 0x0173, 600},
-    {-1, 0x00CB, 600},
-    {-1, 0x0110, 600},
-    {-1, 0xF6C3, 600},
-    {-1, 0x00A9, 600},
-    {-1, 0x0112, 600},
-    {-1, 0x010D, 600},
-    {-1, 0x00E5, 600},
-    {-1, 0x0145, 600},
-    {-1, 0x013A, 600},
+    {-1, 0x00DD, 600},
+    {-1, 0x00DE, 600},
+    {251, 0x00DF, 600},
     {-1, 0x00E0, 600},
-    {-1, 0x0162, 600},
-    {-1, 0x0106, 600},
+    {-1, 0x00E1, 600},
+    {-1, 0x00E2, 600},
     {-1, 0x00E3, 600},
-    {-1, 0x0116, 600},
-    {-1, 0x0161, 600},
-    {-1, 0x015F, 600},
-    {-1, 0x00ED, 600},
-    {-1, 0x25CA, 600},
-    {-1, 0x0158, 600},
-    {-1, 0x0122, 600},
-    {-1, 0x00FB, 600},
-    {-1, 0x00E2, 600},
-    {-1, 0x0100, 600},
-    {-1, 0x0159, 600},
-    {-1, 0x00E7, 600},
-    {-1, 0x017B, 600},
-    {-1, 0x00DE, 600},
-    {-1, 0x014C, 600},
-    {-1, 0x0154, 600},
-    {-1, 0x015A, 600},
-    {-1, 0x010F, 600},
-    {-1, 0x016A, 600},
-    {-1, 0x016F, 600},
-    {-1, 0x00B3, 600},
-    {-1, 0x00D2, 600},
-    {-1, 0x00C0, 600},
-    {-1, 0x0102, 600},
-    {-1, 0x00D7, 600},
-    {-1, 0x00FA, 600},
-    {-1, 0x0164, 600},
-    {-1, 0x2202, 600},
-    {-1, 0x00FF, 600},
-    {-1, 0x0143, 600},
-    {-1, 0x00EE, 600},
-    {-1, 0x00CA, 600},
     {-1, 0x00E4, 600},
-    {-1, 0x00EB, 600},
-    {-1, 0x0107, 600},
-    {-1, 0x0144, 600},
-    {-1, 0x016B, 600},
-    {-1, 0x0147, 600},
-    {-1, 0x00CD, 600},
-    {-1, 0x00B1, 600},
-    {-1, 0x00A6, 600},
-    {-1, 0x00AE, 600},
-    {-1, 0x011E, 600},
-    {-1, 0x0130, 600},
-    {-1, 0x2211, 600},
-    {-1, 0x00C8, 600},
-    {-1, 0x0155, 600},
-    {-1, 0x014D, 600},
-    {-1, 0x0179, 600},
-    {-1, 0x017D, 600},
-    {-1, 0x2265, 600},
-    {-1, 0x00D0, 600},
-    {-1, 0x00C7, 600},
-    {-1, 0x013C, 600},
-    {-1, 0x0165, 600},
-    {-1, 0x0119, 600},
-    {-1, 0x0172, 600},
-    {-1, 0x00C1, 600},
-    {-1, 0x00C4, 600},
+    {-1, 0x00E5, 600},
+    {241, 0x00E6, 600},
+    {-1, 0x00E7, 600},
     {-1, 0x00E8, 600},
-    {-1, 0x017A, 600},
-    {-1, 0x012F, 600},
-    {-1, 0x00D3, 600},
-    {-1, 0x00F3, 600},
-    {-1, 0x0101, 600},
-    {-1, 0x015B, 600},
-    {-1, 0x00EF, 600},
-    {-1, 0x00D4, 600},
-    {-1, 0x00D9, 600},
-    {-1, 0x0394, 600},
-    {-1, 0x00FE, 600},
-    {-1, 0x00B2, 600},
-    {-1, 0x00D6, 600},
-    {-1, 0x00B5, 600},
+    {-1, 0x00E9, 600},
+    {-1, 0x00EA, 600},
+    {-1, 0x00EB, 600},
     {-1, 0x00EC, 600},
-    {-1, 0x0151, 600},
-    {-1, 0x0118, 600},
-    {-1, 0x0111, 600},
-    {-1, 0x00BE, 600},
-    {-1, 0x015E, 600},
-    {-1, 0x013E, 600},
-    {-1, 0x0136, 600},
-    {-1, 0x0139, 600},
-    {-1, 0x2122, 600},
-    {-1, 0x0117, 600},
-    {-1, 0x00CC, 600},
-    {-1, 0x012A, 600},
-    {-1, 0x013D, 600},
-    {-1, 0x00BD, 600},
-    {-1, 0x2264, 600},
-    {-1, 0x00F4, 600},
+    {-1, 0x00ED, 600},
+    {-1, 0x00EE, 600},
+    {-1, 0x00EF, 600},
+    {-1, 0x00F0, 600},
     {-1, 0x00F1, 600},
-    {-1, 0x0170, 600},
-    {-1, 0x00C9, 600},
-    {-1, 0x0113, 600},
-    {-1, 0x011F, 600},
-    {-1, 0x00BC, 600},
-    {-1, 0x0160, 600},
-    {-1, 0x0218, 600},
-    {-1, 0x0150, 600},
-    {-1, 0x00B0, 600},
     {-1, 0x00F2, 600},
-    {-1, 0x010C, 600},
-    {-1, 0x00F9, 600},
-    {-1, 0x221A, 600},
-    {-1, 0x010E, 600},
-    {-1, 0x0157, 600},
-    {-1, 0x00D1, 600},
+    {-1, 0x00F3, 600},
+    {-1, 0x00F4, 600},
     {-1, 0x00F5, 600},
-    {-1, 0x0156, 600},
-    {-1, 0x013B, 600},
-    {-1, 0x00C3, 600},
+    {-1, 0x00F6, 600},
+    {-1, 0x00F7, 600},
+    {249, 0x00F8, 600},
+    {-1, 0x00F9, 600},
+    {-1, 0x00FA, 600},
+    {-1, 0x00FB, 600},
+    {-1, 0x00FC, 600},
+    {-1, 0x00FD, 600},
+    {-1, 0x00FE, 600},
+    {-1, 0x00FF, 600},
+    {-1, 0x0100, 600},
+    {-1, 0x0101, 600},
+    {-1, 0x0102, 600},
+    {-1, 0x0103, 600},
     {-1, 0x0104, 600},
-    {-1, 0x00C5, 600},
-    {-1, 0x00D5, 600},
-    {-1, 0x017C, 600},
+    {-1, 0x0105, 600},
+    {-1, 0x0106, 600},
+    {-1, 0x0107, 600},
+    {-1, 0x010C, 600},
+    {-1, 0x010D, 600},
+    {-1, 0x010E, 600},
+    {-1, 0x010F, 600},
+    {-1, 0x0110, 600},
+    {-1, 0x0111, 600},
+    {-1, 0x0112, 600},
+    {-1, 0x0113, 600},
+    {-1, 0x0116, 600},
+    {-1, 0x0117, 600},
+    {-1, 0x0118, 600},
+    {-1, 0x0119, 600},
     {-1, 0x011A, 600},
+    {-1, 0x011B, 600},
+    {-1, 0x011E, 600},
+    {-1, 0x011F, 600},
+    {-1, 0x0122, 600},
+    {-1, 0x0123, 600},
+    {-1, 0x012A, 600},
+    {-1, 0x012B, 600},
     {-1, 0x012E, 600},
+    {-1, 0x012F, 600},
+    {-1, 0x0130, 600},
+    {245, 0x0131, 600},
+    {-1, 0x0136, 600},
     {-1, 0x0137, 600},
-    {-1, 0x2212, 600},
-    {-1, 0x00CE, 600},
+    {-1, 0x0139, 600},
+    {-1, 0x013A, 600},
+    {-1, 0x013B, 600},
+    {-1, 0x013C, 600},
+    {-1, 0x013D, 600},
+    {-1, 0x013E, 600},
+    {232, 0x0141, 600},
+    {248, 0x0142, 600},
+    {-1, 0x0143, 600},
+    {-1, 0x0144, 600},
+    {-1, 0x0145, 600},
+    {-1, 0x0146, 600},
+    {-1, 0x0147, 600},
     {-1, 0x0148, 600},
+    {-1, 0x014C, 600},
+    {-1, 0x014D, 600},
+    {-1, 0x0150, 600},
+    {-1, 0x0151, 600},
+    {234, 0x0152, 600},
+    {250, 0x0153, 600},
+    {-1, 0x0154, 600},
+    {-1, 0x0155, 600},
+    {-1, 0x0156, 600},
+    {-1, 0x0157, 600},
+    {-1, 0x0158, 600},
+    {-1, 0x0159, 600},
+    {-1, 0x015A, 600},
+    {-1, 0x015B, 600},
+    {-1, 0x015E, 600},
+    {-1, 0x015F, 600},
+    {-1, 0x0160, 600},
+    {-1, 0x0161, 600},
+    {-1, 0x0162, 600},
     {-1, 0x0163, 600},
-    {-1, 0x00AC, 600},
-    {-1, 0x00F6, 600},
-    {-1, 0x00FC, 600},
-    {-1, 0x2260, 600},
-    {-1, 0x0123, 600},
-    {-1, 0x00F0, 600},
+    {-1, 0x0164, 600},
+    {-1, 0x0165, 600},
+    {-1, 0x016A, 600},
+    {-1, 0x016B, 600},
+    {-1, 0x016E, 600},
+    {-1, 0x016F, 600},
+    {-1, 0x0170, 600},
+    {-1, 0x0171, 600},
+    {-1, 0x0172, 600},
+    {-1, 0x0173, 600},
+    {-1, 0x0178, 600},
+    {-1, 0x0179, 600},
+    {-1, 0x017A, 600},
+    {-1, 0x017B, 600},
+    {-1, 0x017C, 600},
+    {-1, 0x017D, 600},
     {-1, 0x017E, 600},
-    {-1, 0x0146, 600},
-    {-1, 0x00B9, 600},
-    {-1, 0x012B, 600},
+    {166, 0x0192, 600},
+    {-1, 0x0218, 600},
+    {-1, 0x0219, 600},
+    {195, 0x02C6, 600},
+    {207, 0x02C7, 600},
+    {198, 0x02D8, 600},
+    {199, 0x02D9, 600},
+    {202, 0x02DA, 600},
+    {206, 0x02DB, 600},
+    {196, 0x02DC, 600},
+    {205, 0x02DD, 600},
+    {-1, 0x0394, 600},
+    {177, 0x2013, 600},
+    {208, 0x2014, 600},
+    {96, 0x2018, 600},
+    {39, 0x2019, 600},
+    {184, 0x201A, 600},
+    {170, 0x201C, 600},
+    {186, 0x201D, 600},
+    {185, 0x201E, 600},
+    {178, 0x2020, 600},
+    {179, 0x2021, 600},
+    {183, 0x2022, 600},
+    {188, 0x2026, 600},
+    {189, 0x2030, 600},
+    {172, 0x2039, 600},
+    {173, 0x203A, 600},
+    {164, 0x2044, 600},
     {-1, 0x20AC, 600},
+    {-1, 0x2122, 600},
+    {-1, 0x2202, 600},
+    {-1, 0x2211, 600},
+    {-1, 0x2212, 600},
+    {-1, 0x221A, 600},
+    {-1, 0x2260, 600},
+    {-1, 0x2264, 600},
+    {-1, 0x2265, 600},
+    {-1, 0x25CA, 600},
+    {-1, 0xF6C3, 600},
+    {174, 0xFB01, 600},
+    {175, 0xFB02, 600},
     {-1, 0xFFFF, 0}
     };
 
@@ -1303,7 +1307,7 @@ static const HPDF_CharData CHAR_DATA_HELVETICA[316] = {
     {36, 0x0024, 556},
     {37, 0x0025, 889},
     {38, 0x0026, 667},
-    {39, 0x2019, 222},
+    {169, 0x0027, 191},
     {40, 0x0028, 333},
     {41, 0x0029, 333},
     {42, 0x002A, 389},
@@ -1360,7 +1364,7 @@ static const HPDF_CharData CHAR_DATA_HELVETICA[316] = {
     {93, 0x005D, 278},
     {94, 0x005E, 469},
     {95, 0x005F, 556},
-    {96, 0x2018, 222},
+    {193, 0x0060, 333},
     {97, 0x0061, 556},
     {98, 0x0062, 556},
     {99, 0x0063, 500},
@@ -1394,223 +1398,223 @@ static const HPDF_CharData CHAR_DATA_HELVETICA[316] = {
     {161, 0x00A1, 333},
     {162, 0x00A2, 556},
     {163, 0x00A3, 556},
-    {164, 0x2044, 167},
+    {168, 0x00A4, 556},
     {165, 0x00A5, 556},
-    {166, 0x0192, 556},
+    {-1, 0x00A6, 260},
     {167, 0x00A7, 556},
-    {168, 0x00A4, 556},
-    {169, 0x0027, 191},
-    {170, 0x201C, 333},
+    {200, 0x00A8, 333},
+    {-1, 0x00A9, 737},
+    {227, 0x00AA, 370},
     {171, 0x00AB, 556},
-    {172, 0x2039, 333},
-    {173, 0x203A, 333},
-    {174, 0xFB01, 500},
-    {175, 0xFB02, 500},
-    {177, 0x2013, 556},
-    {178, 0x2020, 556},
-    {179, 0x2021, 556},
-    {180, 0x00B7, 278},
+    {-1, 0x00AC, 584},
+    {-1, 0x00AE, 737},
+    {197, 0x00AF, 333},
+    {-1, 0x00B0, 400},
+    {-1, 0x00B1, 584},
+    {-1, 0x00B2, 333},
+    {-1, 0x00B3, 333},
+    {194, 0x00B4, 333},
+    {-1, 0x00B5, 556},
     {182, 0x00B6, 537},
-    {183, 0x2022, 350},
-    {184, 0x201A, 222},
-    {185, 0x201E, 333},
-    {186, 0x201D, 333},
+    {180, 0x00B7, 278},
+    {203, 0x00B8, 333},
+    {-1, 0x00B9, 333},
+    {235, 0x00BA, 365},
     {187, 0x00BB, 556},
-    {188, 0x2026, 1000},
-    {189, 0x2030, 1000},
+    {-1, 0x00BC, 834},
+    {-1, 0x00BD, 834},
+    {-1, 0x00BE, 834},
     {191, 0x00BF, 611},
-    {193, 0x0060, 333},
-    {194, 0x00B4, 333},
-    {195, 0x02C6, 333},
-    {196, 0x02DC, 333},
-    {197, 0x00AF, 333},
-    {198, 0x02D8, 333},
-    {199, 0x02D9, 333},
-    {200, 0x00A8, 333},
-    {202, 0x02DA, 333},
-    {203, 0x00B8, 333},
-    {205, 0x02DD, 333},
-    {206, 0x02DB, 333},
-    {207, 0x02C7, 333},
-    {208, 0x2014, 1000},
+    {-1, 0x00C0, 667},
+    {-1, 0x00C1, 667},
+    {-1, 0x00C2, 667},
+    {-1, 0x00C3, 667},
+    {-1, 0x00C4, 667},
+    {-1, 0x00C5, 667},
     {225, 0x00C6, 1000},
-    {227, 0x00AA, 370},
-    {232, 0x0141, 556},
+    {-1, 0x00C7, 722},
+    {-1, 0x00C8, 667},
+    {-1, 0x00C9, 667},
+    {-1, 0x00CA, 667},
+    {-1, 0x00CB, 667},
+    {-1, 0x00CC, 278},
+    {-1, 0x00CD, 278},
+    {-1, 0x00CE, 278},
+    {-1, 0x00CF, 278},
+    {-1, 0x00D0, 722},
+    {-1, 0x00D1, 722},
+    {-1, 0x00D2, 778},
+    {-1, 0x00D3, 778},
+    {-1, 0x00D4, 778},
+    {-1, 0x00D5, 778},
+    {-1, 0x00D6, 778},
+    {-1, 0x00D7, 584},
     {233, 0x00D8, 778},
-    {234, 0x0152, 1000},
-    {235, 0x00BA, 365},
-    {241, 0x00E6, 889},
-    {245, 0x0131, 278},
-    {248, 0x0142, 222},
-    {249, 0x00F8, 611},
-    {250, 0x0153, 944},
+    {-1, 0x00D9, 722},
+    {-1, 0x00DA, 722},
+    {-1, 0x00DB, 722},
+    {-1, 0x00DC, 722},
+    {-1, 0x00DD, 667},
+    {-1, 0x00DE, 667},
     {251, 0x00DF, 611},
-    {-1, 0x00CF, 278},
+    {-1, 0x00E0, 556},
+    {-1, 0x00E1, 556},
+    {-1, 0x00E2, 556},
+    {-1, 0x00E3, 556},
+    {-1, 0x00E4, 556},
+    {-1, 0x00E5, 556},
+    {241, 0x00E6, 889},
+    {-1, 0x00E7, 500},
+    {-1, 0x00E8, 556},
     {-1, 0x00E9, 556},
-    {-1, 0x0103, 556},
-    {-1, 0x0171, 556},
-    {-1, 0x011B, 556},
-    {-1, 0x0178, 667},
+    {-1, 0x00EA, 556},
+    {-1, 0x00EB, 556},
+    {-1, 0x00EC, 278},
+    {-1, 0x00ED, 278},
+    {-1, 0x00EE, 278},
+    {-1, 0x00EF, 278},
+    {-1, 0x00F0, 556},
+    {-1, 0x00F1, 556},
+    {-1, 0x00F2, 556},
+    {-1, 0x00F3, 556},
+    {-1, 0x00F4, 556},
+    {-1, 0x00F5, 556},
+    {-1, 0x00F6, 556},
     {-1, 0x00F7, 584},
-    {-1, 0x00DD, 667},
-    {-1, 0x00C2, 667},
-    {-1, 0x00E1, 556},
-    {-1, 0x00DB, 722},
+    {249, 0x00F8, 611},
+    {-1, 0x00F9, 556},
+    {-1, 0x00FA, 556},
+    {-1, 0x00FB, 556},
+    {-1, 0x00FC, 556},
     {-1, 0x00FD, 500},
-    {-1, 0x0219, 500},
-    {-1, 0x00EA, 556},
-    {-1, 0x016E, 722},
-    {-1, 0x00DC, 722},
+    {-1, 0x00FE, 556},
+    {-1, 0x00FF, 500},
+    {-1, 0x0100, 667},
+    {-1, 0x0101, 556},
+    {-1, 0x0102, 667},
+    {-1, 0x0103, 556},
+    {-1, 0x0104, 667},
     {-1, 0x0105, 556},
-    {-1, 0x00DA, 722},
-    {-1, 0x0173, 556},
-    {-1, 0x00CB, 667},
+    {-1, 0x0106, 722},
+    {-1, 0x0107, 500},
+    {-1, 0x010C, 722},
+    {-1, 0x010D, 500},
+    {-1, 0x010E, 722},
+    {-1, 0x010F, 643},
     {-1, 0x0110, 722},
-    {-1, 0xF6C3, 250},
-    {-1, 0x00A9, 737},
+    {-1, 0x0111, 556},
     {-1, 0x0112, 667},
-    {-1, 0x010D, 500},
-    {-1, 0x00E5, 556},
-    {-1, 0x0145, 722},
-    {-1, 0x013A, 222},
-    {-1, 0x00E0, 556},
-    {-1, 0x0162, 611},
-    {-1, 0x0106, 722},
-    {-1, 0x00E3, 556},
+    {-1, 0x0113, 556},
     {-1, 0x0116, 667},
-    {-1, 0x0161, 500},
-    {-1, 0x015F, 500},
-    {-1, 0x00ED, 278},
-    {-1, 0x25CA, 471},
-    {-1, 0x0158, 722},
+    {-1, 0x0117, 556},
+    {-1, 0x0118, 667},
+    {-1, 0x0119, 556},
+    {-1, 0x011A, 667},
+    {-1, 0x011B, 556},
+    {-1, 0x011E, 778},
+    {-1, 0x011F, 556},
     {-1, 0x0122, 778},
-    {-1, 0x00FB, 556},
-    {-1, 0x00E2, 556},
-    {-1, 0x0100, 667},
-    {-1, 0x0159, 333},
-    {-1, 0x00E7, 500},
-    {-1, 0x017B, 611},
-    {-1, 0x00DE, 667},
+    {-1, 0x0123, 556},
+    {-1, 0x012A, 278},
+    {-1, 0x012B, 278},
+    {-1, 0x012E, 278},
+    {-1, 0x012F, 222},
+    {-1, 0x0130, 278},
+    {245, 0x0131, 278},
+    {-1, 0x0136, 667},
+    {-1, 0x0137, 500},
+    {-1, 0x0139, 556},
+    {-1, 0x013A, 222},
+    {-1, 0x013B, 556},
+    {-1, 0x013C, 222},
+    {-1, 0x013D, 556},
+    {-1, 0x013E, 299},
+    {232, 0x0141, 556},
+    {248, 0x0142, 222},
+    {-1, 0x0143, 722},
+    {-1, 0x0144, 556},
+    {-1, 0x0145, 722},
+    {-1, 0x0146, 556},
+    {-1, 0x0147, 722},
+    {-1, 0x0148, 556},
     {-1, 0x014C, 778},
+    {-1, 0x014D, 556},
+    {-1, 0x0150, 778},
+    {-1, 0x0151, 556},
+    {234, 0x0152, 1000},
+    {250, 0x0153, 944},
     {-1, 0x0154, 722},
+    {-1, 0x0155, 333},
+    {-1, 0x0156, 722},
+    {-1, 0x0157, 333},
+    {-1, 0x0158, 722},
+    {-1, 0x0159, 333},
     {-1, 0x015A, 667},
-    {-1, 0x010F, 643},
-    {-1, 0x016A, 722},
-    {-1, 0x016F, 556},
-    {-1, 0x00B3, 333},
-    {-1, 0x00D2, 778},
-    {-1, 0x00C0, 667},
-    {-1, 0x0102, 667},
-    {-1, 0x00D7, 584},
-    {-1, 0x00FA, 556},
+    {-1, 0x015B, 500},
+    {-1, 0x015E, 667},
+    {-1, 0x015F, 500},
+    {-1, 0x0160, 667},
+    {-1, 0x0161, 500},
+    {-1, 0x0162, 611},
+    {-1, 0x0163, 278},
     {-1, 0x0164, 611},
-    {-1, 0x2202, 476},
-    {-1, 0x00FF, 500},
-    {-1, 0x0143, 722},
-    {-1, 0x00EE, 278},
-    {-1, 0x00CA, 667},
-    {-1, 0x00E4, 556},
-    {-1, 0x00EB, 556},
-    {-1, 0x0107, 500},
-    {-1, 0x0144, 556},
+    {-1, 0x0165, 316},
+    {-1, 0x016A, 722},
     {-1, 0x016B, 556},
-    {-1, 0x0147, 722},
-    {-1, 0x00CD, 278},
-    {-1, 0x00B1, 584},
-    {-1, 0x00A6, 260},
-    {-1, 0x00AE, 737},
-    {-1, 0x011E, 778},
-    {-1, 0x0130, 278},
-    {-1, 0x2211, 600},
-    {-1, 0x00C8, 667},
-    {-1, 0x0155, 333},
-    {-1, 0x014D, 556},
-    {-1, 0x0179, 611},
-    {-1, 0x017D, 611},
-    {-1, 0x2265, 549},
-    {-1, 0x00D0, 722},
-    {-1, 0x00C7, 722},
-    {-1, 0x013C, 222},
-    {-1, 0x0165, 316},
-    {-1, 0x0119, 556},
+    {-1, 0x016E, 722},
+    {-1, 0x016F, 556},
+    {-1, 0x0170, 722},
+    {-1, 0x0171, 556},
     {-1, 0x0172, 722},
-    {-1, 0x00C1, 667},
-    {-1, 0x00C4, 667},
-    {-1, 0x00E8, 556},
+    {-1, 0x0173, 556},
+    {-1, 0x0178, 667},
+    {-1, 0x0179, 611},
     {-1, 0x017A, 500},
-    {-1, 0x012F, 222},
-    {-1, 0x00D3, 778},
-    {-1, 0x00F3, 556},
-    {-1, 0x0101, 556},
-    {-1, 0x015B, 500},
-    {-1, 0x00EF, 278},
-    {-1, 0x00D4, 778},
-    {-1, 0x00D9, 722},
+    {-1, 0x017B, 611},
+    {-1, 0x017C, 500},
+    {-1, 0x017D, 611},
+    {-1, 0x017E, 500},
+    {166, 0x0192, 556},
+    {-1, 0x0218, 667},
+    {-1, 0x0219, 500},
+    {195, 0x02C6, 333},
+    {207, 0x02C7, 333},
+    {198, 0x02D8, 333},
+    {199, 0x02D9, 333},
+    {202, 0x02DA, 333},
+    {206, 0x02DB, 333},
+    {196, 0x02DC, 333},
+    {205, 0x02DD, 333},
     {-1, 0x0394, 612},
-    {-1, 0x00FE, 556},
-    {-1, 0x00B2, 333},
-    {-1, 0x00D6, 778},
-    {-1, 0x00B5, 556},
-    {-1, 0x00EC, 278},
-    {-1, 0x0151, 556},
-    {-1, 0x0118, 667},
-    {-1, 0x0111, 556},
-    {-1, 0x00BE, 834},
-    {-1, 0x015E, 667},
-    {-1, 0x013E, 299},
-    {-1, 0x0136, 667},
-    {-1, 0x0139, 556},
+    {177, 0x2013, 556},
+    {208, 0x2014, 1000},
+    {96, 0x2018, 222},
+    {39, 0x2019, 222},
+    {184, 0x201A, 222},
+    {170, 0x201C, 333},
+    {186, 0x201D, 333},
+    {185, 0x201E, 333},
+    {178, 0x2020, 556},
+    {179, 0x2021, 556},
+    {183, 0x2022, 350},
+    {188, 0x2026, 1000},
+    {189, 0x2030, 1000},
+    {172, 0x2039, 333},
+    {173, 0x203A, 333},
+    {164, 0x2044, 167},
+    {-1, 0x20AC, 556},
     {-1, 0x2122, 1000},
-    {-1, 0x0117, 556},
-    {-1, 0x00CC, 278},
-    {-1, 0x012A, 278},
-    {-1, 0x013D, 556},
-    {-1, 0x00BD, 834},
-    {-1, 0x2264, 549},
-    {-1, 0x00F4, 556},
-    {-1, 0x00F1, 556},
-    {-1, 0x0170, 722},
-    {-1, 0x00C9, 667},
-    {-1, 0x0113, 556},
-    {-1, 0x011F, 556},
-    {-1, 0x00BC, 834},
-    {-1, 0x0160, 667},
-    {-1, 0x0218, 667},
-    {-1, 0x0150, 778},
-    {-1, 0x00B0, 400},
-    {-1, 0x00F2, 556},
-    {-1, 0x010C, 722},
-    {-1, 0x00F9, 556},
-    {-1, 0x221A, 453},
-    {-1, 0x010E, 722},
-    {-1, 0x0157, 333},
-    {-1, 0x00D1, 722},
-    {-1, 0x00F5, 556},
-    {-1, 0x0156, 722},
-    {-1, 0x013B, 556},
-    {-1, 0x00C3, 667},
-    {-1, 0x0104, 667},
-    {-1, 0x00C5, 667},
-    {-1, 0x00D5, 778},
-    {-1, 0x017C, 500},
-    {-1, 0x011A, 667},
-    {-1, 0x012E, 278},
-    {-1, 0x0137, 500},
+    {-1, 0x2202, 476},
+    {-1, 0x2211, 600},
     {-1, 0x2212, 584},
-    {-1, 0x00CE, 278},
-    {-1, 0x0148, 556},
-    {-1, 0x0163, 278},
-    {-1, 0x00AC, 584},
-    {-1, 0x00F6, 556},
-    {-1, 0x00FC, 556},
+    {-1, 0x221A, 453},
     {-1, 0x2260, 549},
-    {-1, 0x0123, 556},
-    {-1, 0x00F0, 556},
-    {-1, 0x017E, 500},
-    {-1, 0x0146, 556},
-    {-1, 0x00B9, 333},
-    {-1, 0x012B, 278},
-    {-1, 0x20AC, 556},
+    {-1, 0x2264, 549},
+    {-1, 0x2265, 549},
+    {-1, 0x25CA, 471},
+    {-1, 0xF6C3, 250},
+    {174, 0xFB01, 500},
+    {175, 0xFB02, 500},
     {-1, 0xFFFF, 0}
     };
 
@@ -1622,7 +1626,7 @@ static const HPDF_CharData CHAR_DATA_HELVETICA_BOLD[316] = {
     {36, 0x0024, 556},
     {37, 0x0025, 889},
     {38, 0x0026, 722},
-    {39, 0x2019, 278},
+    {169, 0x0027, 238},
     {40, 0x0028, 333},
     {41, 0x0029, 333},
     {42, 0x002A, 389},
@@ -1679,7 +1683,7 @@ static const HPDF_CharData CHAR_DATA_HELVETICA_BOLD[316] = {
     {93, 0x005D, 333},
     {94, 0x005E, 584},
     {95, 0x005F, 556},
-    {96, 0x2018, 278},
+    {193, 0x0060, 333},
     {97, 0x0061, 556},
     {98, 0x0062, 611},
     {99, 0x0063, 556},
@@ -1713,223 +1717,223 @@ static const HPDF_CharData CHAR_DATA_HELVETICA_BOLD[316] = {
     {161, 0x00A1, 333},
     {162, 0x00A2, 556},
     {163, 0x00A3, 556},
-    {164, 0x2044, 167},
+    {168, 0x00A4, 556},
     {165, 0x00A5, 556},
-    {166, 0x0192, 556},
+    {-1, 0x00A6, 280},
     {167, 0x00A7, 556},
-    {168, 0x00A4, 556},
-    {169, 0x0027, 238},
-    {170, 0x201C, 500},
+    {200, 0x00A8, 333},
+    {-1, 0x00A9, 737},
+    {227, 0x00AA, 370},
     {171, 0x00AB, 556},
-    {172, 0x2039, 333},
-    {173, 0x203A, 333},
-    {174, 0xFB01, 611},
-    {175, 0xFB02, 611},
-    {177, 0x2013, 556},
-    {178, 0x2020, 556},
-    {179, 0x2021, 556},
-    {180, 0x00B7, 278},
+    {-1, 0x00AC, 584},
+    {-1, 0x00AE, 737},
+    {197, 0x00AF, 333},
+    {-1, 0x00B0, 400},
+    {-1, 0x00B1, 584},
+    {-1, 0x00B2, 333},
+    {-1, 0x00B3, 333},
+    {194, 0x00B4, 333},
+    {-1, 0x00B5, 611},
     {182, 0x00B6, 556},
-    {183, 0x2022, 350},
-    {184, 0x201A, 278},
-    {185, 0x201E, 500},
-    {186, 0x201D, 500},
+    {180, 0x00B7, 278},
+    {203, 0x00B8, 333},
+    {-1, 0x00B9, 333},
+    {235, 0x00BA, 365},
     {187, 0x00BB, 556},
-    {188, 0x2026, 1000},
-    {189, 0x2030, 1000},
+    {-1, 0x00BC, 834},
+    {-1, 0x00BD, 834},
+    {-1, 0x00BE, 834},
     {191, 0x00BF, 611},
-    {193, 0x0060, 333},
-    {194, 0x00B4, 333},
-    {195, 0x02C6, 333},
-    {196, 0x02DC, 333},
-    {197, 0x00AF, 333},
-    {198, 0x02D8, 333},
-    {199, 0x02D9, 333},
-    {200, 0x00A8, 333},
-    {202, 0x02DA, 333},
-    {203, 0x00B8, 333},
-    {205, 0x02DD, 333},
-    {206, 0x02DB, 333},
-    {207, 0x02C7, 333},
-    {208, 0x2014, 1000},
+    {-1, 0x00C0, 722},
+    {-1, 0x00C1, 722},
+    {-1, 0x00C2, 722},
+    {-1, 0x00C3, 722},
+    {-1, 0x00C4, 722},
+    {-1, 0x00C5, 722},
     {225, 0x00C6, 1000},
-    {227, 0x00AA, 370},
-    {232, 0x0141, 611},
-    {233, 0x00D8, 778},
-    {234, 0x0152, 1000},
-    {235, 0x00BA, 365},
-    {241, 0x00E6, 889},
-    {245, 0x0131, 278},
-    {248, 0x0142, 278},
-    {249, 0x00F8, 611},
-    {250, 0x0153, 944},
-    {251, 0x00DF, 611},
+    {-1, 0x00C7, 722},
+    {-1, 0x00C8, 667},
+    {-1, 0x00C9, 667},
+    {-1, 0x00CA, 667},
+    {-1, 0x00CB, 667},
+    {-1, 0x00CC, 278},
+    {-1, 0x00CD, 278},
+    {-1, 0x00CE, 278},
     {-1, 0x00CF, 278},
-    {-1, 0x00E9, 556},
-    {-1, 0x0103, 556},
-    {-1, 0x0171, 611},
-    {-1, 0x011B, 556},
-    {-1, 0x0178, 667},
-    {-1, 0x00F7, 584},
-    {-1, 0x00DD, 667},
-    {-1, 0x00C2, 722},
-    {-1, 0x00E1, 556},
+    {-1, 0x00D0, 722},
+    {-1, 0x00D1, 722},
+    {-1, 0x00D2, 778},
+    {-1, 0x00D3, 778},
+    {-1, 0x00D4, 778},
+    {-1, 0x00D5, 778},
+    {-1, 0x00D6, 778},
+    {-1, 0x00D7, 584},
+    {233, 0x00D8, 778},
+    {-1, 0x00D9, 722},
+    {-1, 0x00DA, 722},
     {-1, 0x00DB, 722},
-    {-1, 0x00FD, 556},
-    {-1, 0x0219, 556},
-    {-1, 0x00EA, 556},
-    {-1, 0x016E, 722},
     {-1, 0x00DC, 722},
-    {-1, 0x0105, 556},
-    {-1, 0x00DA, 722},
-    {-1, 0x0173, 611},
-    {-1, 0x00CB, 667},
-    {-1, 0x0110, 722},
-    {-1, 0xF6C3, 250},
-    {-1, 0x00A9, 737},
-    {-1, 0x0112, 667},
-    {-1, 0x010D, 556},
-    {-1, 0x00E5, 556},
-    {-1, 0x0145, 722},
-    {-1, 0x013A, 278},
+    {-1, 0x00DD, 667},
+    {-1, 0x00DE, 667},
+    {251, 0x00DF, 611},
     {-1, 0x00E0, 556},
-    {-1, 0x0162, 611},
-    {-1, 0x0106, 722},
+    {-1, 0x00E1, 556},
+    {-1, 0x00E2, 556},
     {-1, 0x00E3, 556},
-    {-1, 0x0116, 667},
-    {-1, 0x0161, 556},
-    {-1, 0x015F, 556},
-    {-1, 0x00ED, 278},
-    {-1, 0x25CA, 494},
-    {-1, 0x0158, 722},
-    {-1, 0x0122, 778},
-    {-1, 0x00FB, 611},
-    {-1, 0x00E2, 556},
-    {-1, 0x0100, 722},
-    {-1, 0x0159, 389},
-    {-1, 0x00E7, 556},
-    {-1, 0x017B, 611},
-    {-1, 0x00DE, 667},
-    {-1, 0x014C, 778},
-    {-1, 0x0154, 722},
-    {-1, 0x015A, 667},
-    {-1, 0x010F, 743},
-    {-1, 0x016A, 722},
-    {-1, 0x016F, 611},
-    {-1, 0x00B3, 333},
-    {-1, 0x00D2, 778},
-    {-1, 0x00C0, 722},
-    {-1, 0x0102, 722},
-    {-1, 0x00D7, 584},
-    {-1, 0x00FA, 611},
-    {-1, 0x0164, 611},
-    {-1, 0x2202, 494},
-    {-1, 0x00FF, 556},
-    {-1, 0x0143, 722},
-    {-1, 0x00EE, 278},
-    {-1, 0x00CA, 667},
     {-1, 0x00E4, 556},
-    {-1, 0x00EB, 556},
-    {-1, 0x0107, 556},
-    {-1, 0x0144, 611},
-    {-1, 0x016B, 611},
-    {-1, 0x0147, 722},
-    {-1, 0x00CD, 278},
-    {-1, 0x00B1, 584},
-    {-1, 0x00A6, 280},
-    {-1, 0x00AE, 737},
-    {-1, 0x011E, 778},
-    {-1, 0x0130, 278},
-    {-1, 0x2211, 600},
-    {-1, 0x00C8, 667},
-    {-1, 0x0155, 389},
-    {-1, 0x014D, 611},
-    {-1, 0x0179, 611},
-    {-1, 0x017D, 611},
-    {-1, 0x2265, 549},
-    {-1, 0x00D0, 722},
-    {-1, 0x00C7, 722},
-    {-1, 0x013C, 278},
-    {-1, 0x0165, 389},
-    {-1, 0x0119, 556},
-    {-1, 0x0172, 722},
-    {-1, 0x00C1, 722},
-    {-1, 0x00C4, 722},
+    {-1, 0x00E5, 556},
+    {241, 0x00E6, 889},
+    {-1, 0x00E7, 556},
     {-1, 0x00E8, 556},
-    {-1, 0x017A, 500},
-    {-1, 0x012F, 278},
-    {-1, 0x00D3, 778},
-    {-1, 0x00F3, 611},
-    {-1, 0x0101, 556},
-    {-1, 0x015B, 556},
-    {-1, 0x00EF, 278},
-    {-1, 0x00D4, 778},
-    {-1, 0x00D9, 722},
-    {-1, 0x0394, 612},
-    {-1, 0x00FE, 611},
-    {-1, 0x00B2, 333},
-    {-1, 0x00D6, 778},
-    {-1, 0x00B5, 611},
+    {-1, 0x00E9, 556},
+    {-1, 0x00EA, 556},
+    {-1, 0x00EB, 556},
     {-1, 0x00EC, 278},
-    {-1, 0x0151, 611},
-    {-1, 0x0118, 667},
-    {-1, 0x0111, 611},
-    {-1, 0x00BE, 834},
-    {-1, 0x015E, 667},
-    {-1, 0x013E, 400},
-    {-1, 0x0136, 722},
-    {-1, 0x0139, 611},
-    {-1, 0x2122, 1000},
-    {-1, 0x0117, 556},
-    {-1, 0x00CC, 278},
-    {-1, 0x012A, 278},
-    {-1, 0x013D, 611},
-    {-1, 0x00BD, 834},
-    {-1, 0x2264, 549},
-    {-1, 0x00F4, 611},
+    {-1, 0x00ED, 278},
+    {-1, 0x00EE, 278},
+    {-1, 0x00EF, 278},
+    {-1, 0x00F0, 611},
     {-1, 0x00F1, 611},
-    {-1, 0x0170, 722},
-    {-1, 0x00C9, 667},
-    {-1, 0x0113, 556},
-    {-1, 0x011F, 611},
-    {-1, 0x00BC, 834},
-    {-1, 0x0160, 667},
-    {-1, 0x0218, 667},
-    {-1, 0x0150, 778},
-    {-1, 0x00B0, 400},
     {-1, 0x00F2, 611},
-    {-1, 0x010C, 722},
-    {-1, 0x00F9, 611},
-    {-1, 0x221A, 549},
-    {-1, 0x010E, 722},
-    {-1, 0x0157, 389},
-    {-1, 0x00D1, 722},
+    {-1, 0x00F3, 611},
+    {-1, 0x00F4, 611},
     {-1, 0x00F5, 611},
-    {-1, 0x0156, 722},
-    {-1, 0x013B, 611},
-    {-1, 0x00C3, 722},
+    {-1, 0x00F6, 611},
+    {-1, 0x00F7, 584},
+    {249, 0x00F8, 611},
+    {-1, 0x00F9, 611},
+    {-1, 0x00FA, 611},
+    {-1, 0x00FB, 611},
+    {-1, 0x00FC, 611},
+    {-1, 0x00FD, 556},
+    {-1, 0x00FE, 611},
+    {-1, 0x00FF, 556},
+    {-1, 0x0100, 722},
+    {-1, 0x0101, 556},
+    {-1, 0x0102, 722},
+    {-1, 0x0103, 556},
     {-1, 0x0104, 722},
-    {-1, 0x00C5, 722},
-    {-1, 0x00D5, 778},
-    {-1, 0x017C, 500},
+    {-1, 0x0105, 556},
+    {-1, 0x0106, 722},
+    {-1, 0x0107, 556},
+    {-1, 0x010C, 722},
+    {-1, 0x010D, 556},
+    {-1, 0x010E, 722},
+    {-1, 0x010F, 743},
+    {-1, 0x0110, 722},
+    {-1, 0x0111, 611},
+    {-1, 0x0112, 667},
+    {-1, 0x0113, 556},
+    {-1, 0x0116, 667},
+    {-1, 0x0117, 556},
+    {-1, 0x0118, 667},
+    {-1, 0x0119, 556},
     {-1, 0x011A, 667},
+    {-1, 0x011B, 556},
+    {-1, 0x011E, 778},
+    {-1, 0x011F, 611},
+    {-1, 0x0122, 778},
+    {-1, 0x0123, 611},
+    {-1, 0x012A, 278},
+    {-1, 0x012B, 278},
     {-1, 0x012E, 278},
+    {-1, 0x012F, 278},
+    {-1, 0x0130, 278},
+    {245, 0x0131, 278},
+    {-1, 0x0136, 722},
     {-1, 0x0137, 556},
-    {-1, 0x2212, 584},
-    {-1, 0x00CE, 278},
+    {-1, 0x0139, 611},
+    {-1, 0x013A, 278},
+    {-1, 0x013B, 611},
+    {-1, 0x013C, 278},
+    {-1, 0x013D, 611},
+    {-1, 0x013E, 400},
+    {232, 0x0141, 611},
+    {248, 0x0142, 278},
+    {-1, 0x0143, 722},
+    {-1, 0x0144, 611},
+    {-1, 0x0145, 722},
+    {-1, 0x0146, 611},
+    {-1, 0x0147, 722},
     {-1, 0x0148, 611},
+    {-1, 0x014C, 778},
+    {-1, 0x014D, 611},
+    {-1, 0x0150, 778},
+    {-1, 0x0151, 611},
+    {234, 0x0152, 1000},
+    {250, 0x0153, 944},
+    {-1, 0x0154, 722},
+    {-1, 0x0155, 389},
+    {-1, 0x0156, 722},
+    {-1, 0x0157, 389},
+    {-1, 0x0158, 722},
+    {-1, 0x0159, 389},
+    {-1, 0x015A, 667},
+    {-1, 0x015B, 556},
+    {-1, 0x015E, 667},
+    {-1, 0x015F, 556},
+    {-1, 0x0160, 667},
+    {-1, 0x0161, 556},
+    {-1, 0x0162, 611},
     {-1, 0x0163, 333},
-    {-1, 0x00AC, 584},
-    {-1, 0x00F6, 611},
-    {-1, 0x00FC, 611},
-    {-1, 0x2260, 549},
-    {-1, 0x0123, 611},
-    {-1, 0x00F0, 611},
+    {-1, 0x0164, 611},
+    {-1, 0x0165, 389},
+    {-1, 0x016A, 722},
+    {-1, 0x016B, 611},
+    {-1, 0x016E, 722},
+    {-1, 0x016F, 611},
+    {-1, 0x0170, 722},
+    {-1, 0x0171, 611},
+    {-1, 0x0172, 722},
+    {-1, 0x0173, 611},
+    {-1, 0x0178, 667},
+    {-1, 0x0179, 611},
+    {-1, 0x017A, 500},
+    {-1, 0x017B, 611},
+    {-1, 0x017C, 500},
+    {-1, 0x017D, 611},
     {-1, 0x017E, 500},
-    {-1, 0x0146, 611},
-    {-1, 0x00B9, 333},
-    {-1, 0x012B, 278},
+    {166, 0x0192, 556},
+    {-1, 0x0218, 667},
+    {-1, 0x0219, 556},
+    {195, 0x02C6, 333},
+    {207, 0x02C7, 333},
+    {198, 0x02D8, 333},
+    {199, 0x02D9, 333},
+    {202, 0x02DA, 333},
+    {206, 0x02DB, 333},
+    {196, 0x02DC, 333},
+    {205, 0x02DD, 333},
+    {-1, 0x0394, 612},
+    {177, 0x2013, 556},
+    {208, 0x2014, 1000},
+    {96, 0x2018, 278},
+    {39, 0x2019, 278},
+    {184, 0x201A, 278},
+    {170, 0x201C, 500},
+    {186, 0x201D, 500},
+    {185, 0x201E, 500},
+    {178, 0x2020, 556},
+    {179, 0x2021, 556},
+    {183, 0x2022, 350},
+    {188, 0x2026, 1000},
+    {189, 0x2030, 1000},
+    {172, 0x2039, 333},
+    {173, 0x203A, 333},
+    {164, 0x2044, 167},
     {-1, 0x20AC, 556},
+    {-1, 0x2122, 1000},
+    {-1, 0x2202, 494},
+    {-1, 0x2211, 600},
+    {-1, 0x2212, 584},
+    {-1, 0x221A, 549},
+    {-1, 0x2260, 549},
+    {-1, 0x2264, 549},
+    {-1, 0x2265, 549},
+    {-1, 0x25CA, 494},
+    {-1, 0xF6C3, 250},
+    {174, 0xFB01, 611},
+    {175, 0xFB02, 611},
     {-1, 0xFFFF, 0}
     };
 
@@ -1941,7 +1945,7 @@ static const HPDF_CharData CHAR_DATA_HELVETICA_BOLD_OBLIQUE[316] = {
     {36, 0x0024, 556},
     {37, 0x0025, 889},
     {38, 0x0026, 722},
-    {39, 0x2019, 278},
+    {169, 0x0027, 238},
     {40, 0x0028, 333},
     {41, 0x0029, 333},
     {42, 0x002A, 389},
@@ -1998,7 +2002,7 @@ static const HPDF_CharData CHAR_DATA_HELVETICA_BOLD_OBLIQUE[316] = {
     {93, 0x005D, 333},
     {94, 0x005E, 584},
     {95, 0x005F, 556},
-    {96, 0x2018, 278},
+    {193, 0x0060, 333},
     {97, 0x0061, 556},
     {98, 0x0062, 611},
     {99, 0x0063, 556},
@@ -2032,223 +2036,223 @@ static const HPDF_CharData CHAR_DATA_HELVETICA_BOLD_OBLIQUE[316] = {
     {161, 0x00A1, 333},
     {162, 0x00A2, 556},
     {163, 0x00A3, 556},
-    {164, 0x2044, 167},
+    {168, 0x00A4, 556},
     {165, 0x00A5, 556},
-    {166, 0x0192, 556},
+    {-1, 0x00A6, 280},
     {167, 0x00A7, 556},
-    {168, 0x00A4, 556},
-    {169, 0x0027, 238},
-    {170, 0x201C, 500},
+    {200, 0x00A8, 333},
+    {-1, 0x00A9, 737},
+    {227, 0x00AA, 370},
     {171, 0x00AB, 556},
-    {172, 0x2039, 333},
-    {173, 0x203A, 333},
-    {174, 0xFB01, 611},
-    {175, 0xFB02, 611},
-    {177, 0x2013, 556},
-    {178, 0x2020, 556},
-    {179, 0x2021, 556},
-    {180, 0x00B7, 278},
+    {-1, 0x00AC, 584},
+    {-1, 0x00AE, 737},
+    {197, 0x00AF, 333},
+    {-1, 0x00B0, 400},
+    {-1, 0x00B1, 584},
+    {-1, 0x00B2, 333},
+    {-1, 0x00B3, 333},
+    {194, 0x00B4, 333},
+    {-1, 0x00B5, 611},
     {182, 0x00B6, 556},
-    {183, 0x2022, 350},
-    {184, 0x201A, 278},
-    {185, 0x201E, 500},
-    {186, 0x201D, 500},
+    {180, 0x00B7, 278},
+    {203, 0x00B8, 333},
+    {-1, 0x00B9, 333},
+    {235, 0x00BA, 365},
     {187, 0x00BB, 556},
-    {188, 0x2026, 1000},
-    {189, 0x2030, 1000},
+    {-1, 0x00BC, 834},
+    {-1, 0x00BD, 834},
+    {-1, 0x00BE, 834},
     {191, 0x00BF, 611},
-    {193, 0x0060, 333},
-    {194, 0x00B4, 333},
-    {195, 0x02C6, 333},
-    {196, 0x02DC, 333},
-    {197, 0x00AF, 333},
-    {198, 0x02D8, 333},
-    {199, 0x02D9, 333},
-    {200, 0x00A8, 333},
-    {202, 0x02DA, 333},
-    {203, 0x00B8, 333},
-    {205, 0x02DD, 333},
-    {206, 0x02DB, 333},
-    {207, 0x02C7, 333},
-    {208, 0x2014, 1000},
+    {-1, 0x00C0, 722},
+    {-1, 0x00C1, 722},
+    {-1, 0x00C2, 722},
+    {-1, 0x00C3, 722},
+    {-1, 0x00C4, 722},
+    {-1, 0x00C5, 722},
     {225, 0x00C6, 1000},
-    {227, 0x00AA, 370},
-    {232, 0x0141, 611},
+    {-1, 0x00C7, 722},
+    {-1, 0x00C8, 667},
+    {-1, 0x00C9, 667},
+    {-1, 0x00CA, 667},
+    {-1, 0x00CB, 667},
+    {-1, 0x00CC, 278},
+    {-1, 0x00CD, 278},
+    {-1, 0x00CE, 278},
+    {-1, 0x00CF, 278},
+    {-1, 0x00D0, 722},
+    {-1, 0x00D1, 722},
+    {-1, 0x00D2, 778},
+    {-1, 0x00D3, 778},
+    {-1, 0x00D4, 778},
+    {-1, 0x00D5, 778},
+    {-1, 0x00D6, 778},
+    {-1, 0x00D7, 584},
     {233, 0x00D8, 778},
-    {234, 0x0152, 1000},
-    {235, 0x00BA, 365},
-    {241, 0x00E6, 889},
-    {245, 0x0131, 278},
-    {248, 0x0142, 278},
-    {249, 0x00F8, 611},
-    {250, 0x0153, 944},
+    {-1, 0x00D9, 722},
+    {-1, 0x00DA, 722},
+    {-1, 0x00DB, 722},
+    {-1, 0x00DC, 722},
+    {-1, 0x00DD, 667},
+    {-1, 0x00DE, 667},
     {251, 0x00DF, 611},
-    {-1, 0x00CF, 278},
+    {-1, 0x00E0, 556},
+    {-1, 0x00E1, 556},
+    {-1, 0x00E2, 556},
+    {-1, 0x00E3, 556},
+    {-1, 0x00E4, 556},
+    {-1, 0x00E5, 556},
+    {241, 0x00E6, 889},
+    {-1, 0x00E7, 556},
+    {-1, 0x00E8, 556},
     {-1, 0x00E9, 556},
-    {-1, 0x0103, 556},
-    {-1, 0x0171, 611},
-    {-1, 0x011B, 556},
-    {-1, 0x0178, 667},
+    {-1, 0x00EA, 556},
+    {-1, 0x00EB, 556},
+    {-1, 0x00EC, 278},
+    {-1, 0x00ED, 278},
+    {-1, 0x00EE, 278},
+    {-1, 0x00EF, 278},
+    {-1, 0x00F0, 611},
+    {-1, 0x00F1, 611},
+    {-1, 0x00F2, 611},
+    {-1, 0x00F3, 611},
+    {-1, 0x00F4, 611},
+    {-1, 0x00F5, 611},
+    {-1, 0x00F6, 611},
     {-1, 0x00F7, 584},
-    {-1, 0x00DD, 667},
-    {-1, 0x00C2, 722},
-    {-1, 0x00E1, 556},
-    {-1, 0x00DB, 722},
+    {249, 0x00F8, 611},
+    {-1, 0x00F9, 611},
+    {-1, 0x00FA, 611},
+    {-1, 0x00FB, 611},
+    {-1, 0x00FC, 611},
     {-1, 0x00FD, 556},
-    {-1, 0x0219, 556},
-    {-1, 0x00EA, 556},
-    {-1, 0x016E, 722},
-    {-1, 0x00DC, 722},
+    {-1, 0x00FE, 611},
+    {-1, 0x00FF, 556},
+    {-1, 0x0100, 722},
+    {-1, 0x0101, 556},
+    {-1, 0x0102, 722},
+    {-1, 0x0103, 556},
+    {-1, 0x0104, 722},
     {-1, 0x0105, 556},
-    {-1, 0x00DA, 722},
-    {-1, 0x0173, 611},
-    {-1, 0x00CB, 667},
+    {-1, 0x0106, 722},
+    {-1, 0x0107, 556},
+    {-1, 0x010C, 722},
+    {-1, 0x010D, 556},
+    {-1, 0x010E, 722},
+    {-1, 0x010F, 743},
     {-1, 0x0110, 722},
-    {-1, 0xF6C3, 250},
-    {-1, 0x00A9, 737},
+    {-1, 0x0111, 611},
     {-1, 0x0112, 667},
-    {-1, 0x010D, 556},
-    {-1, 0x00E5, 556},
-    {-1, 0x0145, 722},
-    {-1, 0x013A, 278},
-    {-1, 0x00E0, 556},
-    {-1, 0x0162, 611},
-    {-1, 0x0106, 722},
-    {-1, 0x00E3, 556},
+    {-1, 0x0113, 556},
     {-1, 0x0116, 667},
-    {-1, 0x0161, 556},
-    {-1, 0x015F, 556},
-    {-1, 0x00ED, 278},
-    {-1, 0x25CA, 494},
-    {-1, 0x0158, 722},
+    {-1, 0x0117, 556},
+    {-1, 0x0118, 667},
+    {-1, 0x0119, 556},
+    {-1, 0x011A, 667},
+    {-1, 0x011B, 556},
+    {-1, 0x011E, 778},
+    {-1, 0x011F, 611},
     {-1, 0x0122, 778},
-    {-1, 0x00FB, 611},
-    {-1, 0x00E2, 556},
-    {-1, 0x0100, 722},
-    {-1, 0x0159, 389},
-    {-1, 0x00E7, 556},
-    {-1, 0x017B, 611},
-    {-1, 0x00DE, 667},
+    {-1, 0x0123, 611},
+    {-1, 0x012A, 278},
+    {-1, 0x012B, 278},
+    {-1, 0x012E, 278},
+    {-1, 0x012F, 278},
+    {-1, 0x0130, 278},
+    {245, 0x0131, 278},
+    {-1, 0x0136, 722},
+    {-1, 0x0137, 556},
+    {-1, 0x0139, 611},
+    {-1, 0x013A, 278},
+    {-1, 0x013B, 611},
+    {-1, 0x013C, 278},
+    {-1, 0x013D, 611},
+    {-1, 0x013E, 400},
+    {232, 0x0141, 611},
+    {248, 0x0142, 278},
+    {-1, 0x0143, 722},
+    {-1, 0x0144, 611},
+    {-1, 0x0145, 722},
+    {-1, 0x0146, 611},
+    {-1, 0x0147, 722},
+    {-1, 0x0148, 611},
     {-1, 0x014C, 778},
+    {-1, 0x014D, 611},
+    {-1, 0x0150, 778},
+    {-1, 0x0151, 611},
+    {234, 0x0152, 1000},
+    {250, 0x0153, 944},
     {-1, 0x0154, 722},
+    {-1, 0x0155, 389},
+    {-1, 0x0156, 722},
+    {-1, 0x0157, 389},
+    {-1, 0x0158, 722},
+    {-1, 0x0159, 389},
     {-1, 0x015A, 667},
-    {-1, 0x010F, 743},
-    {-1, 0x016A, 722},
-    {-1, 0x016F, 611},
-    {-1, 0x00B3, 333},
-    {-1, 0x00D2, 778},
-    {-1, 0x00C0, 722},
-    {-1, 0x0102, 722},
-    {-1, 0x00D7, 584},
-    {-1, 0x00FA, 611},
+    {-1, 0x015B, 556},
+    {-1, 0x015E, 667},
+    {-1, 0x015F, 556},
+    {-1, 0x0160, 667},
+    {-1, 0x0161, 556},
+    {-1, 0x0162, 611},
+    {-1, 0x0163, 333},
     {-1, 0x0164, 611},
-    {-1, 0x2202, 494},
-    {-1, 0x00FF, 556},
-    {-1, 0x0143, 722},
-    {-1, 0x00EE, 278},
-    {-1, 0x00CA, 667},
-    {-1, 0x00E4, 556},
-    {-1, 0x00EB, 556},
-    {-1, 0x0107, 556},
-    {-1, 0x0144, 611},
+    {-1, 0x0165, 389},
+    {-1, 0x016A, 722},
     {-1, 0x016B, 611},
-    {-1, 0x0147, 722},
-    {-1, 0x00CD, 278},
-    {-1, 0x00B1, 584},
-    {-1, 0x00A6, 280},
-    {-1, 0x00AE, 737},
-    {-1, 0x011E, 778},
-    {-1, 0x0130, 278},
-    {-1, 0x2211, 600},
-    {-1, 0x00C8, 667},
-    {-1, 0x0155, 389},
-    {-1, 0x014D, 611},
-    {-1, 0x0179, 611},
-    {-1, 0x017D, 611},
-    {-1, 0x2265, 549},
-    {-1, 0x00D0, 722},
-    {-1, 0x00C7, 722},
-    {-1, 0x013C, 278},
-    {-1, 0x0165, 389},
-    {-1, 0x0119, 556},
+    {-1, 0x016E, 722},
+    {-1, 0x016F, 611},
+    {-1, 0x0170, 722},
+    {-1, 0x0171, 611},
     {-1, 0x0172, 722},
-    {-1, 0x00C1, 722},
-    {-1, 0x00C4, 722},
-    {-1, 0x00E8, 556},
+    {-1, 0x0173, 611},
+    {-1, 0x0178, 667},
+    {-1, 0x0179, 611},
     {-1, 0x017A, 500},
-    {-1, 0x012F, 278},
-    {-1, 0x00D3, 778},
-    {-1, 0x00F3, 611},
-    {-1, 0x0101, 556},
-    {-1, 0x015B, 556},
-    {-1, 0x00EF, 278},
-    {-1, 0x00D4, 778},
-    {-1, 0x00D9, 722},
+    {-1, 0x017B, 611},
+    {-1, 0x017C, 500},
+    {-1, 0x017D, 611},
+    {-1, 0x017E, 500},
+    {166, 0x0192, 556},
+    {-1, 0x0218, 667},
+    {-1, 0x0219, 556},
+    {195, 0x02C6, 333},
+    {207, 0x02C7, 333},
+    {198, 0x02D8, 333},
+    {199, 0x02D9, 333},
+    {202, 0x02DA, 333},
+    {206, 0x02DB, 333},
+    {196, 0x02DC, 333},
+    {205, 0x02DD, 333},
     {-1, 0x0394, 612},
-    {-1, 0x00FE, 611},
-    {-1, 0x00B2, 333},
-    {-1, 0x00D6, 778},
-    {-1, 0x00B5, 611},
-    {-1, 0x00EC, 278},
-    {-1, 0x0151, 611},
-    {-1, 0x0118, 667},
-    {-1, 0x0111, 611},
-    {-1, 0x00BE, 834},
-    {-1, 0x015E, 667},
-    {-1, 0x013E, 400},
-    {-1, 0x0136, 722},
-    {-1, 0x0139, 611},
+    {177, 0x2013, 556},
+    {208, 0x2014, 1000},
+    {96, 0x2018, 278},
+    {39, 0x2019, 278},
+    {184, 0x201A, 278},
+    {170, 0x201C, 500},
+    {186, 0x201D, 500},
+    {185, 0x201E, 500},
+    {178, 0x2020, 556},
+    {179, 0x2021, 556},
+    {183, 0x2022, 350},
+    {188, 0x2026, 1000},
+    {189, 0x2030, 1000},
+    {172, 0x2039, 333},
+    {173, 0x203A, 333},
+    {164, 0x2044, 167},
+    {-1, 0x20AC, 556},
     {-1, 0x2122, 1000},
-    {-1, 0x0117, 556},
-    {-1, 0x00CC, 278},
-    {-1, 0x012A, 278},
-    {-1, 0x013D, 611},
-    {-1, 0x00BD, 834},
-    {-1, 0x2264, 549},
-    {-1, 0x00F4, 611},
-    {-1, 0x00F1, 611},
-    {-1, 0x0170, 722},
-    {-1, 0x00C9, 667},
-    {-1, 0x0113, 556},
-    {-1, 0x011F, 611},
-    {-1, 0x00BC, 834},
-    {-1, 0x0160, 667},
-    {-1, 0x0218, 667},
-    {-1, 0x0150, 778},
-    {-1, 0x00B0, 400},
-    {-1, 0x00F2, 611},
-    {-1, 0x010C, 722},
-    {-1, 0x00F9, 611},
-    {-1, 0x221A, 549},
-    {-1, 0x010E, 722},
-    {-1, 0x0157, 389},
-    {-1, 0x00D1, 722},
-    {-1, 0x00F5, 611},
-    {-1, 0x0156, 722},
-    {-1, 0x013B, 611},
-    {-1, 0x00C3, 722},
-    {-1, 0x0104, 722},
-    {-1, 0x00C5, 722},
-    {-1, 0x00D5, 778},
-    {-1, 0x017C, 500},
-    {-1, 0x011A, 667},
-    {-1, 0x012E, 278},
-    {-1, 0x0137, 556},
+    {-1, 0x2202, 494},
+    {-1, 0x2211, 600},
     {-1, 0x2212, 584},
-    {-1, 0x00CE, 278},
-    {-1, 0x0148, 611},
-    {-1, 0x0163, 333},
-    {-1, 0x00AC, 584},
-    {-1, 0x00F6, 611},
-    {-1, 0x00FC, 611},
+    {-1, 0x221A, 549},
     {-1, 0x2260, 549},
-    {-1, 0x0123, 611},
-    {-1, 0x00F0, 611},
-    {-1, 0x017E, 500},
-    {-1, 0x0146, 611},
-    {-1, 0x00B9, 333},
-    {-1, 0x012B, 278},
-    {-1, 0x20AC, 556},
+    {-1, 0x2264, 549},
+    {-1, 0x2265, 549},
+    {-1, 0x25CA, 494},
+    {-1, 0xF6C3, 250},
+    {174, 0xFB01, 611},
+    {175, 0xFB02, 611},
     {-1, 0xFFFF, 0}
     };
 
@@ -2260,7 +2264,7 @@ static const HPDF_CharData CHAR_DATA_HELVETICA_OBLIQUE[316] = {
     {36, 0x0024, 556},
     {37, 0x0025, 889},
     {38, 0x0026, 667},
-    {39, 0x2019, 222},
+    {169, 0x0027, 191},
     {40, 0x0028, 333},
     {41, 0x0029, 333},
     {42, 0x002A, 389},
@@ -2317,7 +2321,7 @@ static const HPDF_CharData CHAR_DATA_HELVETICA_OBLIQUE[316] = {
     {93, 0x005D, 278},
     {94, 0x005E, 469},
     {95, 0x005F, 556},
-    {96, 0x2018, 222},
+    {193, 0x0060, 333},
     {97, 0x0061, 556},
     {98, 0x0062, 556},
     {99, 0x0063, 500},
@@ -2351,223 +2355,223 @@ static const HPDF_CharData CHAR_DATA_HELVETICA_OBLIQUE[316] = {
     {161, 0x00A1, 333},
     {162, 0x00A2, 556},
     {163, 0x00A3, 556},
-    {164, 0x2044, 167},
+    {168, 0x00A4, 556},
     {165, 0x00A5, 556},
-    {166, 0x0192, 556},
+    {-1, 0x00A6, 260},
     {167, 0x00A7, 556},
-    {168, 0x00A4, 556},
-    {169, 0x0027, 191},
-    {170, 0x201C, 333},
+    {200, 0x00A8, 333},
+    {-1, 0x00A9, 737},
+    {227, 0x00AA, 370},
     {171, 0x00AB, 556},
-    {172, 0x2039, 333},
-    {173, 0x203A, 333},
-    {174, 0xFB01, 500},
-    {175, 0xFB02, 500},
-    {177, 0x2013, 556},
-    {178, 0x2020, 556},
-    {179, 0x2021, 556},
-    {180, 0x00B7, 278},
+    {-1, 0x00AC, 584},
+    {-1, 0x00AE, 737},
+    {197, 0x00AF, 333},
+    {-1, 0x00B0, 400},
+    {-1, 0x00B1, 584},
+    {-1, 0x00B2, 333},
+    {-1, 0x00B3, 333},
+    {194, 0x00B4, 333},
+    {-1, 0x00B5, 556},
     {182, 0x00B6, 537},
-    {183, 0x2022, 350},
-    {184, 0x201A, 222},
-    {185, 0x201E, 333},
-    {186, 0x201D, 333},
+    {180, 0x00B7, 278},
+    {203, 0x00B8, 333},
+    {-1, 0x00B9, 333},
+    {235, 0x00BA, 365},
     {187, 0x00BB, 556},
-    {188, 0x2026, 1000},
-    {189, 0x2030, 1000},
+    {-1, 0x00BC, 834},
+    {-1, 0x00BD, 834},
+    {-1, 0x00BE, 834},
     {191, 0x00BF, 611},
-    {193, 0x0060, 333},
-    {194, 0x00B4, 333},
-    {195, 0x02C6, 333},
-    {196, 0x02DC, 333},
-    {197, 0x00AF, 333},
-    {198, 0x02D8, 333},
-    {199, 0x02D9, 333},
-    {200, 0x00A8, 333},
-    {202, 0x02DA, 333},
-    {203, 0x00B8, 333},
-    {205, 0x02DD, 333},
-    {206, 0x02DB, 333},
-    {207, 0x02C7, 333},
-    {208, 0x2014, 1000},
+    {-1, 0x00C0, 667},
+    {-1, 0x00C1, 667},
+    {-1, 0x00C2, 667},
+    {-1, 0x00C3, 667},
+    {-1, 0x00C4, 667},
+    {-1, 0x00C5, 667},
     {225, 0x00C6, 1000},
-    {227, 0x00AA, 370},
-    {232, 0x0141, 556},
-    {233, 0x00D8, 778},
-    {234, 0x0152, 1000},
-    {235, 0x00BA, 365},
-    {241, 0x00E6, 889},
-    {245, 0x0131, 278},
-    {248, 0x0142, 222},
-    {249, 0x00F8, 611},
-    {250, 0x0153, 944},
-    {251, 0x00DF, 611},
+    {-1, 0x00C7, 722},
+    {-1, 0x00C8, 667},
+    {-1, 0x00C9, 667},
+    {-1, 0x00CA, 667},
+    {-1, 0x00CB, 667},
+    {-1, 0x00CC, 278},
+    {-1, 0x00CD, 278},
+    {-1, 0x00CE, 278},
     {-1, 0x00CF, 278},
-    {-1, 0x00E9, 556},
-    {-1, 0x0103, 556},
-    {-1, 0x0171, 556},
-    {-1, 0x011B, 556},
-    {-1, 0x0178, 667},
-    {-1, 0x00F7, 584},
-    {-1, 0x00DD, 667},
-    {-1, 0x00C2, 667},
-    {-1, 0x00E1, 556},
+    {-1, 0x00D0, 722},
+    {-1, 0x00D1, 722},
+    {-1, 0x00D2, 778},
+    {-1, 0x00D3, 778},
+    {-1, 0x00D4, 778},
+    {-1, 0x00D5, 778},
+    {-1, 0x00D6, 778},
+    {-1, 0x00D7, 584},
+    {233, 0x00D8, 778},
+    {-1, 0x00D9, 722},
+    {-1, 0x00DA, 722},
     {-1, 0x00DB, 722},
-    {-1, 0x00FD, 500},
-    {-1, 0x0219, 500},
-    {-1, 0x00EA, 556},
-    {-1, 0x016E, 722},
     {-1, 0x00DC, 722},
-    {-1, 0x0105, 556},
-    {-1, 0x00DA, 722},
-    {-1, 0x0173, 556},
-    {-1, 0x00CB, 667},
-    {-1, 0x0110, 722},
-    {-1, 0xF6C3, 250},
-    {-1, 0x00A9, 737},
-    {-1, 0x0112, 667},
-    {-1, 0x010D, 500},
-    {-1, 0x00E5, 556},
-    {-1, 0x0145, 722},
-    {-1, 0x013A, 222},
+    {-1, 0x00DD, 667},
+    {-1, 0x00DE, 667},
+    {251, 0x00DF, 611},
     {-1, 0x00E0, 556},
-    {-1, 0x0162, 611},
-    {-1, 0x0106, 722},
+    {-1, 0x00E1, 556},
+    {-1, 0x00E2, 556},
     {-1, 0x00E3, 556},
-    {-1, 0x0116, 667},
-    {-1, 0x0161, 500},
-    {-1, 0x015F, 500},
-    {-1, 0x00ED, 278},
-    {-1, 0x25CA, 471},
-    {-1, 0x0158, 722},
-    {-1, 0x0122, 778},
-    {-1, 0x00FB, 556},
-    {-1, 0x00E2, 556},
-    {-1, 0x0100, 667},
-    {-1, 0x0159, 333},
-    {-1, 0x00E7, 500},
-    {-1, 0x017B, 611},
-    {-1, 0x00DE, 667},
-    {-1, 0x014C, 778},
-    {-1, 0x0154, 722},
-    {-1, 0x015A, 667},
-    {-1, 0x010F, 643},
-    {-1, 0x016A, 722},
-    {-1, 0x016F, 556},
-    {-1, 0x00B3, 333},
-    {-1, 0x00D2, 778},
-    {-1, 0x00C0, 667},
-    {-1, 0x0102, 667},
-    {-1, 0x00D7, 584},
-    {-1, 0x00FA, 556},
-    {-1, 0x0164, 611},
-    {-1, 0x2202, 476},
-    {-1, 0x00FF, 500},
-    {-1, 0x0143, 722},
-    {-1, 0x00EE, 278},
-    {-1, 0x00CA, 667},
     {-1, 0x00E4, 556},
-    {-1, 0x00EB, 556},
-    {-1, 0x0107, 500},
-    {-1, 0x0144, 556},
-    {-1, 0x016B, 556},
-    {-1, 0x0147, 722},
-    {-1, 0x00CD, 278},
-    {-1, 0x00B1, 584},
-    {-1, 0x00A6, 260},
-    {-1, 0x00AE, 737},
-    {-1, 0x011E, 778},
-    {-1, 0x0130, 278},
-    {-1, 0x2211, 600},
-    {-1, 0x00C8, 667},
-    {-1, 0x0155, 333},
-    {-1, 0x014D, 556},
-    {-1, 0x0179, 611},
-    {-1, 0x017D, 611},
-    {-1, 0x2265, 549},
-    {-1, 0x00D0, 722},
-    {-1, 0x00C7, 722},
-    {-1, 0x013C, 222},
-    {-1, 0x0165, 316},
-    {-1, 0x0119, 556},
-    {-1, 0x0172, 722},
-    {-1, 0x00C1, 667},
-    {-1, 0x00C4, 667},
+    {-1, 0x00E5, 556},
+    {241, 0x00E6, 889},
+    {-1, 0x00E7, 500},
     {-1, 0x00E8, 556},
-    {-1, 0x017A, 500},
-    {-1, 0x012F, 222},
-    {-1, 0x00D3, 778},
-    {-1, 0x00F3, 556},
-    {-1, 0x0101, 556},
-    {-1, 0x015B, 500},
-    {-1, 0x00EF, 278},
-    {-1, 0x00D4, 778},
-    {-1, 0x00D9, 722},
-    {-1, 0x0394, 612},
-    {-1, 0x00FE, 556},
-    {-1, 0x00B2, 333},
-    {-1, 0x00D6, 778},
-    {-1, 0x00B5, 556},
+    {-1, 0x00E9, 556},
+    {-1, 0x00EA, 556},
+    {-1, 0x00EB, 556},
     {-1, 0x00EC, 278},
-    {-1, 0x0151, 556},
-    {-1, 0x0118, 667},
-    {-1, 0x0111, 556},
-    {-1, 0x00BE, 834},
-    {-1, 0x015E, 667},
-    {-1, 0x013E, 299},
-    {-1, 0x0136, 667},
-    {-1, 0x0139, 556},
-    {-1, 0x2122, 1000},
-    {-1, 0x0117, 556},
-    {-1, 0x00CC, 278},
-    {-1, 0x012A, 278},
-    {-1, 0x013D, 556},
-    {-1, 0x00BD, 834},
-    {-1, 0x2264, 549},
-    {-1, 0x00F4, 556},
+    {-1, 0x00ED, 278},
+    {-1, 0x00EE, 278},
+    {-1, 0x00EF, 278},
+    {-1, 0x00F0, 556},
     {-1, 0x00F1, 556},
-    {-1, 0x0170, 722},
-    {-1, 0x00C9, 667},
-    {-1, 0x0113, 556},
-    {-1, 0x011F, 556},
-    {-1, 0x00BC, 834},
-    {-1, 0x0160, 667},
-    {-1, 0x0218, 667},
-    {-1, 0x0150, 778},
-    {-1, 0x00B0, 400},
     {-1, 0x00F2, 556},
-    {-1, 0x010C, 722},
-    {-1, 0x00F9, 556},
-    {-1, 0x221A, 453},
-    {-1, 0x010E, 722},
-    {-1, 0x0157, 333},
-    {-1, 0x00D1, 722},
+    {-1, 0x00F3, 556},
+    {-1, 0x00F4, 556},
     {-1, 0x00F5, 556},
-    {-1, 0x0156, 722},
-    {-1, 0x013B, 556},
-    {-1, 0x00C3, 667},
+    {-1, 0x00F6, 556},
+    {-1, 0x00F7, 584},
+    {249, 0x00F8, 611},
+    {-1, 0x00F9, 556},
+    {-1, 0x00FA, 556},
+    {-1, 0x00FB, 556},
+    {-1, 0x00FC, 556},
+    {-1, 0x00FD, 500},
+    {-1, 0x00FE, 556},
+    {-1, 0x00FF, 500},
+    {-1, 0x0100, 667},
+    {-1, 0x0101, 556},
+    {-1, 0x0102, 667},
+    {-1, 0x0103, 556},
     {-1, 0x0104, 667},
-    {-1, 0x00C5, 667},
-    {-1, 0x00D5, 778},
-    {-1, 0x017C, 500},
+    {-1, 0x0105, 556},
+    {-1, 0x0106, 722},
+    {-1, 0x0107, 500},
+    {-1, 0x010C, 722},
+    {-1, 0x010D, 500},
+    {-1, 0x010E, 722},
+    {-1, 0x010F, 643},
+    {-1, 0x0110, 722},
+    {-1, 0x0111, 556},
+    {-1, 0x0112, 667},
+    {-1, 0x0113, 556},
+    {-1, 0x0116, 667},
+    {-1, 0x0117, 556},
+    {-1, 0x0118, 667},
+    {-1, 0x0119, 556},
     {-1, 0x011A, 667},
+    {-1, 0x011B, 556},
+    {-1, 0x011E, 778},
+    {-1, 0x011F, 556},
+    {-1, 0x0122, 778},
+    {-1, 0x0123, 556},
+    {-1, 0x012A, 278},
+    {-1, 0x012B, 278},
     {-1, 0x012E, 278},
+    {-1, 0x012F, 222},
+    {-1, 0x0130, 278},
+    {245, 0x0131, 278},
+    {-1, 0x0136, 667},
     {-1, 0x0137, 500},
-    {-1, 0x2212, 584},
-    {-1, 0x00CE, 278},
+    {-1, 0x0139, 556},
+    {-1, 0x013A, 222},
+    {-1, 0x013B, 556},
+    {-1, 0x013C, 222},
+    {-1, 0x013D, 556},
+    {-1, 0x013E, 299},
+    {232, 0x0141, 556},
+    {248, 0x0142, 222},
+    {-1, 0x0143, 722},
+    {-1, 0x0144, 556},
+    {-1, 0x0145, 722},
+    {-1, 0x0146, 556},
+    {-1, 0x0147, 722},
     {-1, 0x0148, 556},
+    {-1, 0x014C, 778},
+    {-1, 0x014D, 556},
+    {-1, 0x0150, 778},
+    {-1, 0x0151, 556},
+    {234, 0x0152, 1000},
+    {250, 0x0153, 944},
+    {-1, 0x0154, 722},
+    {-1, 0x0155, 333},
+    {-1, 0x0156, 722},
+    {-1, 0x0157, 333},
+    {-1, 0x0158, 722},
+    {-1, 0x0159, 333},
+    {-1, 0x015A, 667},
+    {-1, 0x015B, 500},
+    {-1, 0x015E, 667},
+    {-1, 0x015F, 500},
+    {-1, 0x0160, 667},
+    {-1, 0x0161, 500},
+    {-1, 0x0162, 611},
     {-1, 0x0163, 278},
-    {-1, 0x00AC, 584},
-    {-1, 0x00F6, 556},
-    {-1, 0x00FC, 556},
-    {-1, 0x2260, 549},
-    {-1, 0x0123, 556},
-    {-1, 0x00F0, 556},
+    {-1, 0x0164, 611},
+    {-1, 0x0165, 316},
+    {-1, 0x016A, 722},
+    {-1, 0x016B, 556},
+    {-1, 0x016E, 722},
+    {-1, 0x016F, 556},
+    {-1, 0x0170, 722},
+    {-1, 0x0171, 556},
+    {-1, 0x0172, 722},
+    {-1, 0x0173, 556},
+    {-1, 0x0178, 667},
+    {-1, 0x0179, 611},
+    {-1, 0x017A, 500},
+    {-1, 0x017B, 611},
+    {-1, 0x017C, 500},
+    {-1, 0x017D, 611},
     {-1, 0x017E, 500},
-    {-1, 0x0146, 556},
-    {-1, 0x00B9, 333},
-    {-1, 0x012B, 278},
+    {166, 0x0192, 556},
+    {-1, 0x0218, 667},
+    {-1, 0x0219, 500},
+    {195, 0x02C6, 333},
+    {207, 0x02C7, 333},
+    {198, 0x02D8, 333},
+    {199, 0x02D9, 333},
+    {202, 0x02DA, 333},
+    {206, 0x02DB, 333},
+    {196, 0x02DC, 333},
+    {205, 0x02DD, 333},
+    {-1, 0x0394, 612},
+    {177, 0x2013, 556},
+    {208, 0x2014, 1000},
+    {96, 0x2018, 222},
+    {39, 0x2019, 222},
+    {184, 0x201A, 222},
+    {170, 0x201C, 333},
+    {186, 0x201D, 333},
+    {185, 0x201E, 333},
+    {178, 0x2020, 556},
+    {179, 0x2021, 556},
+    {183, 0x2022, 350},
+    {188, 0x2026, 1000},
+    {189, 0x2030, 1000},
+    {172, 0x2039, 333},
+    {173, 0x203A, 333},
+    {164, 0x2044, 167},
     {-1, 0x20AC, 556},
+    {-1, 0x2122, 1000},
+    {-1, 0x2202, 476},
+    {-1, 0x2211, 600},
+    {-1, 0x2212, 584},
+    {-1, 0x221A, 453},
+    {-1, 0x2260, 549},
+    {-1, 0x2264, 549},
+    {-1, 0x2265, 549},
+    {-1, 0x25CA, 471},
+    {-1, 0xF6C3, 250},
+    {174, 0xFB01, 500},
+    {175, 0xFB02, 500},
     {-1, 0xFFFF, 0}
     };
 
@@ -2579,7 +2583,7 @@ static const HPDF_CharData CHAR_DATA_TIMES_ROMAN[316] = {
     {36, 0x0024, 500},
     {37, 0x0025, 833},
     {38, 0x0026, 778},
-    {39, 0x2019, 333},
+    {169, 0x0027, 180},
     {40, 0x0028, 333},
     {41, 0x0029, 333},
     {42, 0x002A, 500},
@@ -2636,7 +2640,7 @@ static const HPDF_CharData CHAR_DATA_TIMES_ROMAN[316] = {
     {93, 0x005D, 333},
     {94, 0x005E, 469},
     {95, 0x005F, 500},
-    {96, 0x2018, 333},
+    {193, 0x0060, 333},
     {97, 0x0061, 444},
     {98, 0x0062, 500},
     {99, 0x0063, 444},
@@ -2670,223 +2674,223 @@ static const HPDF_CharData CHAR_DATA_TIMES_ROMAN[316] = {
     {161, 0x00A1, 333},
     {162, 0x00A2, 500},
     {163, 0x00A3, 500},
-    {164, 0x2044, 167},
+    {168, 0x00A4, 500},
     {165, 0x00A5, 500},
-    {166, 0x0192, 500},
+    {-1, 0x00A6, 200},
     {167, 0x00A7, 500},
-    {168, 0x00A4, 500},
-    {169, 0x0027, 180},
-    {170, 0x201C, 444},
+    {200, 0x00A8, 333},
+    {-1, 0x00A9, 760},
+    {227, 0x00AA, 276},
     {171, 0x00AB, 500},
-    {172, 0x2039, 333},
-    {173, 0x203A, 333},
-    {174, 0xFB01, 556},
-    {175, 0xFB02, 556},
-    {177, 0x2013, 500},
-    {178, 0x2020, 500},
-    {179, 0x2021, 500},
-    {180, 0x00B7, 250},
+    {-1, 0x00AC, 564},
+    {-1, 0x00AE, 760},
+    {197, 0x00AF, 333},
+    {-1, 0x00B0, 400},
+    {-1, 0x00B1, 564},
+    {-1, 0x00B2, 300},
+    {-1, 0x00B3, 300},
+    {194, 0x00B4, 333},
+    {-1, 0x00B5, 500},
     {182, 0x00B6, 453},
-    {183, 0x2022, 350},
-    {184, 0x201A, 333},
-    {185, 0x201E, 444},
-    {186, 0x201D, 444},
+    {180, 0x00B7, 250},
+    {203, 0x00B8, 333},
+    {-1, 0x00B9, 300},
+    {235, 0x00BA, 310},
     {187, 0x00BB, 500},
-    {188, 0x2026, 1000},
-    {189, 0x2030, 1000},
+    {-1, 0x00BC, 750},
+    {-1, 0x00BD, 750},
+    {-1, 0x00BE, 750},
     {191, 0x00BF, 444},
-    {193, 0x0060, 333},
-    {194, 0x00B4, 333},
-    {195, 0x02C6, 333},
-    {196, 0x02DC, 333},
-    {197, 0x00AF, 333},
-    {198, 0x02D8, 333},
-    {199, 0x02D9, 333},
-    {200, 0x00A8, 333},
-    {202, 0x02DA, 333},
-    {203, 0x00B8, 333},
-    {205, 0x02DD, 333},
-    {206, 0x02DB, 333},
-    {207, 0x02C7, 333},
-    {208, 0x2014, 1000},
+    {-1, 0x00C0, 722},
+    {-1, 0x00C1, 722},
+    {-1, 0x00C2, 722},
+    {-1, 0x00C3, 722},
+    {-1, 0x00C4, 722},
+    {-1, 0x00C5, 722},
     {225, 0x00C6, 889},
-    {227, 0x00AA, 276},
-    {232, 0x0141, 611},
+    {-1, 0x00C7, 667},
+    {-1, 0x00C8, 611},
+    {-1, 0x00C9, 611},
+    {-1, 0x00CA, 611},
+    {-1, 0x00CB, 611},
+    {-1, 0x00CC, 333},
+    {-1, 0x00CD, 333},
+    {-1, 0x00CE, 333},
+    {-1, 0x00CF, 333},
+    {-1, 0x00D0, 722},
+    {-1, 0x00D1, 722},
+    {-1, 0x00D2, 722},
+    {-1, 0x00D3, 722},
+    {-1, 0x00D4, 722},
+    {-1, 0x00D5, 722},
+    {-1, 0x00D6, 722},
+    {-1, 0x00D7, 564},
     {233, 0x00D8, 722},
-    {234, 0x0152, 889},
-    {235, 0x00BA, 310},
-    {241, 0x00E6, 667},
-    {245, 0x0131, 278},
-    {248, 0x0142, 278},
-    {249, 0x00F8, 500},
-    {250, 0x0153, 722},
+    {-1, 0x00D9, 722},
+    {-1, 0x00DA, 722},
+    {-1, 0x00DB, 722},
+    {-1, 0x00DC, 722},
+    {-1, 0x00DD, 722},
+    {-1, 0x00DE, 556},
     {251, 0x00DF, 500},
-    {-1, 0x00CF, 333},
+    {-1, 0x00E0, 444},
+    {-1, 0x00E1, 444},
+    {-1, 0x00E2, 444},
+    {-1, 0x00E3, 444},
+    {-1, 0x00E4, 444},
+    {-1, 0x00E5, 444},
+    {241, 0x00E6, 667},
+    {-1, 0x00E7, 444},
+    {-1, 0x00E8, 444},
     {-1, 0x00E9, 444},
-    {-1, 0x0103, 444},
-    {-1, 0x0171, 500},
-    {-1, 0x011B, 444},
-    {-1, 0x0178, 722},
+    {-1, 0x00EA, 444},
+    {-1, 0x00EB, 444},
+    {-1, 0x00EC, 278},
+    {-1, 0x00ED, 278},
+    {-1, 0x00EE, 278},
+    {-1, 0x00EF, 278},
+    {-1, 0x00F0, 500},
+    {-1, 0x00F1, 500},
+    {-1, 0x00F2, 500},
+    {-1, 0x00F3, 500},
+    {-1, 0x00F4, 500},
+    {-1, 0x00F5, 500},
+    {-1, 0x00F6, 500},
     {-1, 0x00F7, 564},
-    {-1, 0x00DD, 722},
-    {-1, 0x00C2, 722},
-    {-1, 0x00E1, 444},
-    {-1, 0x00DB, 722},
+    {249, 0x00F8, 500},
+    {-1, 0x00F9, 500},
+    {-1, 0x00FA, 500},
+    {-1, 0x00FB, 500},
+    {-1, 0x00FC, 500},
     {-1, 0x00FD, 500},
-    {-1, 0x0219, 389},
-    {-1, 0x00EA, 444},
-    {-1, 0x016E, 722},
-    {-1, 0x00DC, 722},
+    {-1, 0x00FE, 500},
+    {-1, 0x00FF, 500},
+    {-1, 0x0100, 722},
+    {-1, 0x0101, 444},
+    {-1, 0x0102, 722},
+    {-1, 0x0103, 444},
+    {-1, 0x0104, 722},
     {-1, 0x0105, 444},
-    {-1, 0x00DA, 722},
-    {-1, 0x0173, 500},
-    {-1, 0x00CB, 611},
+    {-1, 0x0106, 667},
+    {-1, 0x0107, 444},
+    {-1, 0x010C, 667},
+    {-1, 0x010D, 444},
+    {-1, 0x010E, 722},
+    {-1, 0x010F, 588},
     {-1, 0x0110, 722},
-    {-1, 0xF6C3, 250},
-    {-1, 0x00A9, 760},
+    {-1, 0x0111, 500},
     {-1, 0x0112, 611},
-    {-1, 0x010D, 444},
-    {-1, 0x00E5, 444},
-    {-1, 0x0145, 722},
-    {-1, 0x013A, 278},
-    {-1, 0x00E0, 444},
-    {-1, 0x0162, 611},
-    {-1, 0x0106, 667},
-    {-1, 0x00E3, 444},
+    {-1, 0x0113, 444},
     {-1, 0x0116, 611},
-    {-1, 0x0161, 389},
-    {-1, 0x015F, 389},
-    {-1, 0x00ED, 278},
-    {-1, 0x25CA, 471},
-    {-1, 0x0158, 667},
+    {-1, 0x0117, 444},
+    {-1, 0x0118, 611},
+    {-1, 0x0119, 444},
+    {-1, 0x011A, 611},
+    {-1, 0x011B, 444},
+    {-1, 0x011E, 722},
+    {-1, 0x011F, 500},
     {-1, 0x0122, 722},
-    {-1, 0x00FB, 500},
-    {-1, 0x00E2, 444},
-    {-1, 0x0100, 722},
-    {-1, 0x0159, 333},
-    {-1, 0x00E7, 444},
-    {-1, 0x017B, 611},
-    {-1, 0x00DE, 556},
+    {-1, 0x0123, 500},
+    {-1, 0x012A, 333},
+    {-1, 0x012B, 278},
+    {-1, 0x012E, 333},
+    {-1, 0x012F, 278},
+    {-1, 0x0130, 333},
+    {245, 0x0131, 278},
+    {-1, 0x0136, 722},
+    {-1, 0x0137, 500},
+    {-1, 0x0139, 611},
+    {-1, 0x013A, 278},
+    {-1, 0x013B, 611},
+    {-1, 0x013C, 278},
+    {-1, 0x013D, 611},
+    {-1, 0x013E, 344},
+    {232, 0x0141, 611},
+    {248, 0x0142, 278},
+    {-1, 0x0143, 722},
+    {-1, 0x0144, 500},
+    {-1, 0x0145, 722},
+    {-1, 0x0146, 500},
+    {-1, 0x0147, 722},
+    {-1, 0x0148, 500},
     {-1, 0x014C, 722},
+    {-1, 0x014D, 500},
+    {-1, 0x0150, 722},
+    {-1, 0x0151, 500},
+    {234, 0x0152, 889},
+    {250, 0x0153, 722},
     {-1, 0x0154, 667},
+    {-1, 0x0155, 333},
+    {-1, 0x0156, 667},
+    {-1, 0x0157, 333},
+    {-1, 0x0158, 667},
+    {-1, 0x0159, 333},
     {-1, 0x015A, 556},
-    {-1, 0x010F, 588},
-    {-1, 0x016A, 722},
-    {-1, 0x016F, 500},
-    {-1, 0x00B3, 300},
-    {-1, 0x00D2, 722},
-    {-1, 0x00C0, 722},
-    {-1, 0x0102, 722},
-    {-1, 0x00D7, 564},
-    {-1, 0x00FA, 500},
+    {-1, 0x015B, 389},
+    {-1, 0x015E, 556},
+    {-1, 0x015F, 389},
+    {-1, 0x0160, 556},
+    {-1, 0x0161, 389},
+    {-1, 0x0162, 611},
+    {-1, 0x0163, 278},
     {-1, 0x0164, 611},
-    {-1, 0x2202, 476},
-    {-1, 0x00FF, 500},
-    {-1, 0x0143, 722},
-    {-1, 0x00EE, 278},
-    {-1, 0x00CA, 611},
-    {-1, 0x00E4, 444},
-    {-1, 0x00EB, 444},
-    {-1, 0x0107, 444},
-    {-1, 0x0144, 500},
+    {-1, 0x0165, 326},
+    {-1, 0x016A, 722},
     {-1, 0x016B, 500},
-    {-1, 0x0147, 722},
-    {-1, 0x00CD, 333},
-    {-1, 0x00B1, 564},
-    {-1, 0x00A6, 200},
-    {-1, 0x00AE, 760},
-    {-1, 0x011E, 722},
-    {-1, 0x0130, 333},
-    {-1, 0x2211, 600},
-    {-1, 0x00C8, 611},
-    {-1, 0x0155, 333},
-    {-1, 0x014D, 500},
-    {-1, 0x0179, 611},
-    {-1, 0x017D, 611},
-    {-1, 0x2265, 549},
-    {-1, 0x00D0, 722},
-    {-1, 0x00C7, 667},
-    {-1, 0x013C, 278},
-    {-1, 0x0165, 326},
-    {-1, 0x0119, 444},
+    {-1, 0x016E, 722},
+    {-1, 0x016F, 500},
+    {-1, 0x0170, 722},
+    {-1, 0x0171, 500},
     {-1, 0x0172, 722},
-    {-1, 0x00C1, 722},
-    {-1, 0x00C4, 722},
-    {-1, 0x00E8, 444},
+    {-1, 0x0173, 500},
+    {-1, 0x0178, 722},
+    {-1, 0x0179, 611},
     {-1, 0x017A, 444},
-    {-1, 0x012F, 278},
-    {-1, 0x00D3, 722},
-    {-1, 0x00F3, 500},
-    {-1, 0x0101, 444},
-    {-1, 0x015B, 389},
-    {-1, 0x00EF, 278},
-    {-1, 0x00D4, 722},
-    {-1, 0x00D9, 722},
+    {-1, 0x017B, 611},
+    {-1, 0x017C, 444},
+    {-1, 0x017D, 611},
+    {-1, 0x017E, 444},
+    {166, 0x0192, 500},
+    {-1, 0x0218, 556},
+    {-1, 0x0219, 389},
+    {195, 0x02C6, 333},
+    {207, 0x02C7, 333},
+    {198, 0x02D8, 333},
+    {199, 0x02D9, 333},
+    {202, 0x02DA, 333},
+    {206, 0x02DB, 333},
+    {196, 0x02DC, 333},
+    {205, 0x02DD, 333},
     {-1, 0x0394, 612},
-    {-1, 0x00FE, 500},
-    {-1, 0x00B2, 300},
-    {-1, 0x00D6, 722},
-    {-1, 0x00B5, 500},
-    {-1, 0x00EC, 278},
-    {-1, 0x0151, 500},
-    {-1, 0x0118, 611},
-    {-1, 0x0111, 500},
-    {-1, 0x00BE, 750},
-    {-1, 0x015E, 556},
-    {-1, 0x013E, 344},
-    {-1, 0x0136, 722},
-    {-1, 0x0139, 611},
+    {177, 0x2013, 500},
+    {208, 0x2014, 1000},
+    {96, 0x2018, 333},
+    {39, 0x2019, 333},
+    {184, 0x201A, 333},
+    {170, 0x201C, 444},
+    {186, 0x201D, 444},
+    {185, 0x201E, 444},
+    {178, 0x2020, 500},
+    {179, 0x2021, 500},
+    {183, 0x2022, 350},
+    {188, 0x2026, 1000},
+    {189, 0x2030, 1000},
+    {172, 0x2039, 333},
+    {173, 0x203A, 333},
+    {164, 0x2044, 167},
+    {-1, 0x20AC, 500},
     {-1, 0x2122, 980},
-    {-1, 0x0117, 444},
-    {-1, 0x00CC, 333},
-    {-1, 0x012A, 333},
-    {-1, 0x013D, 611},
-    {-1, 0x00BD, 750},
-    {-1, 0x2264, 549},
-    {-1, 0x00F4, 500},
-    {-1, 0x00F1, 500},
-    {-1, 0x0170, 722},
-    {-1, 0x00C9, 611},
-    {-1, 0x0113, 444},
-    {-1, 0x011F, 500},
-    {-1, 0x00BC, 750},
-    {-1, 0x0160, 556},
-    {-1, 0x0218, 556},
-    {-1, 0x0150, 722},
-    {-1, 0x00B0, 400},
-    {-1, 0x00F2, 500},
-    {-1, 0x010C, 667},
-    {-1, 0x00F9, 500},
-    {-1, 0x221A, 453},
-    {-1, 0x010E, 722},
-    {-1, 0x0157, 333},
-    {-1, 0x00D1, 722},
-    {-1, 0x00F5, 500},
-    {-1, 0x0156, 667},
-    {-1, 0x013B, 611},
-    {-1, 0x00C3, 722},
-    {-1, 0x0104, 722},
-    {-1, 0x00C5, 722},
-    {-1, 0x00D5, 722},
-    {-1, 0x017C, 444},
-    {-1, 0x011A, 611},
-    {-1, 0x012E, 333},
-    {-1, 0x0137, 500},
+    {-1, 0x2202, 476},
+    {-1, 0x2211, 600},
     {-1, 0x2212, 564},
-    {-1, 0x00CE, 333},
-    {-1, 0x0148, 500},
-    {-1, 0x0163, 278},
-    {-1, 0x00AC, 564},
-    {-1, 0x00F6, 500},
-    {-1, 0x00FC, 500},
+    {-1, 0x221A, 453},
     {-1, 0x2260, 549},
-    {-1, 0x0123, 500},
-    {-1, 0x00F0, 500},
-    {-1, 0x017E, 444},
-    {-1, 0x0146, 500},
-    {-1, 0x00B9, 300},
-    {-1, 0x012B, 278},
-    {-1, 0x20AC, 500},
+    {-1, 0x2264, 549},
+    {-1, 0x2265, 549},
+    {-1, 0x25CA, 471},
+    {-1, 0xF6C3, 250},
+    {174, 0xFB01, 556},
+    {175, 0xFB02, 556},
     {-1, 0xFFFF, 0}
     };
 
@@ -2898,7 +2902,7 @@ static const HPDF_CharData CHAR_DATA_TIMES_BOLD[316] = {
     {36, 0x0024, 500},
     {37, 0x0025, 1000},
     {38, 0x0026, 833},
-    {39, 0x2019, 333},
+    {169, 0x0027, 278},
     {40, 0x0028, 333},
     {41, 0x0029, 333},
     {42, 0x002A, 500},
@@ -2955,7 +2959,7 @@ static const HPDF_CharData CHAR_DATA_TIMES_BOLD[316] = {
     {93, 0x005D, 333},
     {94, 0x005E, 581},
     {95, 0x005F, 500},
-    {96, 0x2018, 333},
+    {193, 0x0060, 333},
     {97, 0x0061, 500},
     {98, 0x0062, 556},
     {99, 0x0063, 444},
@@ -2989,223 +2993,223 @@ static const HPDF_CharData CHAR_DATA_TIMES_BOLD[316] = {
     {161, 0x00A1, 333},
     {162, 0x00A2, 500},
     {163, 0x00A3, 500},
-    {164, 0x2044, 167},
+    {168, 0x00A4, 500},
     {165, 0x00A5, 500},
-    {166, 0x0192, 500},
+    {-1, 0x00A6, 220},
     {167, 0x00A7, 500},
-    {168, 0x00A4, 500},
-    {169, 0x0027, 278},
-    {170, 0x201C, 500},
+    {200, 0x00A8, 333},
+    {-1, 0x00A9, 747},
+    {227, 0x00AA, 300},
     {171, 0x00AB, 500},
-    {172, 0x2039, 333},
-    {173, 0x203A, 333},
-    {174, 0xFB01, 556},
-    {175, 0xFB02, 556},
-    {177, 0x2013, 500},
-    {178, 0x2020, 500},
-    {179, 0x2021, 500},
-    {180, 0x00B7, 250},
+    {-1, 0x00AC, 570},
+    {-1, 0x00AE, 747},
+    {197, 0x00AF, 333},
+    {-1, 0x00B0, 400},
+    {-1, 0x00B1, 570},
+    {-1, 0x00B2, 300},
+    {-1, 0x00B3, 300},
+    {194, 0x00B4, 333},
+    {-1, 0x00B5, 556},
     {182, 0x00B6, 540},
-    {183, 0x2022, 350},
-    {184, 0x201A, 333},
-    {185, 0x201E, 500},
-    {186, 0x201D, 500},
+    {180, 0x00B7, 250},
+    {203, 0x00B8, 333},
+    {-1, 0x00B9, 300},
+    {235, 0x00BA, 330},
     {187, 0x00BB, 500},
-    {188, 0x2026, 1000},
-    {189, 0x2030, 1000},
+    {-1, 0x00BC, 750},
+    {-1, 0x00BD, 750},
+    {-1, 0x00BE, 750},
     {191, 0x00BF, 500},
-    {193, 0x0060, 333},
-    {194, 0x00B4, 333},
-    {195, 0x02C6, 333},
-    {196, 0x02DC, 333},
-    {197, 0x00AF, 333},
-    {198, 0x02D8, 333},
-    {199, 0x02D9, 333},
-    {200, 0x00A8, 333},
-    {202, 0x02DA, 333},
-    {203, 0x00B8, 333},
-    {205, 0x02DD, 333},
-    {206, 0x02DB, 333},
-    {207, 0x02C7, 333},
-    {208, 0x2014, 1000},
+    {-1, 0x00C0, 722},
+    {-1, 0x00C1, 722},
+    {-1, 0x00C2, 722},
+    {-1, 0x00C3, 722},
+    {-1, 0x00C4, 722},
+    {-1, 0x00C5, 722},
     {225, 0x00C6, 1000},
-    {227, 0x00AA, 300},
-    {232, 0x0141, 667},
-    {233, 0x00D8, 778},
-    {234, 0x0152, 1000},
-    {235, 0x00BA, 330},
-    {241, 0x00E6, 722},
-    {245, 0x0131, 278},
-    {248, 0x0142, 278},
-    {249, 0x00F8, 500},
-    {250, 0x0153, 722},
-    {251, 0x00DF, 556},
+    {-1, 0x00C7, 722},
+    {-1, 0x00C8, 667},
+    {-1, 0x00C9, 667},
+    {-1, 0x00CA, 667},
+    {-1, 0x00CB, 667},
+    {-1, 0x00CC, 389},
+    {-1, 0x00CD, 389},
+    {-1, 0x00CE, 389},
     {-1, 0x00CF, 389},
-    {-1, 0x00E9, 444},
-    {-1, 0x0103, 500},
-    {-1, 0x0171, 556},
-    {-1, 0x011B, 444},
-    {-1, 0x0178, 722},
-    {-1, 0x00F7, 570},
-    {-1, 0x00DD, 722},
-    {-1, 0x00C2, 722},
-    {-1, 0x00E1, 500},
+    {-1, 0x00D0, 722},
+    {-1, 0x00D1, 722},
+    {-1, 0x00D2, 778},
+    {-1, 0x00D3, 778},
+    {-1, 0x00D4, 778},
+    {-1, 0x00D5, 778},
+    {-1, 0x00D6, 778},
+    {-1, 0x00D7, 570},
+    {233, 0x00D8, 778},
+    {-1, 0x00D9, 722},
+    {-1, 0x00DA, 722},
     {-1, 0x00DB, 722},
-    {-1, 0x00FD, 500},
-    {-1, 0x0219, 389},
-    {-1, 0x00EA, 444},
-    {-1, 0x016E, 722},
     {-1, 0x00DC, 722},
-    {-1, 0x0105, 500},
-    {-1, 0x00DA, 722},
-    {-1, 0x0173, 556},
-    {-1, 0x00CB, 667},
-    {-1, 0x0110, 722},
-    {-1, 0xF6C3, 250},
-    {-1, 0x00A9, 747},
-    {-1, 0x0112, 667},
-    {-1, 0x010D, 444},
-    {-1, 0x00E5, 500},
-    {-1, 0x0145, 722},
-    {-1, 0x013A, 278},
+    {-1, 0x00DD, 722},
+    {-1, 0x00DE, 611},
+    {251, 0x00DF, 556},
     {-1, 0x00E0, 500},
-    {-1, 0x0162, 667},
-    {-1, 0x0106, 722},
+    {-1, 0x00E1, 500},
+    {-1, 0x00E2, 500},
     {-1, 0x00E3, 500},
-    {-1, 0x0116, 667},
-    {-1, 0x0161, 389},
-    {-1, 0x015F, 389},
-    {-1, 0x00ED, 278},
-    {-1, 0x25CA, 494},
-    {-1, 0x0158, 722},
-    {-1, 0x0122, 778},
-    {-1, 0x00FB, 556},
-    {-1, 0x00E2, 500},
-    {-1, 0x0100, 722},
-    {-1, 0x0159, 444},
-    {-1, 0x00E7, 444},
-    {-1, 0x017B, 667},
-    {-1, 0x00DE, 611},
-    {-1, 0x014C, 778},
-    {-1, 0x0154, 722},
-    {-1, 0x015A, 556},
-    {-1, 0x010F, 672},
-    {-1, 0x016A, 722},
-    {-1, 0x016F, 556},
-    {-1, 0x00B3, 300},
-    {-1, 0x00D2, 778},
-    {-1, 0x00C0, 722},
-    {-1, 0x0102, 722},
-    {-1, 0x00D7, 570},
-    {-1, 0x00FA, 556},
-    {-1, 0x0164, 667},
-    {-1, 0x2202, 494},
-    {-1, 0x00FF, 500},
-    {-1, 0x0143, 722},
-    {-1, 0x00EE, 278},
-    {-1, 0x00CA, 667},
     {-1, 0x00E4, 500},
-    {-1, 0x00EB, 444},
-    {-1, 0x0107, 444},
-    {-1, 0x0144, 556},
-    {-1, 0x016B, 556},
-    {-1, 0x0147, 722},
-    {-1, 0x00CD, 389},
-    {-1, 0x00B1, 570},
-    {-1, 0x00A6, 220},
-    {-1, 0x00AE, 747},
-    {-1, 0x011E, 778},
-    {-1, 0x0130, 389},
-    {-1, 0x2211, 600},
-    {-1, 0x00C8, 667},
-    {-1, 0x0155, 444},
-    {-1, 0x014D, 500},
-    {-1, 0x0179, 667},
-    {-1, 0x017D, 667},
-    {-1, 0x2265, 549},
-    {-1, 0x00D0, 722},
-    {-1, 0x00C7, 722},
-    {-1, 0x013C, 278},
-    {-1, 0x0165, 416},
-    {-1, 0x0119, 444},
-    {-1, 0x0172, 722},
-    {-1, 0x00C1, 722},
-    {-1, 0x00C4, 722},
+    {-1, 0x00E5, 500},
+    {241, 0x00E6, 722},
+    {-1, 0x00E7, 444},
     {-1, 0x00E8, 444},
-    {-1, 0x017A, 444},
-    {-1, 0x012F, 278},
-    {-1, 0x00D3, 778},
-    {-1, 0x00F3, 500},
-    {-1, 0x0101, 500},
-    {-1, 0x015B, 389},
-    {-1, 0x00EF, 278},
-    {-1, 0x00D4, 778},
-    {-1, 0x00D9, 722},
-    {-1, 0x0394, 612},
-    {-1, 0x00FE, 556},
-    {-1, 0x00B2, 300},
-    {-1, 0x00D6, 778},
-    {-1, 0x00B5, 556},
+    {-1, 0x00E9, 444},
+    {-1, 0x00EA, 444},
+    {-1, 0x00EB, 444},
     {-1, 0x00EC, 278},
-    {-1, 0x0151, 500},
-    {-1, 0x0118, 667},
-    {-1, 0x0111, 556},
-    {-1, 0x00BE, 750},
-    {-1, 0x015E, 556},
-    {-1, 0x013E, 394},
-    {-1, 0x0136, 778},
-    {-1, 0x0139, 667},
-    {-1, 0x2122, 1000},
-    {-1, 0x0117, 444},
-    {-1, 0x00CC, 389},
-    {-1, 0x012A, 389},
-    {-1, 0x013D, 667},
-    {-1, 0x00BD, 750},
-    {-1, 0x2264, 549},
-    {-1, 0x00F4, 500},
+    {-1, 0x00ED, 278},
+    {-1, 0x00EE, 278},
+    {-1, 0x00EF, 278},
+    {-1, 0x00F0, 500},
     {-1, 0x00F1, 556},
-    {-1, 0x0170, 722},
-    {-1, 0x00C9, 667},
-    {-1, 0x0113, 444},
-    {-1, 0x011F, 500},
-    {-1, 0x00BC, 750},
-    {-1, 0x0160, 556},
-    {-1, 0x0218, 556},
-    {-1, 0x0150, 778},
-    {-1, 0x00B0, 400},
     {-1, 0x00F2, 500},
-    {-1, 0x010C, 722},
-    {-1, 0x00F9, 556},
-    {-1, 0x221A, 549},
-    {-1, 0x010E, 722},
-    {-1, 0x0157, 444},
-    {-1, 0x00D1, 722},
+    {-1, 0x00F3, 500},
+    {-1, 0x00F4, 500},
     {-1, 0x00F5, 500},
-    {-1, 0x0156, 722},
-    {-1, 0x013B, 667},
-    {-1, 0x00C3, 722},
+    {-1, 0x00F6, 500},
+    {-1, 0x00F7, 570},
+    {249, 0x00F8, 500},
+    {-1, 0x00F9, 556},
+    {-1, 0x00FA, 556},
+    {-1, 0x00FB, 556},
+    {-1, 0x00FC, 556},
+    {-1, 0x00FD, 500},
+    {-1, 0x00FE, 556},
+    {-1, 0x00FF, 500},
+    {-1, 0x0100, 722},
+    {-1, 0x0101, 500},
+    {-1, 0x0102, 722},
+    {-1, 0x0103, 500},
     {-1, 0x0104, 722},
-    {-1, 0x00C5, 722},
-    {-1, 0x00D5, 778},
-    {-1, 0x017C, 444},
+    {-1, 0x0105, 500},
+    {-1, 0x0106, 722},
+    {-1, 0x0107, 444},
+    {-1, 0x010C, 722},
+    {-1, 0x010D, 444},
+    {-1, 0x010E, 722},
+    {-1, 0x010F, 672},
+    {-1, 0x0110, 722},
+    {-1, 0x0111, 556},
+    {-1, 0x0112, 667},
+    {-1, 0x0113, 444},
+    {-1, 0x0116, 667},
+    {-1, 0x0117, 444},
+    {-1, 0x0118, 667},
+    {-1, 0x0119, 444},
     {-1, 0x011A, 667},
+    {-1, 0x011B, 444},
+    {-1, 0x011E, 778},
+    {-1, 0x011F, 500},
+    {-1, 0x0122, 778},
+    {-1, 0x0123, 500},
+    {-1, 0x012A, 389},
+    {-1, 0x012B, 278},
     {-1, 0x012E, 389},
+    {-1, 0x012F, 278},
+    {-1, 0x0130, 389},
+    {245, 0x0131, 278},
+    {-1, 0x0136, 778},
     {-1, 0x0137, 556},
-    {-1, 0x2212, 570},
-    {-1, 0x00CE, 389},
+    {-1, 0x0139, 667},
+    {-1, 0x013A, 278},
+    {-1, 0x013B, 667},
+    {-1, 0x013C, 278},
+    {-1, 0x013D, 667},
+    {-1, 0x013E, 394},
+    {232, 0x0141, 667},
+    {248, 0x0142, 278},
+    {-1, 0x0143, 722},
+    {-1, 0x0144, 556},
+    {-1, 0x0145, 722},
+    {-1, 0x0146, 556},
+    {-1, 0x0147, 722},
     {-1, 0x0148, 556},
+    {-1, 0x014C, 778},
+    {-1, 0x014D, 500},
+    {-1, 0x0150, 778},
+    {-1, 0x0151, 500},
+    {234, 0x0152, 1000},
+    {250, 0x0153, 722},
+    {-1, 0x0154, 722},
+    {-1, 0x0155, 444},
+    {-1, 0x0156, 722},
+    {-1, 0x0157, 444},
+    {-1, 0x0158, 722},
+    {-1, 0x0159, 444},
+    {-1, 0x015A, 556},
+    {-1, 0x015B, 389},
+    {-1, 0x015E, 556},
+    {-1, 0x015F, 389},
+    {-1, 0x0160, 556},
+    {-1, 0x0161, 389},
+    {-1, 0x0162, 667},
     {-1, 0x0163, 333},
-    {-1, 0x00AC, 570},
-    {-1, 0x00F6, 500},
-    {-1, 0x00FC, 556},
-    {-1, 0x2260, 549},
-    {-1, 0x0123, 500},
-    {-1, 0x00F0, 500},
+    {-1, 0x0164, 667},
+    {-1, 0x0165, 416},
+    {-1, 0x016A, 722},
+    {-1, 0x016B, 556},
+    {-1, 0x016E, 722},
+    {-1, 0x016F, 556},
+    {-1, 0x0170, 722},
+    {-1, 0x0171, 556},
+    {-1, 0x0172, 722},
+    {-1, 0x0173, 556},
+    {-1, 0x0178, 722},
+    {-1, 0x0179, 667},
+    {-1, 0x017A, 444},
+    {-1, 0x017B, 667},
+    {-1, 0x017C, 444},
+    {-1, 0x017D, 667},
     {-1, 0x017E, 444},
-    {-1, 0x0146, 556},
-    {-1, 0x00B9, 300},
-    {-1, 0x012B, 278},
+    {166, 0x0192, 500},
+    {-1, 0x0218, 556},
+    {-1, 0x0219, 389},
+    {195, 0x02C6, 333},
+    {207, 0x02C7, 333},
+    {198, 0x02D8, 333},
+    {199, 0x02D9, 333},
+    {202, 0x02DA, 333},
+    {206, 0x02DB, 333},
+    {196, 0x02DC, 333},
+    {205, 0x02DD, 333},
+    {-1, 0x0394, 612},
+    {177, 0x2013, 500},
+    {208, 0x2014, 1000},
+    {96, 0x2018, 333},
+    {39, 0x2019, 333},
+    {184, 0x201A, 333},
+    {170, 0x201C, 500},
+    {186, 0x201D, 500},
+    {185, 0x201E, 500},
+    {178, 0x2020, 500},
+    {179, 0x2021, 500},
+    {183, 0x2022, 350},
+    {188, 0x2026, 1000},
+    {189, 0x2030, 1000},
+    {172, 0x2039, 333},
+    {173, 0x203A, 333},
+    {164, 0x2044, 167},
     {-1, 0x20AC, 500},
+    {-1, 0x2122, 1000},
+    {-1, 0x2202, 494},
+    {-1, 0x2211, 600},
+    {-1, 0x2212, 570},
+    {-1, 0x221A, 549},
+    {-1, 0x2260, 549},
+    {-1, 0x2264, 549},
+    {-1, 0x2265, 549},
+    {-1, 0x25CA, 494},
+    {-1, 0xF6C3, 250},
+    {174, 0xFB01, 556},
+    {175, 0xFB02, 556},
     {-1, 0xFFFF, 0}
     };
 
@@ -3217,7 +3221,7 @@ static const HPDF_CharData CHAR_DATA_TIMES_BOLD_ITALIC[316] = {
     {36, 0x0024, 500},
     {37, 0x0025, 833},
     {38, 0x0026, 778},
-    {39, 0x2019, 333},
+    {169, 0x0027, 278},
     {40, 0x0028, 333},
     {41, 0x0029, 333},
     {42, 0x002A, 500},
@@ -3274,7 +3278,7 @@ static const HPDF_CharData CHAR_DATA_TIMES_BOLD_ITALIC[316] = {
     {93, 0x005D, 333},
     {94, 0x005E, 570},
     {95, 0x005F, 500},
-    {96, 0x2018, 333},
+    {193, 0x0060, 333},
     {97, 0x0061, 500},
     {98, 0x0062, 500},
     {99, 0x0063, 444},
@@ -3308,223 +3312,223 @@ static const HPDF_CharData CHAR_DATA_TIMES_BOLD_ITALIC[316] = {
     {161, 0x00A1, 389},
     {162, 0x00A2, 500},
     {163, 0x00A3, 500},
-    {164, 0x2044, 167},
+    {168, 0x00A4, 500},
     {165, 0x00A5, 500},
-    {166, 0x0192, 500},
+    {-1, 0x00A6, 220},
     {167, 0x00A7, 500},
-    {168, 0x00A4, 500},
-    {169, 0x0027, 278},
-    {170, 0x201C, 500},
+    {200, 0x00A8, 333},
+    {-1, 0x00A9, 747},
+    {227, 0x00AA, 266},
     {171, 0x00AB, 500},
-    {172, 0x2039, 333},
-    {173, 0x203A, 333},
-    {174, 0xFB01, 556},
-    {175, 0xFB02, 556},
-    {177, 0x2013, 500},
-    {178, 0x2020, 500},
-    {179, 0x2021, 500},
-    {180, 0x00B7, 250},
+    {-1, 0x00AC, 606},
+    {-1, 0x00AE, 747},
+    {197, 0x00AF, 333},
+    {-1, 0x00B0, 400},
+    {-1, 0x00B1, 570},
+    {-1, 0x00B2, 300},
+    {-1, 0x00B3, 300},
+    {194, 0x00B4, 333},
+    {-1, 0x00B5, 576},
     {182, 0x00B6, 500},
-    {183, 0x2022, 350},
-    {184, 0x201A, 333},
-    {185, 0x201E, 500},
-    {186, 0x201D, 500},
+    {180, 0x00B7, 250},
+    {203, 0x00B8, 333},
+    {-1, 0x00B9, 300},
+    {235, 0x00BA, 300},
     {187, 0x00BB, 500},
-    {188, 0x2026, 1000},
-    {189, 0x2030, 1000},
+    {-1, 0x00BC, 750},
+    {-1, 0x00BD, 750},
+    {-1, 0x00BE, 750},
     {191, 0x00BF, 500},
-    {193, 0x0060, 333},
-    {194, 0x00B4, 333},
-    {195, 0x02C6, 333},
-    {196, 0x02DC, 333},
-    {197, 0x00AF, 333},
-    {198, 0x02D8, 333},
-    {199, 0x02D9, 333},
-    {200, 0x00A8, 333},
-    {202, 0x02DA, 333},
-    {203, 0x00B8, 333},
-    {205, 0x02DD, 333},
-    {206, 0x02DB, 333},
-    {207, 0x02C7, 333},
-    {208, 0x2014, 1000},
+    {-1, 0x00C0, 667},
+    {-1, 0x00C1, 667},
+    {-1, 0x00C2, 667},
+    {-1, 0x00C3, 667},
+    {-1, 0x00C4, 667},
+    {-1, 0x00C5, 667},
     {225, 0x00C6, 944},
-    {227, 0x00AA, 266},
-    {232, 0x0141, 611},
+    {-1, 0x00C7, 667},
+    {-1, 0x00C8, 667},
+    {-1, 0x00C9, 667},
+    {-1, 0x00CA, 667},
+    {-1, 0x00CB, 667},
+    {-1, 0x00CC, 389},
+    {-1, 0x00CD, 389},
+    {-1, 0x00CE, 389},
+    {-1, 0x00CF, 389},
+    {-1, 0x00D0, 722},
+    {-1, 0x00D1, 722},
+    {-1, 0x00D2, 722},
+    {-1, 0x00D3, 722},
+    {-1, 0x00D4, 722},
+    {-1, 0x00D5, 722},
+    {-1, 0x00D6, 722},
+    {-1, 0x00D7, 570},
     {233, 0x00D8, 722},
-    {234, 0x0152, 944},
-    {235, 0x00BA, 300},
-    {241, 0x00E6, 722},
-    {245, 0x0131, 278},
-    {248, 0x0142, 278},
-    {249, 0x00F8, 500},
-    {250, 0x0153, 722},
+    {-1, 0x00D9, 722},
+    {-1, 0x00DA, 722},
+    {-1, 0x00DB, 722},
+    {-1, 0x00DC, 722},
+    {-1, 0x00DD, 611},
+    {-1, 0x00DE, 611},
     {251, 0x00DF, 500},
-    {-1, 0x00CF, 389},
+    {-1, 0x00E0, 500},
+    {-1, 0x00E1, 500},
+    {-1, 0x00E2, 500},
+    {-1, 0x00E3, 500},
+    {-1, 0x00E4, 500},
+    {-1, 0x00E5, 500},
+    {241, 0x00E6, 722},
+    {-1, 0x00E7, 444},
+    {-1, 0x00E8, 444},
     {-1, 0x00E9, 444},
-    {-1, 0x0103, 500},
-    {-1, 0x0171, 556},
-    {-1, 0x011B, 444},
-    {-1, 0x0178, 611},
+    {-1, 0x00EA, 444},
+    {-1, 0x00EB, 444},
+    {-1, 0x00EC, 278},
+    {-1, 0x00ED, 278},
+    {-1, 0x00EE, 278},
+    {-1, 0x00EF, 278},
+    {-1, 0x00F0, 500},
+    {-1, 0x00F1, 556},
+    {-1, 0x00F2, 500},
+    {-1, 0x00F3, 500},
+    {-1, 0x00F4, 500},
+    {-1, 0x00F5, 500},
+    {-1, 0x00F6, 500},
     {-1, 0x00F7, 570},
-    {-1, 0x00DD, 611},
-    {-1, 0x00C2, 667},
-    {-1, 0x00E1, 500},
-    {-1, 0x00DB, 722},
+    {249, 0x00F8, 500},
+    {-1, 0x00F9, 556},
+    {-1, 0x00FA, 556},
+    {-1, 0x00FB, 556},
+    {-1, 0x00FC, 556},
     {-1, 0x00FD, 444},
-    {-1, 0x0219, 389},
-    {-1, 0x00EA, 444},
-    {-1, 0x016E, 722},
-    {-1, 0x00DC, 722},
+    {-1, 0x00FE, 500},
+    {-1, 0x00FF, 444},
+    {-1, 0x0100, 667},
+    {-1, 0x0101, 500},
+    {-1, 0x0102, 667},
+    {-1, 0x0103, 500},
+    {-1, 0x0104, 667},
     {-1, 0x0105, 500},
-    {-1, 0x00DA, 722},
-    {-1, 0x0173, 556},
-    {-1, 0x00CB, 667},
+    {-1, 0x0106, 667},
+    {-1, 0x0107, 444},
+    {-1, 0x010C, 667},
+    {-1, 0x010D, 444},
+    {-1, 0x010E, 722},
+    {-1, 0x010F, 608},
     {-1, 0x0110, 722},
-    {-1, 0xF6C3, 250},
-    {-1, 0x00A9, 747},
+    {-1, 0x0111, 500},
     {-1, 0x0112, 667},
-    {-1, 0x010D, 444},
-    {-1, 0x00E5, 500},
-    {-1, 0x0145, 722},
-    {-1, 0x013A, 278},
-    {-1, 0x00E0, 500},
-    {-1, 0x0162, 611},
-    {-1, 0x0106, 667},
-    {-1, 0x00E3, 500},
+    {-1, 0x0113, 444},
     {-1, 0x0116, 667},
-    {-1, 0x0161, 389},
-    {-1, 0x015F, 389},
-    {-1, 0x00ED, 278},
-    {-1, 0x25CA, 494},
-    {-1, 0x0158, 667},
+    {-1, 0x0117, 444},
+    {-1, 0x0118, 667},
+    {-1, 0x0119, 444},
+    {-1, 0x011A, 667},
+    {-1, 0x011B, 444},
+    {-1, 0x011E, 722},
+    {-1, 0x011F, 500},
     {-1, 0x0122, 722},
-    {-1, 0x00FB, 556},
-    {-1, 0x00E2, 500},
-    {-1, 0x0100, 667},
-    {-1, 0x0159, 389},
-    {-1, 0x00E7, 444},
-    {-1, 0x017B, 611},
-    {-1, 0x00DE, 611},
+    {-1, 0x0123, 500},
+    {-1, 0x012A, 389},
+    {-1, 0x012B, 278},
+    {-1, 0x012E, 389},
+    {-1, 0x012F, 278},
+    {-1, 0x0130, 389},
+    {245, 0x0131, 278},
+    {-1, 0x0136, 667},
+    {-1, 0x0137, 500},
+    {-1, 0x0139, 611},
+    {-1, 0x013A, 278},
+    {-1, 0x013B, 611},
+    {-1, 0x013C, 278},
+    {-1, 0x013D, 611},
+    {-1, 0x013E, 382},
+    {232, 0x0141, 611},
+    {248, 0x0142, 278},
+    {-1, 0x0143, 722},
+    {-1, 0x0144, 556},
+    {-1, 0x0145, 722},
+    {-1, 0x0146, 556},
+    {-1, 0x0147, 722},
+    {-1, 0x0148, 556},
     {-1, 0x014C, 722},
+    {-1, 0x014D, 500},
+    {-1, 0x0150, 722},
+    {-1, 0x0151, 500},
+    {234, 0x0152, 944},
+    {250, 0x0153, 722},
     {-1, 0x0154, 667},
+    {-1, 0x0155, 389},
+    {-1, 0x0156, 667},
+    {-1, 0x0157, 389},
+    {-1, 0x0158, 667},
+    {-1, 0x0159, 389},
     {-1, 0x015A, 556},
-    {-1, 0x010F, 608},
-    {-1, 0x016A, 722},
-    {-1, 0x016F, 556},
-    {-1, 0x00B3, 300},
-    {-1, 0x00D2, 722},
-    {-1, 0x00C0, 667},
-    {-1, 0x0102, 667},
-    {-1, 0x00D7, 570},
-    {-1, 0x00FA, 556},
+    {-1, 0x015B, 389},
+    {-1, 0x015E, 556},
+    {-1, 0x015F, 389},
+    {-1, 0x0160, 556},
+    {-1, 0x0161, 389},
+    {-1, 0x0162, 611},
+    {-1, 0x0163, 278},
     {-1, 0x0164, 611},
-    {-1, 0x2202, 494},
-    {-1, 0x00FF, 444},
-    {-1, 0x0143, 722},
-    {-1, 0x00EE, 278},
-    {-1, 0x00CA, 667},
-    {-1, 0x00E4, 500},
-    {-1, 0x00EB, 444},
-    {-1, 0x0107, 444},
-    {-1, 0x0144, 556},
+    {-1, 0x0165, 366},
+    {-1, 0x016A, 722},
     {-1, 0x016B, 556},
-    {-1, 0x0147, 722},
-    {-1, 0x00CD, 389},
-    {-1, 0x00B1, 570},
-    {-1, 0x00A6, 220},
-    {-1, 0x00AE, 747},
-    {-1, 0x011E, 722},
-    {-1, 0x0130, 389},
-    {-1, 0x2211, 600},
-    {-1, 0x00C8, 667},
-    {-1, 0x0155, 389},
-    {-1, 0x014D, 500},
-    {-1, 0x0179, 611},
-    {-1, 0x017D, 611},
-    {-1, 0x2265, 549},
-    {-1, 0x00D0, 722},
-    {-1, 0x00C7, 667},
-    {-1, 0x013C, 278},
-    {-1, 0x0165, 366},
-    {-1, 0x0119, 444},
+    {-1, 0x016E, 722},
+    {-1, 0x016F, 556},
+    {-1, 0x0170, 722},
+    {-1, 0x0171, 556},
     {-1, 0x0172, 722},
-    {-1, 0x00C1, 667},
-    {-1, 0x00C4, 667},
-    {-1, 0x00E8, 444},
+    {-1, 0x0173, 556},
+    {-1, 0x0178, 611},
+    {-1, 0x0179, 611},
     {-1, 0x017A, 389},
-    {-1, 0x012F, 278},
-    {-1, 0x00D3, 722},
-    {-1, 0x00F3, 500},
-    {-1, 0x0101, 500},
-    {-1, 0x015B, 389},
-    {-1, 0x00EF, 278},
-    {-1, 0x00D4, 722},
-    {-1, 0x00D9, 722},
+    {-1, 0x017B, 611},
+    {-1, 0x017C, 389},
+    {-1, 0x017D, 611},
+    {-1, 0x017E, 389},
+    {166, 0x0192, 500},
+    {-1, 0x0218, 556},
+    {-1, 0x0219, 389},
+    {195, 0x02C6, 333},
+    {207, 0x02C7, 333},
+    {198, 0x02D8, 333},
+    {199, 0x02D9, 333},
+    {202, 0x02DA, 333},
+    {206, 0x02DB, 333},
+    {196, 0x02DC, 333},
+    {205, 0x02DD, 333},
     {-1, 0x0394, 612},
-    {-1, 0x00FE, 500},
-    {-1, 0x00B2, 300},
-    {-1, 0x00D6, 722},
-    {-1, 0x00B5, 576},
-    {-1, 0x00EC, 278},
-    {-1, 0x0151, 500},
-    {-1, 0x0118, 667},
-    {-1, 0x0111, 500},
-    {-1, 0x00BE, 750},
-    {-1, 0x015E, 556},
-    {-1, 0x013E, 382},
-    {-1, 0x0136, 667},
-    {-1, 0x0139, 611},
+    {177, 0x2013, 500},
+    {208, 0x2014, 1000},
+    {96, 0x2018, 333},
+    {39, 0x2019, 333},
+    {184, 0x201A, 333},
+    {170, 0x201C, 500},
+    {186, 0x201D, 500},
+    {185, 0x201E, 500},
+    {178, 0x2020, 500},
+    {179, 0x2021, 500},
+    {183, 0x2022, 350},
+    {188, 0x2026, 1000},
+    {189, 0x2030, 1000},
+    {172, 0x2039, 333},
+    {173, 0x203A, 333},
+    {164, 0x2044, 167},
+    {-1, 0x20AC, 500},
     {-1, 0x2122, 1000},
-    {-1, 0x0117, 444},
-    {-1, 0x00CC, 389},
-    {-1, 0x012A, 389},
-    {-1, 0x013D, 611},
-    {-1, 0x00BD, 750},
-    {-1, 0x2264, 549},
-    {-1, 0x00F4, 500},
-    {-1, 0x00F1, 556},
-    {-1, 0x0170, 722},
-    {-1, 0x00C9, 667},
-    {-1, 0x0113, 444},
-    {-1, 0x011F, 500},
-    {-1, 0x00BC, 750},
-    {-1, 0x0160, 556},
-    {-1, 0x0218, 556},
-    {-1, 0x0150, 722},
-    {-1, 0x00B0, 400},
-    {-1, 0x00F2, 500},
-    {-1, 0x010C, 667},
-    {-1, 0x00F9, 556},
-    {-1, 0x221A, 549},
-    {-1, 0x010E, 722},
-    {-1, 0x0157, 389},
-    {-1, 0x00D1, 722},
-    {-1, 0x00F5, 500},
-    {-1, 0x0156, 667},
-    {-1, 0x013B, 611},
-    {-1, 0x00C3, 667},
-    {-1, 0x0104, 667},
-    {-1, 0x00C5, 667},
-    {-1, 0x00D5, 722},
-    {-1, 0x017C, 389},
-    {-1, 0x011A, 667},
-    {-1, 0x012E, 389},
-    {-1, 0x0137, 500},
+    {-1, 0x2202, 494},
+    {-1, 0x2211, 600},
     {-1, 0x2212, 606},
-    {-1, 0x00CE, 389},
-    {-1, 0x0148, 556},
-    {-1, 0x0163, 278},
-    {-1, 0x00AC, 606},
-    {-1, 0x00F6, 500},
-    {-1, 0x00FC, 556},
+    {-1, 0x221A, 549},
     {-1, 0x2260, 549},
-    {-1, 0x0123, 500},
-    {-1, 0x00F0, 500},
-    {-1, 0x017E, 389},
-    {-1, 0x0146, 556},
-    {-1, 0x00B9, 300},
-    {-1, 0x012B, 278},
-    {-1, 0x20AC, 500},
+    {-1, 0x2264, 549},
+    {-1, 0x2265, 549},
+    {-1, 0x25CA, 494},
+    {-1, 0xF6C3, 250},
+    {174, 0xFB01, 556},
+    {175, 0xFB02, 556},
     {-1, 0xFFFF, 0}
     };
 
@@ -3536,7 +3540,7 @@ static const HPDF_CharData CHAR_DATA_TIMES_ITALIC[316] = {
     {36, 0x0024, 500},
     {37, 0x0025, 833},
     {38, 0x0026, 778},
-    {39, 0x2019, 333},
+    {169, 0x0027, 214},
     {40, 0x0028, 333},
     {41, 0x0029, 333},
     {42, 0x002A, 500},
@@ -3593,7 +3597,7 @@ static const HPDF_CharData CHAR_DATA_TIMES_ITALIC[316] = {
     {93, 0x005D, 389},
     {94, 0x005E, 422},
     {95, 0x005F, 500},
-    {96, 0x2018, 333},
+    {193, 0x0060, 333},
     {97, 0x0061, 500},
     {98, 0x0062, 500},
     {99, 0x0063, 444},
@@ -3627,223 +3631,223 @@ static const HPDF_CharData CHAR_DATA_TIMES_ITALIC[316] = {
     {161, 0x00A1, 389},
     {162, 0x00A2, 500},
     {163, 0x00A3, 500},
-    {164, 0x2044, 167},
+    {168, 0x00A4, 500},
     {165, 0x00A5, 500},
-    {166, 0x0192, 500},
+    {-1, 0x00A6, 275},
     {167, 0x00A7, 500},
-    {168, 0x00A4, 500},
-    {169, 0x0027, 214},
-    {170, 0x201C, 556},
+    {200, 0x00A8, 333},
+    {-1, 0x00A9, 760},
+    {227, 0x00AA, 276},
     {171, 0x00AB, 500},
-    {172, 0x2039, 333},
-    {173, 0x203A, 333},
-    {174, 0xFB01, 500},
-    {175, 0xFB02, 500},
-    {177, 0x2013, 500},
-    {178, 0x2020, 500},
-    {179, 0x2021, 500},
-    {180, 0x00B7, 250},
+    {-1, 0x00AC, 675},
+    {-1, 0x00AE, 760},
+    {197, 0x00AF, 333},
+    {-1, 0x00B0, 400},
+    {-1, 0x00B1, 675},
+    {-1, 0x00B2, 300},
+    {-1, 0x00B3, 300},
+    {194, 0x00B4, 333},
+    {-1, 0x00B5, 500},
     {182, 0x00B6, 523},
-    {183, 0x2022, 350},
-    {184, 0x201A, 333},
-    {185, 0x201E, 556},
-    {186, 0x201D, 556},
+    {180, 0x00B7, 250},
+    {203, 0x00B8, 333},
+    {-1, 0x00B9, 300},
+    {235, 0x00BA, 310},
     {187, 0x00BB, 500},
-    {188, 0x2026, 889},
-    {189, 0x2030, 1000},
+    {-1, 0x00BC, 750},
+    {-1, 0x00BD, 750},
+    {-1, 0x00BE, 750},
     {191, 0x00BF, 500},
-    {193, 0x0060, 333},
-    {194, 0x00B4, 333},
-    {195, 0x02C6, 333},
-    {196, 0x02DC, 333},
-    {197, 0x00AF, 333},
-    {198, 0x02D8, 333},
-    {199, 0x02D9, 333},
-    {200, 0x00A8, 333},
-    {202, 0x02DA, 333},
-    {203, 0x00B8, 333},
-    {205, 0x02DD, 333},
-    {206, 0x02DB, 333},
-    {207, 0x02C7, 333},
-    {208, 0x2014, 889},
+    {-1, 0x00C0, 611},
+    {-1, 0x00C1, 611},
+    {-1, 0x00C2, 611},
+    {-1, 0x00C3, 611},
+    {-1, 0x00C4, 611},
+    {-1, 0x00C5, 611},
     {225, 0x00C6, 889},
-    {227, 0x00AA, 276},
-    {232, 0x0141, 556},
+    {-1, 0x00C7, 667},
+    {-1, 0x00C8, 611},
+    {-1, 0x00C9, 611},
+    {-1, 0x00CA, 611},
+    {-1, 0x00CB, 611},
+    {-1, 0x00CC, 333},
+    {-1, 0x00CD, 333},
+    {-1, 0x00CE, 333},
+    {-1, 0x00CF, 333},
+    {-1, 0x00D0, 722},
+    {-1, 0x00D1, 667},
+    {-1, 0x00D2, 722},
+    {-1, 0x00D3, 722},
+    {-1, 0x00D4, 722},
+    {-1, 0x00D5, 722},
+    {-1, 0x00D6, 722},
+    {-1, 0x00D7, 675},
     {233, 0x00D8, 722},
-    {234, 0x0152, 944},
-    {235, 0x00BA, 310},
-    {241, 0x00E6, 667},
-    {245, 0x0131, 278},
-    {248, 0x0142, 278},
-    {249, 0x00F8, 500},
-    {250, 0x0153, 667},
+    {-1, 0x00D9, 722},
+    {-1, 0x00DA, 722},
+    {-1, 0x00DB, 722},
+    {-1, 0x00DC, 722},
+    {-1, 0x00DD, 556},
+    {-1, 0x00DE, 611},
     {251, 0x00DF, 500},
-    {-1, 0x00CF, 333},
+    {-1, 0x00E0, 500},
+    {-1, 0x00E1, 500},
+    {-1, 0x00E2, 500},
+    {-1, 0x00E3, 500},
+    {-1, 0x00E4, 500},
+    {-1, 0x00E5, 500},
+    {241, 0x00E6, 667},
+    {-1, 0x00E7, 444},
+    {-1, 0x00E8, 444},
     {-1, 0x00E9, 444},
-    {-1, 0x0103, 500},
-    {-1, 0x0171, 500},
-    {-1, 0x011B, 444},
-    {-1, 0x0178, 556},
+    {-1, 0x00EA, 444},
+    {-1, 0x00EB, 444},
+    {-1, 0x00EC, 278},
+    {-1, 0x00ED, 278},
+    {-1, 0x00EE, 278},
+    {-1, 0x00EF, 278},
+    {-1, 0x00F0, 500},
+    {-1, 0x00F1, 500},
+    {-1, 0x00F2, 500},
+    {-1, 0x00F3, 500},
+    {-1, 0x00F4, 500},
+    {-1, 0x00F5, 500},
+    {-1, 0x00F6, 500},
     {-1, 0x00F7, 675},
-    {-1, 0x00DD, 556},
-    {-1, 0x00C2, 611},
-    {-1, 0x00E1, 500},
-    {-1, 0x00DB, 722},
+    {249, 0x00F8, 500},
+    {-1, 0x00F9, 500},
+    {-1, 0x00FA, 500},
+    {-1, 0x00FB, 500},
+    {-1, 0x00FC, 500},
     {-1, 0x00FD, 444},
-    {-1, 0x0219, 389},
-    {-1, 0x00EA, 444},
-    {-1, 0x016E, 722},
-    {-1, 0x00DC, 722},
+    {-1, 0x00FE, 500},
+    {-1, 0x00FF, 444},
+    {-1, 0x0100, 611},
+    {-1, 0x0101, 500},
+    {-1, 0x0102, 611},
+    {-1, 0x0103, 500},
+    {-1, 0x0104, 611},
     {-1, 0x0105, 500},
-    {-1, 0x00DA, 722},
-    {-1, 0x0173, 500},
-    {-1, 0x00CB, 611},
+    {-1, 0x0106, 667},
+    {-1, 0x0107, 444},
+    {-1, 0x010C, 667},
+    {-1, 0x010D, 444},
+    {-1, 0x010E, 722},
+    {-1, 0x010F, 544},
     {-1, 0x0110, 722},
-    {-1, 0xF6C3, 250},
-    {-1, 0x00A9, 760},
+    {-1, 0x0111, 500},
     {-1, 0x0112, 611},
-    {-1, 0x010D, 444},
-    {-1, 0x00E5, 500},
-    {-1, 0x0145, 667},
-    {-1, 0x013A, 278},
-    {-1, 0x00E0, 500},
-    {-1, 0x0162, 556},
-    {-1, 0x0106, 667},
-    {-1, 0x00E3, 500},
+    {-1, 0x0113, 444},
     {-1, 0x0116, 611},
-    {-1, 0x0161, 389},
-    {-1, 0x015F, 389},
-    {-1, 0x00ED, 278},
-    {-1, 0x25CA, 471},
-    {-1, 0x0158, 611},
+    {-1, 0x0117, 444},
+    {-1, 0x0118, 611},
+    {-1, 0x0119, 444},
+    {-1, 0x011A, 611},
+    {-1, 0x011B, 444},
+    {-1, 0x011E, 722},
+    {-1, 0x011F, 500},
     {-1, 0x0122, 722},
-    {-1, 0x00FB, 500},
-    {-1, 0x00E2, 500},
-    {-1, 0x0100, 611},
-    {-1, 0x0159, 389},
-    {-1, 0x00E7, 444},
-    {-1, 0x017B, 556},
-    {-1, 0x00DE, 611},
-    {-1, 0x014C, 722},
-    {-1, 0x0154, 611},
-    {-1, 0x015A, 500},
-    {-1, 0x010F, 544},
-    {-1, 0x016A, 722},
-    {-1, 0x016F, 500},
-    {-1, 0x00B3, 300},
-    {-1, 0x00D2, 722},
-    {-1, 0x00C0, 611},
-    {-1, 0x0102, 611},
-    {-1, 0x00D7, 675},
-    {-1, 0x00FA, 500},
-    {-1, 0x0164, 556},
-    {-1, 0x2202, 476},
-    {-1, 0x00FF, 444},
+    {-1, 0x0123, 500},
+    {-1, 0x012A, 333},
+    {-1, 0x012B, 278},
+    {-1, 0x012E, 333},
+    {-1, 0x012F, 278},
+    {-1, 0x0130, 333},
+    {245, 0x0131, 278},
+    {-1, 0x0136, 667},
+    {-1, 0x0137, 444},
+    {-1, 0x0139, 556},
+    {-1, 0x013A, 278},
+    {-1, 0x013B, 556},
+    {-1, 0x013C, 278},
+    {-1, 0x013D, 611},
+    {-1, 0x013E, 300},
+    {232, 0x0141, 556},
+    {248, 0x0142, 278},
     {-1, 0x0143, 667},
-    {-1, 0x00EE, 278},
-    {-1, 0x00CA, 611},
-    {-1, 0x00E4, 500},
-    {-1, 0x00EB, 444},
-    {-1, 0x0107, 444},
     {-1, 0x0144, 500},
-    {-1, 0x016B, 500},
+    {-1, 0x0145, 667},
+    {-1, 0x0146, 500},
     {-1, 0x0147, 667},
-    {-1, 0x00CD, 333},
-    {-1, 0x00B1, 675},
-    {-1, 0x00A6, 275},
-    {-1, 0x00AE, 760},
-    {-1, 0x011E, 722},
-    {-1, 0x0130, 333},
-    {-1, 0x2211, 600},
-    {-1, 0x00C8, 611},
-    {-1, 0x0155, 389},
+    {-1, 0x0148, 500},
+    {-1, 0x014C, 722},
     {-1, 0x014D, 500},
-    {-1, 0x0179, 556},
-    {-1, 0x017D, 556},
-    {-1, 0x2265, 549},
-    {-1, 0x00D0, 722},
-    {-1, 0x00C7, 667},
-    {-1, 0x013C, 278},
+    {-1, 0x0150, 722},
+    {-1, 0x0151, 500},
+    {234, 0x0152, 944},
+    {250, 0x0153, 667},
+    {-1, 0x0154, 611},
+    {-1, 0x0155, 389},
+    {-1, 0x0156, 611},
+    {-1, 0x0157, 389},
+    {-1, 0x0158, 611},
+    {-1, 0x0159, 389},
+    {-1, 0x015A, 500},
+    {-1, 0x015B, 389},
+    {-1, 0x015E, 500},
+    {-1, 0x015F, 389},
+    {-1, 0x0160, 500},
+    {-1, 0x0161, 389},
+    {-1, 0x0162, 556},
+    {-1, 0x0163, 278},
+    {-1, 0x0164, 556},
     {-1, 0x0165, 300},
-    {-1, 0x0119, 444},
+    {-1, 0x016A, 722},
+    {-1, 0x016B, 500},
+    {-1, 0x016E, 722},
+    {-1, 0x016F, 500},
+    {-1, 0x0170, 722},
+    {-1, 0x0171, 500},
     {-1, 0x0172, 722},
-    {-1, 0x00C1, 611},
-    {-1, 0x00C4, 611},
-    {-1, 0x00E8, 444},
+    {-1, 0x0173, 500},
+    {-1, 0x0178, 556},
+    {-1, 0x0179, 556},
     {-1, 0x017A, 389},
-    {-1, 0x012F, 278},
-    {-1, 0x00D3, 722},
-    {-1, 0x00F3, 500},
-    {-1, 0x0101, 500},
-    {-1, 0x015B, 389},
-    {-1, 0x00EF, 278},
-    {-1, 0x00D4, 722},
-    {-1, 0x00D9, 722},
+    {-1, 0x017B, 556},
+    {-1, 0x017C, 389},
+    {-1, 0x017D, 556},
+    {-1, 0x017E, 389},
+    {166, 0x0192, 500},
+    {-1, 0x0218, 500},
+    {-1, 0x0219, 389},
+    {195, 0x02C6, 333},
+    {207, 0x02C7, 333},
+    {198, 0x02D8, 333},
+    {199, 0x02D9, 333},
+    {202, 0x02DA, 333},
+    {206, 0x02DB, 333},
+    {196, 0x02DC, 333},
+    {205, 0x02DD, 333},
     {-1, 0x0394, 612},
-    {-1, 0x00FE, 500},
-    {-1, 0x00B2, 300},
-    {-1, 0x00D6, 722},
-    {-1, 0x00B5, 500},
-    {-1, 0x00EC, 278},
-    {-1, 0x0151, 500},
-    {-1, 0x0118, 611},
-    {-1, 0x0111, 500},
-    {-1, 0x00BE, 750},
-    {-1, 0x015E, 500},
-    {-1, 0x013E, 300},
-    {-1, 0x0136, 667},
-    {-1, 0x0139, 556},
+    {177, 0x2013, 500},
+    {208, 0x2014, 889},
+    {96, 0x2018, 333},
+    {39, 0x2019, 333},
+    {184, 0x201A, 333},
+    {170, 0x201C, 556},
+    {186, 0x201D, 556},
+    {185, 0x201E, 556},
+    {178, 0x2020, 500},
+    {179, 0x2021, 500},
+    {183, 0x2022, 350},
+    {188, 0x2026, 889},
+    {189, 0x2030, 1000},
+    {172, 0x2039, 333},
+    {173, 0x203A, 333},
+    {164, 0x2044, 167},
+    {-1, 0x20AC, 500},
     {-1, 0x2122, 980},
-    {-1, 0x0117, 444},
-    {-1, 0x00CC, 333},
-    {-1, 0x012A, 333},
-    {-1, 0x013D, 611},
-    {-1, 0x00BD, 750},
-    {-1, 0x2264, 549},
-    {-1, 0x00F4, 500},
-    {-1, 0x00F1, 500},
-    {-1, 0x0170, 722},
-    {-1, 0x00C9, 611},
-    {-1, 0x0113, 444},
-    {-1, 0x011F, 500},
-    {-1, 0x00BC, 750},
-    {-1, 0x0160, 500},
-    {-1, 0x0218, 500},
-    {-1, 0x0150, 722},
-    {-1, 0x00B0, 400},
-    {-1, 0x00F2, 500},
-    {-1, 0x010C, 667},
-    {-1, 0x00F9, 500},
-    {-1, 0x221A, 453},
-    {-1, 0x010E, 722},
-    {-1, 0x0157, 389},
-    {-1, 0x00D1, 667},
-    {-1, 0x00F5, 500},
-    {-1, 0x0156, 611},
-    {-1, 0x013B, 556},
-    {-1, 0x00C3, 611},
-    {-1, 0x0104, 611},
-    {-1, 0x00C5, 611},
-    {-1, 0x00D5, 722},
-    {-1, 0x017C, 389},
-    {-1, 0x011A, 611},
-    {-1, 0x012E, 333},
-    {-1, 0x0137, 444},
+    {-1, 0x2202, 476},
+    {-1, 0x2211, 600},
     {-1, 0x2212, 675},
-    {-1, 0x00CE, 333},
-    {-1, 0x0148, 500},
-    {-1, 0x0163, 278},
-    {-1, 0x00AC, 675},
-    {-1, 0x00F6, 500},
-    {-1, 0x00FC, 500},
+    {-1, 0x221A, 453},
     {-1, 0x2260, 549},
-    {-1, 0x0123, 500},
-    {-1, 0x00F0, 500},
-    {-1, 0x017E, 389},
-    {-1, 0x0146, 500},
-    {-1, 0x00B9, 300},
-    {-1, 0x012B, 278},
-    {-1, 0x20AC, 500},
+    {-1, 0x2264, 549},
+    {-1, 0x2265, 549},
+    {-1, 0x25CA, 471},
+    {-1, 0xF6C3, 250},
+    {174, 0xFB01, 500},
+    {175, 0xFB02, 500},
     {-1, 0xFFFF, 0}
     };
 
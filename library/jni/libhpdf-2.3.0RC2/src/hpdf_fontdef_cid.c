@@ -70,6 +70,7 @@ HPDF_CIDFontDef_New  (HPDF_MMgr               mmgr,
         return NULL;
 
     HPDF_MemSet (fontdef, 0, sizeof(HPDF_FontDef_Rec));
+    HPDF_FontDef_InitLock (fontdef);
     fontdef->sig_bytes = HPDF_FONTDEF_SIG_BYTES;
     HPDF_StrCpy (fontdef->base_font, name, fontdef->base_font +
                     HPDF_LIMIT_MAX_NAME_LEN);
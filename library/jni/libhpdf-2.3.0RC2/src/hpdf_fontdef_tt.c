@@ -261,6 +261,7 @@ HPDF_TTFontDef_New (HPDF_MMgr   mmgr)
         return NULL;
 
     HPDF_MemSet (fontdef, 0, sizeof(HPDF_FontDef_Rec));
+    HPDF_FontDef_InitLock (fontdef);
     fontdef->sig_bytes = HPDF_FONTDEF_SIG_BYTES;
     fontdef->mmgr = mmgr;
     fontdef->error = mmgr->error;
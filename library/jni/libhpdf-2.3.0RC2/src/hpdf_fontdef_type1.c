@@ -42,8 +42,66 @@ LoadFontData (HPDF_FontDef  fontdef,
               HPDF_Stream   stream);
 
 
+static HPDF_STATUS
+LoadMetrics (HPDF_FontDef  fontdef,
+             HPDF_Stream   stream);
+
+
+static void
+SortWidths  (HPDF_Type1FontDefAttr  attr);
+
+
+/*
+ *  The binary metrics written by HPDF_Type1FontDef_SaveMetrics hold the
+ *  global font information and the sorted widths array of an AFM file, so
+ *  that the font can be loaded again without parsing the AFM. All the
+ *  integers are stored big-endian.
+ *
+ *    magic           "HPDFAFM1"
+ *    header          HPDF_METRICS_HEADER_LEN bytes (see LoadMetrics)
+ *    base_font       1 byte length + bytes
+ *    encoding_scheme 1 byte length + bytes
+ *    char_set        2 byte length + bytes
+ *    widths          widths_count * (char_cd, unicode, width)
+ */
+
+#define HPDF_METRICS_MAGIC         "HPDFAFM1"
+#define HPDF_METRICS_MAGIC_LEN     8
+#define HPDF_METRICS_HEADER_LEN    32
+#define HPDF_METRICS_CHAR_LEN      6
+
+
 /*---------------------------------------------------------------------------*/
 
+/*
+ *  HPDF_Type1FontDef_GetWidth looks the widths up with a binary search, so
+ *  they are kept sorted by unicode. Insertion sort is stable, which keeps
+ *  the first of several entries for the same unicode in front as the linear
+ *  search used to find it, and it costs nothing for the base-14 tables,
+ *  which are already sorted.
+ */
+static void
+SortWidths  (HPDF_Type1FontDefAttr  attr)
+{
+    HPDF_CharData *widths = attr->widths;
+    HPDF_UINT i;
+
+    HPDF_PTRACE ((" SortWidths\n"));
+
+    for (i = 1; i < attr->widths_count; i++) {
+        HPDF_CharData tmp = widths[i];
+        HPDF_UINT j = i;
+
+        while (j > 0 && widths[j - 1].unicode > tmp.unicode) {
+            widths[j] = widths[j - 1];
+            j--;
+        }
+
+        widths[j] = tmp;
+    }
+}
+
+
 static void
 FreeWidth  (HPDF_FontDef  fontdef)
 {
@@ -73,6 +131,7 @@ HPDF_Type1FontDef_New  (HPDF_MMgr  mmgr)
         return NULL;
 
     HPDF_MemSet (fontdef, 0, sizeof (HPDF_FontDef_Rec));
+    HPDF_FontDef_InitLock (fontdef);
     fontdef->sig_bytes = HPDF_FONTDEF_SIG_BYTES;
     fontdef->mmgr = mmgr;
     fontdef->error = mmgr->error;
@@ -137,6 +196,20 @@ LoadAfm (HPDF_FontDef  fontdef,
 
     HPDF_PTRACE ((" LoadAfm\n"));
 
+    /* binary metrics saved by HPDF_Type1FontDef_SaveMetrics */
+    len = HPDF_METRICS_MAGIC_LEN;
+    ret = HPDF_Stream_Read (stream, (HPDF_BYTE *)buf, &len);
+    if (ret != HPDF_OK && ret != HPDF_STREAM_EOF)
+        return ret;
+
+    if (len == HPDF_METRICS_MAGIC_LEN && HPDF_MemCmp ((HPDF_BYTE *)buf,
+                (const HPDF_BYTE *)HPDF_METRICS_MAGIC,
+                HPDF_METRICS_MAGIC_LEN) == 0)
+        return LoadMetrics (fontdef, stream);
+
+    if ((ret = HPDF_Stream_Seek (stream, 0, HPDF_SEEK_SET)) != HPDF_OK)
+        return ret;
+
     len = HPDF_TMP_BUF_SIZ;
 
     /* chaeck AFM header */
@@ -293,6 +366,212 @@ LoadAfm (HPDF_FontDef  fontdef,
 
     }
 
+    SortWidths (attr);
+
+    return HPDF_OK;
+}
+
+
+static void
+PutUInt16  (HPDF_BYTE    *p,
+            HPDF_UINT16   v)
+{
+    p[0] = (HPDF_BYTE)(v >> 8);
+    p[1] = (HPDF_BYTE)v;
+}
+
+
+static HPDF_UINT16
+GetUInt16  (const HPDF_BYTE  *p)
+{
+    return (HPDF_UINT16)((p[0] << 8) | p[1]);
+}
+
+
+static HPDF_STATUS
+ReadMetrics  (HPDF_FontDef  fontdef,
+              HPDF_Stream   stream,
+              void         *buf,
+              HPDF_UINT     size)
+{
+    HPDF_UINT len = size;
+    HPDF_STATUS ret = HPDF_Stream_Read (stream, (HPDF_BYTE *)buf, &len);
+
+    if (ret != HPDF_OK && ret != HPDF_STREAM_EOF)
+        return ret;
+
+    if (len != size)
+        return HPDF_SetError (fontdef->error, HPDF_INVALID_AFM_HEADER, 0);
+
+    return HPDF_OK;
+}
+
+
+static HPDF_STATUS
+LoadMetrics (HPDF_FontDef  fontdef,
+             HPDF_Stream   stream)
+{
+    HPDF_Type1FontDefAttr attr = (HPDF_Type1FontDefAttr)fontdef->attr;
+    HPDF_BYTE buf[HPDF_METRICS_HEADER_LEN];
+    HPDF_BYTE *pbuf;
+    HPDF_UINT len;
+    HPDF_UINT i;
+    HPDF_STATUS ret;
+
+    HPDF_PTRACE ((" LoadMetrics\n"));
+
+    if ((ret = ReadMetrics (fontdef, stream, buf, HPDF_METRICS_HEADER_LEN))
+            != HPDF_OK)
+        return ret;
+
+    fontdef->flags = ((HPDF_UINT)GetUInt16 (buf) << 16) | GetUInt16 (buf + 2);
+    fontdef->font_bbox.left = (HPDF_INT16)GetUInt16 (buf + 4);
+    fontdef->font_bbox.bottom = (HPDF_INT16)GetUInt16 (buf + 6);
+    fontdef->font_bbox.right = (HPDF_INT16)GetUInt16 (buf + 8);
+    fontdef->font_bbox.top = (HPDF_INT16)GetUInt16 (buf + 10);
+    fontdef->italic_angle = (HPDF_INT16)GetUInt16 (buf + 12);
+    fontdef->ascent = (HPDF_INT16)GetUInt16 (buf + 14);
+    fontdef->descent = (HPDF_INT16)GetUInt16 (buf + 16);
+    fontdef->cap_height = GetUInt16 (buf + 18);
+    fontdef->x_height = GetUInt16 (buf + 20);
+    fontdef->stemv = GetUInt16 (buf + 22);
+    fontdef->stemh = GetUInt16 (buf + 24);
+    fontdef->missing_width = (HPDF_INT16)GetUInt16 (buf + 26);
+    attr->widths_count = GetUInt16 (buf + 28);
+
+    /* base_font and encoding_scheme */
+    if ((ret = ReadMetrics (fontdef, stream, buf, 1)) != HPDF_OK)
+        return ret;
+    if (buf[0] > HPDF_LIMIT_MAX_NAME_LEN)
+        return HPDF_SetError (fontdef->error, HPDF_INVALID_AFM_HEADER, 0);
+    if ((ret = ReadMetrics (fontdef, stream, fontdef->base_font, buf[0]))
+            != HPDF_OK)
+        return ret;
+    fontdef->base_font[buf[0]] = 0;
+
+    if ((ret = ReadMetrics (fontdef, stream, buf, 1)) != HPDF_OK)
+        return ret;
+    if (buf[0] > HPDF_LIMIT_MAX_NAME_LEN)
+        return HPDF_SetError (fontdef->error, HPDF_INVALID_AFM_HEADER, 0);
+    if ((ret = ReadMetrics (fontdef, stream, attr->encoding_scheme, buf[0]))
+            != HPDF_OK)
+        return ret;
+    attr->encoding_scheme[buf[0]] = 0;
+
+    /* char_set */
+    if ((ret = ReadMetrics (fontdef, stream, buf, 2)) != HPDF_OK)
+        return ret;
+    len = GetUInt16 (buf);
+    if (len > 0) {
+        attr->char_set = HPDF_GetMem (fontdef->mmgr, len + 1);
+        if (!attr->char_set)
+            return HPDF_Error_GetCode (fontdef->error);
+
+        if ((ret = ReadMetrics (fontdef, stream, attr->char_set, len))
+                != HPDF_OK)
+            return ret;
+        attr->char_set[len] = 0;
+    }
+
+    /* widths, which are read in one go and unpacked in place. */
+    len = attr->widths_count * HPDF_METRICS_CHAR_LEN;
+    attr->widths = (HPDF_CharData*)HPDF_GetMem (fontdef->mmgr,
+            sizeof(HPDF_CharData) * attr->widths_count + len);
+    if (!attr->widths)
+        return HPDF_Error_GetCode (fontdef->error);
+
+    pbuf = (HPDF_BYTE *)(attr->widths + attr->widths_count);
+    if ((ret = ReadMetrics (fontdef, stream, pbuf, len)) != HPDF_OK)
+        return ret;
+
+    for (i = 0; i < attr->widths_count; i++) {
+        HPDF_CharData *cdata = attr->widths + i;
+
+        cdata->char_cd = (HPDF_INT16)GetUInt16 (pbuf);
+        cdata->unicode = GetUInt16 (pbuf + 2);
+        cdata->width = (HPDF_INT16)GetUInt16 (pbuf + 4);
+        pbuf += HPDF_METRICS_CHAR_LEN;
+    }
+
+    /* the metrics are written sorted, but a hand made file may not be. */
+    SortWidths (attr);
+
+    return HPDF_OK;
+}
+
+
+HPDF_STATUS
+HPDF_Type1FontDef_SaveMetrics  (HPDF_FontDef  fontdef,
+                                HPDF_Stream   stream)
+{
+    HPDF_Type1FontDefAttr attr = (HPDF_Type1FontDefAttr)fontdef->attr;
+    HPDF_BYTE buf[HPDF_METRICS_MAGIC_LEN + HPDF_METRICS_HEADER_LEN];
+    HPDF_BYTE *pbuf = buf + HPDF_METRICS_MAGIC_LEN;
+    HPDF_UINT len;
+    HPDF_UINT i;
+    HPDF_STATUS ret;
+
+    HPDF_PTRACE ((" HPDF_Type1FontDef_SaveMetrics\n"));
+
+    if (fontdef->type != HPDF_FONTDEF_TYPE_TYPE1 || attr->widths_count > 0xFFFF)
+        return HPDF_SetError (fontdef->error, HPDF_INVALID_FONTDEF_TYPE, 0);
+
+    HPDF_MemSet (buf, 0, sizeof(buf));
+    HPDF_MemCpy (buf, (const HPDF_BYTE *)HPDF_METRICS_MAGIC,
+            HPDF_METRICS_MAGIC_LEN);
+
+    PutUInt16 (pbuf, (HPDF_UINT16)(fontdef->flags >> 16));
+    PutUInt16 (pbuf + 2, (HPDF_UINT16)fontdef->flags);
+    PutUInt16 (pbuf + 4, (HPDF_UINT16)(HPDF_INT16)fontdef->font_bbox.left);
+    PutUInt16 (pbuf + 6, (HPDF_UINT16)(HPDF_INT16)fontdef->font_bbox.bottom);
+    PutUInt16 (pbuf + 8, (HPDF_UINT16)(HPDF_INT16)fontdef->font_bbox.right);
+    PutUInt16 (pbuf + 10, (HPDF_UINT16)(HPDF_INT16)fontdef->font_bbox.top);
+    PutUInt16 (pbuf + 12, (HPDF_UINT16)fontdef->italic_angle);
+    PutUInt16 (pbuf + 14, (HPDF_UINT16)fontdef->ascent);
+    PutUInt16 (pbuf + 16, (HPDF_UINT16)fontdef->descent);
+    PutUInt16 (pbuf + 18, fontdef->cap_height);
+    PutUInt16 (pbuf + 20, fontdef->x_height);
+    PutUInt16 (pbuf + 22, fontdef->stemv);
+    PutUInt16 (pbuf + 24, fontdef->stemh);
+    PutUInt16 (pbuf + 26, (HPDF_UINT16)fontdef->missing_width);
+    PutUInt16 (pbuf + 28, (HPDF_UINT16)attr->widths_count);
+
+    if ((ret = HPDF_Stream_Write (stream, buf, sizeof(buf))) != HPDF_OK)
+        return ret;
+
+    len = HPDF_StrLen (fontdef->base_font, HPDF_LIMIT_MAX_NAME_LEN);
+    buf[0] = (HPDF_BYTE)len;
+    if ((ret = HPDF_Stream_Write (stream, buf, 1)) != HPDF_OK ||
+            (ret = HPDF_Stream_Write (stream,
+            (const HPDF_BYTE *)fontdef->base_font, len)) != HPDF_OK)
+        return ret;
+
+    len = HPDF_StrLen (attr->encoding_scheme, HPDF_LIMIT_MAX_NAME_LEN);
+    buf[0] = (HPDF_BYTE)len;
+    if ((ret = HPDF_Stream_Write (stream, buf, 1)) != HPDF_OK ||
+            (ret = HPDF_Stream_Write (stream,
+            (const HPDF_BYTE *)attr->encoding_scheme, len)) != HPDF_OK)
+        return ret;
+
+    len = attr->char_set ? HPDF_StrLen (attr->char_set,
+            HPDF_LIMIT_MAX_STRING_LEN) : 0;
+    PutUInt16 (buf, (HPDF_UINT16)len);
+    if ((ret = HPDF_Stream_Write (stream, buf, 2)) != HPDF_OK ||
+            (len > 0 && (ret = HPDF_Stream_Write (stream,
+            (const HPDF_BYTE *)attr->char_set, len)) != HPDF_OK))
+        return ret;
+
+    for (i = 0; i < attr->widths_count; i++) {
+        const HPDF_CharData *cdata = attr->widths + i;
+
+        PutUInt16 (buf, (HPDF_UINT16)cdata->char_cd);
+        PutUInt16 (buf + 2, cdata->unicode);
+        PutUInt16 (buf + 4, (HPDF_UINT16)cdata->width);
+        if ((ret = HPDF_Stream_Write (stream, buf, HPDF_METRICS_CHAR_LEN))
+                != HPDF_OK)
+            return ret;
+    }
+
     return HPDF_OK;
 }
 
@@ -454,21 +733,13 @@ HPDF_Type1FontDef_SetWidths  (HPDF_FontDef          fontdef,
     if (dst == NULL)
         return HPDF_Error_GetCode (fontdef->error);
 
-    HPDF_MemSet (dst, 0, sizeof(HPDF_CharData) * attr->widths_count);
+    HPDF_MemCpy ((HPDF_BYTE *)dst, (const HPDF_BYTE *)widths,
+            sizeof(HPDF_CharData) * attr->widths_count);
     attr->widths = dst;
 
-    src = widths;
-    for (i = 0; i < attr->widths_count; i++) {
-        dst->char_cd = src->char_cd;
-        dst->unicode = src->unicode;
-        dst->width = src->width;
-        if (dst->unicode == 0x0020) {
-            fontdef->missing_width = src->width;
-        }
+    SortWidths (attr);
 
-        src++;
-        dst++;
-    }
+    fontdef->missing_width = HPDF_Type1FontDef_GetWidth (fontdef, 0x0020);
 
     return HPDF_OK;
 }
@@ -491,17 +762,25 @@ HPDF_Type1FontDef_GetWidth  (HPDF_FontDef  fontdef,
                              HPDF_UNICODE  unicode)
 {
     HPDF_Type1FontDefAttr attr = (HPDF_Type1FontDefAttr)fontdef->attr;
-    HPDF_CharData *cdata = attr->widths;
-    HPDF_UINT i;
+    const HPDF_CharData *cdata = attr->widths;
+    HPDF_UINT lo = 0;
+    HPDF_UINT hi = attr->widths_count;
 
     HPDF_PTRACE ((" HPDF_Type1FontDef_GetWidth\n"));
 
-    for (i = 0; i < attr->widths_count; i++) {
-        if (cdata->unicode == unicode)
-            return cdata->width;
-        cdata++;
+    /* the first entry whose unicode is not less than the one searched */
+    while (lo < hi) {
+        HPDF_UINT mid = lo + (hi - lo) / 2;
+
+        if (cdata[mid].unicode < unicode)
+            lo = mid + 1;
+        else
+            hi = mid;
     }
 
+    if (lo < attr->widths_count && cdata[lo].unicode == unicode)
+        return cdata[lo].width;
+
     return fontdef->missing_width;
 }
 
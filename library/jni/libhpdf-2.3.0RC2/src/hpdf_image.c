@@ -19,6 +19,14 @@
 #include "hpdf_utils.h"
 #include "hpdf.h"
 
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#define HPDF_USE_NEON
+#elif defined(__SSSE3__)
+#include <tmmintrin.h>
+#define HPDF_USE_SSSE3
+#endif
+
 static const char *COL_CMYK = "DeviceCMYK";
 static const char *COL_RGB = "DeviceRGB";
 static const char *COL_GRAY = "DeviceGray";
@@ -28,6 +36,14 @@ LoadJpegHeader (HPDF_Image   image,
                 HPDF_Stream  stream);
 
 
+static HPDF_STATUS
+FileImage_BeforeWrite  (HPDF_Dict  obj);
+
+
+static HPDF_STATUS
+FileImage_AfterWrite  (HPDF_Dict  obj);
+
+
 /*---------------------------------------------------------------------------*/
 
 static HPDF_STATUS
@@ -167,21 +183,108 @@ LoadJpegHeader (HPDF_Image   image,
     return HPDF_OK;
 }
 
-HPDF_Image
-HPDF_Image_LoadJpegImage  (HPDF_MMgr        mmgr,
-                           HPDF_Stream      jpeg_data,
-                           HPDF_Xref        xref)
+
+/*
+ *  The data of images loaded from files is not copied into memory. The
+ *  file name and size are kept as hidden entries, and the file is only
+ *  opened while the image is written, in place of its (empty) memory
+ *  stream.
+ */
+static HPDF_STATUS
+SetImageFile  (HPDF_Image   image,
+               const char  *filename,
+               HPDF_UINT64  size)
 {
-    HPDF_Dict image;
+    HPDF_String fname;
+    HPDF_Number fsize;
     HPDF_STATUS ret = HPDF_OK;
 
-    HPDF_PTRACE ((" HPDF_Image_LoadJpegImage\n"));
+    if (size > HPDF_LIMIT_MAX_INT)
+        return HPDF_SetError (image->error, HPDF_STREAM_OFFSET_OUT_OF_RANGE,
+                0);
+
+    fname = HPDF_String_New (image->mmgr, filename, NULL);
+    if (!fname)
+        return HPDF_Error_GetCode (image->error);
+
+    fname->header.obj_id |= HPDF_OTYPE_HIDDEN;
+    ret += HPDF_Dict_Add (image, "_FILE_NAME", fname);
+
+    fsize = HPDF_Number_New (image->mmgr, (HPDF_INT32)size);
+    if (!fsize)
+        return HPDF_Error_GetCode (image->error);
+
+    fsize->header.obj_id |= HPDF_OTYPE_HIDDEN;
+    ret += HPDF_Dict_Add (image, "_FILE_SIZE", fsize);
+    if (ret != HPDF_OK)
+        return HPDF_Error_GetCode (image->error);
+
+    image->before_write_fn = FileImage_BeforeWrite;
+    image->after_write_fn = FileImage_AfterWrite;
+
+    return HPDF_OK;
+}
+
+
+static HPDF_STATUS
+FileImage_BeforeWrite  (HPDF_Dict  obj)
+{
+    HPDF_String fname;
+    HPDF_Number fsize;
+    HPDF_Stream data;
+
+    HPDF_PTRACE ((" FileImage_BeforeWrite\n"));
+
+    fname = HPDF_Dict_GetItem (obj, "_FILE_NAME", HPDF_OCLASS_STRING);
+    fsize = HPDF_Dict_GetItem (obj, "_FILE_SIZE", HPDF_OCLASS_NUMBER);
+    if (!fname || !fsize)
+        return HPDF_SetError (obj->error, HPDF_MISSING_FILE_NAME_ENTRY, 0);
+
+    data = HPDF_FileReader_New (obj->mmgr, (const char *)(fname->value));
+    if (!HPDF_Stream_Validate (data))
+        return HPDF_Error_GetCode (obj->error);
+
+    /* the file must not have changed since the image was loaded */
+    if (HPDF_Stream_Size (data) != (HPDF_UINT64)fsize->value) {
+        HPDF_Stream_Free (data);
+        return HPDF_SetError (obj->error, HPDF_INVALID_IMAGE, 0);
+    }
+
+    HPDF_Stream_Free (obj->stream);
+    obj->stream = data;
+
+    return HPDF_OK;
+}
+
+
+static HPDF_STATUS
+FileImage_AfterWrite  (HPDF_Dict  obj)
+{
+    HPDF_PTRACE ((" FileImage_AfterWrite\n"));
+
+    HPDF_Stream_Free (obj->stream);
+    obj->stream = HPDF_MemStream_New (obj->mmgr, HPDF_STREAM_BUF_SIZ);
+    if (!obj->stream)
+        return HPDF_Error_GetCode (obj->error);
+
+    return HPDF_OK;
+}
+
+
+static HPDF_Image
+NewJpegImage  (HPDF_MMgr        mmgr,
+               HPDF_Stream      jpeg_data,
+               HPDF_Xref        xref)
+{
+    HPDF_Dict image;
+    HPDF_STATUS ret = HPDF_OK;
 
     image = HPDF_DictStream_New (mmgr, xref);
     if (!image)
         return NULL;
 
     image->header.obj_class |= HPDF_OSUBCLASS_XOBJECT;
+    image->header.obj_id |= HPDF_OTYPE_FINAL;
 
     /* add requiered elements */
     image->filter = HPDF_STREAM_FILTER_DCT_DECODE;
@@ -193,6 +296,23 @@ HPDF_Image_LoadJpegImage  (HPDF_MMgr        mmgr,
     if (LoadJpegHeader (image, jpeg_data) != HPDF_OK)
         return NULL;
 
+    return image;
+}
+
+
+HPDF_Image
+HPDF_Image_LoadJpegImage  (HPDF_MMgr        mmgr,
+                           HPDF_Stream      jpeg_data,
+                           HPDF_Xref        xref)
+{
+    HPDF_Dict image;
+
+    HPDF_PTRACE ((" HPDF_Image_LoadJpegImage\n"));
+
+    image = NewJpegImage (mmgr, jpeg_data, xref);
+    if (!image)
+        return NULL;
+
     if (HPDF_Stream_Seek (jpeg_data, 0, HPDF_SEEK_SET) != HPDF_OK)
         return NULL;
 
@@ -252,19 +372,55 @@ HPDF_Image_LoadJpegImageFromMem  (HPDF_MMgr    mmgr,
 }
 
 
+/*
+ *  HPDF_Image_LoadJpegImageFromFile
+ *
+ *  Reads only the header of the JPEG file; its data is copied from the
+ *  file to the output when the document is saved.
+ */
 HPDF_Image
-HPDF_Image_LoadRawImage (HPDF_MMgr          mmgr,
-                         HPDF_Stream        raw_data,
-                         HPDF_Xref          xref,
-                         HPDF_UINT          width,
-                         HPDF_UINT          height,
-                         HPDF_ColorSpace    color_space)
+HPDF_Image_LoadJpegImageFromFile  (HPDF_MMgr    mmgr,
+                                   const char  *filename,
+                                   HPDF_Xref    xref)
+{
+    HPDF_Stream jpeg_data;
+    HPDF_Image image;
+    HPDF_UINT64 size;
+
+    HPDF_PTRACE ((" HPDF_Image_LoadJpegImageFromFile\n"));
+
+    jpeg_data = HPDF_FileReader_New (mmgr, filename);
+    if (!HPDF_Stream_Validate (jpeg_data))
+        return NULL;
+
+    image = NewJpegImage (mmgr, jpeg_data, xref);
+    size = HPDF_Stream_Size (jpeg_data);
+
+    /* destroy file stream */
+    HPDF_Stream_Free (jpeg_data);
+
+    if (!image || SetImageFile (image, filename, size) != HPDF_OK)
+        return NULL;
+
+    return image;
+}
+
+
+/*
+ *  Creates the dictionary of a raw image and returns the size of its
+ *  data in size.
+ */
+static HPDF_Image
+NewRawImage  (HPDF_MMgr          mmgr,
+              HPDF_Xref          xref,
+              HPDF_UINT          width,
+              HPDF_UINT          height,
+              HPDF_ColorSpace    color_space,
+              HPDF_UINT          bits_per_component,
+              HPDF_UINT         *size)
 {
     HPDF_Dict image;
     HPDF_STATUS ret = HPDF_OK;
-    HPDF_UINT size;
-
-    HPDF_PTRACE ((" HPDF_Image_LoadRawImage\n"));
 
     if (color_space != HPDF_CS_DEVICE_GRAY &&
             color_space != HPDF_CS_DEVICE_RGB &&
@@ -273,25 +429,38 @@ HPDF_Image_LoadRawImage (HPDF_MMgr          mmgr,
         return NULL;
     }
 
+    if (bits_per_component != 1 && bits_per_component != 2 &&
+            bits_per_component != 4 && bits_per_component != 8) {
+        HPDF_SetError (mmgr->error, HPDF_INVALID_IMAGE, 0);
+        return NULL;
+    }
+
     image = HPDF_DictStream_New (mmgr, xref);
     if (!image)
         return NULL;
 
     image->header.obj_class |= HPDF_OSUBCLASS_XOBJECT;
+    image->header.obj_id |= HPDF_OTYPE_FINAL;
     ret += HPDF_Dict_AddName (image, "Type", "XObject");
     ret += HPDF_Dict_AddName (image, "Subtype", "Image");
     if (ret != HPDF_OK)
         return NULL;
 
-    if (color_space == HPDF_CS_DEVICE_GRAY) {
-        size = width * height;
-        ret = HPDF_Dict_AddName (image, "ColorSpace", COL_GRAY);
-	} else if (color_space == HPDF_CS_DEVICE_CMYK) {
-		size = width * height * 4;
-		ret = HPDF_Dict_AddName (image, "ColorSpace", COL_CMYK);
-    } else {
-        size = width * height * 3;
-        ret = HPDF_Dict_AddName (image, "ColorSpace", COL_RGB);
+    *size = (HPDF_UINT)((HPDF_DOUBLE)width * height / (8 / bits_per_component) + 0.876);
+
+    switch (color_space) {
+        case HPDF_CS_DEVICE_GRAY:
+            ret = HPDF_Dict_AddName (image, "ColorSpace", COL_GRAY);
+            break;
+        case HPDF_CS_DEVICE_RGB:
+            *size *= 3;
+            ret = HPDF_Dict_AddName (image, "ColorSpace", COL_RGB);
+            break;
+        case HPDF_CS_DEVICE_CMYK:
+            *size *= 4;
+            ret = HPDF_Dict_AddName (image, "ColorSpace", COL_CMYK);
+            break;
+        default:;
     }
 
     if (ret != HPDF_OK)
@@ -303,7 +472,29 @@ HPDF_Image_LoadRawImage (HPDF_MMgr          mmgr,
     if (HPDF_Dict_AddNumber (image, "Height", height) != HPDF_OK)
         return NULL;
 
-    if (HPDF_Dict_AddNumber (image, "BitsPerComponent", 8) != HPDF_OK)
+    if (HPDF_Dict_AddNumber (image, "BitsPerComponent", bits_per_component)
+            != HPDF_OK)
+        return NULL;
+
+    return image;
+}
+
+
+HPDF_Image
+HPDF_Image_LoadRawImage (HPDF_MMgr          mmgr,
+                         HPDF_Stream        raw_data,
+                         HPDF_Xref          xref,
+                         HPDF_UINT          width,
+                         HPDF_UINT          height,
+                         HPDF_ColorSpace    color_space)
+{
+    HPDF_Dict image;
+    HPDF_UINT size;
+
+    HPDF_PTRACE ((" HPDF_Image_LoadRawImage\n"));
+
+    image = NewRawImage (mmgr, xref, width, height, color_space, 8, &size);
+    if (!image)
         return NULL;
 
     if (HPDF_Stream_WriteToStream (raw_data, image->stream, 0, NULL) != HPDF_OK)
@@ -318,6 +509,52 @@ HPDF_Image_LoadRawImage (HPDF_MMgr          mmgr,
 }
 
 
+/*
+ *  HPDF_Image_LoadRawImageFromFile
+ *
+ *  Only checks the size of the file; its data is copied from the file to
+ *  the output when the document is saved.
+ */
+HPDF_Image
+HPDF_Image_LoadRawImageFromFile  (HPDF_MMgr          mmgr,
+                                  const char        *filename,
+                                  HPDF_Xref          xref,
+                                  HPDF_UINT          width,
+                                  HPDF_UINT          height,
+                                  HPDF_ColorSpace    color_space)
+{
+    HPDF_Stream raw_data;
+    HPDF_Dict image;
+    HPDF_UINT size;
+    HPDF_UINT64 file_size;
+
+    HPDF_PTRACE ((" HPDF_Image_LoadRawImageFromFile\n"));
+
+    raw_data = HPDF_FileReader_New (mmgr, filename);
+    if (!HPDF_Stream_Validate (raw_data))
+        return NULL;
+
+    file_size = HPDF_Stream_Size (raw_data);
+
+    /* destroy file stream */
+    HPDF_Stream_Free (raw_data);
+
+    image = NewRawImage (mmgr, xref, width, height, color_space, 8, &size);
+    if (!image)
+        return NULL;
+
+    if (file_size != size) {
+        HPDF_SetError (image->error, HPDF_INVALID_IMAGE, 0);
+        return NULL;
+    }
+
+    if (SetImageFile (image, filename, file_size) != HPDF_OK)
+        return NULL;
+
+    return image;
+}
+
+
 HPDF_Image
 HPDF_Image_LoadRawImageFromMem  (HPDF_MMgr          mmgr,
                                  const HPDF_BYTE   *buf,
@@ -328,66 +565,346 @@ HPDF_Image_LoadRawImageFromMem  (HPDF_MMgr          mmgr,
                                  HPDF_UINT          bits_per_component)
 {
     HPDF_Dict image;
-    HPDF_STATUS ret = HPDF_OK;
-    HPDF_UINT size=0;
+    HPDF_UINT size;
 
     HPDF_PTRACE ((" HPDF_Image_LoadRawImageFromMem\n"));
 
-    if (color_space != HPDF_CS_DEVICE_GRAY &&
-            color_space != HPDF_CS_DEVICE_RGB &&
-            color_space != HPDF_CS_DEVICE_CMYK) {
-        HPDF_SetError (mmgr->error, HPDF_INVALID_COLOR_SPACE, 0);
+    image = NewRawImage (mmgr, xref, width, height, color_space,
+            bits_per_component, &size);
+    if (!image)
+        return NULL;
+
+    if (HPDF_Stream_Write (image->stream, buf, size) != HPDF_OK)
+        return NULL;
+
+    return image;
+}
+
+
+static HPDF_STATUS
+RawImageJob_Func  (HPDF_ImageJob  job)
+{
+    HPDF_PTRACE ((" RawImageJob_Func\n"));
+
+    job->data = HPDF_MemStream_New (job->mmgr, 0);
+    if (!job->data)
+        return HPDF_Error_GetCode (&job->error);
+
+    return HPDF_Stream_WriteToStream (job->src, job->data, job->filter, NULL);
+}
+
+
+/*
+ *  HPDF_Image_LoadRawImageFromMemAsync
+ *
+ *  Copies the data of the image and compresses it with the flate filter
+ *  on a worker thread of loader.
+ */
+HPDF_Image
+HPDF_Image_LoadRawImageFromMemAsync  (HPDF_ImageLoader   loader,
+                                      HPDF_MMgr          mmgr,
+                                      const HPDF_BYTE   *buf,
+                                      HPDF_Xref          xref,
+                                      HPDF_UINT          width,
+                                      HPDF_UINT          height,
+                                      HPDF_ColorSpace    color_space,
+                                      HPDF_UINT          bits_per_component)
+{
+    HPDF_Dict image;
+    HPDF_ImageJob job;
+    HPDF_UINT size;
+
+    HPDF_PTRACE ((" HPDF_Image_LoadRawImageFromMemAsync\n"));
+
+    image = NewRawImage (mmgr, xref, width, height, color_space,
+            bits_per_component, &size);
+    if (!image)
+        return NULL;
+
+    job = HPDF_ImageJob_New (mmgr, RawImageJob_Func, buf, size);
+    if (!job)
         return NULL;
+
+    job->filter = HPDF_STREAM_FILTER_FLATE_DECODE;
+    image->filter = HPDF_STREAM_FILTER_FLATE_DECODE |
+            HPDF_STREAM_FILTER_ENCODED;
+
+    HPDF_ImageLoader_Submit (loader, image, job);
+
+    return image;
+}
+
+
+/*
+ *  Row kernels for HPDF_Image_LoadPixelImageFromMem. Each converts one
+ *  row of pixels into packed 8-bit RGB samples and, when alpha is not
+ *  NULL, 8-bit alpha samples. The vector paths store whole registers,
+ *  so the rgb buffer must have 4 bytes of slack past width * 3.
+ */
+static void
+ConvertRGBA8888Row  (const HPDF_BYTE  *src,
+                     HPDF_BYTE        *rgb,
+                     HPDF_BYTE        *alpha,
+                     HPDF_UINT         width)
+{
+    HPDF_UINT i = 0;
+
+#if defined(HPDF_USE_NEON)
+    for (; i + 16 <= width; i += 16) {
+        uint8x16x4_t px = vld4q_u8 (src + i * 4);
+        uint8x16x3_t c;
+
+        c.val[0] = px.val[0];
+        c.val[1] = px.val[1];
+        c.val[2] = px.val[2];
+        vst3q_u8 (rgb + i * 3, c);
+        if (alpha)
+            vst1q_u8 (alpha + i, px.val[3]);
+    }
+#elif defined(HPDF_USE_SSSE3)
+    {
+        const __m128i rgb_mask = _mm_setr_epi8 (0, 1, 2, 4, 5, 6, 8, 9, 10,
+                12, 13, 14, -1, -1, -1, -1);
+        const __m128i alpha_mask = _mm_setr_epi8 (3, 7, 11, 15, -1, -1, -1,
+                -1, -1, -1, -1, -1, -1, -1, -1, -1);
+
+        for (; i + 4 <= width; i += 4) {
+            __m128i px = _mm_loadu_si128 ((const __m128i *)(src + i * 4));
+
+            /* the 4 unused bytes are overwritten by the next store */
+            _mm_storeu_si128 ((__m128i *)(rgb + i * 3),
+                    _mm_shuffle_epi8 (px, rgb_mask));
+            if (alpha) {
+                HPDF_UINT32 a = (HPDF_UINT32)_mm_cvtsi128_si32 (
+                        _mm_shuffle_epi8 (px, alpha_mask));
+
+                alpha[i] = (HPDF_BYTE)a;
+                alpha[i + 1] = (HPDF_BYTE)(a >> 8);
+                alpha[i + 2] = (HPDF_BYTE)(a >> 16);
+                alpha[i + 3] = (HPDF_BYTE)(a >> 24);
+            }
+        }
     }
+#endif
+
+    for (; i < width; i++) {
+        rgb[i * 3] = src[i * 4];
+        rgb[i * 3 + 1] = src[i * 4 + 1];
+        rgb[i * 3 + 2] = src[i * 4 + 2];
+        if (alpha)
+            alpha[i] = src[i * 4 + 3];
+    }
+}
 
-    if (bits_per_component != 1 && bits_per_component != 2 &&
-            bits_per_component != 4 && bits_per_component != 8) {
+
+static void
+ConvertRGB565Row  (const HPDF_BYTE  *src,
+                   HPDF_BYTE        *rgb,
+                   HPDF_UINT         width)
+{
+    HPDF_UINT i;
+
+    for (i = 0; i < width; i++) {
+        HPDF_UINT v = src[i * 2] | ((HPDF_UINT)src[i * 2 + 1] << 8);
+        HPDF_UINT r = v >> 11;
+        HPDF_UINT g = (v >> 5) & 0x3F;
+        HPDF_UINT b = v & 0x1F;
+
+        rgb[i * 3] = (HPDF_BYTE)((r << 3) | (r >> 2));
+        rgb[i * 3 + 1] = (HPDF_BYTE)((g << 2) | (g >> 4));
+        rgb[i * 3 + 2] = (HPDF_BYTE)((b << 3) | (b >> 2));
+    }
+}
+
+
+/*
+ *  Divides premultiplied color samples by their alpha. recip[a] holds
+ *  255 / a in 16.16 fixed point, so only translucent pixels cost a
+ *  multiply and opaque ones are skipped.
+ */
+static void
+UnpremultiplyRow  (HPDF_BYTE          *rgb,
+                   const HPDF_BYTE    *alpha,
+                   HPDF_UINT           width,
+                   const HPDF_UINT32  *recip)
+{
+    HPDF_UINT i;
+
+    for (i = 0; i < width; i++) {
+        HPDF_BYTE a = alpha[i];
+        HPDF_UINT k;
+
+        if (a == 0xFF)
+            continue;
+
+        for (k = 0; k < 3; k++) {
+            HPDF_UINT32 v = (rgb[i * 3 + k] * recip[a] + 0x8000) >> 16;
+
+            rgb[i * 3 + k] = (HPDF_BYTE)(v > 0xFF ? 0xFF : v);
+        }
+    }
+}
+
+
+static HPDF_BOOL
+HasTransparentPixel  (const HPDF_BYTE  *pixels,
+                      HPDF_UINT         width,
+                      HPDF_UINT         height,
+                      HPDF_UINT         stride)
+{
+    HPDF_UINT row;
+    HPDF_UINT i;
+
+    for (row = 0; row < height; row++) {
+        const HPDF_BYTE *src = pixels + row * stride;
+
+        for (i = 0; i < width; i++)
+            if (src[i * 4 + 3] != 0xFF)
+                return HPDF_TRUE;
+    }
+
+    return HPDF_FALSE;
+}
+
+
+/*
+ *  HPDF_Image_LoadPixelImageFromMem
+ *
+ *  Creates an 8-bit DeviceRGB image from an uncompressed pixel buffer,
+ *  converting it row by row straight into the image stream. RGBA pixels
+ *  get a DeviceGray SMask holding their alpha unless every pixel is
+ *  opaque. stride is the number of bytes between the starts of two rows.
+ */
+HPDF_Image
+HPDF_Image_LoadPixelImageFromMem  (HPDF_MMgr          mmgr,
+                                   const HPDF_BYTE   *pixels,
+                                   HPDF_Xref          xref,
+                                   HPDF_UINT          width,
+                                   HPDF_UINT          height,
+                                   HPDF_UINT          stride,
+                                   HPDF_PixelFormat   format)
+{
+    HPDF_Dict image;
+    HPDF_Dict smask = NULL;
+    HPDF_STATUS ret = HPDF_OK;
+    HPDF_UINT bytes_per_pixel;
+    HPDF_BYTE *rgb = NULL;
+    HPDF_BYTE *alpha = NULL;
+    HPDF_UINT32 recip[256];
+    HPDF_UINT row;
+
+    HPDF_PTRACE ((" HPDF_Image_LoadPixelImageFromMem\n"));
+
+    switch (format) {
+        case HPDF_PIXEL_RGB888:
+            bytes_per_pixel = 3;
+            break;
+        case HPDF_PIXEL_RGBA8888:
+        case HPDF_PIXEL_RGBA8888_PREMUL:
+            bytes_per_pixel = 4;
+            break;
+        case HPDF_PIXEL_RGB565:
+            bytes_per_pixel = 2;
+            break;
+        default:
+            HPDF_SetError (mmgr->error, HPDF_INVALID_PARAMETER, 0);
+            return NULL;
+    }
+
+    if (!pixels || width == 0 || height == 0) {
         HPDF_SetError (mmgr->error, HPDF_INVALID_IMAGE, 0);
         return NULL;
     }
 
+    if (stride < width * bytes_per_pixel) {
+        HPDF_SetError (mmgr->error, HPDF_INVALID_PARAMETER, 0);
+        return NULL;
+    }
+
     image = HPDF_DictStream_New (mmgr, xref);
     if (!image)
         return NULL;
 
     image->header.obj_class |= HPDF_OSUBCLASS_XOBJECT;
+    image->header.obj_id |= HPDF_OTYPE_FINAL;
     ret += HPDF_Dict_AddName (image, "Type", "XObject");
     ret += HPDF_Dict_AddName (image, "Subtype", "Image");
+    ret += HPDF_Dict_AddName (image, "ColorSpace", COL_RGB);
+    ret += HPDF_Dict_AddNumber (image, "Width", width);
+    ret += HPDF_Dict_AddNumber (image, "Height", height);
+    ret += HPDF_Dict_AddNumber (image, "BitsPerComponent", 8);
     if (ret != HPDF_OK)
         return NULL;
 
-    switch (color_space) {
-        case HPDF_CS_DEVICE_GRAY:
-            size = (HPDF_UINT)((HPDF_DOUBLE)width * height / (8 / bits_per_component) + 0.876);
-            ret = HPDF_Dict_AddName (image, "ColorSpace", COL_GRAY);
-            break;
-        case HPDF_CS_DEVICE_RGB:
-            size = (HPDF_UINT)((HPDF_DOUBLE)width * height / (8 / bits_per_component) + 0.876);
-            size *= 3;
-            ret = HPDF_Dict_AddName (image, "ColorSpace", COL_RGB);
-            break;
-        case HPDF_CS_DEVICE_CMYK:
-            size = (HPDF_UINT)((HPDF_DOUBLE)width * height / (8 / bits_per_component) + 0.876);
-            size *= 4;
-            ret = HPDF_Dict_AddName (image, "ColorSpace", COL_CMYK);
-            break;
-        default:;
+    if (format == HPDF_PIXEL_RGB888 && stride == width * 3) {
+        if (HPDF_Stream_Write (image->stream, pixels, stride * height)
+                != HPDF_OK)
+            return NULL;
+
+        return image;
     }
 
-    if (ret != HPDF_OK)
-        return NULL;
+    if (bytes_per_pixel == 4 &&
+            HasTransparentPixel (pixels, width, height, stride)) {
+        smask = HPDF_DictStream_New (mmgr, xref);
+        if (!smask)
+            return NULL;
 
-    if (HPDF_Dict_AddNumber (image, "Width", width) != HPDF_OK)
-        return NULL;
+        smask->header.obj_class |= HPDF_OSUBCLASS_XOBJECT;
+        smask->header.obj_id |= HPDF_OTYPE_FINAL;
+        ret += HPDF_Dict_AddName (smask, "Type", "XObject");
+        ret += HPDF_Dict_AddName (smask, "Subtype", "Image");
+        ret += HPDF_Dict_AddName (smask, "ColorSpace", COL_GRAY);
+        ret += HPDF_Dict_AddNumber (smask, "Width", width);
+        ret += HPDF_Dict_AddNumber (smask, "Height", height);
+        ret += HPDF_Dict_AddNumber (smask, "BitsPerComponent", 8);
+        ret += HPDF_Dict_Add (image, "SMask", smask);
+        if (ret != HPDF_OK)
+            return NULL;
 
-    if (HPDF_Dict_AddNumber (image, "Height", height) != HPDF_OK)
-        return NULL;
+        if (format == HPDF_PIXEL_RGBA8888_PREMUL) {
+            HPDF_UINT a;
 
-    if (HPDF_Dict_AddNumber (image, "BitsPerComponent", bits_per_component)
-            != HPDF_OK)
-        return NULL;
+            recip[0] = 0;
+            for (a = 1; a < 256; a++)
+                recip[a] = (0xFF * 0x10000 + a / 2) / a;
+        }
+    }
 
-    if (HPDF_Stream_Write (image->stream, buf, size) != HPDF_OK)
+    if (format != HPDF_PIXEL_RGB888) {
+        rgb = HPDF_GetMem (mmgr, width * 3 + 4 + (smask ? width : 0));
+        if (!rgb)
+            return NULL;
+
+        if (smask)
+            alpha = rgb + width * 3 + 4;
+    }
+
+    for (row = 0; row < height && ret == HPDF_OK; row++) {
+        const HPDF_BYTE *src = pixels + row * stride;
+
+        switch (format) {
+            case HPDF_PIXEL_RGB888:
+                ret = HPDF_Stream_Write (image->stream, src, width * 3);
+                continue;
+            case HPDF_PIXEL_RGB565:
+                ConvertRGB565Row (src, rgb, width);
+                break;
+            default:
+                ConvertRGBA8888Row (src, rgb, alpha, width);
+                if (alpha && format == HPDF_PIXEL_RGBA8888_PREMUL)
+                    UnpremultiplyRow (rgb, alpha, width, recip);
+        }
+
+        ret = HPDF_Stream_Write (image->stream, rgb, width * 3);
+        if (ret == HPDF_OK && alpha)
+            ret = HPDF_Stream_Write (smask->stream, alpha, width);
+    }
+
+    if (rgb)
+        HPDF_FreeMem (mmgr, rgb);
+
+    if (ret != HPDF_OK)
         return NULL;
 
     return image;
@@ -548,6 +1065,9 @@ HPDF_Image_SetMask (HPDF_Image   image,
             return ret;
     }
 
+    /* the bytes kept since the image was saved do not match any more. */
+    image->header.obj_id &= ~HPDF_OTYPE_FINAL;
+
     image_mask->value = mask;
     return HPDF_OK;
 }
@@ -566,6 +1086,8 @@ HPDF_Image_SetMaskImage  (HPDF_Image   image,
     if (HPDF_Image_SetMask (mask_image, HPDF_TRUE) != HPDF_OK)
         return HPDF_CheckError (image->error);
 
+    image->header.obj_id &= ~HPDF_OTYPE_FINAL;
+
     return HPDF_Dict_Add (image, "Mask", mask_image);
 }
 
@@ -605,6 +1127,8 @@ HPDF_Image_SetColorMask (HPDF_Image   image,
     if (!array)
         return HPDF_CheckError (image->error);
 
+    image->header.obj_id &= ~HPDF_OTYPE_FINAL;
+
     ret += HPDF_Dict_Add (image, "Mask", array);
     ret += HPDF_Array_AddNumber (array, rmin);
     ret += HPDF_Array_AddNumber (array, rmax);
@@ -638,9 +1162,268 @@ HPDF_Image_AddSMask  (HPDF_Image  image,
    if (!name || HPDF_StrCmp (COL_GRAY, name) != 0)
        return HPDF_RaiseError (smask->error, HPDF_INVALID_COLOR_SPACE, 0);
 
+   image->header.obj_id &= ~HPDF_OTYPE_FINAL;
+
    return HPDF_Dict_Add (image, "SMask", smask);
 }
 
+
+/*
+ *  ResampleStream
+ *
+ *  Reduces the samples read from src to dst_width x dst_height by
+ *  averaging the box of source pixels which falls on each output pixel,
+ *  and makes the result the stream of obj. Source rows are read one at a
+ *  time and each contributes to exactly one output row, so only a row of
+ *  each size and a row of sums are held in memory.
+ */
+static HPDF_STATUS
+ResampleStream  (HPDF_Dict    obj,
+                 HPDF_Stream  src,
+                 HPDF_UINT    comps,
+                 HPDF_UINT    width,
+                 HPDF_UINT    height,
+                 HPDF_UINT    dst_width,
+                 HPDF_UINT    dst_height)
+{
+    HPDF_STATUS ret = HPDF_OK;
+    HPDF_UINT row_len = width * comps;
+    HPDF_UINT dst_row_len = dst_width * comps;
+    HPDF_UINT64 *sums;
+    HPDF_UINT *xs;
+    HPDF_BYTE *row;
+    HPDF_BYTE *dst_row;
+    HPDF_Stream dst;
+    HPDF_UINT x, y, i, c;
+
+    HPDF_PTRACE ((" ResampleStream\n"));
+
+    sums = HPDF_GetMem (obj->mmgr, dst_row_len * sizeof (HPDF_UINT64) +
+            (dst_width + 1) * sizeof (HPDF_UINT) + row_len + dst_row_len);
+    if (!sums)
+        return HPDF_Error_GetCode (obj->error);
+
+    xs = (HPDF_UINT *)(sums + dst_row_len);
+    row = (HPDF_BYTE *)(xs + dst_width + 1);
+    dst_row = row + row_len;
+
+    /* first source column of each output column */
+    for (i = 0; i <= dst_width; i++)
+        xs[i] = (HPDF_UINT)((HPDF_UINT64)i * width / dst_width);
+
+    dst = HPDF_MemStream_New (obj->mmgr, HPDF_STREAM_BUF_SIZ);
+    if (!dst) {
+        HPDF_FreeMem (obj->mmgr, sums);
+        return HPDF_Error_GetCode (obj->error);
+    }
+
+    if (obj->stream->type == HPDF_STREAM_MEMORY) {
+        HPDF_MemStreamAttr attr = (HPDF_MemStreamAttr)obj->stream->attr;
+
+        if (attr->budget)
+            HPDF_MemStream_SetBudget (dst, attr->budget);
+    }
+
+    ret = HPDF_Stream_Seek (src, 0, HPDF_SEEK_SET);
+
+    y = 0;
+    for (i = 0; i < dst_height && ret == HPDF_OK; i++) {
+        HPDF_UINT y1 = (HPDF_UINT)((HPDF_UINT64)(i + 1) * height /
+                dst_height);
+        HPDF_UINT rows = y1 - y;
+
+        HPDF_MemSet (sums, 0, dst_row_len * sizeof (HPDF_UINT64));
+
+        for (; y < y1; y++) {
+            HPDF_UINT len = row_len;
+            HPDF_UINT64 *sum = sums;
+
+            ret = HPDF_Stream_Read (src, row, &len);
+            if (ret == HPDF_STREAM_EOF && len == row_len)
+                ret = HPDF_OK;
+            if (ret != HPDF_OK) {
+                if (ret == HPDF_STREAM_EOF)
+                    ret = HPDF_SetError (obj->error, HPDF_INVALID_IMAGE, 0);
+                break;
+            }
+
+            for (x = 0; x < dst_width; x++) {
+                const HPDF_BYTE *p = row + xs[x] * comps;
+                const HPDF_BYTE *end = row + xs[x + 1] * comps;
+
+                for (; p < end; p += comps)
+                    for (c = 0; c < comps; c++)
+                        sum[c] += p[c];
+
+                sum += comps;
+            }
+        }
+
+        if (ret != HPDF_OK)
+            break;
+
+        for (x = 0; x < dst_width; x++) {
+            HPDF_UINT64 n = (HPDF_UINT64)(xs[x + 1] - xs[x]) * rows;
+
+            for (c = 0; c < comps; c++)
+                dst_row[x * comps + c] =
+                        (HPDF_BYTE)((sums[x * comps + c] + n / 2) / n);
+        }
+
+        ret = HPDF_Stream_Write (dst, dst_row, dst_row_len);
+    }
+
+    HPDF_FreeMem (obj->mmgr, sums);
+
+    if (ret != HPDF_OK) {
+        HPDF_Stream_Free (dst);
+        return ret;
+    }
+
+    HPDF_Stream_Free (obj->stream);
+    obj->stream = dst;
+
+    ret += HPDF_Dict_AddNumber (obj, "Width", dst_width);
+    ret += HPDF_Dict_AddNumber (obj, "Height", dst_height);
+    if (ret != HPDF_OK)
+        return HPDF_Error_GetCode (obj->error);
+
+    return HPDF_OK;
+}
+
+
+/*
+ *  HPDF_Image_Downsample
+ *
+ *  Reduces the resolution of an image which is drawn width x height
+ *  points in size to at most dpi pixels per inch, together with its soft
+ *  mask. Only images with 8-bit DeviceGray, DeviceRGB or DeviceCMYK
+ *  samples can be resampled; JPEG, CCITT, indexed and delay-loaded PNG
+ *  images, images compressed by an asynchronous loading function, and
+ *  images which are already small enough, are left as they are. The
+ *  same image must not be drawn larger elsewhere in the document.
+ */
+HPDF_EXPORT(HPDF_STATUS)
+HPDF_Image_Downsample  (HPDF_Image  image,
+                        HPDF_REAL   width,
+                        HPDF_REAL   height,
+                        HPDF_REAL   dpi)
+{
+    const char *name;
+    HPDF_UINT comps;
+    HPDF_UINT src_width;
+    HPDF_UINT src_height;
+    HPDF_UINT dst_width;
+    HPDF_UINT dst_height;
+    HPDF_REAL w;
+    HPDF_REAL h;
+    HPDF_Stream src;
+    HPDF_Dict smask;
+    HPDF_STATUS ret;
+
+    HPDF_PTRACE ((" HPDF_Image_Downsample\n"));
+
+    if (!HPDF_Image_Validate (image))
+        return HPDF_INVALID_IMAGE;
+
+    if (width <= 0 || height <= 0 || dpi <= 0)
+        return HPDF_RaiseError (image->error, HPDF_INVALID_PARAMETER, 0);
+
+    if ((ret = HPDF_Image_WaitLoad (image)) != HPDF_OK)
+        return ret;
+
+    if (image->filter & (HPDF_STREAM_FILTER_DCT_DECODE |
+                HPDF_STREAM_FILTER_CCITT_DECODE | HPDF_STREAM_FILTER_ENCODED))
+        return HPDF_OK;
+
+    if (image->before_write_fn &&
+            image->before_write_fn != FileImage_BeforeWrite)
+        return HPDF_OK;
+
+    if (HPDF_Image_GetBitsPerComponent (image) != 8)
+        return HPDF_OK;
+
+    name = HPDF_Image_GetColorSpace (image);
+    if (!name)
+        return HPDF_OK;
+
+    if (HPDF_StrCmp (name, COL_GRAY) == 0)
+        comps = 1;
+    else if (HPDF_StrCmp (name, COL_RGB) == 0)
+        comps = 3;
+    else if (HPDF_StrCmp (name, COL_CMYK) == 0)
+        comps = 4;
+    else
+        return HPDF_OK;
+
+    src_width = HPDF_Image_GetWidth (image);
+    src_height = HPDF_Image_GetHeight (image);
+
+    /* round the required number of pixels up */
+    w = width * dpi / 72;
+    h = height * dpi / 72;
+    dst_width = (HPDF_UINT)w;
+    dst_height = (HPDF_UINT)h;
+    if (dst_width < w || dst_width == 0)
+        dst_width++;
+    if (dst_height < h || dst_height == 0)
+        dst_height++;
+
+    if (dst_width >= src_width && dst_height >= src_height)
+        return HPDF_OK;
+
+    if (dst_width > src_width)
+        dst_width = src_width;
+    if (dst_height > src_height)
+        dst_height = src_height;
+
+    if (image->before_write_fn) {
+        /* the data is still in its file; read it from there */
+        HPDF_String fname = HPDF_Dict_GetItem (image, "_FILE_NAME",
+                HPDF_OCLASS_STRING);
+
+        if (!fname)
+            return HPDF_RaiseError (image->error,
+                    HPDF_MISSING_FILE_NAME_ENTRY, 0);
+
+        src = HPDF_FileReader_New (image->mmgr,
+                (const char *)(fname->value));
+        if (!HPDF_Stream_Validate (src))
+            return HPDF_CheckError (image->error);
+    } else
+        src = image->stream;
+
+    ret = ResampleStream (image, src, comps, src_width, src_height,
+            dst_width, dst_height);
+
+    if (src != image->stream && image->before_write_fn) {
+        HPDF_Stream_Free (src);
+
+        if (ret == HPDF_OK) {
+            image->before_write_fn = NULL;
+            image->after_write_fn = NULL;
+            HPDF_Dict_RemoveElement (image, "_FILE_NAME");
+            HPDF_Dict_RemoveElement (image, "_FILE_SIZE");
+        }
+    }
+
+    if (ret != HPDF_OK)
+        return HPDF_CheckError (image->error);
+
+    smask = HPDF_Dict_GetItem (image, "SMask", HPDF_OCLASS_DICT);
+    if (smask && smask->stream &&
+            HPDF_Image_GetBitsPerComponent (smask) == 8 &&
+            HPDF_Image_GetWidth (smask) == src_width &&
+            HPDF_Image_GetHeight (smask) == src_height) {
+        ret = ResampleStream (smask, smask->stream, 1, src_width,
+                src_height, dst_width, dst_height);
+        if (ret != HPDF_OK)
+            return HPDF_CheckError (image->error);
+    }
+
+    return HPDF_OK;
+}
+
 HPDF_STATUS
 HPDF_Image_SetColorSpace  (HPDF_Image   image,
                           HPDF_Array   colorspace)
@@ -648,6 +1431,8 @@ HPDF_Image_SetColorSpace  (HPDF_Image   image,
     if (!HPDF_Image_Validate (image))
         return HPDF_INVALID_IMAGE;
 
+    image->header.obj_id &= ~HPDF_OTYPE_FINAL;
+
     return HPDF_Dict_Add (image, "ColorSpace", colorspace);
 }
 
@@ -659,6 +1444,8 @@ HPDF_Image_SetRenderingIntent  (HPDF_Image   image,
     if (!HPDF_Image_Validate (image))
         return HPDF_INVALID_IMAGE;
 
+    image->header.obj_id &= ~HPDF_OTYPE_FINAL;
+
     return HPDF_Dict_AddName (image, "Intent", intent);
 }
 
@@ -101,7 +101,7 @@ struct _HPDF_CCITT_Data {
 	tidata_t	tif_rawcp;	/* current spot in raw buffer */
 	tidata_t	tif_rawdata;	/* raw data buffer */	
 
-} HPDF_CCITT_Data;
+};
 
 static HPDF_STATUS HPDF_InitCCITTFax3(struct _HPDF_CCITT_Data *pData)
 {
@@ -355,6 +355,7 @@ putspan(struct _HPDF_CCITT_Data *pData, int32 span, const tableentry* tab)
 	sp->bit = bit;
 }
 
+#if !defined(__GNUC__)
 static const unsigned char zeroruns[256] = {
     8, 7, 6, 6, 5, 5, 5, 5, 4, 4, 4, 4, 4, 4, 4, 4,	/* 0x00 - 0x0f */
     3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,	/* 0x10 - 0x1f */
@@ -373,147 +374,86 @@ static const unsigned char zeroruns[256] = {
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,	/* 0xe0 - 0xef */
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,	/* 0xf0 - 0xff */
 };
-static const unsigned char oneruns[256] = {
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,	/* 0x00 - 0x0f */
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,	/* 0x10 - 0x1f */
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,	/* 0x20 - 0x2f */
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,	/* 0x30 - 0x3f */
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,	/* 0x40 - 0x4f */
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,	/* 0x50 - 0x5f */
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,	/* 0x60 - 0x6f */
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,	/* 0x70 - 0x7f */
-    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,	/* 0x80 - 0x8f */
-    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,	/* 0x90 - 0x9f */
-    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,	/* 0xa0 - 0xaf */
-    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,	/* 0xb0 - 0xbf */
-    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,	/* 0xc0 - 0xcf */
-    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,	/* 0xd0 - 0xdf */
-    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,	/* 0xe0 - 0xef */
-    4, 4, 4, 4, 4, 4, 4, 4, 5, 5, 5, 5, 6, 6, 7, 8,	/* 0xf0 - 0xff */
-};
+#endif
 
 /*
- * Find a span of ones or zeros using the supplied
- * table.  The ``base'' of the bit string is supplied
- * along with the start+end bit indices.
+ * Count the leading zero bits of a non-zero word.
  */
-static /*inline*/ int32 find0span(unsigned char* bp, int32 bs, int32 be)
+static /*inline*/ int32
+countleadingzeros(HPDF_UINT64 w)
 {
-	int32 bits = be - bs;
-	int32 n, span;
-
-	bp += bs>>3;
-	/*
-	 * Check partial byte on lhs.
-	 */
-	if (bits > 0 && (n = (bs & 7))) {
-		span = zeroruns[(*bp << n) & 0xff];
-		if (span > 8-n)		/* table value too generous */
-			span = 8-n;
-		if (span > bits)	/* constrain span to bit range */
-			span = bits;
-		if (n+span < 8)		/* doesn't extend to edge of byte */
-			return (span);
-		bits -= span;
-		bp++;
-	} else
-		span = 0;
-	if (bits >= (int32)(2 * 8 * sizeof(long))) {
-		long* lp;
-		/*
-		 * Align to longword boundary and check longwords.
-		 */
-		while (!isAligned(bp, long)) {
-			if (*bp != 0x00)
-				return (span + zeroruns[*bp]);
-			span += 8, bits -= 8;
-			bp++;
-		}
-		lp = (long*) bp;
-		while ((bits >= (int32)(8 * sizeof(long))) && (0 == *lp)) {
-			span += 8*sizeof (long), bits -= 8*sizeof (long);
-			lp++;
-		}
-		bp = (unsigned char*) lp;
+#if defined(__GNUC__)
+	return __builtin_clzll(w);
+#else
+	int32 n = 0;
+
+	while (!(w & ((HPDF_UINT64)0xff << 56))) {
+		w <<= 8;
+		n += 8;
 	}
-	/*
-	 * Scan full bytes for all 0's.
-	 */
-	while (bits >= 8) {
-		if (*bp != 0x00)	/* end of run */
-			return (span + zeroruns[*bp]);
-		span += 8, bits -= 8;
-		bp++;
-	}
-	/*
-	 * Check partial byte on rhs.
-	 */
-	if (bits > 0) {
-		n = zeroruns[*bp];
-		span += (n > bits ? bits : n);
+	return (n + zeroruns[(unsigned char)(w >> 56)]);
+#endif
+}
+
+/*
+ * Load the 64 bits starting at byte bp[0] most significant bit first,
+ * without reading past bp[avail - 1]; missing bytes read as 0.
+ */
+static /*inline*/ HPDF_UINT64
+loadbits(const unsigned char* bp, int32 avail)
+{
+	HPDF_UINT64 w = 0;
+	int32 i;
+
+	if (avail >= 8)
+		return ((HPDF_UINT64)bp[0] << 56) | ((HPDF_UINT64)bp[1] << 48) |
+		    ((HPDF_UINT64)bp[2] << 40) | ((HPDF_UINT64)bp[3] << 32) |
+		    ((HPDF_UINT64)bp[4] << 24) | ((HPDF_UINT64)bp[5] << 16) |
+		    ((HPDF_UINT64)bp[6] << 8) | (HPDF_UINT64)bp[7];
+
+	for (i = 0; i < 8; i++) {
+		w <<= 8;
+		if (i < avail)
+			w |= bp[i];
 	}
-	return (span);
+	return (w);
 }
 
+/*
+ * Find a span of ones or zeros a word at a time.  The
+ * ``base'' of the bit string is supplied along with the
+ * start+end bit indices; invert is all ones to look for
+ * a span of ones.  Each step loads the 64 bits from the
+ * byte holding the current bit, shifts out the bits
+ * before it and counts the leading zeros; the bits
+ * shifted in are zero, so a zero word means the run
+ * covers all of the bits that were loaded.  Bytes past
+ * the one holding bit be-1 are never read, and the span
+ * is constrained to the bit range at the end.
+ */
 static /*inline*/ int32
-find1span(unsigned char* bp, int32 bs, int32 be)
+findspan(unsigned char* bp, int32 bs, int32 be, HPDF_UINT64 invert)
 {
-	int32 bits = be - bs;
-	int32 n, span;
+	int32 nbytes = (be + 7) >> 3;
+	int32 pos = bs;
 
-	bp += bs>>3;
-	/*
-	 * Check partial byte on lhs.
-	 */
-	if (bits > 0 && (n = (bs & 7))) {
-		span = oneruns[(*bp << n) & 0xff];
-		if (span > 8-n)		/* table value too generous */
-			span = 8-n;
-		if (span > bits)	/* constrain span to bit range */
-			span = bits;
-		if (n+span < 8)		/* doesn't extend to edge of byte */
-			return (span);
-		bits -= span;
-		bp++;
-	} else
-		span = 0;
-	if (bits >= (int32)(2 * 8 * sizeof(long))) {
-		long* lp;
-		/*
-		 * Align to longword boundary and check longwords.
-		 */
-		while (!isAligned(bp, long)) {
-			if (*bp != 0xff)
-				return (span + oneruns[*bp]);
-			span += 8, bits -= 8;
-			bp++;
-		}
-		lp = (long*) bp;
-		while ((bits >= (int32)(8 * sizeof(long))) && (~0 == *lp)) {
-			span += 8*sizeof (long), bits -= 8*sizeof (long);
-			lp++;
+	while (pos < be) {
+		int32 byte = pos >> 3;
+		int32 sh = pos & 7;
+		HPDF_UINT64 w = (loadbits(bp + byte, nbytes - byte) ^ invert) << sh;
+
+		if (w != 0) {
+			pos += countleadingzeros(w);
+			break;
 		}
-		bp = (unsigned char*) lp;
-	}
-	/*
-	 * Scan full bytes for all 1's.
-	 */
-	while (bits >= 8) {
-		if (*bp != 0xff)	/* end of run */
-			return (span + oneruns[*bp]);
-		span += 8, bits -= 8;
-		bp++;
-	}
-	/*
-	 * Check partial byte on rhs.
-	 */
-	if (bits > 0) {
-		n = oneruns[*bp];
-		span += (n > bits ? bits : n);
+		pos += 64 - sh;
 	}
-	return (span);
+	return ((pos < be ? pos : be) - bs);
 }
 
+#define	find0span(_bp, _bs, _be)	findspan(_bp, _bs, _be, 0)
+#define	find1span(_bp, _bs, _be)	findspan(_bp, _bs, _be, ~(HPDF_UINT64)0)
+
 /*
  * Return the offset of the next bit in the range
  * [bs..be] that is different from the specified
@@ -697,33 +637,26 @@ HPDF_Stream_CcittToStream( const HPDF_BYTE   *buf,
 	return HPDF_OK;
 }
 
-HPDF_Image
-HPDF_Image_Load1BitImageFromMem  (HPDF_MMgr        mmgr,
-                          const HPDF_BYTE   *buf,
-                          HPDF_Xref        xref,
-                          HPDF_UINT          width,
-                          HPDF_UINT          height,
-						  HPDF_UINT          line_width,
-						  HPDF_BOOL			 top_is_first
-                          )
+static HPDF_Image
+New1BitImage  (HPDF_MMgr        mmgr,
+               HPDF_Xref        xref,
+               HPDF_UINT        width,
+               HPDF_UINT        height)
 {
     HPDF_Dict image;
     HPDF_STATUS ret = HPDF_OK;
-    /* HPDF_UINT size; */
-
-    HPDF_PTRACE ((" HPDF_Image_Load1BitImage\n"));
 
     image = HPDF_DictStream_New (mmgr, xref);
     if (!image)
         return NULL;
 
     image->header.obj_class |= HPDF_OSUBCLASS_XOBJECT;
+    image->header.obj_id |= HPDF_OTYPE_FINAL;
     ret += HPDF_Dict_AddName (image, "Type", "XObject");
     ret += HPDF_Dict_AddName (image, "Subtype", "Image");
     if (ret != HPDF_OK)
         return NULL;
 
-    /* size = width * height; */
     ret = HPDF_Dict_AddName (image, "ColorSpace", "DeviceGray");
     if (ret != HPDF_OK)
         return NULL;
@@ -737,12 +670,126 @@ HPDF_Image_Load1BitImageFromMem  (HPDF_MMgr        mmgr,
     if (HPDF_Dict_AddNumber (image, "BitsPerComponent", 1) != HPDF_OK)
         return NULL;
 
+    return image;
+}
+
+HPDF_Image
+HPDF_Image_Load1BitImageFromMem  (HPDF_MMgr        mmgr,
+                          const HPDF_BYTE   *buf,
+                          HPDF_Xref        xref,
+                          HPDF_UINT          width,
+                          HPDF_UINT          height,
+						  HPDF_UINT          line_width,
+						  HPDF_BOOL			 top_is_first
+                          )
+{
+    HPDF_Dict image;
+
+    HPDF_PTRACE ((" HPDF_Image_Load1BitImage\n"));
+
+    image = New1BitImage (mmgr, xref, width, height);
+    if (!image)
+        return NULL;
+
     if (HPDF_Stream_CcittToStream (buf, image->stream, NULL, width, height, line_width, top_is_first) != HPDF_OK)
         return NULL;
 
     return image;
 }
 
+static HPDF_STATUS
+CcittJob_Func  (HPDF_ImageJob  job)
+{
+    HPDF_BYTE *buf;
+    HPDF_UINT len;
+
+    HPDF_PTRACE ((" CcittJob_Func\n"));
+
+    job->data = HPDF_MemStream_New (job->mmgr, 0);
+    if (!job->data)
+        return HPDF_Error_GetCode (&job->error);
+
+    /* the source is kept in a single block */
+    buf = HPDF_MemStream_GetBufPtr (job->src, 0, &len);
+    if (!buf)
+        return HPDF_Error_GetCode (&job->error);
+
+    if (HPDF_Stream_CcittToStream (buf, job->data, NULL, job->width,
+                job->height, job->line_width, job->top_is_first) != HPDF_OK)
+        return HPDF_INVALID_IMAGE;
+
+    return HPDF_OK;
+}
+
+/*
+ * Like HPDF_Image_Load1BitImageFromMem, but the data is copied and
+ * encoded on a worker thread of loader.
+ */
+HPDF_Image
+HPDF_Image_Load1BitImageFromMemAsync  (HPDF_ImageLoader   loader,
+                                       HPDF_MMgr          mmgr,
+                                       const HPDF_BYTE   *buf,
+                                       HPDF_Xref          xref,
+                                       HPDF_UINT          width,
+                                       HPDF_UINT          height,
+                                       HPDF_UINT          line_width,
+                                       HPDF_BOOL          top_is_first)
+{
+    HPDF_Dict image;
+    HPDF_ImageJob job;
+
+    HPDF_PTRACE ((" HPDF_Image_Load1BitImageFromMemAsync\n"));
+
+    if (height == 0 || line_width == 0) {
+        HPDF_SetError (mmgr->error, HPDF_INVALID_IMAGE, 0);
+        return NULL;
+    }
+
+    image = New1BitImage (mmgr, xref, width, height);
+    if (!image)
+        return NULL;
+
+    job = HPDF_ImageJob_New (mmgr, CcittJob_Func, buf, line_width * height);
+    if (!job)
+        return NULL;
+
+    job->width = width;
+    job->height = height;
+    job->line_width = line_width;
+    job->top_is_first = top_is_first;
+
+    HPDF_ImageLoader_Submit (loader, image, job);
+
+    return image;
+}
+
+static HPDF_STATUS
+SetCcittFilter  (HPDF_Doc      pdf,
+                 HPDF_Image    image,
+                 HPDF_UINT     width,
+                 HPDF_UINT     height,
+                 HPDF_BOOL     black_is1)
+{
+    if (pdf->compression_mode & HPDF_COMP_IMAGE)
+	{
+		image->filter = HPDF_STREAM_FILTER_CCITT_DECODE;
+		image->filterParams = HPDF_Dict_New(pdf->mmgr);
+		if(image->filterParams==NULL) {
+			return HPDF_Error_GetCode (&pdf->error);
+		}
+		
+		/* pure 2D encoding, default is 0 */
+		HPDF_Dict_AddNumber (image->filterParams, "K", -1);
+		/* default is 1728 */
+		HPDF_Dict_AddNumber (image->filterParams, "Columns", width);
+		/* default is 0 */
+		HPDF_Dict_AddNumber (image->filterParams, "Rows", height);
+		HPDF_Dict_AddBoolean (image->filterParams, "BlackIs1", black_is1);
+	}
+
+    return HPDF_OK;
+}
+
 /*
  * Load image from buffer
  * line_width - width of the line in bytes
@@ -769,25 +816,49 @@ HPDF_Image_LoadRaw1BitImageFromMem  (HPDF_Doc           pdf,
     image = HPDF_Image_Load1BitImageFromMem(pdf->mmgr, buf, pdf->xref, width,
                 height, line_width, top_is_first);
 
-    if (!image)
+    if (!image) {
         HPDF_CheckError (&pdf->error);
+        return NULL;
+    }
 
-    if (pdf->compression_mode & HPDF_COMP_IMAGE)
-	{
-		image->filter = HPDF_STREAM_FILTER_CCITT_DECODE;
-		image->filterParams = HPDF_Dict_New(pdf->mmgr);
-		if(image->filterParams==NULL) {
-			return NULL;
-		}
-		
-		/* pure 2D encoding, default is 0 */
-		HPDF_Dict_AddNumber (image->filterParams, "K", -1);
-		/* default is 1728 */
-		HPDF_Dict_AddNumber (image->filterParams, "Columns", width);
-		/* default is 0 */
-		HPDF_Dict_AddNumber (image->filterParams, "Rows", height);
-		HPDF_Dict_AddBoolean (image->filterParams, "BlackIs1", black_is1);
-	}
+    if (SetCcittFilter (pdf, image, width, height, black_is1) != HPDF_OK)
+        return NULL;
+
+    return image;
+}
+
+/*
+ * Like HPDF_Image_LoadRaw1BitImageFromMem, but returns as soon as the
+ * data has been copied; it is encoded on a worker thread and the image
+ * is only waited for when it is written.
+ */
+HPDF_EXPORT(HPDF_Image)
+HPDF_Image_LoadRaw1BitImageFromMemAsync  (HPDF_Doc           pdf,
+                                          const HPDF_BYTE   *buf,
+                                          HPDF_UINT          width,
+                                          HPDF_UINT          height,
+                                          HPDF_UINT          line_width,
+                                          HPDF_BOOL          black_is1,
+                                          HPDF_BOOL          top_is_first)
+{
+    HPDF_Image image;
+
+    HPDF_PTRACE ((" HPDF_Image_LoadRaw1BitImageFromMemAsync\n"));
+
+    if (!HPDF_HasDoc (pdf))
+        return NULL;
+
+    image = HPDF_Image_Load1BitImageFromMemAsync (HPDF_Doc_GetImageLoader (pdf),
+                pdf->mmgr, buf, pdf->xref, width, height, line_width,
+                top_is_first);
+
+    if (!image) {
+        HPDF_CheckError (&pdf->error);
+        return NULL;
+    }
+
+    if (SetCcittFilter (pdf, image, width, height, black_is1) != HPDF_OK)
+        return NULL;
 
     return image;
 }
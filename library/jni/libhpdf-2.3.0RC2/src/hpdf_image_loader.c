@@ -0,0 +1,461 @@
+/*
+ * << Haru Free PDF Library >> -- hpdf_image_loader.c
+ *
+ * URL: http://libharu.org
+ *
+ * Copyright (c) 1999-2006 Takeshi Kanno <takeshi_kanno@est.hi-ho.ne.jp>
+ * Copyright (c) 2007-2009 Antony Dovgal <tony@daylessday.org>
+ *
+ * Permission to use, copy, modify, distribute and sell this software
+ * and its documentation for any purpose is hereby granted without fee,
+ * provided that the above copyright notice appear in all copies and
+ * that both that copyright notice and this permission notice appear
+ * in supporting documentation.
+ * It is provided "as is" without express or implied warranty.
+ *
+ */
+
+#include "hpdf_conf.h"
+#include "hpdf_utils.h"
+#include "hpdf_image_loader.h"
+#include "hpdf.h"
+
+#if !defined(LIBHPDF_HAVE_NOTHREADS) && !defined(_WIN32)
+#include <pthread.h>
+#include <unistd.h>
+#define HPDF_IMAGE_LOADER_THREADS
+#endif
+
+#ifdef HPDF_IMAGE_LOADER_THREADS
+
+typedef struct _HPDF_ImageLoader_Rec {
+    HPDF_MMgr        mmgr;
+    pthread_mutex_t  lock;
+
+    /* signalled whenever a job is queued, taken from the queue or done */
+    pthread_cond_t   cond;
+
+    pthread_t       *threads;
+    HPDF_UINT        num_threads;
+
+    HPDF_ImageJob    head;
+    HPDF_ImageJob    tail;
+    HPDF_UINT        queued;
+    HPDF_UINT        max_queued;
+    HPDF_BOOL        shutdown;
+} HPDF_ImageLoader_Rec;
+
+#endif /* HPDF_IMAGE_LOADER_THREADS */
+
+
+static void
+RunJob  (HPDF_ImageJob  job);
+
+
+static HPDF_STATUS
+ImageJob_BeforeWrite  (HPDF_Dict  obj);
+
+
+static void
+ImageJob_OnFree  (HPDF_Dict  obj);
+
+
+/*---------------------------------------------------------------------------*/
+
+static void
+RunJob  (HPDF_ImageJob  job)
+{
+    HPDF_STATUS ret;
+
+    HPDF_PTRACE ((" RunJob\n"));
+
+    ret = job->func (job);
+    if (ret != HPDF_OK && HPDF_Error_GetCode (&job->error) == HPDF_OK)
+        HPDF_SetError (&job->error, ret, 0);
+
+    HPDF_Stream_Free (job->src);
+    job->src = NULL;
+}
+
+
+#ifdef HPDF_IMAGE_LOADER_THREADS
+
+static void*
+ImageLoader_Main  (void  *arg)
+{
+    HPDF_ImageLoader loader = (HPDF_ImageLoader)arg;
+
+    pthread_mutex_lock (&loader->lock);
+
+    for (;;) {
+        HPDF_ImageJob job;
+
+        while (!loader->head && !loader->shutdown)
+            pthread_cond_wait (&loader->cond, &loader->lock);
+
+        /* the jobs left in the queue are run before the thread exits */
+        job = loader->head;
+        if (!job)
+            break;
+
+        loader->head = job->next;
+        if (!loader->head)
+            loader->tail = NULL;
+        loader->queued--;
+
+        job->next = NULL;
+        job->state = HPDF_IMAGE_JOB_RUNNING;
+        pthread_cond_broadcast (&loader->cond);
+        pthread_mutex_unlock (&loader->lock);
+
+        RunJob (job);
+
+        pthread_mutex_lock (&loader->lock);
+        job->state = HPDF_IMAGE_JOB_DONE;
+        pthread_cond_broadcast (&loader->cond);
+    }
+
+    pthread_mutex_unlock (&loader->lock);
+
+    return NULL;
+}
+
+#endif /* HPDF_IMAGE_LOADER_THREADS */
+
+
+/*
+ *  HPDF_ImageLoader_New
+ *
+ *  Starts a pool of worker threads; 0 starts one for each online
+ *  processor. NULL is returned when threads are not available, in which
+ *  case jobs run on the calling thread when they are submitted.
+ */
+HPDF_ImageLoader
+HPDF_ImageLoader_New  (HPDF_MMgr  mmgr,
+                       HPDF_UINT  threads)
+{
+#ifdef HPDF_IMAGE_LOADER_THREADS
+    HPDF_ImageLoader loader;
+    HPDF_UINT i;
+
+    HPDF_PTRACE ((" HPDF_ImageLoader_New\n"));
+
+    if (threads == 0) {
+        long n = sysconf (_SC_NPROCESSORS_ONLN);
+
+        threads = (n > 0) ? (HPDF_UINT)n : 1;
+    }
+
+    if (threads > HPDF_MAX_IMAGE_LOAD_THREADS)
+        threads = HPDF_MAX_IMAGE_LOAD_THREADS;
+
+    loader = HPDF_GetMem (mmgr, sizeof (HPDF_ImageLoader_Rec));
+    if (!loader)
+        return NULL;
+
+    HPDF_MemSet (loader, 0, sizeof (HPDF_ImageLoader_Rec));
+    loader->mmgr = mmgr;
+    loader->max_queued = threads * HPDF_IMAGE_LOAD_QUEUE_SIZ;
+
+    loader->threads = HPDF_GetMem (mmgr, threads * sizeof (pthread_t));
+    if (!loader->threads) {
+        HPDF_FreeMem (mmgr, loader);
+        return NULL;
+    }
+
+    if (pthread_mutex_init (&loader->lock, NULL) != 0) {
+        HPDF_FreeMem (mmgr, loader->threads);
+        HPDF_FreeMem (mmgr, loader);
+        return NULL;
+    }
+
+    if (pthread_cond_init (&loader->cond, NULL) != 0) {
+        pthread_mutex_destroy (&loader->lock);
+        HPDF_FreeMem (mmgr, loader->threads);
+        HPDF_FreeMem (mmgr, loader);
+        return NULL;
+    }
+
+    for (i = 0; i < threads; i++) {
+        if (pthread_create (&loader->threads[i], NULL, ImageLoader_Main,
+                    loader) != 0)
+            break;
+    }
+
+    loader->num_threads = i;
+
+    if (loader->num_threads == 0) {
+        HPDF_ImageLoader_Free (loader);
+        return NULL;
+    }
+
+    return loader;
+#else
+    HPDF_UNUSED (mmgr);
+    HPDF_UNUSED (threads);
+
+    return NULL;
+#endif /* HPDF_IMAGE_LOADER_THREADS */
+}
+
+
+void
+HPDF_ImageLoader_Free  (HPDF_ImageLoader  loader)
+{
+#ifdef HPDF_IMAGE_LOADER_THREADS
+    HPDF_UINT i;
+
+    HPDF_PTRACE ((" HPDF_ImageLoader_Free\n"));
+
+    if (!loader)
+        return;
+
+    pthread_mutex_lock (&loader->lock);
+    loader->shutdown = HPDF_TRUE;
+    pthread_cond_broadcast (&loader->cond);
+    pthread_mutex_unlock (&loader->lock);
+
+    for (i = 0; i < loader->num_threads; i++)
+        pthread_join (loader->threads[i], NULL);
+
+    pthread_cond_destroy (&loader->cond);
+    pthread_mutex_destroy (&loader->lock);
+
+    HPDF_FreeMem (loader->mmgr, loader->threads);
+    HPDF_FreeMem (loader->mmgr, loader);
+#else
+    HPDF_UNUSED (loader);
+#endif /* HPDF_IMAGE_LOADER_THREADS */
+}
+
+
+/*
+ *  HPDF_ImageJob_New
+ *
+ *  Creates a job which runs func on a copy of size bytes of buf. The
+ *  copy is kept in a single block of the source stream, so that the
+ *  job can also access it directly with HPDF_MemStream_GetBufPtr.
+ */
+HPDF_ImageJob
+HPDF_ImageJob_New  (HPDF_MMgr            mmgr,
+                    HPDF_ImageJob_Func   func,
+                    const HPDF_BYTE     *buf,
+                    HPDF_UINT            size)
+{
+    HPDF_ImageJob job;
+
+    HPDF_PTRACE ((" HPDF_ImageJob_New\n"));
+
+    job = HPDF_GetMem (mmgr, sizeof (HPDF_ImageJob_Rec));
+    if (!job)
+        return NULL;
+
+    HPDF_MemSet (job, 0, sizeof (HPDF_ImageJob_Rec));
+    job->func = func;
+    job->state = HPDF_IMAGE_JOB_DONE;
+    HPDF_Error_Init (&job->error, NULL);
+
+    job->mmgr = HPDF_MMgr_New (&job->error, 0, NULL, NULL);
+    if (!job->mmgr) {
+        HPDF_FreeMem (mmgr, job);
+        HPDF_SetError (mmgr->error, HPDF_FAILD_TO_ALLOC_MEM, 0);
+        return NULL;
+    }
+
+    job->src = HPDF_MemStream_New (job->mmgr, size);
+    if (!job->src || HPDF_Stream_Write (job->src, buf, size) != HPDF_OK) {
+        HPDF_ImageJob_Free (mmgr, job);
+        HPDF_SetError (mmgr->error, HPDF_FAILD_TO_ALLOC_MEM, 0);
+        return NULL;
+    }
+
+    return job;
+}
+
+
+void
+HPDF_ImageJob_Free  (HPDF_MMgr      mmgr,
+                     HPDF_ImageJob  job)
+{
+    HPDF_PTRACE ((" HPDF_ImageJob_Free\n"));
+
+    HPDF_Stream_Free (job->src);
+    HPDF_Stream_Free (job->data);
+    HPDF_Stream_Free (job->smask);
+    HPDF_MMgr_Free (job->mmgr);
+    HPDF_FreeMem (mmgr, job);
+}
+
+
+/*
+ *  HPDF_ImageLoader_Submit
+ *
+ *  Attaches job to image and queues it. If the queue of the loader is
+ *  full, the call waits until a worker takes the next job from it.
+ */
+void
+HPDF_ImageLoader_Submit  (HPDF_ImageLoader  loader,
+                          HPDF_Dict         image,
+                          HPDF_ImageJob     job)
+{
+    HPDF_PTRACE ((" HPDF_ImageLoader_Submit\n"));
+
+    job->loader = loader;
+    image->attr = job;
+    image->before_write_fn = ImageJob_BeforeWrite;
+    image->free_fn = ImageJob_OnFree;
+
+    if (!loader) {
+        RunJob (job);
+        job->state = HPDF_IMAGE_JOB_DONE;
+        return;
+    }
+
+#ifdef HPDF_IMAGE_LOADER_THREADS
+    pthread_mutex_lock (&loader->lock);
+
+    while (loader->queued >= loader->max_queued)
+        pthread_cond_wait (&loader->cond, &loader->lock);
+
+    job->state = HPDF_IMAGE_JOB_QUEUED;
+    if (loader->tail)
+        loader->tail->next = job;
+    else
+        loader->head = job;
+    loader->tail = job;
+    loader->queued++;
+
+    pthread_cond_broadcast (&loader->cond);
+    pthread_mutex_unlock (&loader->lock);
+#endif /* HPDF_IMAGE_LOADER_THREADS */
+}
+
+
+static void
+WaitJob  (HPDF_ImageJob  job,
+          HPDF_BOOL      cancel)
+{
+#ifdef HPDF_IMAGE_LOADER_THREADS
+    HPDF_ImageLoader loader = job->loader;
+
+    if (!loader)
+        return;
+
+    pthread_mutex_lock (&loader->lock);
+
+    if (cancel && job->state == HPDF_IMAGE_JOB_QUEUED) {
+        HPDF_ImageJob prev = NULL;
+        HPDF_ImageJob cur = loader->head;
+
+        while (cur != job) {
+            prev = cur;
+            cur = cur->next;
+        }
+
+        if (prev)
+            prev->next = job->next;
+        else
+            loader->head = job->next;
+
+        if (loader->tail == job)
+            loader->tail = prev;
+
+        loader->queued--;
+        job->next = NULL;
+        job->state = HPDF_IMAGE_JOB_DONE;
+        pthread_cond_broadcast (&loader->cond);
+    }
+
+    while (job->state != HPDF_IMAGE_JOB_DONE)
+        pthread_cond_wait (&loader->cond, &loader->lock);
+
+    pthread_mutex_unlock (&loader->lock);
+#else
+    HPDF_UNUSED (job);
+    HPDF_UNUSED (cancel);
+#endif /* HPDF_IMAGE_LOADER_THREADS */
+}
+
+
+/*
+ *  Waits for the job of image and copies the data it produced into the
+ *  streams of the image and of its soft-mask.
+ */
+static HPDF_STATUS
+FinishJob  (HPDF_Dict  image)
+{
+    HPDF_ImageJob job = (HPDF_ImageJob)image->attr;
+    HPDF_STATUS ret;
+
+    HPDF_PTRACE ((" FinishJob\n"));
+
+    WaitJob (job, HPDF_FALSE);
+
+    image->attr = NULL;
+    image->before_write_fn = NULL;
+    image->free_fn = NULL;
+
+    ret = HPDF_Error_GetCode (&job->error);
+    if (ret != HPDF_OK) {
+        HPDF_SetError (image->error, ret,
+                HPDF_Error_GetDetailCode (&job->error));
+    } else {
+        if (job->data)
+            ret = HPDF_Stream_WriteToStream (job->data, image->stream,
+                    HPDF_STREAM_FILTER_NONE, NULL);
+
+        if (ret == HPDF_OK && job->smask) {
+            HPDF_Dict smask = HPDF_Dict_GetItem (image, "SMask",
+                    HPDF_OCLASS_DICT);
+
+            if (smask)
+                ret = HPDF_Stream_WriteToStream (job->smask, smask->stream,
+                        HPDF_STREAM_FILTER_NONE, NULL);
+        }
+    }
+
+    HPDF_ImageJob_Free (image->mmgr, job);
+
+    return ret;
+}
+
+
+static HPDF_STATUS
+ImageJob_BeforeWrite  (HPDF_Dict  obj)
+{
+    HPDF_PTRACE ((" ImageJob_BeforeWrite\n"));
+
+    return FinishJob (obj);
+}
+
+
+static void
+ImageJob_OnFree  (HPDF_Dict  obj)
+{
+    HPDF_ImageJob job = (HPDF_ImageJob)obj->attr;
+
+    HPDF_PTRACE ((" ImageJob_OnFree\n"));
+
+    WaitJob (job, HPDF_TRUE);
+    HPDF_ImageJob_Free (obj->mmgr, job);
+    obj->attr = NULL;
+}
+
+
+HPDF_EXPORT(HPDF_STATUS)
+HPDF_Image_WaitLoad  (HPDF_Image  image)
+{
+    HPDF_PTRACE ((" HPDF_Image_WaitLoad\n"));
+
+    if (!HPDF_Image_Validate (image))
+        return HPDF_INVALID_IMAGE;
+
+    if (image->free_fn != ImageJob_OnFree)
+        return HPDF_OK;
+
+    if (FinishJob (image) != HPDF_OK)
+        return HPDF_CheckError (image->error);
+
+    return HPDF_OK;
+}
+
@@ -39,11 +39,56 @@ PngReadFunc  (png_structp   png_ptr,
 }
 
 
+/*
+ *  libpng does not return from png_error even when PngErrorFunc does; it
+ *  jumps to the jmpbuf of png_ptr, or aborts the process when none is set.
+ *  The calls which can fail are made through the functions below, which
+ *  come back with the error set on the image, so that an invalid image
+ *  fails its own document instead of every document of the process.
+ */
+
+static void
+PngReadInfo  (png_structp  png_ptr,
+              png_infop    info_ptr)
+{
+    if (setjmp (png_jmpbuf (png_ptr)) == 0)
+        png_read_info (png_ptr, info_ptr);
+}
+
+
+static void
+PngReadUpdateInfo  (png_structp  png_ptr,
+                    png_infop    info_ptr)
+{
+    if (setjmp (png_jmpbuf (png_ptr)) == 0)
+        png_read_update_info (png_ptr, info_ptr);
+}
+
+
+static void
+PngReadImage  (png_structp  png_ptr,
+               png_bytepp   rows)
+{
+    if (setjmp (png_jmpbuf (png_ptr)) == 0)
+        png_read_image (png_ptr, rows);
+}
+
+
+static void
+PngReadRow  (png_structp  png_ptr,
+             png_bytep    row)
+{
+    if (setjmp (png_jmpbuf (png_ptr)) == 0)
+        png_read_row (png_ptr, row, NULL);
+}
+
+
 static HPDF_STATUS
 LoadPngData  (HPDF_Dict     image,
               HPDF_Xref     xref,
               HPDF_Stream   png_data,
-              HPDF_BOOL     delayed_loading);
+              HPDF_BOOL     delayed_loading,
+              HPDF_BOOL     header_only);
 
 
 static void
@@ -125,7 +170,7 @@ ReadPngData_Interlaced  (HPDF_Dict    image,
         }
 
         if (image->error->error_no == HPDF_OK) {
-            png_read_image(png_ptr, row_pointers);
+            PngReadImage (png_ptr, row_pointers);
             if (image->error->error_no == HPDF_OK) {       /* add this line */
                 for (i = 0; i < (HPDF_UINT)height; i++) {
                     if (HPDF_Stream_Write (image->stream, row_pointers[i], len) !=
@@ -159,7 +204,7 @@ ReadPngData  (HPDF_Dict    image,
         HPDF_UINT i;
 
         for (i = 0; i < (HPDF_UINT)height; i++) {
-            png_read_rows(png_ptr, (png_byte**)&buf_ptr, NULL, 1);
+            PngReadRow (png_ptr, buf_ptr);
             if (image->error->error_no != HPDF_OK)
                 break;
 
@@ -205,7 +250,7 @@ ReadTransparentPaletteData  (HPDF_Dict    image,
 		}
 	}
 
-	png_read_image(png_ptr, row_ptr);
+	PngReadImage (png_ptr, row_ptr);
 	if (image->error->error_no != HPDF_OK) {
 		ret = HPDF_INVALID_PNG_IMAGE;
 		goto Error;
@@ -269,7 +314,7 @@ ReadTransparentPngData  (HPDF_Dict    image,
 		}
 	}
 
-	png_read_image(png_ptr, row_ptr);
+	PngReadImage (png_ptr, row_ptr);
 	if (image->error->error_no != HPDF_OK) {
 		ret = HPDF_INVALID_PNG_IMAGE;
 		goto Error;
@@ -375,19 +420,18 @@ CreatePallet (HPDF_Dict    image,
 
 #define HPDF_PNG_BYTES_TO_CHECK 8
 
-HPDF_Image
-HPDF_Image_LoadPngImage  (HPDF_MMgr        mmgr,
-                          HPDF_Stream      png_data,
-                          HPDF_Xref        xref,
-                          HPDF_BOOL        delayed_loading)
+static HPDF_Image
+LoadPngImage  (HPDF_MMgr        mmgr,
+               HPDF_Stream      png_data,
+               HPDF_Xref        xref,
+               HPDF_BOOL        delayed_loading,
+               HPDF_BOOL        header_only)
 {
     HPDF_STATUS ret;
     HPDF_Dict image;
     png_byte header[HPDF_PNG_BYTES_TO_CHECK];
     HPDF_UINT len = HPDF_PNG_BYTES_TO_CHECK;
 
-    HPDF_PTRACE ((" HPDF_Image_LoadPngImage\n"));
-
     HPDF_MemSet (header, 0x00, HPDF_PNG_BYTES_TO_CHECK);
     ret = HPDF_Stream_Read (png_data, header, &len);
     if (ret != HPDF_OK ||
@@ -401,23 +445,137 @@ HPDF_Image_LoadPngImage  (HPDF_MMgr        mmgr,
         return NULL;
 
     image->header.obj_class |= HPDF_OSUBCLASS_XOBJECT;
+    image->header.obj_id |= HPDF_OTYPE_FINAL;
     ret += HPDF_Dict_AddName (image, "Type", "XObject");
     ret += HPDF_Dict_AddName (image, "Subtype", "Image");
     if (ret != HPDF_OK)
         return NULL;
 
-    if (LoadPngData (image, xref, png_data, delayed_loading) != HPDF_OK)
+    if (LoadPngData (image, xref, png_data, delayed_loading, header_only)
+            != HPDF_OK)
+        return NULL;
+
+    return image;
+}
+
+
+HPDF_Image
+HPDF_Image_LoadPngImage  (HPDF_MMgr        mmgr,
+                          HPDF_Stream      png_data,
+                          HPDF_Xref        xref,
+                          HPDF_BOOL        delayed_loading)
+{
+    HPDF_PTRACE ((" HPDF_Image_LoadPngImage\n"));
+
+    return LoadPngImage (mmgr, png_data, xref, delayed_loading, HPDF_FALSE);
+}
+
+
+/*
+ *  Decodes the image into a document of the job's own and takes the
+ *  decoded data, compressed with the filter of the job, and the data of
+ *  the soft-mask from it.
+ */
+static HPDF_STATUS
+PngJob_Func  (HPDF_ImageJob  job)
+{
+    HPDF_Xref xref;
+    HPDF_Dict image;
+    HPDF_Dict smask;
+    HPDF_STATUS ret;
+
+    HPDF_PTRACE ((" PngJob_Func\n"));
+
+    xref = HPDF_Xref_New (job->mmgr, 0);
+    if (!xref)
+        return HPDF_Error_GetCode (&job->error);
+
+    image = LoadPngImage (job->mmgr, job->src, xref, HPDF_FALSE, HPDF_FALSE);
+    if (!image) {
+        HPDF_Xref_Free (xref);
+        return HPDF_Error_GetCode (&job->error);
+    }
+
+    ret = HPDF_OK;
+    if (job->filter == HPDF_STREAM_FILTER_NONE) {
+        job->data = image->stream;
+        image->stream = NULL;
+    } else {
+        job->data = HPDF_MemStream_New (job->mmgr, 0);
+        if (job->data)
+            ret = HPDF_Stream_WriteToStream (image->stream, job->data,
+                    job->filter, NULL);
+        else
+            ret = HPDF_Error_GetCode (&job->error);
+    }
+
+    smask = HPDF_Dict_GetItem (image, "SMask", HPDF_OCLASS_DICT);
+    if (smask) {
+        job->smask = smask->stream;
+        smask->stream = NULL;
+    }
+
+    HPDF_Xref_Free (xref);
+
+    return ret;
+}
+
+
+/*
+ *  HPDF_Image_LoadPngImageAsync
+ *
+ *  Reads the header of the image to create its dictionary, and decodes
+ *  the image on a worker thread of loader. The data is compressed with
+ *  filter on the worker as well.
+ */
+HPDF_Image
+HPDF_Image_LoadPngImageAsync  (HPDF_ImageLoader   loader,
+                               HPDF_MMgr          mmgr,
+                               const HPDF_BYTE   *buf,
+                               HPDF_UINT          size,
+                               HPDF_Xref          xref,
+                               HPDF_UINT          filter)
+{
+    HPDF_Dict image;
+    HPDF_ImageJob job;
+
+    HPDF_PTRACE ((" HPDF_Image_LoadPngImageAsync\n"));
+
+    job = HPDF_ImageJob_New (mmgr, PngJob_Func, buf, size);
+    if (!job)
+        return NULL;
+
+    image = LoadPngImage (mmgr, job->src, xref, HPDF_FALSE, HPDF_TRUE);
+    if (!image) {
+        HPDF_ImageJob_Free (mmgr, job);
         return NULL;
+    }
+
+    /* the worker reads the data again from the start */
+    HPDF_Error_Reset (&job->error);
+    HPDF_Stream_Seek (job->src, 0, HPDF_SEEK_SET);
+
+    job->filter = filter;
+    if (filter != HPDF_STREAM_FILTER_NONE)
+        image->filter = filter | HPDF_STREAM_FILTER_ENCODED;
+
+    HPDF_ImageLoader_Submit (loader, image, job);
 
     return image;
 }
 
 
+/*
+ *  Reads the image into the dictionary. With header_only, only the
+ *  entries of the dictionary and of its soft-mask are set; the data is
+ *  left to be read by HPDF_Image_LoadPngImageAsync.
+ */
 static HPDF_STATUS
 LoadPngData  (HPDF_Dict     image,
               HPDF_Xref     xref,
               HPDF_Stream   png_data,
-              HPDF_BOOL     delayed_loading)
+              HPDF_BOOL     delayed_loading,
+              HPDF_BOOL     header_only)
 
 {
 	HPDF_STATUS ret = HPDF_OK;
@@ -449,7 +607,7 @@ LoadPngData  (HPDF_Dict     image,
 	png_set_read_fn (png_ptr, (void *)png_data, (png_rw_ptr)&PngReadFunc);
 
 	/* reading info structure. */
-	png_read_info(png_ptr, info_ptr);
+	PngReadInfo (png_ptr, info_ptr);
 	if (image->error->error_no != HPDF_OK) {
 		goto Exit;
 	}
@@ -461,7 +619,7 @@ LoadPngData  (HPDF_Dict     image,
 		png_set_strip_16(png_ptr);
 	}
 
-	png_read_update_info(png_ptr, info_ptr);
+	PngReadUpdateInfo (png_ptr, info_ptr);
 	if (image->error->error_no != HPDF_OK) {
 		goto Exit;
 	}
@@ -485,6 +643,7 @@ LoadPngData  (HPDF_Dict     image,
 		}
 
 		smask->header.obj_class |= HPDF_OSUBCLASS_XOBJECT;
+		smask->header.obj_id |= HPDF_OTYPE_FINAL;
 		ret = HPDF_Dict_AddName (smask, "Type", "XObject");
 		ret += HPDF_Dict_AddName (smask, "Subtype", "Image");
 		ret += HPDF_Dict_AddNumber (smask, "Width", (HPDF_UINT)width);
@@ -498,27 +657,29 @@ LoadPngData  (HPDF_Dict     image,
 			goto Exit;
 		}
 
-		smask_data = HPDF_GetMem(image->mmgr, width * height);
-		if (!smask_data) {
-			HPDF_Dict_Free(smask);
-			ret = HPDF_FAILD_TO_ALLOC_MEM;
-			goto Exit;
-		}
+		if (!header_only) {
+			smask_data = HPDF_GetMem(image->mmgr, width * height);
+			if (!smask_data) {
+				HPDF_Dict_Free(smask);
+				ret = HPDF_FAILD_TO_ALLOC_MEM;
+				goto Exit;
+			}
 
-		if (ReadTransparentPaletteData(image, png_ptr, info_ptr, smask_data, trans, num_trans) != HPDF_OK) {
-			HPDF_FreeMem(image->mmgr, smask_data);
-			HPDF_Dict_Free(smask);
-			ret = HPDF_INVALID_PNG_IMAGE;
-			goto Exit;
-		}
+			if (ReadTransparentPaletteData(image, png_ptr, info_ptr, smask_data, trans, num_trans) != HPDF_OK) {
+				HPDF_FreeMem(image->mmgr, smask_data);
+				HPDF_Dict_Free(smask);
+				ret = HPDF_INVALID_PNG_IMAGE;
+				goto Exit;
+			}
 
-		if (HPDF_Stream_Write(smask->stream, smask_data, width * height) != HPDF_OK) {
+			if (HPDF_Stream_Write(smask->stream, smask_data, width * height) != HPDF_OK) {
+				HPDF_FreeMem(image->mmgr, smask_data);
+				HPDF_Dict_Free(smask);
+				ret = HPDF_FILE_IO_ERROR;
+				goto Exit;
+			}
 			HPDF_FreeMem(image->mmgr, smask_data);
-			HPDF_Dict_Free(smask);
-			ret = HPDF_FILE_IO_ERROR;
-			goto Exit;
 		}
-		HPDF_FreeMem(image->mmgr, smask_data);
 
 
 		ret += CreatePallet(image, png_ptr, info_ptr);
@@ -546,6 +707,7 @@ no_transparent_color_in_palette:
 		}
 
 		smask->header.obj_class |= HPDF_OSUBCLASS_XOBJECT;
+		smask->header.obj_id |= HPDF_OTYPE_FINAL;
 		ret = HPDF_Dict_AddName (smask, "Type", "XObject");
 		ret += HPDF_Dict_AddName (smask, "Subtype", "Image");
 		ret += HPDF_Dict_AddNumber (smask, "Width", (HPDF_UINT)width);
@@ -559,27 +721,29 @@ no_transparent_color_in_palette:
 			goto Exit;
 		}
 
-		smask_data = HPDF_GetMem(image->mmgr, width * height);
-		if (!smask_data) {
-			HPDF_Dict_Free(smask);
-			ret = HPDF_FAILD_TO_ALLOC_MEM;
-			goto Exit;
-		}
+		if (!header_only) {
+			smask_data = HPDF_GetMem(image->mmgr, width * height);
+			if (!smask_data) {
+				HPDF_Dict_Free(smask);
+				ret = HPDF_FAILD_TO_ALLOC_MEM;
+				goto Exit;
+			}
 
-		if (ReadTransparentPngData(image, png_ptr, info_ptr, smask_data) != HPDF_OK) {
-			HPDF_FreeMem(image->mmgr, smask_data);
-			HPDF_Dict_Free(smask);
-			ret = HPDF_INVALID_PNG_IMAGE;
-			goto Exit;
-		}
+			if (ReadTransparentPngData(image, png_ptr, info_ptr, smask_data) != HPDF_OK) {
+				HPDF_FreeMem(image->mmgr, smask_data);
+				HPDF_Dict_Free(smask);
+				ret = HPDF_INVALID_PNG_IMAGE;
+				goto Exit;
+			}
 
-		if (HPDF_Stream_Write(smask->stream, smask_data, width * height) != HPDF_OK) {
+			if (HPDF_Stream_Write(smask->stream, smask_data, width * height) != HPDF_OK) {
+				HPDF_FreeMem(image->mmgr, smask_data);
+				HPDF_Dict_Free(smask);
+				ret = HPDF_FILE_IO_ERROR;
+				goto Exit;
+			}
 			HPDF_FreeMem(image->mmgr, smask_data);
-			HPDF_Dict_Free(smask);
-			ret = HPDF_FILE_IO_ERROR;
-			goto Exit;
 		}
-		HPDF_FreeMem(image->mmgr, smask_data);
 
 		if (color_type == PNG_COLOR_TYPE_GRAY_ALPHA) {
 			ret += HPDF_Dict_AddName (image, "ColorSpace", "DeviceGray");
@@ -615,7 +779,7 @@ no_transparent_color_in_palette:
 	if (delayed_loading) {
 		image->before_write_fn = PngBeforeWrite;
 		image->after_write_fn = PngAfterWrite;
-	} else {
+	} else if (!header_only) {
 		if (png_get_interlace_type(png_ptr, info_ptr) != PNG_INTERLACE_NONE)
 			ret = ReadPngData_Interlaced(image, png_ptr, info_ptr);
 		else
@@ -682,7 +846,8 @@ PngBeforeWrite  (HPDF_Dict obj)
         return HPDF_SetError (obj->error, HPDF_INVALID_PNG_IMAGE, 0);
     }
 
-    if ((ret = LoadPngData (obj, NULL, png_data, HPDF_FALSE)) != HPDF_OK) {
+    if ((ret = LoadPngData (obj, NULL, png_data, HPDF_FALSE, HPDF_FALSE))
+            != HPDF_OK) {
         HPDF_Stream_Free(png_data);
         return ret;
     }
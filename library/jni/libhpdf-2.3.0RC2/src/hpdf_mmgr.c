@@ -59,6 +59,7 @@ HPDF_MMgr_New  (HPDF_Error       error,
     if (mmgr != NULL) {
         /* initialize mmgr object */
         mmgr->error = error;
+        mmgr->spare = NULL;
 
 
 #ifdef HPDF_MEM_DEBUG
@@ -142,6 +143,21 @@ HPDF_MMgr_Free  (HPDF_MMgr  mmgr)
         HPDF_PTRACE(("-%p mmgr-node-free\n", tmp));
         mmgr->free_fn (tmp);
 
+#ifdef HPDF_MEM_DEBUG
+        mmgr->free_cnt++;
+#endif
+
+    }
+
+    node = mmgr->spare;
+
+    while (node != NULL) {
+        HPDF_MPool_Node tmp = node;
+        node = tmp->next_node;
+
+        HPDF_PTRACE(("-%p mmgr-node-free\n", tmp));
+        mmgr->free_fn (tmp);
+
 #ifdef HPDF_MEM_DEBUG
         mmgr->free_cnt++;
 #endif
@@ -169,15 +185,18 @@ HPDF_GetMem  (HPDF_MMgr  mmgr,
     if (mmgr->mpool) {
         HPDF_MPool_Node node = mmgr->mpool;
 
-#ifdef HPDF_ALINMENT_SIZ
-        size = (size + (HPDF_ALINMENT_SIZ - 1)) / HPDF_ALINMENT_SIZ;
-        size *= HPDF_ALINMENT_SIZ;
+#ifdef HPDF_ALIGN_SIZ
+        size = (size + (HPDF_ALIGN_SIZ - 1)) / HPDF_ALIGN_SIZ;
+        size *= HPDF_ALIGN_SIZ;
 #endif
 
         if (node->size - node->used_size >= size) {
             ptr = (HPDF_BYTE*)node->buf + node->used_size;
             node->used_size += size;
             return ptr;
+        } else if (mmgr->spare && mmgr->spare->size >= size) {
+            node = mmgr->spare;
+            mmgr->spare = node->next_node;
         } else {
             HPDF_UINT tmp_buf_siz = (mmgr->buf_size < size) ?  size :
                 mmgr->buf_size;
@@ -235,6 +254,51 @@ HPDF_FreeMem  (HPDF_MMgr  mmgr,
     return;
 }
 
+void
+HPDF_MMgr_GetMark  (HPDF_MMgr            mmgr,
+                    HPDF_MPool_Mark_Rec  *mark)
+{
+    mark->node = mmgr->mpool;
+    mark->used_size = mmgr->mpool ? mmgr->mpool->used_size : 0;
+}
+
+
+void
+HPDF_MMgr_Rewind  (HPDF_MMgr                  mmgr,
+                   const HPDF_MPool_Mark_Rec  *mark)
+{
+    HPDF_MPool_Node node;
+
+    HPDF_PTRACE((" HPDF_MMgr_Rewind\n"));
+
+    if (!mmgr->mpool || !mark->node)
+        return;
+
+    /* the nodes allocated after the mark are in front of it. */
+    node = mmgr->mpool;
+    while (node != mark->node) {
+        HPDF_MPool_Node tmp = node;
+        node = tmp->next_node;
+
+        if (tmp->size == mmgr->buf_size) {
+            tmp->next_node = mmgr->spare;
+            mmgr->spare = tmp;
+        } else {
+            /* a node for one large block is not kept. */
+            HPDF_PTRACE(("-%p mmgr-node-free\n", tmp));
+            mmgr->free_fn (tmp);
+
+#ifdef HPDF_MEM_DEBUG
+            mmgr->free_cnt++;
+#endif
+        }
+    }
+
+    mmgr->mpool = mark->node;
+    mark->node->used_size = mark->used_size;
+}
+
+
 static void * HPDF_STDCALL
 InternalGetMem  (HPDF_UINT  size)
 {
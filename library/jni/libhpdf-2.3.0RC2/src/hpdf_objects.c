@@ -173,3 +173,113 @@ HPDF_Proxy_New  (HPDF_MMgr  mmgr,
     return p;
 }
 
+
+
+/*
+ *  HPDF_Obj_Copy
+ *
+ *  Makes a direct copy of obj in mmgr. A reference to an indirect object
+ *  is copied as a reference to the object of xref which has the same
+ *  object number, so the objects of a copied xref refer to each other.
+ */
+void*
+HPDF_Obj_Copy  (HPDF_MMgr  mmgr,
+                void       *obj,
+                HPDF_Xref  xref)
+{
+    HPDF_Obj_Header *header = (HPDF_Obj_Header *)obj;
+    void *copy = NULL;
+    HPDF_UINT i;
+
+    HPDF_PTRACE((" HPDF_Obj_Copy\n"));
+
+    switch (header->obj_class & HPDF_OCLASS_ANY) {
+        case HPDF_OCLASS_NULL:
+            copy = HPDF_Null_New (mmgr);
+            break;
+        case HPDF_OCLASS_BOOLEAN:
+            copy = HPDF_Boolean_New (mmgr, ((HPDF_Boolean)obj)->value);
+            break;
+        case HPDF_OCLASS_NUMBER:
+            copy = HPDF_Number_New (mmgr, ((HPDF_Number)obj)->value);
+            break;
+        case HPDF_OCLASS_REAL:
+            copy = HPDF_Real_New (mmgr, ((HPDF_Real)obj)->value);
+            break;
+        case HPDF_OCLASS_NAME:
+            copy = HPDF_Name_New (mmgr, ((HPDF_Name)obj)->value);
+            break;
+        case HPDF_OCLASS_STRING: {
+            HPDF_String s = (HPDF_String)obj;
+
+            copy = HPDF_String_New (mmgr, (const char *)s->value, s->encoder);
+            break;
+        }
+        case HPDF_OCLASS_BINARY: {
+            HPDF_Binary b = (HPDF_Binary)obj;
+
+            copy = HPDF_Binary_New (mmgr, b->value, b->len);
+            break;
+        }
+        case HPDF_OCLASS_ARRAY: {
+            HPDF_Array src = (HPDF_Array)obj;
+            HPDF_Array array = HPDF_Array_New (mmgr);
+
+            if (!array)
+                return NULL;
+
+            for (i = 0; i < src->list->count; i++) {
+                void *item = HPDF_Obj_Copy (mmgr,
+                        HPDF_List_ItemAt (src->list, i), xref);
+
+                if (!item || HPDF_Array_Add (array, item) != HPDF_OK) {
+                    HPDF_Array_Free (array);
+                    return NULL;
+                }
+            }
+
+            copy = array;
+            break;
+        }
+        case HPDF_OCLASS_DICT: {
+            HPDF_Dict dict = HPDF_Dict_New (mmgr);
+
+            if (!dict)
+                return NULL;
+
+            if (HPDF_Dict_CopyFrom (dict, (HPDF_Dict)obj, xref) != HPDF_OK) {
+                HPDF_Dict_Free (dict);
+                return NULL;
+            }
+
+            copy = dict;
+            break;
+        }
+        case HPDF_OCLASS_PROXY: {
+            HPDF_Obj_Header *target =
+                    (HPDF_Obj_Header *)((HPDF_Proxy)obj)->obj;
+            HPDF_UINT obj_id = target->obj_id & 0x00FFFFFF;
+            HPDF_XrefEntry entry;
+
+            if (obj_id < xref->start_offset ||
+                    obj_id - xref->start_offset >= xref->entries->count) {
+                HPDF_SetError (mmgr->error, HPDF_INVALID_OBJ_ID, 0);
+                return NULL;
+            }
+
+            /* the indirect object is added to its container as a
+             * reference. */
+            entry = HPDF_Xref_GetEntry (xref, obj_id - xref->start_offset);
+            return entry->obj;
+        }
+        default:
+            HPDF_SetError (mmgr->error, HPDF_ERR_UNKNOWN_CLASS, 0);
+            return NULL;
+    }
+
+    if (copy)
+        ((HPDF_Obj_Header *)copy)->obj_id |= header->obj_id &
+                HPDF_OTYPE_HIDDEN;
+
+    return copy;
+}
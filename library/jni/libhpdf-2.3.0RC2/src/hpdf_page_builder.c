@@ -0,0 +1,316 @@
+/*
+ * << Haru Free PDF Library >> -- hpdf_page_builder.c
+ *
+ * URL: http://libharu.org
+ *
+ * Copyright (c) 1999-2006 Takeshi Kanno <takeshi_kanno@est.hi-ho.ne.jp>
+ * Copyright (c) 2007-2009 Antony Dovgal <tony@daylessday.org>
+ *
+ * Permission to use, copy, modify, distribute and sell this software
+ * and its documentation for any purpose is hereby granted without fee,
+ * provided that the above copyright notice appear in all copies and
+ * that both that copyright notice and this permission notice appear
+ * in supporting documentation.
+ * It is provided "as is" without express or implied warranty.
+ *
+ */
+
+#include "hpdf_conf.h"
+#include "hpdf_utils.h"
+#include "hpdf.h"
+
+
+static HPDF_BOOL
+PageBuilder_Validate  (HPDF_PageBuilder  builder)
+{
+    if (!builder || builder->sig_bytes != HPDF_PAGE_BUILDER_SIG_BYTES)
+        return HPDF_FALSE;
+
+    return HPDF_TRUE;
+}
+
+
+static void
+PageBuilder_Free  (HPDF_PageBuilder  builder)
+{
+    HPDF_MMgr mmgr = builder->mmgr;
+
+    HPDF_PTRACE ((" PageBuilder_Free\n"));
+
+    if (builder->xref)
+        HPDF_Xref_Free (builder->xref);
+
+    if (builder->page_list)
+        HPDF_List_Free (builder->page_list);
+
+    builder->sig_bytes = 0;
+
+    HPDF_FreeMem (mmgr, builder);
+    HPDF_MMgr_Free (mmgr);
+}
+
+
+/*
+ *  HPDF_PageBuilder_New
+ *
+ *  The memory manager of the builder allocates memory the same way as the
+ *  one of the document, so that the xref of the document can free the
+ *  objects which are moved to it.
+ */
+HPDF_EXPORT(HPDF_PageBuilder)
+HPDF_PageBuilder_New  (HPDF_Doc  pdf)
+{
+    HPDF_PageBuilder builder;
+    HPDF_MMgr mmgr;
+    HPDF_Error_Rec tmp_error;
+
+    HPDF_PTRACE ((" HPDF_PageBuilder_New\n"));
+
+    if (!HPDF_HasDoc (pdf))
+        return NULL;
+
+    HPDF_Error_Init (&tmp_error, NULL);
+
+    mmgr = HPDF_MMgr_New (&tmp_error, pdf->mmgr->buf_size,
+            pdf->mmgr->alloc_fn, pdf->mmgr->free_fn);
+    if (!mmgr) {
+        HPDF_RaiseError (&pdf->error, HPDF_Error_GetCode (&tmp_error),
+                HPDF_Error_GetDetailCode (&tmp_error));
+        return NULL;
+    }
+
+    builder = HPDF_GetMem (mmgr, sizeof (HPDF_PageBuilder_Rec));
+    if (!builder) {
+        HPDF_MMgr_Free (mmgr);
+        HPDF_RaiseError (&pdf->error, HPDF_Error_GetCode (&tmp_error),
+                HPDF_Error_GetDetailCode (&tmp_error));
+        return NULL;
+    }
+
+    HPDF_MemSet (builder, 0, sizeof (HPDF_PageBuilder_Rec));
+    builder->sig_bytes = HPDF_PAGE_BUILDER_SIG_BYTES;
+    builder->pdf = pdf;
+    builder->mmgr = mmgr;
+    builder->compression_mode = pdf->compression_mode;
+    builder->real_precision = pdf->real_precision;
+    builder->optimize_content = pdf->optimize_content;
+
+    /* the error handler of the document is not called from other threads;
+     * it is set when the builder is committed. */
+    builder->error = tmp_error;
+    mmgr->error = &builder->error;
+
+    builder->xref = HPDF_Xref_New (mmgr, 0);
+    if (builder->xref)
+        builder->page_list = HPDF_List_New (mmgr, HPDF_DEF_PAGE_LIST_NUM);
+
+    if (!builder->page_list) {
+        tmp_error = builder->error;
+        PageBuilder_Free (builder);
+        HPDF_RaiseError (&pdf->error, HPDF_Error_GetCode (&tmp_error),
+                HPDF_Error_GetDetailCode (&tmp_error));
+        return NULL;
+    }
+
+    return builder;
+}
+
+
+HPDF_EXPORT(HPDF_Page)
+HPDF_PageBuilder_AddPage  (HPDF_PageBuilder  builder)
+{
+    HPDF_Page page;
+    HPDF_STATUS ret;
+
+    HPDF_PTRACE ((" HPDF_PageBuilder_AddPage\n"));
+
+    if (!PageBuilder_Validate (builder))
+        return NULL;
+
+    if (builder->committed) {
+        HPDF_RaiseError (&builder->error, HPDF_INVALID_PAGE_BUILDER, 0);
+        return NULL;
+    }
+
+    page = HPDF_Page_New (builder->mmgr, builder->xref);
+    if (!page) {
+        HPDF_CheckError (&builder->error);
+        return NULL;
+    }
+
+    if ((ret = HPDF_List_Add (builder->page_list, page)) != HPDF_OK) {
+        HPDF_RaiseError (&builder->error, ret, 0);
+        return NULL;
+    }
+
+    /* the page draws the resources of the document. */
+    ((HPDF_PageAttr)page->attr)->doc_mmgr = builder->pdf->mmgr;
+
+    if (builder->compression_mode & HPDF_COMP_TEXT)
+        HPDF_Page_SetFilter (page, HPDF_STREAM_FILTER_FLATE_DECODE);
+
+    HPDF_Page_SetRealPrecision (page, builder->real_precision);
+    HPDF_Page_SetOptimizeContent (page, builder->optimize_content);
+
+    return page;
+}
+
+
+HPDF_EXPORT(HPDF_STATUS)
+HPDF_PageBuilder_Finish  (HPDF_PageBuilder  builder)
+{
+    HPDF_UINT i;
+
+    HPDF_PTRACE ((" HPDF_PageBuilder_Finish\n"));
+
+    if (!PageBuilder_Validate (builder))
+        return HPDF_INVALID_PAGE_BUILDER;
+
+    for (i = 0; i < builder->page_list->count; i++) {
+        HPDF_Page page = HPDF_List_ItemAt (builder->page_list, i);
+
+        if (HPDF_Page_Finish (page) != HPDF_OK)
+            return HPDF_CheckError (&builder->error);
+    }
+
+    return HPDF_OK;
+}
+
+
+HPDF_EXPORT(HPDF_STATUS)
+HPDF_PageBuilder_GetError  (HPDF_PageBuilder  builder)
+{
+    if (!PageBuilder_Validate (builder))
+        return HPDF_INVALID_PAGE_BUILDER;
+
+    return HPDF_Error_GetCode (&builder->error);
+}
+
+
+/*
+ *  HPDF_PageBuilder_Commit
+ *
+ *  Numbers the objects of builder after the objects of the document and
+ *  adds its pages after the last page. A builder which failed is not
+ *  committed, and its error is raised on the document. Once the builder
+ *  is in the list of the document, it is freed with the document even if
+ *  a later step fails.
+ */
+static void
+PageBuilder_LockExtGStates  (HPDF_Page  page)
+{
+    HPDF_PageAttr attr = (HPDF_PageAttr)page->attr;
+    HPDF_UINT i;
+
+    if (!attr->ext_gstates)
+        return;
+
+    for (i = 0; i < attr->ext_gstates->list->count; i++) {
+        HPDF_DictElement element =
+                HPDF_List_ItemAt (attr->ext_gstates->list, i);
+        HPDF_Proxy proxy = element->value;
+        HPDF_ExtGState ext_gstate = proxy->obj;
+
+        ext_gstate->header.obj_class = (HPDF_OSUBCLASS_EXT_GSTATE_R |
+                HPDF_OCLASS_DICT);
+    }
+}
+
+
+HPDF_EXPORT(HPDF_STATUS)
+HPDF_PageBuilder_Commit  (HPDF_PageBuilder  builder)
+{
+    HPDF_Doc pdf;
+    HPDF_STATUS ret;
+    HPDF_UINT i;
+
+    HPDF_PTRACE ((" HPDF_PageBuilder_Commit\n"));
+
+    if (!PageBuilder_Validate (builder))
+        return HPDF_INVALID_PAGE_BUILDER;
+
+    pdf = builder->pdf;
+    if (!HPDF_HasDoc (pdf))
+        return HPDF_INVALID_DOCUMENT;
+
+    if (builder->committed)
+        return HPDF_RaiseError (&pdf->error, HPDF_INVALID_PAGE_BUILDER, 0);
+
+    if (HPDF_Error_GetCode (&builder->error) != HPDF_OK)
+        return HPDF_RaiseError (&pdf->error,
+                HPDF_Error_GetCode (&builder->error),
+                HPDF_Error_GetDetailCode (&builder->error));
+
+    if (!pdf->page_builders) {
+        pdf->page_builders = HPDF_List_New (pdf->mmgr,
+                HPDF_DEF_ITEMS_PER_BLOCK);
+        if (!pdf->page_builders)
+            return HPDF_CheckError (&pdf->error);
+    }
+
+    if (HPDF_List_Add (pdf->page_builders, builder) != HPDF_OK)
+        return HPDF_CheckError (&pdf->error);
+
+    builder->committed = HPDF_TRUE;
+    builder->error.error_fn = pdf->error.error_fn;
+    builder->error.user_data = pdf->error.user_data;
+
+    if (HPDF_Xref_Append (pdf->xref, builder->xref) != HPDF_OK)
+        return HPDF_CheckError (&pdf->error);
+
+    for (i = 0; i < builder->page_list->count; i++) {
+        HPDF_Page page = HPDF_List_ItemAt (builder->page_list, i);
+
+        /* the objects created for the page from now on, such as its
+         * annotations, are added to the document. */
+        ((HPDF_PageAttr)page->attr)->xref = pdf->xref;
+        PageBuilder_LockExtGStates (page);
+
+        if (pdf->page_per_pages) {
+            if (pdf->page_per_pages <= pdf->cur_page_num) {
+                pdf->cur_pages = HPDF_Doc_AddPagesTo (pdf, pdf->root_pages);
+                if (!pdf->cur_pages)
+                    return HPDF_Error_GetCode (&pdf->error);
+                pdf->cur_page_num = 0;
+            }
+        }
+
+        if ((ret = HPDF_Pages_AddKids (pdf->cur_pages, page)) != HPDF_OK)
+            return HPDF_RaiseError (&pdf->error, ret, 0);
+
+        if ((ret = HPDF_List_Add (pdf->page_list, page)) != HPDF_OK)
+            return HPDF_RaiseError (&pdf->error, ret, 0);
+
+        pdf->cur_page = page;
+        pdf->cur_page_num++;
+    }
+
+    return HPDF_OK;
+}
+
+
+HPDF_EXPORT(void)
+HPDF_PageBuilder_Free  (HPDF_PageBuilder  builder)
+{
+    HPDF_PTRACE ((" HPDF_PageBuilder_Free\n"));
+
+    /* a committed builder belongs to the document. */
+    if (!PageBuilder_Validate (builder) || builder->committed)
+        return;
+
+    PageBuilder_Free (builder);
+}
+
+
+void
+HPDF_PageBuilder_FreeAll  (HPDF_List  builders)
+{
+    HPDF_UINT i;
+
+    HPDF_PTRACE ((" HPDF_PageBuilder_FreeAll\n"));
+
+    for (i = 0; i < builders->count; i++)
+        PageBuilder_Free ((HPDF_PageBuilder)HPDF_List_ItemAt (builders, i));
+
+    HPDF_List_Free (builders);
+}
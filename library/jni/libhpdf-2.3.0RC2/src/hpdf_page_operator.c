@@ -42,7 +42,34 @@ InternalArc  (HPDF_Page    page,
 static HPDF_STATUS
 InternalShowTextNextLine  (HPDF_Page    page,
                            const char  *text,
-                           HPDF_UINT    len);
+                           HPDF_UINT    len,
+                           HPDF_REAL    tw);
+
+
+/*
+ *  When optimize_content is set on a page, the operators which set a
+ *  parameter of the graphics state are not written if the current state
+ *  (which is saved and restored along with q and Q) already holds the value.
+ *  The text state parameters are part of the graphics state and are not
+ *  reset by BT and ET, so they are compared in the same way.
+ */
+static HPDF_BOOL
+IsSameDash  (const HPDF_DashMode  *mode,
+             const HPDF_UINT16    *dash_ptn,
+             HPDF_UINT             num_param,
+             HPDF_UINT             phase)
+{
+    HPDF_UINT i;
+
+    if (mode->num_ptn != num_param || mode->phase != phase)
+        return HPDF_FALSE;
+
+    for (i = 0; i < num_param; i++)
+        if (mode->ptn[i] != dash_ptn[i])
+            return HPDF_FALSE;
+
+    return HPDF_TRUE;
+}
 
 
 
@@ -67,6 +94,9 @@ HPDF_Page_SetLineWidth  (HPDF_Page  page,
     if (line_width < 0)
         return HPDF_RaiseError (page->error, HPDF_PAGE_OUT_OF_RANGE, 0);
 
+    if (attr->optimize_content && attr->gstate->line_width == line_width)
+        return ret;
+
     if (HPDF_Stream_WriteReal (attr->stream, line_width) != HPDF_OK)
         return HPDF_CheckError (page->error);
 
@@ -98,6 +128,9 @@ HPDF_Page_SetLineCap  (HPDF_Page     page,
 
     attr = (HPDF_PageAttr)page->attr;
 
+    if (attr->optimize_content && attr->gstate->line_cap == line_cap)
+        return ret;
+
     if ((ret = HPDF_Stream_WriteInt (attr->stream,
                 (HPDF_UINT)line_cap)) != HPDF_OK)
         return ret;
@@ -131,6 +164,9 @@ HPDF_Page_SetLineJoin  (HPDF_Page      page,
 
     attr = (HPDF_PageAttr)page->attr;
 
+    if (attr->optimize_content && attr->gstate->line_join == line_join)
+        return ret;
+
     if (HPDF_Stream_WriteInt (attr->stream, (HPDF_UINT)line_join) != HPDF_OK)
         return HPDF_CheckError (page->error);
 
@@ -161,6 +197,9 @@ HPDF_Page_SetMiterLimit  (HPDF_Page  page,
     if (miter_limit < 1)
         return HPDF_RaiseError (page->error, HPDF_PAGE_OUT_OF_RANGE, 0);
 
+    if (attr->optimize_content && attr->gstate->miter_limit == miter_limit)
+        return ret;
+
     if (HPDF_Stream_WriteReal (attr->stream, miter_limit) != HPDF_OK)
         return HPDF_CheckError (page->error);
 
@@ -225,6 +264,10 @@ HPDF_Page_SetDash  (HPDF_Page           page,
 
     attr = (HPDF_PageAttr)page->attr;
 
+    if (attr->optimize_content && IsSameDash (&attr->gstate->dash_mode,
+                dash_ptn, num_param, phase))
+        return ret;
+
     if ((ret = HPDF_Stream_WriteStr (attr->stream, buf)) != HPDF_OK)
         return HPDF_CheckError (page->error);
 
@@ -263,6 +306,9 @@ HPDF_Page_SetFlat  (HPDF_Page  page,
     if (flatness > 100 || flatness < 0)
         return HPDF_RaiseError (page->error, HPDF_PAGE_OUT_OF_RANGE, 0);
 
+    if (attr->optimize_content && attr->gstate->flatness == flatness)
+        return ret;
+
     if (HPDF_Stream_WriteReal (attr->stream, flatness) != HPDF_OK)
         return HPDF_CheckError (page->error);
 
@@ -291,10 +337,11 @@ HPDF_Page_SetExtGState  (HPDF_Page        page,
     if (!HPDF_ExtGState_Validate (ext_gstate))
         return HPDF_RaiseError (page->error, HPDF_INVALID_OBJECT, 0);
 
-    if (page->mmgr != ext_gstate->mmgr)
+    attr = (HPDF_PageAttr)page->attr;
+
+    if (attr->doc_mmgr != ext_gstate->mmgr)
         return HPDF_RaiseError (page->error, HPDF_INVALID_EXT_GSTATE, 0);
 
-    attr = (HPDF_PageAttr)page->attr;
     local_name = HPDF_Page_GetExtGStateName (page, ext_gstate);
 
     if (!local_name)
@@ -306,8 +353,11 @@ HPDF_Page_SetExtGState  (HPDF_Page        page,
     if (HPDF_Stream_WriteStr (attr->stream, " gs\012") != HPDF_OK)
         return HPDF_CheckError (page->error);
 
-    /* change objct class to read only. */
-    ext_gstate->header.obj_class = (HPDF_OSUBCLASS_EXT_GSTATE_R | HPDF_OCLASS_DICT);
+    /* change objct class to read only. the page of a builder leaves it to
+     * HPDF_PageBuilder_Commit, as other builders may be validating it. */
+    if (page->mmgr == attr->doc_mmgr)
+        ext_gstate->header.obj_class = (HPDF_OSUBCLASS_EXT_GSTATE_R |
+                HPDF_OCLASS_DICT);
 
     return ret;
 }
@@ -330,15 +380,17 @@ HPDF_Page_GSave  (HPDF_Page  page)
 
     attr = (HPDF_PageAttr)page->attr;
 
-    new_gstate = HPDF_GState_New (page->mmgr, attr->gstate);
+    new_gstate = HPDF_GStateStack_Push (page->mmgr, &attr->gstate_stack,
+            attr->gstate);
     if (!new_gstate)
         return HPDF_CheckError (page->error);
 
+    /* pushing may have moved the stack, so the old pointer is invalid. */
+    attr->gstate = new_gstate;
+
     if (HPDF_Stream_WriteStr (attr->stream, "q\012") != HPDF_OK)
         return HPDF_CheckError (page->error);
 
-    attr->gstate = new_gstate;
-
     return ret;
 }
 
@@ -357,12 +409,11 @@ HPDF_Page_GRestore  (HPDF_Page  page)
 
     attr = (HPDF_PageAttr)page->attr;
 
-    if (!attr->gstate->prev)
+    new_gstate = HPDF_GStateStack_Pop (&attr->gstate_stack, attr->gstate);
+    if (!new_gstate)
         return HPDF_RaiseError (page->error, HPDF_PAGE_CANNOT_RESTORE_GSTATE,
                 0);
 
-    new_gstate = HPDF_GState_Free (page->mmgr, attr->gstate);
-
     attr->gstate = new_gstate;
 
     if (HPDF_Stream_WriteStr (attr->stream, "Q\012") != HPDF_OK)
@@ -397,17 +448,17 @@ HPDF_Page_Concat  (HPDF_Page         page,
 
     HPDF_MemSet (buf, 0, HPDF_TMP_BUF_SIZ);
 
-    pbuf = HPDF_FToA (pbuf, a, eptr);
+    pbuf = HPDF_FToA2 (pbuf, a, attr->stream->real_precision, eptr);
     *pbuf++ = ' ';
-    pbuf = HPDF_FToA (pbuf, b, eptr);
+    pbuf = HPDF_FToA2 (pbuf, b, attr->stream->real_precision, eptr);
     *pbuf++ = ' ';
-    pbuf = HPDF_FToA (pbuf, c, eptr);
+    pbuf = HPDF_FToA2 (pbuf, c, attr->stream->real_precision, eptr);
     *pbuf++ = ' ';
-    pbuf = HPDF_FToA (pbuf, d, eptr);
+    pbuf = HPDF_FToA2 (pbuf, d, attr->stream->real_precision, eptr);
     *pbuf++ = ' ';
-    pbuf = HPDF_FToA (pbuf, x, eptr);
+    pbuf = HPDF_FToA2 (pbuf, x, attr->stream->real_precision, eptr);
     *pbuf++ = ' ';
-    pbuf = HPDF_FToA (pbuf, y, eptr);
+    pbuf = HPDF_FToA2 (pbuf, y, attr->stream->real_precision, eptr);
     HPDF_StrCpy (pbuf, " cm\012", eptr);
 
     if (HPDF_Stream_WriteStr (attr->stream, buf) != HPDF_OK)
@@ -449,9 +500,9 @@ HPDF_Page_MoveTo  (HPDF_Page  page,
 
     HPDF_MemSet (buf, 0, HPDF_TMP_BUF_SIZ);
 
-    pbuf = HPDF_FToA (pbuf, x, eptr);
+    pbuf = HPDF_FToA2 (pbuf, x, attr->stream->real_precision, eptr);
     *pbuf++ = ' ';
-    pbuf = HPDF_FToA (pbuf, y, eptr);
+    pbuf = HPDF_FToA2 (pbuf, y, attr->stream->real_precision, eptr);
     HPDF_StrCpy (pbuf, " m\012", eptr);
 
     if (HPDF_Stream_WriteStr (attr->stream, buf) != HPDF_OK)
@@ -486,9 +537,9 @@ HPDF_Page_LineTo  (HPDF_Page  page,
 
     HPDF_MemSet (buf, 0, HPDF_TMP_BUF_SIZ);
 
-    pbuf = HPDF_FToA (pbuf, x, eptr);
+    pbuf = HPDF_FToA2 (pbuf, x, attr->stream->real_precision, eptr);
     *pbuf++ = ' ';
-    pbuf = HPDF_FToA (pbuf, y, eptr);
+    pbuf = HPDF_FToA2 (pbuf, y, attr->stream->real_precision, eptr);
     HPDF_StrCpy (pbuf, " l\012", eptr);
 
     if (HPDF_Stream_WriteStr (attr->stream, buf) != HPDF_OK)
@@ -525,17 +576,17 @@ HPDF_Page_CurveTo  (HPDF_Page  page,
 
     HPDF_MemSet (buf, 0, HPDF_TMP_BUF_SIZ);
 
-    pbuf = HPDF_FToA (pbuf, x1, eptr);
+    pbuf = HPDF_FToA2 (pbuf, x1, attr->stream->real_precision, eptr);
     *pbuf++ = ' ';
-    pbuf = HPDF_FToA (pbuf, y1, eptr);
+    pbuf = HPDF_FToA2 (pbuf, y1, attr->stream->real_precision, eptr);
     *pbuf++ = ' ';
-    pbuf = HPDF_FToA (pbuf, x2, eptr);
+    pbuf = HPDF_FToA2 (pbuf, x2, attr->stream->real_precision, eptr);
     *pbuf++ = ' ';
-    pbuf = HPDF_FToA (pbuf, y2, eptr);
+    pbuf = HPDF_FToA2 (pbuf, y2, attr->stream->real_precision, eptr);
     *pbuf++ = ' ';
-    pbuf = HPDF_FToA (pbuf, x3, eptr);
+    pbuf = HPDF_FToA2 (pbuf, x3, attr->stream->real_precision, eptr);
     *pbuf++ = ' ';
-    pbuf = HPDF_FToA (pbuf, y3, eptr);
+    pbuf = HPDF_FToA2 (pbuf, y3, attr->stream->real_precision, eptr);
     HPDF_StrCpy (pbuf, " c\012", eptr);
 
     if (HPDF_Stream_WriteStr (attr->stream, buf) != HPDF_OK)
@@ -570,13 +621,13 @@ HPDF_Page_CurveTo2  (HPDF_Page  page,
 
     HPDF_MemSet (buf, 0, HPDF_TMP_BUF_SIZ);
 
-    pbuf = HPDF_FToA (pbuf, x2, eptr);
+    pbuf = HPDF_FToA2 (pbuf, x2, attr->stream->real_precision, eptr);
     *pbuf++ = ' ';
-    pbuf = HPDF_FToA (pbuf, y2, eptr);
+    pbuf = HPDF_FToA2 (pbuf, y2, attr->stream->real_precision, eptr);
     *pbuf++ = ' ';
-    pbuf = HPDF_FToA (pbuf, x3, eptr);
+    pbuf = HPDF_FToA2 (pbuf, x3, attr->stream->real_precision, eptr);
     *pbuf++ = ' ';
-    pbuf = HPDF_FToA (pbuf, y3, eptr);
+    pbuf = HPDF_FToA2 (pbuf, y3, attr->stream->real_precision, eptr);
     HPDF_StrCpy (pbuf, " v\012", eptr);
 
     if (HPDF_Stream_WriteStr (attr->stream, buf) != HPDF_OK)
@@ -611,13 +662,13 @@ HPDF_Page_CurveTo3  (HPDF_Page  page,
 
     HPDF_MemSet (buf, 0, HPDF_TMP_BUF_SIZ);
 
-    pbuf = HPDF_FToA (pbuf, x1, eptr);
+    pbuf = HPDF_FToA2 (pbuf, x1, attr->stream->real_precision, eptr);
     *pbuf++ = ' ';
-    pbuf = HPDF_FToA (pbuf, y1, eptr);
+    pbuf = HPDF_FToA2 (pbuf, y1, attr->stream->real_precision, eptr);
     *pbuf++ = ' ';
-    pbuf = HPDF_FToA (pbuf, x3, eptr);
+    pbuf = HPDF_FToA2 (pbuf, x3, attr->stream->real_precision, eptr);
     *pbuf++ = ' ';
-    pbuf = HPDF_FToA (pbuf, y3, eptr);
+    pbuf = HPDF_FToA2 (pbuf, y3, attr->stream->real_precision, eptr);
     HPDF_StrCpy (pbuf, " y\012", eptr);
 
     if (HPDF_Stream_WriteStr (attr->stream, buf) != HPDF_OK)
@@ -675,13 +726,13 @@ HPDF_Page_Rectangle  (HPDF_Page  page,
 
     HPDF_MemSet (buf, 0, HPDF_TMP_BUF_SIZ);
 
-    pbuf = HPDF_FToA (pbuf, x, eptr);
+    pbuf = HPDF_FToA2 (pbuf, x, attr->stream->real_precision, eptr);
     *pbuf++ = ' ';
-    pbuf = HPDF_FToA (pbuf, y, eptr);
+    pbuf = HPDF_FToA2 (pbuf, y, attr->stream->real_precision, eptr);
     *pbuf++ = ' ';
-    pbuf = HPDF_FToA (pbuf, width, eptr);
+    pbuf = HPDF_FToA2 (pbuf, width, attr->stream->real_precision, eptr);
     *pbuf++ = ' ';
-    pbuf = HPDF_FToA (pbuf, height, eptr);
+    pbuf = HPDF_FToA2 (pbuf, height, attr->stream->real_precision, eptr);
     HPDF_StrCpy (pbuf, " re\012", eptr);
 
     if (HPDF_Stream_WriteStr (attr->stream, buf) != HPDF_OK)
@@ -696,6 +747,241 @@ HPDF_Page_Rectangle  (HPDF_Page  page,
 }
 
 
+/*--- Bulk path construction ----------------------------------------------*/
+
+/*
+ *  The bulk path functions format their operators into one buffer and
+ *  write it to the contents stream when it is full, instead of checking
+ *  the state and writing the stream once per point.
+ */
+
+#define HPDF_PATH_BUF_SIZ        HPDF_STREAM_BUF_SIZ
+
+/* the longest number HPDF_FToA2 writes is a sign, the 5 digits of
+ * HPDF_LIMIT_MAX_REAL, a point and the decimals, as in "-32767.12345". */
+#define HPDF_PATH_REAL_LEN       (1 + 5 + 1 + HPDF_MAX_REAL_PRECISION)
+
+/* the longest operator is "x1 y1 x2 y2 x3 y3 c\012" */
+#define HPDF_PATH_OP_LEN         (6 * (HPDF_PATH_REAL_LEN + 1) + 2)
+
+
+static char*
+AppendPathOperator  (char             *pbuf,
+                     char             *eptr,
+                     HPDF_UINT        precision,
+                     const HPDF_REAL  *coords,
+                     HPDF_UINT        num_coords,
+                     char             op)
+{
+    HPDF_UINT i;
+
+    for (i = 0; i < num_coords; i++) {
+        pbuf = HPDF_FToA2 (pbuf, coords[i], precision, eptr);
+        *pbuf++ = ' ';
+    }
+    *pbuf++ = op;
+    *pbuf++ = 0x0A;
+
+    return pbuf;
+}
+
+
+static HPDF_STATUS
+WritePolyline  (HPDF_Page          page,
+                const HPDF_Point  *points,
+                HPDF_UINT          num_points,
+                HPDF_BOOL          close_path)
+{
+    HPDF_STATUS ret = HPDF_Page_CheckState (page, HPDF_GMODE_PAGE_DESCRIPTION |
+                    HPDF_GMODE_PATH_OBJECT);
+    char buf[HPDF_PATH_BUF_SIZ];
+    char *pbuf = buf;
+    char *eptr = buf + HPDF_PATH_BUF_SIZ - 1;
+    HPDF_PageAttr attr;
+    HPDF_UINT i;
+
+    if (ret != HPDF_OK)
+        return ret;
+
+    if (!points || num_points == 0)
+        return HPDF_RaiseError (page->error, HPDF_INVALID_PARAMETER, 0);
+
+    attr = (HPDF_PageAttr)page->attr;
+
+    for (i = 0; i < num_points; i++) {
+        if (eptr - pbuf < HPDF_PATH_OP_LEN) {
+            if (HPDF_Stream_Write (attr->stream, (HPDF_BYTE *)buf,
+                        (HPDF_UINT)(pbuf - buf)) != HPDF_OK)
+                return HPDF_CheckError (page->error);
+            pbuf = buf;
+        }
+
+        pbuf = AppendPathOperator (pbuf, eptr, attr->stream->real_precision,
+                &points[i].x, 2, (char)((i == 0) ? 'm' : 'l'));
+    }
+
+    if (close_path) {
+        *pbuf++ = 'h';
+        *pbuf++ = 0x0A;
+    }
+
+    if (HPDF_Stream_Write (attr->stream, (HPDF_BYTE *)buf,
+                (HPDF_UINT)(pbuf - buf)) != HPDF_OK)
+        return HPDF_CheckError (page->error);
+
+    attr->str_pos = points[0];
+    attr->cur_pos = (close_path) ? points[0] : points[num_points - 1];
+    attr->gmode = HPDF_GMODE_PATH_OBJECT;
+
+    return ret;
+}
+
+
+/* m l l ... */
+HPDF_EXPORT(HPDF_STATUS)
+HPDF_Page_Polyline  (HPDF_Page          page,
+                     const HPDF_Point  *points,
+                     HPDF_UINT          num_points)
+{
+    HPDF_PTRACE ((" HPDF_Page_Polyline\n"));
+
+    return WritePolyline (page, points, num_points, HPDF_FALSE);
+}
+
+
+/* m l l ... h */
+HPDF_EXPORT(HPDF_STATUS)
+HPDF_Page_Polygon  (HPDF_Page          page,
+                    const HPDF_Point  *points,
+                    HPDF_UINT          num_points)
+{
+    HPDF_PTRACE ((" HPDF_Page_Polygon\n"));
+
+    return WritePolyline (page, points, num_points, HPDF_TRUE);
+}
+
+
+/*
+ *  HPDF_Page_PathFromArrays
+ *
+ *  ops : path construction operators ('m', 'l', 'c', 'v', 'y' or 'h').
+ *  coords : coordinates which the operators consume in order (2 for 'm'
+ *           and 'l', 6 for 'c', 4 for 'v' and 'y', none for 'h').
+ */
+HPDF_EXPORT(HPDF_STATUS)
+HPDF_Page_PathFromArrays  (HPDF_Page         page,
+                           const char       *ops,
+                           HPDF_UINT         num_ops,
+                           const HPDF_REAL  *coords,
+                           HPDF_UINT         num_coords)
+{
+    HPDF_STATUS ret = HPDF_Page_CheckState (page, HPDF_GMODE_PAGE_DESCRIPTION |
+                    HPDF_GMODE_PATH_OBJECT);
+    char buf[HPDF_PATH_BUF_SIZ];
+    char *pbuf = buf;
+    char *eptr = buf + HPDF_PATH_BUF_SIZ - 1;
+    HPDF_PageAttr attr;
+    HPDF_Point cur_pos;
+    HPDF_Point str_pos;
+    HPDF_UINT needed = 0;
+    HPDF_UINT i;
+
+    HPDF_PTRACE ((" HPDF_Page_PathFromArrays\n"));
+
+    if (ret != HPDF_OK)
+        return ret;
+
+    if (!ops || num_ops == 0 || (!coords && num_coords > 0))
+        return HPDF_RaiseError (page->error, HPDF_INVALID_PARAMETER, 0);
+
+    attr = (HPDF_PageAttr)page->attr;
+
+    /* validate the whole path before anything is written */
+    for (i = 0; i < num_ops; i++) {
+        switch (ops[i]) {
+            case 'm':
+            case 'l':
+                needed += 2;
+                break;
+            case 'c':
+                needed += 6;
+                break;
+            case 'v':
+            case 'y':
+                needed += 4;
+                break;
+            case 'h':
+                break;
+            default:
+                return HPDF_RaiseError (page->error, HPDF_INVALID_PARAMETER,
+                        0);
+        }
+    }
+
+    if (needed != num_coords)
+        return HPDF_RaiseError (page->error, HPDF_PAGE_INVALID_PARAM_COUNT, 0);
+
+    /* a new path has to begin with a subpath */
+    if (attr->gmode == HPDF_GMODE_PAGE_DESCRIPTION && ops[0] != 'm')
+        return HPDF_RaiseError (page->error, HPDF_PAGE_INVALID_GMODE, 0);
+
+    cur_pos = attr->cur_pos;
+    str_pos = attr->str_pos;
+
+    for (i = 0; i < num_ops; i++) {
+        HPDF_UINT n = 0;
+
+        if (eptr - pbuf < HPDF_PATH_OP_LEN) {
+            if (HPDF_Stream_Write (attr->stream, (HPDF_BYTE *)buf,
+                        (HPDF_UINT)(pbuf - buf)) != HPDF_OK)
+                return HPDF_CheckError (page->error);
+            pbuf = buf;
+        }
+
+        switch (ops[i]) {
+            case 'm':
+                n = 2;
+                str_pos.x = coords[0];
+                str_pos.y = coords[1];
+                break;
+            case 'l':
+                n = 2;
+                break;
+            case 'c':
+                n = 6;
+                break;
+            case 'v':
+            case 'y':
+                n = 4;
+                break;
+            default:
+                break;
+        }
+
+        pbuf = AppendPathOperator (pbuf, eptr, attr->stream->real_precision,
+                coords, n, ops[i]);
+
+        if (n > 0) {
+            cur_pos.x = coords[n - 2];
+            cur_pos.y = coords[n - 1];
+        } else
+            cur_pos = str_pos;
+
+        coords += n;
+    }
+
+    if (HPDF_Stream_Write (attr->stream, (HPDF_BYTE *)buf,
+                (HPDF_UINT)(pbuf - buf)) != HPDF_OK)
+        return HPDF_CheckError (page->error);
+
+    attr->cur_pos = cur_pos;
+    attr->str_pos = str_pos;
+    attr->gmode = HPDF_GMODE_PATH_OBJECT;
+
+    return ret;
+}
+
+
 /*--- Path painting operator ---------------------------------------------*/
 
 /* S */
@@ -1032,6 +1318,9 @@ HPDF_Page_SetCharSpace  (HPDF_Page  page,
     if (value < HPDF_MIN_CHARSPACE || value > HPDF_MAX_CHARSPACE)
         return HPDF_RaiseError (page->error, HPDF_PAGE_OUT_OF_RANGE, 0);
 
+    if (attr->optimize_content && attr->gstate->char_space == value)
+        return ret;
+
     if (HPDF_Stream_WriteReal (attr->stream, value) != HPDF_OK)
         return HPDF_CheckError (page->error);
 
@@ -1062,6 +1351,9 @@ HPDF_Page_SetWordSpace  (HPDF_Page  page,
     if (value < HPDF_MIN_WORDSPACE || value > HPDF_MAX_WORDSPACE)
         return HPDF_RaiseError (page->error, HPDF_PAGE_OUT_OF_RANGE, 0);
 
+    if (attr->optimize_content && attr->gstate->word_space == value)
+        return ret;
+
     if (HPDF_Stream_WriteReal (attr->stream, value) != HPDF_OK)
         return HPDF_CheckError (page->error);
 
@@ -1093,6 +1385,9 @@ HPDF_Page_SetHorizontalScalling  (HPDF_Page  page,
             value > HPDF_MAX_HORIZONTALSCALING)
         return HPDF_RaiseError (page->error, HPDF_PAGE_OUT_OF_RANGE, 0);
 
+    if (attr->optimize_content && attr->gstate->h_scalling == value)
+        return ret;
+
     if (HPDF_Stream_WriteReal (attr->stream, value) != HPDF_OK)
         return HPDF_CheckError (page->error);
 
@@ -1120,6 +1415,9 @@ HPDF_Page_SetTextLeading  (HPDF_Page  page,
 
     attr = (HPDF_PageAttr)page->attr;
 
+    if (attr->optimize_content && attr->gstate->text_leading == value)
+        return ret;
+
     if (HPDF_Stream_WriteReal (attr->stream, value) != HPDF_OK)
         return HPDF_CheckError (page->error);
 
@@ -1157,10 +1455,16 @@ HPDF_Page_SetFontAndSize  (HPDF_Page  page,
     if (size <= 0 || size > HPDF_MAX_FONTSIZE)
         return HPDF_RaiseError (page->error, HPDF_PAGE_INVALID_FONT_SIZE, 0);
 
-    if (page->mmgr != font->mmgr)
+    attr = (HPDF_PageAttr)page->attr;
+
+    if (attr->doc_mmgr != font->mmgr)
         return HPDF_RaiseError (page->error, HPDF_PAGE_INVALID_FONT, 0);
 
-    attr = (HPDF_PageAttr)page->attr;
+    /* the font is already in the resources of the page if it is current. */
+    if (attr->optimize_content && attr->gstate->font == font &&
+            attr->gstate->font_size == size)
+        return ret;
+
     local_name = HPDF_Page_GetLocalFontName (page, font);
 
     if (!local_name)
@@ -1171,7 +1475,7 @@ HPDF_Page_SetFontAndSize  (HPDF_Page  page,
 
     HPDF_MemSet (buf, 0, HPDF_TMP_BUF_SIZ);
     *pbuf++ = ' ';
-    pbuf = HPDF_FToA (pbuf, size, eptr);
+    pbuf = HPDF_FToA2 (pbuf, size, attr->stream->real_precision, eptr);
     HPDF_StrCpy (pbuf, " Tf\012", eptr);
 
     if (HPDF_Stream_WriteStr (attr->stream, buf) != HPDF_OK)
@@ -1204,6 +1508,9 @@ HPDF_Page_SetTextRenderingMode  (HPDF_Page               page,
 
     attr = (HPDF_PageAttr)page->attr;
 
+    if (attr->optimize_content && attr->gstate->rendering_mode == mode)
+        return ret;
+
     if (HPDF_Stream_WriteInt (attr->stream, (HPDF_INT)mode) != HPDF_OK)
         return HPDF_CheckError (page->error);
 
@@ -1239,6 +1546,9 @@ HPDF_Page_SetTextRise  (HPDF_Page  page,
 
     attr = (HPDF_PageAttr)page->attr;
 
+    if (attr->optimize_content && attr->gstate->text_rise == value)
+        return ret;
+
     if (HPDF_Stream_WriteReal (attr->stream, value) != HPDF_OK)
         return HPDF_CheckError (page->error);
 
@@ -1274,9 +1584,9 @@ HPDF_Page_MoveTextPos  (HPDF_Page  page,
 
     HPDF_MemSet (buf, 0, HPDF_TMP_BUF_SIZ);
 
-    pbuf = HPDF_FToA (pbuf, x, eptr);
+    pbuf = HPDF_FToA2 (pbuf, x, attr->stream->real_precision, eptr);
     *pbuf++ = ' ';
-    pbuf = HPDF_FToA (pbuf, y, eptr);
+    pbuf = HPDF_FToA2 (pbuf, y, attr->stream->real_precision, eptr);
     HPDF_StrCpy (pbuf, " Td\012", eptr);
 
     if (HPDF_Stream_WriteStr (attr->stream, buf) != HPDF_OK)
@@ -1311,9 +1621,9 @@ HPDF_Page_MoveTextPos2  (HPDF_Page  page,
 
     HPDF_MemSet (buf, 0, HPDF_TMP_BUF_SIZ);
 
-    pbuf = HPDF_FToA (pbuf, x, eptr);
+    pbuf = HPDF_FToA2 (pbuf, x, attr->stream->real_precision, eptr);
     *pbuf++ = ' ';
-    pbuf = HPDF_FToA (pbuf, y, eptr);
+    pbuf = HPDF_FToA2 (pbuf, y, attr->stream->real_precision, eptr);
     HPDF_StrCpy (pbuf, " TD\012", eptr);
 
     if (HPDF_Stream_WriteStr (attr->stream, buf) != HPDF_OK)
@@ -1356,17 +1666,17 @@ HPDF_Page_SetTextMatrix  (HPDF_Page         page,
 
     HPDF_MemSet (buf, 0, HPDF_TMP_BUF_SIZ);
 
-    pbuf = HPDF_FToA (pbuf, a, eptr);
+    pbuf = HPDF_FToA2 (pbuf, a, attr->stream->real_precision, eptr);
     *pbuf++ = ' ';
-    pbuf = HPDF_FToA (pbuf, b, eptr);
+    pbuf = HPDF_FToA2 (pbuf, b, attr->stream->real_precision, eptr);
     *pbuf++ = ' ';
-    pbuf = HPDF_FToA (pbuf, c, eptr);
+    pbuf = HPDF_FToA2 (pbuf, c, attr->stream->real_precision, eptr);
     *pbuf++ = ' ';
-    pbuf = HPDF_FToA (pbuf, d, eptr);
+    pbuf = HPDF_FToA2 (pbuf, d, attr->stream->real_precision, eptr);
     *pbuf++ = ' ';
-    pbuf = HPDF_FToA (pbuf, x, eptr);
+    pbuf = HPDF_FToA2 (pbuf, x, attr->stream->real_precision, eptr);
     *pbuf++ = ' ';
-    pbuf = HPDF_FToA (pbuf, y, eptr);
+    pbuf = HPDF_FToA2 (pbuf, y, attr->stream->real_precision, eptr);
     HPDF_StrCpy (pbuf, " Tm\012", eptr);
 
     if (HPDF_Stream_WriteStr (attr->stream, buf) != HPDF_OK)
@@ -1541,9 +1851,9 @@ HPDF_Page_ShowTextNextLineEx  (HPDF_Page    page,
         return HPDF_Page_MoveToNextLine(page);
 
     HPDF_MemSet (buf, 0, HPDF_TMP_BUF_SIZ);
-    pbuf = HPDF_FToA (pbuf, word_space, eptr);
+    pbuf = HPDF_FToA2 (pbuf, word_space, attr->stream->real_precision, eptr);
     *pbuf++ = ' ';
-    pbuf = HPDF_FToA (pbuf, char_space, eptr);
+    pbuf = HPDF_FToA2 (pbuf, char_space, attr->stream->real_precision, eptr);
     *pbuf = ' ';
 
     if (InternalWriteText (attr, buf) != HPDF_OK)
@@ -1608,6 +1918,10 @@ HPDF_Page_SetGrayFill  (HPDF_Page  page,
     if (gray < 0 || gray > 1)
         return HPDF_RaiseError (page->error, HPDF_PAGE_OUT_OF_RANGE, 0);
 
+    if (attr->optimize_content && attr->gstate->cs_fill == HPDF_CS_DEVICE_GRAY &&
+            attr->gstate->gray_fill == gray)
+        return ret;
+
     if (HPDF_Stream_WriteReal (attr->stream, gray) != HPDF_OK)
         return HPDF_CheckError (page->error);
 
@@ -1639,6 +1953,11 @@ HPDF_Page_SetGrayStroke  (HPDF_Page  page,
     if (gray < 0 || gray > 1)
         return HPDF_RaiseError (page->error, HPDF_PAGE_OUT_OF_RANGE, 0);
 
+    if (attr->optimize_content &&
+            attr->gstate->cs_stroke == HPDF_CS_DEVICE_GRAY &&
+            attr->gstate->gray_stroke == gray)
+        return ret;
+
     if (HPDF_Stream_WriteReal (attr->stream, gray) != HPDF_OK)
         return HPDF_CheckError (page->error);
 
@@ -1675,13 +1994,18 @@ HPDF_Page_SetRGBFill  (HPDF_Page  page,
 
     attr = (HPDF_PageAttr)page->attr;
 
+    if (attr->optimize_content && attr->gstate->cs_fill == HPDF_CS_DEVICE_RGB &&
+            attr->gstate->rgb_fill.r == r && attr->gstate->rgb_fill.g == g &&
+            attr->gstate->rgb_fill.b == b)
+        return ret;
+
     HPDF_MemSet (buf, 0, HPDF_TMP_BUF_SIZ);
 
-    pbuf = HPDF_FToA (pbuf, r, eptr);
+    pbuf = HPDF_FToA2 (pbuf, r, attr->stream->real_precision, eptr);
     *pbuf++ = ' ';
-    pbuf = HPDF_FToA (pbuf, g, eptr);
+    pbuf = HPDF_FToA2 (pbuf, g, attr->stream->real_precision, eptr);
     *pbuf++ = ' ';
-    pbuf = HPDF_FToA (pbuf, b, eptr);
+    pbuf = HPDF_FToA2 (pbuf, b, attr->stream->real_precision, eptr);
     HPDF_StrCpy (pbuf, " rg\012", eptr);
 
     if (HPDF_Stream_WriteStr (attr->stream, buf) != HPDF_OK)
@@ -1719,13 +2043,18 @@ HPDF_Page_SetRGBStroke  (HPDF_Page  page,
 
     attr = (HPDF_PageAttr)page->attr;
 
+    if (attr->optimize_content && attr->gstate->cs_stroke == HPDF_CS_DEVICE_RGB &&
+            attr->gstate->rgb_stroke.r == r && attr->gstate->rgb_stroke.g == g &&
+            attr->gstate->rgb_stroke.b == b)
+        return ret;
+
     HPDF_MemSet (buf, 0, HPDF_TMP_BUF_SIZ);
 
-    pbuf = HPDF_FToA (pbuf, r, eptr);
+    pbuf = HPDF_FToA2 (pbuf, r, attr->stream->real_precision, eptr);
     *pbuf++ = ' ';
-    pbuf = HPDF_FToA (pbuf, g, eptr);
+    pbuf = HPDF_FToA2 (pbuf, g, attr->stream->real_precision, eptr);
     *pbuf++ = ' ';
-    pbuf = HPDF_FToA (pbuf, b, eptr);
+    pbuf = HPDF_FToA2 (pbuf, b, attr->stream->real_precision, eptr);
     HPDF_StrCpy (pbuf, " RG\012", eptr);
 
     if (HPDF_Stream_WriteStr (attr->stream, buf) != HPDF_OK)
@@ -1764,15 +2093,20 @@ HPDF_Page_SetCMYKFill  (HPDF_Page  page,
 
     attr = (HPDF_PageAttr)page->attr;
 
+    if (attr->optimize_content && attr->gstate->cs_fill == HPDF_CS_DEVICE_CMYK &&
+            attr->gstate->cmyk_fill.c == c && attr->gstate->cmyk_fill.m == m &&
+            attr->gstate->cmyk_fill.y == y && attr->gstate->cmyk_fill.k == k)
+        return ret;
+
     HPDF_MemSet (buf, 0, HPDF_TMP_BUF_SIZ);
 
-    pbuf = HPDF_FToA (pbuf, c, eptr);
+    pbuf = HPDF_FToA2 (pbuf, c, attr->stream->real_precision, eptr);
     *pbuf++ = ' ';
-    pbuf = HPDF_FToA (pbuf, m, eptr);
+    pbuf = HPDF_FToA2 (pbuf, m, attr->stream->real_precision, eptr);
     *pbuf++ = ' ';
-    pbuf = HPDF_FToA (pbuf, y, eptr);
+    pbuf = HPDF_FToA2 (pbuf, y, attr->stream->real_precision, eptr);
     *pbuf++ = ' ';
-    pbuf = HPDF_FToA (pbuf, k, eptr);
+    pbuf = HPDF_FToA2 (pbuf, k, attr->stream->real_precision, eptr);
     HPDF_StrCpy (pbuf, " k\012", eptr);
 
     if (HPDF_Stream_WriteStr (attr->stream, buf) != HPDF_OK)
@@ -1812,15 +2146,20 @@ HPDF_Page_SetCMYKStroke  (HPDF_Page  page,
 
     attr = (HPDF_PageAttr)page->attr;
 
+    if (attr->optimize_content && attr->gstate->cs_stroke == HPDF_CS_DEVICE_CMYK &&
+            attr->gstate->cmyk_stroke.c == c && attr->gstate->cmyk_stroke.m == m &&
+            attr->gstate->cmyk_stroke.y == y && attr->gstate->cmyk_stroke.k == k)
+        return ret;
+
     HPDF_MemSet (buf, 0, HPDF_TMP_BUF_SIZ);
 
-    pbuf = HPDF_FToA (pbuf, c, eptr);
+    pbuf = HPDF_FToA2 (pbuf, c, attr->stream->real_precision, eptr);
     *pbuf++ = ' ';
-    pbuf = HPDF_FToA (pbuf, m, eptr);
+    pbuf = HPDF_FToA2 (pbuf, m, attr->stream->real_precision, eptr);
     *pbuf++ = ' ';
-    pbuf = HPDF_FToA (pbuf, y, eptr);
+    pbuf = HPDF_FToA2 (pbuf, y, attr->stream->real_precision, eptr);
     *pbuf++ = ' ';
-    pbuf = HPDF_FToA (pbuf, k, eptr);
+    pbuf = HPDF_FToA2 (pbuf, k, attr->stream->real_precision, eptr);
     HPDF_StrCpy (pbuf, " K\012", eptr);
 
     if (HPDF_Stream_WriteStr (attr->stream, buf) != HPDF_OK)
@@ -1865,10 +2204,10 @@ HPDF_Page_ExecuteXObject  (HPDF_Page     page,
             HPDF_OCLASS_DICT))
         return HPDF_RaiseError (page->error, HPDF_INVALID_OBJECT, 0);
 
-    if (page->mmgr != obj->mmgr)
-        return HPDF_RaiseError (page->error, HPDF_PAGE_INVALID_XOBJECT, 0);
-
     attr = (HPDF_PageAttr)page->attr;
+
+    if (attr->doc_mmgr != obj->mmgr)
+        return HPDF_RaiseError (page->error, HPDF_PAGE_INVALID_XOBJECT, 0);
     local_name = HPDF_Page_GetXObjectName (page, obj);
 
     if (!local_name)
@@ -1904,84 +2243,88 @@ static const HPDF_REAL KAPPA = 0.552F;
 static char*
 QuarterCircleA  (char   *pbuf,
                  char   *eptr,
+                 HPDF_UINT    precision,
                  HPDF_REAL    x,
                  HPDF_REAL    y,
                  HPDF_REAL    ray)
 {
-    pbuf = HPDF_FToA (pbuf, x -ray, eptr);
+    pbuf = HPDF_FToA2 (pbuf, x -ray, precision, eptr);
     *pbuf++ = ' ';
-    pbuf = HPDF_FToA (pbuf, y + ray * KAPPA, eptr);
+    pbuf = HPDF_FToA2 (pbuf, y + ray * KAPPA, precision, eptr);
     *pbuf++ = ' ';
-    pbuf = HPDF_FToA (pbuf, x -ray * KAPPA, eptr);
+    pbuf = HPDF_FToA2 (pbuf, x -ray * KAPPA, precision, eptr);
     *pbuf++ = ' ';
-    pbuf = HPDF_FToA (pbuf, y + ray, eptr);
+    pbuf = HPDF_FToA2 (pbuf, y + ray, precision, eptr);
     *pbuf++ = ' ';
-    pbuf = HPDF_FToA (pbuf, x, eptr);
+    pbuf = HPDF_FToA2 (pbuf, x, precision, eptr);
     *pbuf++ = ' ';
-    pbuf = HPDF_FToA (pbuf, y + ray, eptr);
+    pbuf = HPDF_FToA2 (pbuf, y + ray, precision, eptr);
     return (char *)HPDF_StrCpy (pbuf, " c\012", eptr);
 }
 
 static char*
 QuarterCircleB  (char   *pbuf,
                  char   *eptr,
+                 HPDF_UINT    precision,
                  HPDF_REAL    x,
                  HPDF_REAL    y,
                  HPDF_REAL    ray)
 {
-    pbuf = HPDF_FToA (pbuf, x + ray * KAPPA, eptr);
+    pbuf = HPDF_FToA2 (pbuf, x + ray * KAPPA, precision, eptr);
     *pbuf++ = ' ';
-    pbuf = HPDF_FToA (pbuf, y + ray, eptr);
+    pbuf = HPDF_FToA2 (pbuf, y + ray, precision, eptr);
     *pbuf++ = ' ';
-    pbuf = HPDF_FToA (pbuf, x + ray, eptr);
+    pbuf = HPDF_FToA2 (pbuf, x + ray, precision, eptr);
     *pbuf++ = ' ';
-    pbuf = HPDF_FToA (pbuf, y + ray * KAPPA, eptr);
+    pbuf = HPDF_FToA2 (pbuf, y + ray * KAPPA, precision, eptr);
     *pbuf++ = ' ';
-    pbuf = HPDF_FToA (pbuf, x + ray, eptr);
+    pbuf = HPDF_FToA2 (pbuf, x + ray, precision, eptr);
     *pbuf++ = ' ';
-    pbuf = HPDF_FToA (pbuf, y, eptr);
+    pbuf = HPDF_FToA2 (pbuf, y, precision, eptr);
     return (char *)HPDF_StrCpy (pbuf, " c\012", eptr);
 }
 
 static char*
 QuarterCircleC  (char   *pbuf,
                  char   *eptr,
+                 HPDF_UINT    precision,
                  HPDF_REAL    x,
                  HPDF_REAL    y,
                  HPDF_REAL    ray)
 {
-    pbuf = HPDF_FToA (pbuf, x + ray, eptr);
+    pbuf = HPDF_FToA2 (pbuf, x + ray, precision, eptr);
     *pbuf++ = ' ';
-    pbuf = HPDF_FToA (pbuf, y - ray * KAPPA, eptr);
+    pbuf = HPDF_FToA2 (pbuf, y - ray * KAPPA, precision, eptr);
     *pbuf++ = ' ';
-    pbuf = HPDF_FToA (pbuf, x + ray * KAPPA, eptr);
+    pbuf = HPDF_FToA2 (pbuf, x + ray * KAPPA, precision, eptr);
     *pbuf++ = ' ';
-    pbuf = HPDF_FToA (pbuf, y - ray, eptr);
+    pbuf = HPDF_FToA2 (pbuf, y - ray, precision, eptr);
     *pbuf++ = ' ';
-    pbuf = HPDF_FToA (pbuf, x, eptr);
+    pbuf = HPDF_FToA2 (pbuf, x, precision, eptr);
     *pbuf++ = ' ';
-    pbuf = HPDF_FToA (pbuf, y - ray, eptr);
+    pbuf = HPDF_FToA2 (pbuf, y - ray, precision, eptr);
     return (char *)HPDF_StrCpy (pbuf, " c\012", eptr);
 }
 
 static char*
 QuarterCircleD  (char   *pbuf,
                  char   *eptr,
+                 HPDF_UINT    precision,
                  HPDF_REAL    x,
                  HPDF_REAL    y,
                  HPDF_REAL    ray)
 {
-    pbuf = HPDF_FToA (pbuf, x - ray * KAPPA, eptr);
+    pbuf = HPDF_FToA2 (pbuf, x - ray * KAPPA, precision, eptr);
     *pbuf++ = ' ';
-    pbuf = HPDF_FToA (pbuf, y - ray, eptr);
+    pbuf = HPDF_FToA2 (pbuf, y - ray, precision, eptr);
     *pbuf++ = ' ';
-    pbuf = HPDF_FToA (pbuf, x - ray, eptr);
+    pbuf = HPDF_FToA2 (pbuf, x - ray, precision, eptr);
     *pbuf++ = ' ';
-    pbuf = HPDF_FToA (pbuf, y - ray * KAPPA, eptr);
+    pbuf = HPDF_FToA2 (pbuf, y - ray * KAPPA, precision, eptr);
     *pbuf++ = ' ';
-    pbuf = HPDF_FToA (pbuf, x - ray, eptr);
+    pbuf = HPDF_FToA2 (pbuf, x - ray, precision, eptr);
     *pbuf++ = ' ';
-    pbuf = HPDF_FToA (pbuf, y, eptr);
+    pbuf = HPDF_FToA2 (pbuf, y, precision, eptr);
     return (char *)HPDF_StrCpy (pbuf, " c\012", eptr);
 }
 
@@ -1997,6 +2340,7 @@ HPDF_Page_Circle  (HPDF_Page     page,
     char *pbuf = buf;
     char *eptr = buf + HPDF_TMP_BUF_SIZ - 1;
     HPDF_PageAttr attr;
+    HPDF_UINT precision;
 
     HPDF_PTRACE ((" HPDF_Page_Circle\n"));
 
@@ -2004,18 +2348,19 @@ HPDF_Page_Circle  (HPDF_Page     page,
         return ret;
 
     attr = (HPDF_PageAttr)page->attr;
+    precision = attr->stream->real_precision;
 
     HPDF_MemSet (buf, 0, HPDF_TMP_BUF_SIZ);
 
-    pbuf = HPDF_FToA (pbuf, x - ray, eptr);
+    pbuf = HPDF_FToA2 (pbuf, x - ray, precision, eptr);
     *pbuf++ = ' ';
-    pbuf = HPDF_FToA (pbuf, y, eptr);
+    pbuf = HPDF_FToA2 (pbuf, y, precision, eptr);
     pbuf = (char *)HPDF_StrCpy (pbuf, " m\012", eptr);
 
-    pbuf = QuarterCircleA (pbuf, eptr, x, y, ray);
-    pbuf = QuarterCircleB (pbuf, eptr, x, y, ray);
-    pbuf = QuarterCircleC (pbuf, eptr, x, y, ray);
-    QuarterCircleD (pbuf, eptr, x, y, ray);
+    pbuf = QuarterCircleA (pbuf, eptr, precision, x, y, ray);
+    pbuf = QuarterCircleB (pbuf, eptr, precision, x, y, ray);
+    pbuf = QuarterCircleC (pbuf, eptr, precision, x, y, ray);
+    QuarterCircleD (pbuf, eptr, precision, x, y, ray);
 
     if (HPDF_Stream_WriteStr (attr->stream, buf) != HPDF_OK)
         return HPDF_CheckError (page->error);
@@ -2032,88 +2377,92 @@ HPDF_Page_Circle  (HPDF_Page     page,
 static char*
 QuarterEllipseA  (char      *pbuf,
                   char      *eptr,
+                  HPDF_UINT  precision,
                   HPDF_REAL  x,
                   HPDF_REAL  y,
                   HPDF_REAL  xray,
                   HPDF_REAL  yray)
 {
-    pbuf = HPDF_FToA (pbuf, x - xray, eptr);
+    pbuf = HPDF_FToA2 (pbuf, x - xray, precision, eptr);
     *pbuf++ = ' ';
-    pbuf = HPDF_FToA (pbuf, y + yray * KAPPA, eptr);
+    pbuf = HPDF_FToA2 (pbuf, y + yray * KAPPA, precision, eptr);
     *pbuf++ = ' ';
-    pbuf = HPDF_FToA (pbuf, x -xray * KAPPA, eptr);
+    pbuf = HPDF_FToA2 (pbuf, x -xray * KAPPA, precision, eptr);
     *pbuf++ = ' ';
-    pbuf = HPDF_FToA (pbuf, y + yray, eptr);
+    pbuf = HPDF_FToA2 (pbuf, y + yray, precision, eptr);
     *pbuf++ = ' ';
-    pbuf = HPDF_FToA (pbuf, x, eptr);
+    pbuf = HPDF_FToA2 (pbuf, x, precision, eptr);
     *pbuf++ = ' ';
-    pbuf = HPDF_FToA (pbuf, y + yray, eptr);
+    pbuf = HPDF_FToA2 (pbuf, y + yray, precision, eptr);
     return (char *)HPDF_StrCpy (pbuf, " c\012", eptr);
 }
 
 static char*
 QuarterEllipseB  (char      *pbuf,
                   char      *eptr,
+                  HPDF_UINT  precision,
                   HPDF_REAL  x,
                   HPDF_REAL  y,
                   HPDF_REAL  xray,
                   HPDF_REAL  yray)
 {
-    pbuf = HPDF_FToA (pbuf, x + xray * KAPPA, eptr);
+    pbuf = HPDF_FToA2 (pbuf, x + xray * KAPPA, precision, eptr);
     *pbuf++ = ' ';
-    pbuf = HPDF_FToA (pbuf, y + yray, eptr);
+    pbuf = HPDF_FToA2 (pbuf, y + yray, precision, eptr);
     *pbuf++ = ' ';
-    pbuf = HPDF_FToA (pbuf, x + xray, eptr);
+    pbuf = HPDF_FToA2 (pbuf, x + xray, precision, eptr);
     *pbuf++ = ' ';
-    pbuf = HPDF_FToA (pbuf, y + yray * KAPPA, eptr);
+    pbuf = HPDF_FToA2 (pbuf, y + yray * KAPPA, precision, eptr);
     *pbuf++ = ' ';
-    pbuf = HPDF_FToA (pbuf, x + xray, eptr);
+    pbuf = HPDF_FToA2 (pbuf, x + xray, precision, eptr);
     *pbuf++ = ' ';
-    pbuf = HPDF_FToA (pbuf, y, eptr);
+    pbuf = HPDF_FToA2 (pbuf, y, precision, eptr);
     return (char *)HPDF_StrCpy (pbuf, " c\012", eptr);
 }
 
 static char*
 QuarterEllipseC  (char      *pbuf,
                   char      *eptr,
+                  HPDF_UINT  precision,
                   HPDF_REAL  x,
                   HPDF_REAL  y,
                   HPDF_REAL  xray,
                   HPDF_REAL  yray)
 {
-    pbuf = HPDF_FToA (pbuf, x + xray, eptr);
+    pbuf = HPDF_FToA2 (pbuf, x + xray, precision, eptr);
     *pbuf++ = ' ';
-    pbuf = HPDF_FToA (pbuf, y - yray * KAPPA, eptr);
+    pbuf = HPDF_FToA2 (pbuf, y - yray * KAPPA, precision, eptr);
     *pbuf++ = ' ';
-    pbuf = HPDF_FToA (pbuf, x + xray * KAPPA, eptr);
+    pbuf = HPDF_FToA2 (pbuf, x + xray * KAPPA, precision, eptr);
     *pbuf++ = ' ';
-    pbuf = HPDF_FToA (pbuf, y - yray, eptr);
+    pbuf = HPDF_FToA2 (pbuf, y - yray, precision, eptr);
     *pbuf++ = ' ';
-    pbuf = HPDF_FToA (pbuf, x, eptr);
+    pbuf = HPDF_FToA2 (pbuf, x, precision, eptr);
     *pbuf++ = ' ';
-    pbuf = HPDF_FToA (pbuf, y - yray, eptr);
+    pbuf = HPDF_FToA2 (pbuf, y - yray, precision, eptr);
     return (char *)HPDF_StrCpy (pbuf, " c\012", eptr);
 }
 
 static char*
 QuarterEllipseD  (char      *pbuf,
                   char      *eptr,
+                  HPDF_UINT  precision,
                   HPDF_REAL  x,
                   HPDF_REAL  y,
                   HPDF_REAL  xray,
                   HPDF_REAL  yray)
 {
-    pbuf = HPDF_FToA (pbuf, x - xray * KAPPA, eptr);
+    pbuf = HPDF_FToA2 (pbuf, x - xray * KAPPA, precision, eptr);
     *pbuf++ = ' ';
-    pbuf = HPDF_FToA (pbuf, y - yray, eptr);
+    pbuf = HPDF_FToA2 (pbuf, y - yray, precision, eptr);
     *pbuf++ = ' ';
-    pbuf = HPDF_FToA (pbuf, x - xray, eptr);
+    pbuf = HPDF_FToA2 (pbuf, x - xray, precision, eptr);
     *pbuf++ = ' ';
-    pbuf = HPDF_FToA (pbuf, y - yray * KAPPA, eptr);
+    pbuf = HPDF_FToA2 (pbuf, y - yray * KAPPA, precision, eptr);
     *pbuf++ = ' ';
-    pbuf = HPDF_FToA (pbuf, x - xray, eptr);
+    pbuf = HPDF_FToA2 (pbuf, x - xray, precision, eptr);
     *pbuf++ = ' ';
-    pbuf = HPDF_FToA (pbuf, y, eptr);
+    pbuf = HPDF_FToA2 (pbuf, y, precision, eptr);
     return (char *)HPDF_StrCpy (pbuf, " c\012", eptr);
 }
 
@@ -2130,6 +2479,7 @@ HPDF_Page_Ellipse  (HPDF_Page   page,
     char *pbuf = buf;
     char *eptr = buf + HPDF_TMP_BUF_SIZ - 1;
     HPDF_PageAttr attr;
+    HPDF_UINT precision;
 
     HPDF_PTRACE ((" HPDF_Page_Ellipse\n"));
 
@@ -2137,18 +2487,19 @@ HPDF_Page_Ellipse  (HPDF_Page   page,
         return ret;
 
     attr = (HPDF_PageAttr)page->attr;
+    precision = attr->stream->real_precision;
 
     HPDF_MemSet (buf, 0, HPDF_TMP_BUF_SIZ);
 
-    pbuf = HPDF_FToA (pbuf, x - xray, eptr);
+    pbuf = HPDF_FToA2 (pbuf, x - xray, precision, eptr);
     *pbuf++ = ' ';
-    pbuf = HPDF_FToA (pbuf, y, eptr);
+    pbuf = HPDF_FToA2 (pbuf, y, precision, eptr);
     pbuf = (char *)HPDF_StrCpy (pbuf, " m\012", eptr);
 
-    pbuf = QuarterEllipseA (pbuf, eptr, x, y, xray, yray);
-    pbuf = QuarterEllipseB (pbuf, eptr, x, y, xray, yray);
-    pbuf = QuarterEllipseC (pbuf, eptr, x, y, xray, yray);
-    QuarterEllipseD (pbuf, eptr, x, y, xray, yray);
+    pbuf = QuarterEllipseA (pbuf, eptr, precision, x, y, xray, yray);
+    pbuf = QuarterEllipseB (pbuf, eptr, precision, x, y, xray, yray);
+    pbuf = QuarterEllipseC (pbuf, eptr, precision, x, y, xray, yray);
+    QuarterEllipseD (pbuf, eptr, precision, x, y, xray, yray);
 
     if (HPDF_Stream_WriteStr (attr->stream, buf) != HPDF_OK)
         return HPDF_CheckError (page->error);
@@ -2268,23 +2619,31 @@ InternalArc  (HPDF_Page    page,
     y3 = rx3 * HPDF_SIN (delta_angle) + ry3 * HPDF_COS (delta_angle) + y;
 
     if (!cont_flg) {
-        pbuf = HPDF_FToA (pbuf, (HPDF_REAL)x0, eptr);
+        pbuf = HPDF_FToA2 (pbuf, (HPDF_REAL)x0,
+                attr->stream->real_precision, eptr);
         *pbuf++ = ' ';
-        pbuf = HPDF_FToA (pbuf, (HPDF_REAL)y0, eptr);
+        pbuf = HPDF_FToA2 (pbuf, (HPDF_REAL)y0,
+                attr->stream->real_precision, eptr);
         pbuf = (char *)HPDF_StrCpy (pbuf, " m\012", eptr);
     }
 
-    pbuf = HPDF_FToA (pbuf, (HPDF_REAL)x1, eptr);
+    pbuf = HPDF_FToA2 (pbuf, (HPDF_REAL)x1,
+            attr->stream->real_precision, eptr);
     *pbuf++ = ' ';
-    pbuf = HPDF_FToA (pbuf, (HPDF_REAL)y1, eptr);
+    pbuf = HPDF_FToA2 (pbuf, (HPDF_REAL)y1,
+            attr->stream->real_precision, eptr);
     *pbuf++ = ' ';
-    pbuf = HPDF_FToA (pbuf, (HPDF_REAL)x2, eptr);
+    pbuf = HPDF_FToA2 (pbuf, (HPDF_REAL)x2,
+            attr->stream->real_precision, eptr);
     *pbuf++ = ' ';
-    pbuf = HPDF_FToA (pbuf, (HPDF_REAL)y2, eptr);
+    pbuf = HPDF_FToA2 (pbuf, (HPDF_REAL)y2,
+            attr->stream->real_precision, eptr);
     *pbuf++ = ' ';
-    pbuf = HPDF_FToA (pbuf, (HPDF_REAL)x3, eptr);
+    pbuf = HPDF_FToA2 (pbuf, (HPDF_REAL)x3,
+            attr->stream->real_precision, eptr);
     *pbuf++ = ' ';
-    pbuf = HPDF_FToA (pbuf, (HPDF_REAL)y3, eptr);
+    pbuf = HPDF_FToA2 (pbuf, (HPDF_REAL)y3,
+            attr->stream->real_precision, eptr);
     HPDF_StrCpy (pbuf, " c\012", eptr);
 
     if ((ret = HPDF_Stream_WriteStr (attr->stream, buf)) != HPDF_OK)
@@ -2452,19 +2811,21 @@ HPDF_Page_TextRect  (HPDF_Page            page,
                 attr->gstate->text_leading;
     bottom = bottom - bbox.bottom / 1000 * attr->gstate->font_size;
 
-    if (align == HPDF_TALIGN_JUSTIFY) {
-        save_char_space = attr->gstate->char_space;
-        attr->gstate->char_space = 0;
-    }
+    save_char_space = attr->gstate->char_space;
 
     for (;;) {
         HPDF_REAL x, y;
         HPDF_UINT line_len, tmp_len;
         HPDF_REAL rw;
         HPDF_BOOL LineBreak;
+        HPDF_REAL char_space = attr->gstate->char_space;
 
+        /* lines are measured without character spacing. the gstate keeps
+         * the value of the last Tc written, which the optimization of
+         * the content relies on. */
         attr->gstate->char_space = 0;
         line_len = tmp_len = HPDF_Page_MeasureText (page, ptr, right - left, HPDF_TRUE, &rw);
+        attr->gstate->char_space = char_space;
         if (line_len == 0) {
             is_insufficient_space = HPDF_TRUE;
             break;
@@ -2555,7 +2916,7 @@ HPDF_Page_TextRect  (HPDF_Page            page,
                 }
         }
 
-        if (InternalShowTextNextLine (page, ptr, tmp_len) != HPDF_OK)
+        if (InternalShowTextNextLine (page, ptr, tmp_len, rw) != HPDF_OK)
             return HPDF_CheckError (page->error);
 
         if (num_rest <= 0)
@@ -2581,14 +2942,186 @@ HPDF_Page_TextRect  (HPDF_Page            page,
 }
 
 
+/*
+ *  HPDF_Page_ShowTextLayout
+ *
+ *  Shows the lines of a layout from first_line on inside the rectangle, in
+ *  the same way as HPDF_Page_TextRect. The font, font size and spacing of
+ *  the page are set to the ones the layout was measured with. When the
+ *  rectangle is full, HPDF_PAGE_INSUFFICIENT_SPACE is returned and
+ *  next_line receives the index of the first line which was not shown, to
+ *  continue in another rectangle or on another page.
+ */
+HPDF_EXPORT(HPDF_STATUS)
+HPDF_Page_ShowTextLayout  (HPDF_Page            page,
+                           HPDF_TextLayout      layout,
+                           HPDF_UINT            first_line,
+                           HPDF_REAL            left,
+                           HPDF_REAL            top,
+                           HPDF_REAL            right,
+                           HPDF_REAL            bottom,
+                           HPDF_TextAlignment   align,
+                           HPDF_UINT           *next_line)
+{
+    HPDF_STATUS ret = HPDF_Page_CheckState (page, HPDF_GMODE_TEXT_OBJECT);
+    HPDF_PageAttr attr;
+    HPDF_BOOL pos_initialized = HPDF_FALSE;
+    HPDF_BOOL is_insufficient_space = HPDF_FALSE;
+    HPDF_BOOL char_space_changed = HPDF_FALSE;
+    HPDF_Box bbox;
+    HPDF_UINT i;
+
+    HPDF_PTRACE ((" HPDF_Page_ShowTextLayout\n"));
+
+    if (ret != HPDF_OK)
+        return ret;
+
+    if (next_line)
+        *next_line = first_line;
+
+    if (!layout)
+        return HPDF_RaiseError (page->error, HPDF_INVALID_PARAMETER, 0);
+
+    if (first_line >= layout->num_lines)
+        return HPDF_OK;
+
+    attr = (HPDF_PageAttr )page->attr;
+
+    /* show the text with the state it was measured with */
+    if (attr->gstate->font != layout->font ||
+            attr->gstate->font_size != layout->font_size) {
+        if ((ret = HPDF_Page_SetFontAndSize (page, layout->font,
+                        layout->font_size)) != HPDF_OK)
+            return ret;
+    }
+
+    if (attr->gstate->char_space != layout->char_space) {
+        if ((ret = HPDF_Page_SetCharSpace (page, layout->char_space))
+                != HPDF_OK)
+            return ret;
+    }
+
+    if (attr->gstate->word_space != layout->word_space) {
+        if ((ret = HPDF_Page_SetWordSpace (page, layout->word_space))
+                != HPDF_OK)
+            return ret;
+    }
+
+    bbox = HPDF_Font_GetBBox (layout->font);
+
+    if (attr->gstate->text_leading == 0)
+        HPDF_Page_SetTextLeading (page, (bbox.top - bbox.bottom) / 1000 *
+                attr->gstate->font_size);
+
+    top = top - bbox.top / 1000 * attr->gstate->font_size +
+                attr->gstate->text_leading;
+    bottom = bottom - bbox.bottom / 1000 * attr->gstate->font_size;
+
+    for (i = first_line; i < layout->num_lines; ) {
+        const HPDF_TextLine *line = layout->lines + i;
+        HPDF_REAL tw = line->width;
+        HPDF_REAL x, y;
+
+        switch (align) {
+
+            case HPDF_TALIGN_RIGHT:
+                TextPos_AbsToRel (attr->text_matrix, right - line->width, top,
+                        &x, &y);
+                if (!pos_initialized) {
+                    pos_initialized = HPDF_TRUE;
+                } else {
+                    y = 0;
+                }
+                if ((ret = HPDF_Page_MoveTextPos (page, x, y)) != HPDF_OK)
+                    return ret;
+                break;
+
+            case HPDF_TALIGN_CENTER:
+                TextPos_AbsToRel (attr->text_matrix, left + (right - left -
+                        line->width) / 2, top, &x, &y);
+                if (!pos_initialized) {
+                    pos_initialized = HPDF_TRUE;
+                } else {
+                    y = 0;
+                }
+                if ((ret = HPDF_Page_MoveTextPos (page, x, y)) != HPDF_OK)
+                    return ret;
+                break;
+
+            case HPDF_TALIGN_JUSTIFY:
+                if (!pos_initialized) {
+                    pos_initialized = HPDF_TRUE;
+                    TextPos_AbsToRel (attr->text_matrix, left, top, &x, &y);
+                    if ((ret = HPDF_Page_MoveTextPos (page, x, y)) != HPDF_OK)
+                        return ret;
+                }
+
+                /* Do not justify last line of paragraph or text. */
+                if (line->line_break || line->numchars < 2) {
+                    if (char_space_changed) {
+                        if ((ret = HPDF_Page_SetCharSpace (page,
+                                        layout->char_space)) != HPDF_OK)
+                            return ret;
+                        char_space_changed = HPDF_FALSE;
+                    }
+                } else {
+                    HPDF_REAL x_adjust = (right - left - line->width) /
+                            (line->numchars - 1);
+
+                    if ((ret = HPDF_Page_SetCharSpace (page,
+                                    layout->char_space + x_adjust)) != HPDF_OK)
+                        return ret;
+                    char_space_changed = HPDF_TRUE;
+                    tw = right - left;
+                }
+                break;
+
+            default:
+                if (!pos_initialized) {
+                    pos_initialized = HPDF_TRUE;
+                    TextPos_AbsToRel (attr->text_matrix, left, top, &x, &y);
+                    if ((ret = HPDF_Page_MoveTextPos (page, x, y)) != HPDF_OK)
+                        return ret;
+                }
+        }
+
+        if (InternalShowTextNextLine (page, layout->text + line->start,
+                    line->len, tw) != HPDF_OK)
+            return HPDF_CheckError (page->error);
+
+        i++;
+
+        if (i < layout->num_lines &&
+                attr->text_pos.y - attr->gstate->text_leading < bottom) {
+            is_insufficient_space = HPDF_TRUE;
+            break;
+        }
+    }
+
+    if (char_space_changed) {
+        if ((ret = HPDF_Page_SetCharSpace (page, layout->char_space))
+                != HPDF_OK)
+            return ret;
+    }
+
+    if (next_line)
+        *next_line = i;
+
+    if (is_insufficient_space)
+        return HPDF_PAGE_INSUFFICIENT_SPACE;
+    else
+        return HPDF_OK;
+}
+
+
 static HPDF_STATUS
 InternalShowTextNextLine  (HPDF_Page    page,
                            const char  *text,
-                           HPDF_UINT    len)
+                           HPDF_UINT    len,
+                           HPDF_REAL    tw)
 {
     HPDF_STATUS ret;
     HPDF_PageAttr attr;
-    HPDF_REAL tw;
     HPDF_FontAttr font_attr;
 
     HPDF_PTRACE ((" ShowTextNextLine\n"));
@@ -2614,8 +3147,6 @@ InternalShowTextNextLine  (HPDF_Page    page,
     if ((ret = HPDF_Stream_WriteStr (attr->stream, " \'\012")) != HPDF_OK)
         return ret;
 
-    tw = HPDF_Page_TextWidth (page, text);
-
     /* calculate the reference point of text */
     attr->text_matrix.x -= attr->gstate->text_leading * attr->text_matrix.c;
     attr->text_matrix.y -= attr->gstate->text_leading * attr->text_matrix.d;
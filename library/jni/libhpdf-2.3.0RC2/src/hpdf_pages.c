@@ -245,7 +245,7 @@ Page_BeforeWrite  (HPDF_Dict    obj)
     }
 
     if (attr->gstate)
-        while (attr->gstate->prev) {
+        while (attr->gstate->depth > 1) {
             if ((ret = HPDF_Page_GRestore (page)) != HPDF_OK)
                 return ret;
         }
@@ -329,17 +329,21 @@ HPDF_Page_New  (HPDF_MMgr   mmgr,
     attr->gmode = HPDF_GMODE_PAGE_DESCRIPTION;
     attr->cur_pos = HPDF_ToPoint (0, 0);
     attr->text_pos = HPDF_ToPoint (0, 0);
+    attr->doc_mmgr = mmgr;
 
     ret = HPDF_Xref_Add (xref, page);
     if (ret != HPDF_OK)
         return NULL;
 
-    attr->gstate = HPDF_GState_New (page->mmgr, NULL);
+    attr->gstate = HPDF_GStateStack_Init (page->mmgr, &attr->gstate_stack);
     attr->contents = HPDF_DictStream_New (page->mmgr, xref);
 
     if (!attr->gstate || !attr->contents)
         return NULL;
 
+    /* the contents are only appended to, so the bytes of a finished page
+     * are kept by the xref after it is saved. */
+    attr->contents->header.obj_id |= HPDF_OTYPE_FINAL;
     attr->stream = attr->contents->stream;
     attr->xref = xref;
 
@@ -368,8 +372,7 @@ Page_OnFree  (HPDF_Dict  obj)
     HPDF_PTRACE((" HPDF_Page_OnFree\n"));
 
     if (attr) {
-        if (attr->gstate)
-            HPDF_GState_Free (obj->mmgr, attr->gstate);
+        HPDF_GStateStack_Free (obj->mmgr, &attr->gstate_stack);
 
         HPDF_FreeMem (obj->mmgr, attr);
     }
@@ -427,7 +430,7 @@ HPDF_Page_GetInheritableItem  (HPDF_Page          page,
     if (!obj) {
         HPDF_Pages pages = HPDF_Dict_GetItem (page, "Parent", HPDF_OCLASS_DICT);
         while (pages) {
-            obj = HPDF_Dict_GetItem (page, key, obj_class);
+            obj = HPDF_Dict_GetItem (pages, key, obj_class);
 
             if (obj)
                 break;
@@ -440,6 +443,145 @@ HPDF_Page_GetInheritableItem  (HPDF_Page          page,
 }
 
 
+HPDF_STATUS
+HPDF_Page_InheritResources  (HPDF_Page   page,
+                             HPDF_Pages  pages)
+{
+    HPDF_STATUS ret;
+
+    HPDF_PTRACE((" HPDF_Page_InheritResources\n"));
+
+    /* the resource dictionary of pages is shared by all pages below it
+     * which have no resource dictionary of their own.
+     */
+    if (!HPDF_Dict_GetItem (pages, "Resources", HPDF_OCLASS_DICT) &&
+            (ret = AddResource (pages)) != HPDF_OK)
+        return ret;
+
+    return HPDF_Dict_RemoveElement (page, "Resources");
+}
+
+
+/*
+ *  HPDF_Page_InitCopy
+ *
+ *  Makes page, into which HPDF_Dict_CopyFrom copied the elements of src,
+ *  a page which continues where src ended: it gets the graphics state of
+ *  src and a new contents stream, which is drawn after the contents of
+ *  src. The current font is left unset, since the font of src may not
+ *  be used by the document of page.
+ */
+HPDF_STATUS
+HPDF_Page_InitCopy  (HPDF_Page  page,
+                     HPDF_Page  src,
+                     HPDF_Xref  xref)
+{
+    HPDF_PageAttr src_attr = (HPDF_PageAttr)src->attr;
+    HPDF_PageAttr attr;
+    HPDF_Array contents;
+    HPDF_STATUS ret = HPDF_OK;
+
+    HPDF_PTRACE((" HPDF_Page_InitCopy\n"));
+
+    attr = HPDF_GetMem (page->mmgr, sizeof(HPDF_PageAttr_Rec));
+    if (!attr)
+        return HPDF_Error_GetCode (page->error);
+
+    HPDF_MemCpy ((HPDF_BYTE *)attr, (HPDF_BYTE *)src_attr,
+            sizeof(HPDF_PageAttr_Rec));
+    attr->gstate_stack.states = NULL;
+    attr->gstate_stack.size = 0;
+
+    page->attr = attr;
+    page->free_fn = Page_OnFree;
+
+    attr->parent = HPDF_Dict_GetItem (page, "Parent", HPDF_OCLASS_DICT);
+    attr->gmode = HPDF_GMODE_PAGE_DESCRIPTION;
+    attr->xref = xref;
+    attr->doc_mmgr = page->mmgr;
+
+    /* looked up again in the copied resources when they are used. */
+    attr->fonts = NULL;
+    attr->xobjects = NULL;
+    attr->ext_gstates = NULL;
+
+    attr->gstate = HPDF_GStateStack_Init (page->mmgr, &attr->gstate_stack);
+    if (!attr->gstate)
+        return HPDF_Error_GetCode (page->error);
+
+    *attr->gstate = *src_attr->gstate;
+    attr->gstate->font = NULL;
+
+    attr->contents = HPDF_DictStream_New (page->mmgr, xref);
+    if (!attr->contents)
+        return HPDF_Error_GetCode (page->error);
+
+    attr->contents->header.obj_id |= HPDF_OTYPE_FINAL;
+    attr->contents->filter = src_attr->contents->filter;
+    attr->stream = attr->contents->stream;
+    attr->stream->real_precision = src_attr->stream->real_precision;
+
+    contents = HPDF_Array_New (page->mmgr);
+    if (!contents)
+        return HPDF_Error_GetCode (page->error);
+
+    ret += HPDF_Dict_Add (page, "Contents", contents);
+    ret += HPDF_Array_Add (contents, src_attr->contents);
+    ret += HPDF_Array_Add (contents, attr->contents);
+
+    if (ret != HPDF_OK)
+        return HPDF_Error_GetCode (page->error);
+
+    return HPDF_OK;
+}
+
+
+/*
+ *  HPDF_Page_Finish
+ *
+ *  Ends the page description of page, as it is ended when the page is
+ *  written, and compresses the contents if they are to be compressed, so
+ *  that this work is done by the calling thread rather than when the
+ *  document is saved. Nothing can be drawn on the page afterwards.
+ */
+HPDF_STATUS
+HPDF_Page_Finish  (HPDF_Page  page)
+{
+    HPDF_PageAttr attr = (HPDF_PageAttr)page->attr;
+    HPDF_Stream data;
+    HPDF_STATUS ret;
+
+    HPDF_PTRACE((" HPDF_Page_Finish\n"));
+
+    if ((ret = Page_BeforeWrite (page)) != HPDF_OK)
+        return ret;
+
+    /* the operators check the graphics mode, and none is allowed in 0. */
+    attr->gmode = 0;
+
+    if (!(attr->contents->filter & HPDF_STREAM_FILTER_FLATE_DECODE) ||
+            (attr->contents->filter & HPDF_STREAM_FILTER_ENCODED))
+        return HPDF_OK;
+
+    data = HPDF_MemStream_New (page->mmgr, HPDF_STREAM_BUF_SIZ);
+    if (!data)
+        return HPDF_Error_GetCode (page->error);
+
+    if ((ret = HPDF_Stream_WriteToStream (attr->stream, data,
+                    attr->contents->filter, NULL)) != HPDF_OK) {
+        HPDF_Stream_Free (data);
+        return ret;
+    }
+
+    HPDF_Stream_Free (attr->contents->stream);
+    attr->contents->stream = data;
+    attr->contents->filter |= HPDF_STREAM_FILTER_ENCODED;
+    attr->stream = data;
+
+    return HPDF_OK;
+}
+
+
 HPDF_STATUS
 AddResource  (HPDF_Page  page)
 {
@@ -501,12 +643,16 @@ HPDF_Page_GetLocalFontName  (HPDF_Page  page,
         if (!resources)
             return NULL;
 
-        fonts = HPDF_Dict_New (page->mmgr);
-        if (!fonts)
-            return NULL;
+        /* the resources may be shared with other pages. */
+        fonts = HPDF_Dict_GetItem (resources, "Font", HPDF_OCLASS_DICT);
+        if (!fonts) {
+            fonts = HPDF_Dict_New (page->mmgr);
+            if (!fonts)
+                return NULL;
 
-        if (HPDF_Dict_Add (resources, "Font", fonts) != HPDF_OK)
-            return NULL;
+            if (HPDF_Dict_Add (resources, "Font", fonts) != HPDF_OK)
+                return NULL;
+        }
 
         attr->fonts = fonts;
     }
@@ -590,12 +736,16 @@ HPDF_Page_GetXObjectName  (HPDF_Page     page,
         if (!resources)
             return NULL;
 
-        xobjects = HPDF_Dict_New (page->mmgr);
-        if (!xobjects)
-            return NULL;
+        /* the resources may be shared with other pages. */
+        xobjects = HPDF_Dict_GetItem (resources, "XObject", HPDF_OCLASS_DICT);
+        if (!xobjects) {
+            xobjects = HPDF_Dict_New (page->mmgr);
+            if (!xobjects)
+                return NULL;
 
-        if (HPDF_Dict_Add (resources, "XObject", xobjects) != HPDF_OK)
-            return NULL;
+            if (HPDF_Dict_Add (resources, "XObject", xobjects) != HPDF_OK)
+                return NULL;
+        }
 
         attr->xobjects = xobjects;
     }
@@ -641,12 +791,16 @@ HPDF_Page_GetExtGStateName  (HPDF_Page       page,
         if (!resources)
             return NULL;
 
-        ext_gstates = HPDF_Dict_New (page->mmgr);
-        if (!ext_gstates)
-            return NULL;
+        /* the resources may be shared with other pages. */
+        ext_gstates = HPDF_Dict_GetItem (resources, "ExtGState", HPDF_OCLASS_DICT);
+        if (!ext_gstates) {
+            ext_gstates = HPDF_Dict_New (page->mmgr);
+            if (!ext_gstates)
+                return NULL;
 
-        if (HPDF_Dict_Add (resources, "ExtGState", ext_gstates) != HPDF_OK)
-            return NULL;
+            if (HPDF_Dict_Add (resources, "ExtGState", ext_gstates) != HPDF_OK)
+                return NULL;
+        }
 
         attr->ext_gstates = ext_gstates;
     }
@@ -660,9 +814,15 @@ HPDF_Page_GetExtGStateName  (HPDF_Page       page,
         char ext_gstate_name[HPDF_LIMIT_MAX_NAME_LEN + 1];
         char *ptr;
         char *end_ptr = ext_gstate_name + HPDF_LIMIT_MAX_NAME_LEN;
-
-        ptr = (char *)HPDF_StrCpy (ext_gstate_name, "E", end_ptr);
-        HPDF_IToA (ptr, attr->ext_gstates->list->count + 1, end_ptr);
+        const char *shared_name = HPDF_ExtGState_GetSharedName (state);
+
+        /* an interned ext-gstate has the same name on every page. */
+        if (shared_name)
+            HPDF_StrCpy (ext_gstate_name, shared_name, end_ptr);
+        else {
+            ptr = (char *)HPDF_StrCpy (ext_gstate_name, "E", end_ptr);
+            HPDF_IToA (ptr, attr->ext_gstates->list->count + 1, end_ptr);
+        }
 
         if (HPDF_Dict_Add (attr->ext_gstates, ext_gstate_name, state) != HPDF_OK)
             return NULL;
@@ -774,6 +934,277 @@ HPDF_Page_MeasureText  (HPDF_Page          page,
 }
 
 
+static HPDF_UINT
+FirstCharLen  (HPDF_Encoder      encoder,
+               const HPDF_BYTE  *text,
+               HPDF_UINT         len)
+{
+    HPDF_ParseText_Rec state;
+    HPDF_UINT n = 1;
+
+    if (encoder->type != HPDF_ENCODER_TYPE_DOUBLE_BYTE)
+        return 1;
+
+    HPDF_Encoder_SetParseText (encoder, &state, text, len);
+    HPDF_Encoder_ByteType (encoder, &state);
+    while (n < len &&
+            HPDF_Encoder_ByteType (encoder, &state) == HPDF_BYTE_TYPE_TRIAL)
+        n++;
+
+    return n;
+}
+
+
+static HPDF_STATUS
+TextLayout_AddLine  (HPDF_TextLayout       layout,
+                     const HPDF_TextLine  *line)
+{
+    if (layout->num_lines >= layout->lines_siz) {
+        HPDF_UINT new_siz = (layout->lines_siz == 0) ?
+                HPDF_DEF_ITEMS_PER_BLOCK : layout->lines_siz * 2;
+        HPDF_TextLine *new_lines = (HPDF_TextLine *)HPDF_GetMem (layout->mmgr,
+                sizeof (HPDF_TextLine) * new_siz);
+
+        if (!new_lines)
+            return HPDF_Error_GetCode (layout->error);
+
+        if (layout->lines) {
+            HPDF_MemCpy ((HPDF_BYTE *)new_lines, (HPDF_BYTE *)layout->lines,
+                    sizeof (HPDF_TextLine) * layout->num_lines);
+            HPDF_FreeMem (layout->mmgr, layout->lines);
+        }
+
+        layout->lines = new_lines;
+        layout->lines_siz = new_siz;
+    }
+
+    layout->lines[layout->num_lines++] = *line;
+
+    return HPDF_OK;
+}
+
+
+/*
+ *  HPDF_Page_LayoutText
+ *
+ *  Breaks the text into lines of the given width with the current font,
+ *  font size, character spacing and word spacing of the page. Every glyph
+ *  is measured once; HPDF_Page_ShowTextLayout shows the lines without
+ *  measuring them again. Unlike HPDF_Page_TextRect the text is not limited
+ *  to HPDF_LIMIT_MAX_STRING_LEN bytes, and a word wider than a line is
+ *  broken between characters.
+ *
+ *  The layout keeps a copy of the text and has to be released with
+ *  HPDF_TextLayout_Free.
+ */
+HPDF_EXPORT(HPDF_TextLayout)
+HPDF_Page_LayoutText  (HPDF_Page    page,
+                       const char  *text,
+                       HPDF_UINT    len,
+                       HPDF_REAL    width)
+{
+    HPDF_PageAttr attr;
+    HPDF_FontAttr font_attr;
+    HPDF_TextLayout layout;
+    HPDF_UINT pos = 0;
+
+    HPDF_PTRACE((" HPDF_Page_LayoutText\n"));
+
+    if (!HPDF_Page_Validate (page))
+        return NULL;
+
+    attr = (HPDF_PageAttr )page->attr;
+
+    /* no font exists */
+    if (!attr->gstate->font) {
+        HPDF_RaiseError (page->error, HPDF_PAGE_FONT_NOT_FOUND, 0);
+        return NULL;
+    }
+
+    if (!text && len > 0) {
+        HPDF_RaiseError (page->error, HPDF_INVALID_PARAMETER, 0);
+        return NULL;
+    }
+
+    font_attr = (HPDF_FontAttr)attr->gstate->font->attr;
+
+    layout = (HPDF_TextLayout)HPDF_GetMem (page->mmgr,
+            sizeof (HPDF_TextLayout_Rec));
+    if (!layout) {
+        HPDF_CheckError (page->error);
+        return NULL;
+    }
+
+    HPDF_MemSet (layout, 0, sizeof (HPDF_TextLayout_Rec));
+    layout->mmgr = page->mmgr;
+    layout->error = page->error;
+    layout->font = attr->gstate->font;
+    layout->font_size = attr->gstate->font_size;
+    layout->char_space = attr->gstate->char_space;
+    layout->word_space = attr->gstate->word_space;
+    layout->width = width;
+    layout->text_len = len;
+
+    layout->text = (char *)HPDF_GetMem (page->mmgr, len + 1);
+    if (!layout->text) {
+        HPDF_TextLayout_Free (layout);
+        HPDF_CheckError (page->error);
+        return NULL;
+    }
+
+    HPDF_MemCpy ((HPDF_BYTE *)layout->text, (const HPDF_BYTE *)text, len);
+    layout->text[len] = 0;
+
+    while (pos < len) {
+        const HPDF_BYTE *p = (const HPDF_BYTE *)layout->text + pos;
+        HPDF_TextLine line;
+        HPDF_REAL rw = 0;
+        HPDF_UINT line_len;
+        HPDF_UINT i;
+
+        HPDF_Font_LockWidths (layout->font);
+
+        line_len = font_attr->measure_text_fn (layout->font, p, len - pos,
+                width, layout->font_size, layout->char_space,
+                layout->word_space, HPDF_TRUE, &rw);
+
+        if (line_len == 0) {
+            /* the first word is wider than the line */
+            line_len = font_attr->measure_text_fn (layout->font, p, len - pos,
+                    width, layout->font_size, layout->char_space,
+                    layout->word_space, HPDF_FALSE, &rw);
+
+            if (line_len == 0) {
+                HPDF_TextWidth tw;
+
+                /* even one character does not fit; show it anyway */
+                line_len = FirstCharLen (font_attr->encoder, p, len - pos);
+                tw = font_attr->text_width_fn (layout->font, p, line_len);
+                rw = (HPDF_REAL)tw.width * layout->font_size / 1000;
+            }
+        }
+
+        HPDF_Font_UnlockWidths (layout->font);
+
+        line.start = pos;
+        line.next = pos + line_len;
+        line.width = rw;
+        line.numchars = 0;
+        line.numspace = 0;
+        line.line_break = (line.next >= len);
+
+        /* Shorten the line by trailing white space and control characters. */
+        while (line_len > 0 && HPDF_IS_WHITE_SPACE(p[line_len - 1])) {
+            line_len--;
+            if (p[line_len] == 0x0A || p[line_len] == 0x0D)
+                line.line_break = HPDF_TRUE;
+        }
+        line.len = line_len;
+
+        /* count the characters, which are needed for justification. */
+        if (font_attr->encoder->type == HPDF_ENCODER_TYPE_DOUBLE_BYTE) {
+            HPDF_ParseText_Rec state;
+
+            HPDF_Encoder_SetParseText (font_attr->encoder, &state, p,
+                    line_len);
+            for (i = 0; i < line_len; i++) {
+                HPDF_ByteType btype = HPDF_Encoder_ByteType (
+                        font_attr->encoder, &state);
+
+                if (btype != HPDF_BYTE_TYPE_TRIAL) {
+                    line.numchars++;
+                    if (HPDF_IS_WHITE_SPACE(p[i]))
+                        line.numspace++;
+                }
+            }
+        } else {
+            line.numchars = line_len;
+            for (i = 0; i < line_len; i++)
+                if (HPDF_IS_WHITE_SPACE(p[i]))
+                    line.numspace++;
+        }
+
+        if (TextLayout_AddLine (layout, &line) != HPDF_OK) {
+            HPDF_TextLayout_Free (layout);
+            HPDF_CheckError (page->error);
+            return NULL;
+        }
+
+        pos = line.next;
+    }
+
+    return layout;
+}
+
+
+HPDF_EXPORT(HPDF_UINT)
+HPDF_TextLayout_GetLineCount  (HPDF_TextLayout  layout)
+{
+    HPDF_PTRACE((" HPDF_TextLayout_GetLineCount\n"));
+
+    if (!layout)
+        return 0;
+
+    return layout->num_lines;
+}
+
+
+HPDF_EXPORT(HPDF_TextLine)
+HPDF_TextLayout_GetLine  (HPDF_TextLayout  layout,
+                          HPDF_UINT        index)
+{
+    HPDF_TextLine line = {0, 0, 0, 0, 0, 0, HPDF_FALSE};
+
+    HPDF_PTRACE((" HPDF_TextLayout_GetLine\n"));
+
+    if (!layout)
+        return line;
+
+    if (index >= layout->num_lines) {
+        HPDF_SetError (layout->error, HPDF_INVALID_PARAMETER, 0);
+        return line;
+    }
+
+    return layout->lines[index];
+}
+
+
+/*
+ *  HPDF_TextLayout_GetText
+ *
+ *  Returns the copy of the text held by the layout. The start and len
+ *  fields of each HPDF_TextLine are offsets into this buffer.
+ */
+HPDF_EXPORT(const char*)
+HPDF_TextLayout_GetText  (HPDF_TextLayout  layout)
+{
+    HPDF_PTRACE((" HPDF_TextLayout_GetText\n"));
+
+    if (!layout)
+        return NULL;
+
+    return layout->text;
+}
+
+
+HPDF_EXPORT(void)
+HPDF_TextLayout_Free  (HPDF_TextLayout  layout)
+{
+    HPDF_PTRACE((" HPDF_TextLayout_Free\n"));
+
+    if (!layout)
+        return;
+
+    if (layout->lines)
+        HPDF_FreeMem (layout->mmgr, layout->lines);
+
+    if (layout->text)
+        HPDF_FreeMem (layout->mmgr, layout->text);
+
+    HPDF_FreeMem (layout->mmgr, layout);
+}
+
+
 HPDF_EXPORT(HPDF_REAL)
 HPDF_Page_GetWidth  (HPDF_Page    page)
 {
@@ -1973,3 +2404,29 @@ HPDF_Page_SetFilter  (HPDF_Page    page,
     attr->contents->filter = filter;
 }
 
+
+void
+HPDF_Page_SetRealPrecision  (HPDF_Page    page,
+                             HPDF_UINT    precision)
+{
+    HPDF_PageAttr attr;
+
+    HPDF_PTRACE((" HPDF_Page_SetRealPrecision\n"));
+
+    attr = (HPDF_PageAttr)page->attr;
+    attr->stream->real_precision = precision;
+}
+
+
+void
+HPDF_Page_SetOptimizeContent  (HPDF_Page    page,
+                               HPDF_BOOL    optimize)
+{
+    HPDF_PageAttr attr;
+
+    HPDF_PTRACE((" HPDF_Page_SetOptimizeContent\n"));
+
+    attr = (HPDF_PageAttr)page->attr;
+    attr->optimize_content = optimize;
+}
+
@@ -14,11 +14,6 @@
  * It is provided "as is" without express or implied warranty.
  *
  */
-/* This is used to avoid warnings on 'ctime' when compiling in MSVC 9 */
-#ifndef _CRT_SECURE_NO_WARNINGS
-#define _CRT_SECURE_NO_WARNINGS
-#endif
-
 #include <time.h>
 #include "hpdf_utils.h"
 #include "hpdf.h"
@@ -188,13 +183,13 @@ HPDF_STATUS
 HPDF_PDFA_GenerateID(HPDF_Doc pdf)
 {
     HPDF_Array id;
-    HPDF_BYTE *currentTime;
     HPDF_BYTE idkey[HPDF_MD5_KEY_LEN];
     HPDF_MD5_CTX md5_ctx;
     time_t ltime; 
 
+    /* the time is hashed as it is, as in HPDF_EncryptDict_CreateID; the
+     * string of ctime is shared by all threads. */
     ltime = time(NULL); 
-    currentTime = (HPDF_BYTE *)ctime(&ltime);
         
     id = HPDF_Dict_GetItem(pdf->trailer, "ID", HPDF_OCLASS_ARRAY);
     if (!id) {
@@ -205,7 +200,7 @@ HPDF_PDFA_GenerateID(HPDF_Doc pdf)
        
        HPDF_MD5Init(&md5_ctx);
        HPDF_MD5Update(&md5_ctx, (HPDF_BYTE *) "libHaru", sizeof("libHaru") - 1);
-       HPDF_MD5Update(&md5_ctx, currentTime, HPDF_StrLen((const char *)currentTime, -1));
+       HPDF_MD5Update(&md5_ctx, (HPDF_BYTE *)&ltime, sizeof(ltime));
        HPDF_MD5Final(idkey, &md5_ctx);
        
        if (HPDF_Array_Add (id, HPDF_Binary_New (pdf->mmgr, idkey, HPDF_MD5_KEY_LEN)) != HPDF_OK)
@@ -21,6 +21,10 @@
 #ifndef UNDER_CE
 #include <errno.h>
 #endif
+#if !defined(_WIN32) && !defined(UNDER_CE)
+#include <stdlib.h>
+#include <unistd.h>
+#endif
 #ifndef HPDF_UNUSED
 #define HPDF_UNUSED(a) ((void)(a))
 #endif
@@ -43,7 +47,7 @@ HPDF_MemStream_WriteFunc  (HPDF_Stream      stream,
 
 HPDF_STATUS
 HPDF_MemStream_SeekFunc  (HPDF_Stream      stream,
-                          HPDF_INT         pos,
+                          HPDF_INT64       pos,
                           HPDF_WhenceMode  mode);
 
 
@@ -53,11 +57,11 @@ HPDF_MemStream_ReadFunc  (HPDF_Stream  stream,
                           HPDF_UINT    *size);
 
 
-HPDF_INT32
+HPDF_INT64
 HPDF_MemStream_TellFunc  (HPDF_Stream  stream);
 
 
-HPDF_UINT32
+HPDF_UINT64
 HPDF_MemStream_SizeFunc  (HPDF_Stream  stream);
 
 
@@ -75,6 +79,17 @@ HPDF_Stream_WriteToStreamWithDeflate  (HPDF_Stream  src,
                                        HPDF_Encrypt  e);
 
 
+static HPDF_STATUS
+InternalWriteBuffered  (HPDF_Stream      stream,
+                        const HPDF_BYTE  *ptr,
+                        HPDF_UINT        size);
+
+
+static HPDF_STATUS
+CopyFileStream  (HPDF_Stream  src,
+                 HPDF_Stream  dst);
+
+
 HPDF_STATUS
 HPDF_FileReader_ReadFunc  (HPDF_Stream  stream,
                           HPDF_BYTE    *ptr,
@@ -83,15 +98,15 @@ HPDF_FileReader_ReadFunc  (HPDF_Stream  stream,
 
 HPDF_STATUS
 HPDF_FileReader_SeekFunc  (HPDF_Stream      stream,
-                           HPDF_INT         pos,
+                           HPDF_INT64       pos,
                            HPDF_WhenceMode  mode);
 
 
-HPDF_INT32
+HPDF_INT64
 HPDF_FileStream_TellFunc  (HPDF_Stream  stream);
 
 
-HPDF_UINT32
+HPDF_UINT64
 HPDF_FileStream_SizeFunc  (HPDF_Stream  stream);
 
 
@@ -193,7 +208,7 @@ HPDF_Stream_ReadLn  (HPDF_Stream  stream,
                 }
 
                 if (read_size > 0)
-                    return HPDF_Stream_Seek (stream, 0 - read_size,
+                    return HPDF_Stream_Seek (stream, -(HPDF_INT64)read_size,
                                 HPDF_SEEK_CUR);
                 else
                     return HPDF_OK;
@@ -247,7 +262,10 @@ HPDF_Stream_Write  (HPDF_Stream      stream,
         return HPDF_THIS_FUNC_WAS_SKIPPED;
     */
 
-    ret = stream->write_fn(stream, ptr, size);
+    if (stream->wbuf)
+        ret = InternalWriteBuffered (stream, ptr, size);
+    else
+        ret = stream->write_fn(stream, ptr, size);
 
     if (ret != HPDF_OK)
         return ret;
@@ -258,6 +276,122 @@ HPDF_Stream_Write  (HPDF_Stream      stream,
 }
 
 
+/*
+ *  InternalWriteBuffered
+ *
+ *  Collects small writes in the write-combining buffer of the stream and
+ *  passes them to write_fn in blocks of wbuf_siz bytes. The buffer is
+ *  always topped up before it is flushed, and the part of a large write
+ *  which does not fit into the buffer is passed to write_fn directly.
+ *
+ */
+static HPDF_STATUS
+InternalWriteBuffered  (HPDF_Stream      stream,
+                        const HPDF_BYTE  *ptr,
+                        HPDF_UINT        size)
+{
+    HPDF_UINT rsize = stream->wbuf_siz - stream->wbuf_len;
+    HPDF_STATUS ret;
+
+    if (size < rsize) {
+        HPDF_MemCpy (stream->wbuf + stream->wbuf_len, ptr, size);
+        stream->wbuf_len += size;
+        return HPDF_OK;
+    }
+
+    HPDF_MemCpy (stream->wbuf + stream->wbuf_len, ptr, rsize);
+    ptr += rsize;
+    size -= rsize;
+
+    ret = stream->write_fn (stream, stream->wbuf, stream->wbuf_siz);
+    stream->wbuf_len = 0;
+    if (ret != HPDF_OK)
+        return ret;
+
+    if (size >= stream->wbuf_siz)
+        return stream->write_fn (stream, ptr, size);
+
+    HPDF_MemCpy (stream->wbuf, ptr, size);
+    stream->wbuf_len = size;
+
+    return HPDF_OK;
+}
+
+
+/*
+ *  HPDF_Stream_Flush
+ *
+ *  Passes the data kept in the write-combining buffer of the stream to
+ *  its writing function.
+ *
+ */
+HPDF_STATUS
+HPDF_Stream_Flush  (HPDF_Stream  stream)
+{
+    HPDF_STATUS ret;
+
+    HPDF_PTRACE((" HPDF_Stream_Flush\n"));
+
+    if (!stream->wbuf || stream->wbuf_len == 0)
+        return HPDF_OK;
+
+    ret = stream->write_fn (stream, stream->wbuf, stream->wbuf_len);
+    stream->wbuf_len = 0;
+
+    return ret;
+}
+
+
+/*
+ *  HPDF_Stream_SetWriteBuffer
+ *
+ *  stream : Pointer to a HPDF_Stream object.
+ *  buf_siz : Size of the write-combining buffer. 0 disables buffering.
+ *
+ *  Makes the stream collect written data and pass it to its writing
+ *  function in blocks of buf_siz bytes. It is available for file-writer
+ *  and callback-writer, not for memory-stream which is read back.
+ *  stream->size always counts the bytes written by HPDF_Stream_Write, so
+ *  the offsets of the cross-reference table are not affected.
+ *
+ *  The buffer is taken from the allocator of the memory manager, not from
+ *  its memory pool, which would keep it until the document is freed.
+ *
+ */
+HPDF_STATUS
+HPDF_Stream_SetWriteBuffer  (HPDF_Stream  stream,
+                             HPDF_UINT    buf_siz)
+{
+    HPDF_STATUS ret;
+
+    HPDF_PTRACE((" HPDF_Stream_SetWriteBuffer\n"));
+
+    if (!stream->write_fn || stream->type == HPDF_STREAM_MEMORY)
+        return HPDF_SetError (stream->error, HPDF_INVALID_OPERATION, 0);
+
+    if ((ret = HPDF_Stream_Flush (stream)) != HPDF_OK)
+        return ret;
+
+    if (stream->wbuf) {
+        stream->mmgr->free_fn (stream->wbuf);
+        stream->wbuf = NULL;
+        stream->wbuf_siz = 0;
+    }
+
+    if (buf_siz == 0)
+        return HPDF_OK;
+
+    stream->wbuf = (HPDF_BYTE *)stream->mmgr->alloc_fn (buf_siz);
+    if (!stream->wbuf)
+        return HPDF_SetError (stream->error, HPDF_FAILD_TO_ALLOC_MEM,
+                HPDF_NOERROR);
+
+    stream->wbuf_siz = buf_siz;
+
+    return HPDF_OK;
+}
+
+
 HPDF_STATUS
 HPDF_Stream_WriteChar  (HPDF_Stream  stream,
                         char    value)
@@ -306,7 +440,8 @@ HPDF_Stream_WriteReal  (HPDF_Stream  stream,
 {
     char buf[HPDF_REAL_LEN + 1];
 
-    char* p = HPDF_FToA(buf, value, buf + HPDF_REAL_LEN);
+    char* p = HPDF_FToA2(buf, value, stream->real_precision,
+            buf + HPDF_REAL_LEN);
 
     return HPDF_Stream_Write(stream, (HPDF_BYTE *)buf, (HPDF_UINT)(p - buf));
 }
@@ -317,6 +452,12 @@ HPDF_Stream_Free  (HPDF_Stream  stream)
     if (!stream)
         return;
 
+    if (stream->wbuf) {
+        HPDF_Stream_Flush (stream);
+        stream->mmgr->free_fn (stream->wbuf);
+        stream->wbuf = NULL;
+    }
+
     if (stream->free_fn)
         stream->free_fn(stream);
 
@@ -327,7 +468,7 @@ HPDF_Stream_Free  (HPDF_Stream  stream)
 
 HPDF_STATUS
 HPDF_Stream_Seek  (HPDF_Stream      stream,
-                   HPDF_INT         pos,
+                   HPDF_INT64       pos,
                    HPDF_WhenceMode  mode)
 {
     HPDF_PTRACE((" HPDF_Stream_Seek\n"));
@@ -342,7 +483,7 @@ HPDF_Stream_Seek  (HPDF_Stream      stream,
 }
 
 
-HPDF_INT32
+HPDF_INT64
 HPDF_Stream_Tell  (HPDF_Stream  stream)
 {
     HPDF_PTRACE((" HPDF_Stream_Tell\n"));
@@ -353,11 +494,13 @@ HPDF_Stream_Tell  (HPDF_Stream  stream)
     if (HPDF_Error_GetCode(stream->error) != 0)
         return HPDF_THIS_FUNC_WAS_SKIPPED;
 
-    return stream->tell_fn(stream);
+    /* the data in the write-combining buffer is not passed to the
+     * underlying writer yet */
+    return stream->tell_fn(stream) + stream->wbuf_len;
 }
 
 
-HPDF_UINT32
+HPDF_UINT64
 HPDF_Stream_Size  (HPDF_Stream  stream)
 {
     HPDF_PTRACE((" HPDF_Stream_Tell\n"));
@@ -377,13 +520,56 @@ HPDF_Stream_Size  (HPDF_Stream  stream)
 }
 
 
+/*
+ *  Bytes which have to be escaped in names and literal strings
+ *  (see HPDF_NEEDS_ESCAPE), indexed by the byte value.
+ */
+static const HPDF_BYTE HPDF_ESCAPE_TABLE[256] = {
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    0, 0, 0, 1, 0, 1, 0, 0, 1, 1, 0, 0, 0, 0, 0, 1,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1};
+
+
+/* two hexadecimal digits for each byte value */
+static const char HPDF_HEX_PAIRS[] =
+    "000102030405060708090A0B0C0D0E0F"
+    "101112131415161718191A1B1C1D1E1F"
+    "202122232425262728292A2B2C2D2E2F"
+    "303132333435363738393A3B3C3D3E3F"
+    "404142434445464748494A4B4C4D4E4F"
+    "505152535455565758595A5B5C5D5E5F"
+    "606162636465666768696A6B6C6D6E6F"
+    "707172737475767778797A7B7C7D7E7F"
+    "808182838485868788898A8B8C8D8E8F"
+    "909192939495969798999A9B9C9D9E9F"
+    "A0A1A2A3A4A5A6A7A8A9AAABACADAEAF"
+    "B0B1B2B3B4B5B6B7B8B9BABBBCBDBEBF"
+    "C0C1C2C3C4C5C6C7C8C9CACBCCCDCECF"
+    "D0D1D2D3D4D5D6D7D8D9DADBDCDDDEDF"
+    "E0E1E2E3E4E5E6E7E8E9EAEBECEDEEEF"
+    "F0F1F2F3F4F5F6F7F8F9FAFBFCFDFEFF";
+
+
 HPDF_STATUS
 HPDF_Stream_WriteEscapeName  (HPDF_Stream      stream,
                               const char  *value)
 {
     char tmp_char[HPDF_LIMIT_MAX_NAME_LEN * 3 + 2];
     HPDF_UINT len;
-    HPDF_INT i;
+    HPDF_UINT i;
     const HPDF_BYTE* pos1;
     char* pos2;
 
@@ -394,29 +580,20 @@ HPDF_Stream_WriteEscapeName  (HPDF_Stream      stream,
     pos2 = tmp_char;
 
     *pos2++ = '/';
-    for (i = 0; i < (HPDF_INT32)len; i++) {
+    for (i = 0; i < len; i++) {
         HPDF_BYTE c = *pos1++;
-        if (HPDF_NEEDS_ESCAPE(c)) {
+        if (HPDF_ESCAPE_TABLE[c]) {
+            const char *hex = HPDF_HEX_PAIRS + c * 2;
+
             *pos2++ = '#';
-            *pos2 = (char)(c >> 4);
-            if (*pos2 <= 9)
-                *pos2 += 0x30;
-            else
-                *pos2 += 0x41 - 10;
-            pos2++;
-
-            *pos2 = (char)(c & 0x0f);
-            if (*pos2 <= 9)
-                *pos2 += 0x30;
-            else
-                *pos2 += 0x41 - 10;
-            pos2++;
+            *pos2++ = hex[0];
+            *pos2++ = hex[1];
         } else
             *pos2++ = c;
     }
-    *pos2 = 0;
 
-    return HPDF_Stream_Write (stream, (HPDF_BYTE *)tmp_char, HPDF_StrLen(tmp_char, -1));
+    return HPDF_Stream_Write (stream, (HPDF_BYTE *)tmp_char,
+            (HPDF_UINT)(pos2 - tmp_char));
 }
 
 HPDF_STATUS
@@ -424,10 +601,10 @@ HPDF_Stream_WriteEscapeText2  (HPDF_Stream    stream,
                                const char    *text,
                                HPDF_UINT      len)
 {
-    char buf[HPDF_TEXT_DEFAULT_LEN];
+    char buf[HPDF_STREAM_BUF_SIZ];
     HPDF_UINT idx = 0;
-    HPDF_INT i;
-    const char* p = text;
+    const HPDF_BYTE* p = (const HPDF_BYTE *)text;
+    const HPDF_BYTE* end = p + len;
     HPDF_STATUS ret;
 
     HPDF_PTRACE((" HPDF_Stream_WriteEscapeText2\n"));
@@ -443,29 +620,47 @@ HPDF_Stream_WriteEscapeText2  (HPDF_Stream    stream,
 
     buf[idx++] = '(';
 
-    for (i = 0; i < (HPDF_INT)len; i++) {
-        HPDF_BYTE c = (HPDF_BYTE)*p++;
-        if (HPDF_NEEDS_ESCAPE(c)) {
-            buf[idx++] = '\\';
+    /* the buffer always keeps room for one escape sequence and ')' */
+    while (p < end) {
+        const HPDF_BYTE* run = p;
+        HPDF_UINT run_len;
 
-            buf[idx] = (char)(c >> 6);
-            buf[idx] += 0x30;
-            idx++;
-            buf[idx] = (char)((c & 0x38) >> 3);
-            buf[idx] += 0x30;
-            idx++;
-            buf[idx] = (char)(c & 0x07);
-            buf[idx] += 0x30;
-            idx++;
-        }
-        else
-            buf[idx++] = c;
+        /* copy the bytes up to the next one to be escaped in one go */
+        while (p < end && !HPDF_ESCAPE_TABLE[*p])
+            p++;
+        run_len = (HPDF_UINT)(p - run);
 
-        if (idx > HPDF_TEXT_DEFAULT_LEN - 4) {
+        if (idx + run_len > HPDF_STREAM_BUF_SIZ - 5) {
             ret = HPDF_Stream_Write (stream, (HPDF_BYTE *)buf, idx);
             if (ret != HPDF_OK)
                 return ret;
             idx = 0;
+
+            if (run_len > HPDF_STREAM_BUF_SIZ - 5) {
+                ret = HPDF_Stream_Write (stream, run, run_len);
+                if (ret != HPDF_OK)
+                    return ret;
+                run_len = 0;
+            }
+        }
+
+        HPDF_MemCpy ((HPDF_BYTE *)buf + idx, run, run_len);
+        idx += run_len;
+
+        if (p < end) {
+            HPDF_BYTE c = *p++;
+
+            buf[idx++] = '\\';
+            buf[idx++] = (char)((c >> 6) + 0x30);
+            buf[idx++] = (char)(((c & 0x38) >> 3) + 0x30);
+            buf[idx++] = (char)((c & 0x07) + 0x30);
+
+            if (idx > HPDF_STREAM_BUF_SIZ - 5) {
+                ret = HPDF_Stream_Write (stream, (HPDF_BYTE *)buf, idx);
+                if (ret != HPDF_OK)
+                    return ret;
+                idx = 0;
+            }
         }
     }
     buf[idx++] = ')';
@@ -494,64 +689,42 @@ HPDF_Stream_WriteBinary  (HPDF_Stream      stream,
                           HPDF_UINT        len,
                           HPDF_Encrypt     e)
 {
-    char buf[HPDF_TEXT_DEFAULT_LEN];
-    HPDF_BYTE ebuf[HPDF_TEXT_DEFAULT_LEN];
-    HPDF_BYTE *pbuf = NULL;
-    HPDF_BOOL flg = HPDF_FALSE;
-    HPDF_UINT idx = 0;
-    HPDF_UINT i;
-    const HPDF_BYTE* p;
+    char buf[HPDF_STREAM_BUF_SIZ];
+    HPDF_BYTE ebuf[HPDF_STREAM_BUF_SIZ / 2];
     HPDF_STATUS ret = HPDF_OK;
 
     HPDF_PTRACE((" HPDF_Stream_WriteBinary\n"));
 
-    if (e) {
-        if (len <= HPDF_TEXT_DEFAULT_LEN)
-            pbuf = ebuf;
-        else {
-            pbuf = (HPDF_BYTE *)HPDF_GetMem (stream->mmgr, len);
-            flg = HPDF_TRUE;
-        }
-
-        HPDF_Encrypt_CryptBuf (e, data, pbuf, len);
-        p = pbuf;
-    } else {
-        p = data;
-    }
-
-    for (i = 0; i < len; i++, p++) {
-        char c = (char)(*p >> 4);
+    /* encode at most half a buffer of input at a time; RC4 is a stream
+     * cipher, so the data can be encrypted in the same pieces.
+     */
+    while (len > 0) {
+        HPDF_UINT n = (len > HPDF_STREAM_BUF_SIZ / 2) ?
+                HPDF_STREAM_BUF_SIZ / 2 : len;
+        const HPDF_BYTE* p = data;
+        char* q = buf;
+        HPDF_UINT i;
 
-        if (c <= 9)
-            c += 0x30;
-        else
-            c += 0x41 - 10;
-        buf[idx++] = c;
+        if (e) {
+            HPDF_Encrypt_CryptBuf (e, data, ebuf, n);
+            p = ebuf;
+        }
 
-        c = (char)(*p & 0x0f);
-        if (c <= 9)
-            c += 0x30;
-        else
-            c += 0x41 - 10;
-        buf[idx++] = c;
+        for (i = 0; i < n; i++) {
+            const char *hex = HPDF_HEX_PAIRS + p[i] * 2;
 
-        if (idx > HPDF_TEXT_DEFAULT_LEN - 2) {
-            ret = HPDF_Stream_Write (stream, (HPDF_BYTE *)buf, idx);
-            if (ret != HPDF_OK) {
-                if (flg)
-                    HPDF_FreeMem (stream->mmgr, pbuf);
-                return ret;
-            }
-            idx = 0;
+            q[0] = hex[0];
+            q[1] = hex[1];
+            q += 2;
         }
-    }
 
-    if (idx > 0) {
-        ret = HPDF_Stream_Write (stream, (HPDF_BYTE *)buf, idx);
-    }
+        ret = HPDF_Stream_Write (stream, (HPDF_BYTE *)buf, n * 2);
+        if (ret != HPDF_OK)
+            return ret;
 
-    if (flg)
-        HPDF_FreeMem (stream->mmgr, pbuf);
+        data += n;
+        len -= n;
+    }
 
     return ret;
 }
@@ -712,7 +885,8 @@ HPDF_Stream_WriteToStream  (HPDF_Stream  src,
         return HPDF_OK;
 
 #ifndef LIBHPDF_HAVE_NOZLIB
-    if (filter & HPDF_STREAM_FILTER_FLATE_DECODE)
+    if ((filter & HPDF_STREAM_FILTER_FLATE_DECODE) &&
+            !(filter & HPDF_STREAM_FILTER_ENCODED))
         return HPDF_Stream_WriteToStreamWithDeflate (src, dst, e);
 #endif /* LIBHPDF_HAVE_NOZLIB */
 
@@ -720,6 +894,9 @@ HPDF_Stream_WriteToStream  (HPDF_Stream  src,
     if (ret != HPDF_OK)
         return ret;
 
+    if (src->type == HPDF_STREAM_FILE && !e)
+        return CopyFileStream (src, dst);
+
     flg = HPDF_FALSE;
     for (;;) {
         HPDF_UINT size = HPDF_STREAM_BUF_SIZ;
@@ -753,6 +930,55 @@ HPDF_Stream_WriteToStream  (HPDF_Stream  src,
     return HPDF_OK;
 }
 
+
+/*
+ *  CopyFileStream
+ *
+ *  Copies a file-backed stream (an embedded file, or image data left in
+ *  its file until the document is saved) to dst in blocks of
+ *  HPDF_FILE_COPY_BUF_SIZ bytes, which pass the write-combining buffer
+ *  of dst without being copied again.
+ */
+static HPDF_STATUS
+CopyFileStream  (HPDF_Stream  src,
+                 HPDF_Stream  dst)
+{
+    HPDF_STATUS ret = HPDF_OK;
+    HPDF_BYTE *buf;
+
+    HPDF_PTRACE((" CopyFileStream\n"));
+
+    buf = HPDF_GetMem (src->mmgr, HPDF_FILE_COPY_BUF_SIZ);
+    if (!buf)
+        return HPDF_Error_GetCode (src->error);
+
+    for (;;) {
+        HPDF_UINT size = HPDF_FILE_COPY_BUF_SIZ;
+
+        ret = HPDF_Stream_Read (src, buf, &size);
+        if (ret != HPDF_OK && ret != HPDF_STREAM_EOF)
+            break;
+
+        if (size > 0) {
+            HPDF_STATUS wret = HPDF_Stream_Write (dst, buf, size);
+
+            if (wret != HPDF_OK) {
+                ret = wret;
+                break;
+            }
+        }
+
+        if (ret == HPDF_STREAM_EOF) {
+            ret = HPDF_OK;
+            break;
+        }
+    }
+
+    HPDF_FreeMem (src->mmgr, buf);
+
+    return ret;
+}
+
 HPDF_Stream
 HPDF_FileReader_New  (HPDF_MMgr   mmgr,
                       const char  *fname)
@@ -777,6 +1003,7 @@ HPDF_FileReader_New  (HPDF_MMgr   mmgr,
         HPDF_MemSet(stream, 0, sizeof(HPDF_Stream_Rec));
         stream->sig_bytes = HPDF_STREAM_SIG_BYTES;
         stream->type = HPDF_STREAM_FILE;
+        stream->real_precision = HPDF_DEF_REAL_PRECISION;
         stream->error = mmgr->error;
         stream->mmgr = mmgr;
         stream->read_fn = HPDF_FileReader_ReadFunc;
@@ -807,10 +1034,12 @@ HPDF_FileReader_ReadFunc  (HPDF_Stream  stream,
 
     HPDF_PTRACE((" HPDF_FileReader_ReadFunc\n"));
 
-    HPDF_MemSet(ptr, 0, *siz);
     rsiz = HPDF_FREAD(ptr, 1, *siz, fp);
 
     if (rsiz != *siz) {
+        /* only the part which was not read is cleared */
+        HPDF_MemSet(ptr + rsiz, 0, *siz - rsiz);
+
         if (HPDF_FEOF(fp)) {
 
             *siz = rsiz;
@@ -844,7 +1073,7 @@ HPDF_FileReader_ReadFunc  (HPDF_Stream  stream,
 
 HPDF_STATUS
 HPDF_FileReader_SeekFunc  (HPDF_Stream     stream,
-                           HPDF_INT         pos,
+                           HPDF_INT64       pos,
                            HPDF_WhenceMode  mode)
 {
     HPDF_FILEP fp = (HPDF_FILEP)stream->attr;
@@ -863,7 +1092,12 @@ HPDF_FileReader_SeekFunc  (HPDF_Stream     stream,
             whence = SEEK_SET;
     }
 
-    if (HPDF_FSEEK (fp, pos, whence) != 0) {
+    /* the offsets of stdio may be narrower than the ones of streams */
+    if ((HPDF_INT64)(HPDF_FOFF)pos != pos)
+        return HPDF_SetError (stream->error, HPDF_STREAM_OFFSET_OUT_OF_RANGE,
+                0);
+
+    if (HPDF_FSEEK (fp, (HPDF_FOFF)pos, whence) != 0) {
         return HPDF_SetError (stream->error, HPDF_FILE_IO_ERROR, HPDF_FERROR(fp));
     }
 
@@ -871,10 +1105,10 @@ HPDF_FileReader_SeekFunc  (HPDF_Stream     stream,
 }
 
 
-HPDF_INT32
+HPDF_INT64
 HPDF_FileStream_TellFunc  (HPDF_Stream   stream)
 {
-    HPDF_INT32 ret;
+    HPDF_INT64 ret;
     HPDF_FILEP fp = (HPDF_FILEP)stream->attr;
 
     HPDF_PTRACE((" HPDF_FileReader_TellFunc\n"));
@@ -888,11 +1122,11 @@ HPDF_FileStream_TellFunc  (HPDF_Stream   stream)
 }
 
 
-HPDF_UINT32
+HPDF_UINT64
 HPDF_FileStream_SizeFunc  (HPDF_Stream   stream)
 {
-    HPDF_INT size;
-    HPDF_INT ptr;
+    HPDF_INT64 size;
+    HPDF_INT64 ptr;
     HPDF_FILEP fp = (HPDF_FILEP)stream->attr;
 
     HPDF_PTRACE((" HPDF_FileReader_SizeFunc\n"));
@@ -919,13 +1153,13 @@ HPDF_FileStream_SizeFunc  (HPDF_Stream   stream)
     }
 
     /* restore current file-pointer */
-    if (HPDF_FSEEK (fp, ptr, SEEK_SET) < 0) {
+    if (HPDF_FSEEK (fp, (HPDF_FOFF)ptr, SEEK_SET) < 0) {
         HPDF_SetError (stream->error, HPDF_FILE_IO_ERROR,
                 HPDF_FERROR(fp));
         return 0;
     }
 
-    return (HPDF_UINT32)size;
+    return (HPDF_UINT64)size;
 }
 
 
@@ -959,6 +1193,7 @@ HPDF_FileWriter_New  (HPDF_MMgr        mmgr,
         stream->tell_fn = HPDF_FileStream_TellFunc;
         stream->attr = fp;
         stream->type = HPDF_STREAM_FILE;
+        stream->real_precision = HPDF_DEF_REAL_PRECISION;
     }
 
     return stream;
@@ -1000,6 +1235,196 @@ HPDF_FileStream_FreeFunc  (HPDF_Stream  stream)
     stream->attr = NULL;
 }
 
+/*
+ *  memory budget of memory-streams.
+ *
+ *  the registered streams are kept in a list ordered by the time of their
+ *  last write. when the budget is exceeded, the streams at the tail of the
+ *  list are moved into temporary files, from which they are read back
+ *  when the document is saved.
+ */
+
+static void
+MemStream_BudgetUnlink  (HPDF_Stream  stream)
+{
+    HPDF_MemStreamAttr attr = (HPDF_MemStreamAttr)stream->attr;
+    HPDF_StreamBudget budget = attr->budget;
+
+    if (attr->prev)
+        ((HPDF_MemStreamAttr)attr->prev->attr)->next = attr->next;
+    else if (budget->head == stream)
+        budget->head = attr->next;
+    else
+        return;
+
+    if (attr->next)
+        ((HPDF_MemStreamAttr)attr->next->attr)->prev = attr->prev;
+    else
+        budget->tail = attr->prev;
+
+    attr->prev = NULL;
+    attr->next = NULL;
+}
+
+
+static void
+MemStream_BudgetTouch  (HPDF_Stream  stream)
+{
+    HPDF_MemStreamAttr attr = (HPDF_MemStreamAttr)stream->attr;
+    HPDF_StreamBudget budget = attr->budget;
+
+    if (budget->head == stream)
+        return;
+
+    MemStream_BudgetUnlink (stream);
+
+    attr->next = budget->head;
+    if (budget->head)
+        ((HPDF_MemStreamAttr)budget->head->attr)->prev = stream;
+    budget->head = stream;
+
+    if (!budget->tail)
+        budget->tail = stream;
+}
+
+
+static void
+MemStream_FreeBuffers  (HPDF_Stream  stream)
+{
+    HPDF_MemStreamAttr attr = (HPDF_MemStreamAttr)stream->attr;
+    HPDF_UINT i;
+
+    for (i = 0; i < attr->buf->count; i++)
+        HPDF_FreeMem (stream->mmgr, HPDF_List_ItemAt (attr->buf, i));
+
+    if (attr->budget)
+        attr->budget->used -= attr->buf->count * attr->buf_siz;
+
+    HPDF_List_Clear(attr->buf);
+
+    attr->w_pos = attr->buf_siz;
+    attr->w_ptr = NULL;
+    attr->r_ptr = NULL;
+}
+
+
+static HPDF_FILEP
+MemStream_OpenSpillFile  (HPDF_StreamBudget  budget)
+{
+#if !defined(_WIN32) && !defined(UNDER_CE)
+    if (budget->tmp_dir[0] != 0) {
+        char path[HPDF_TMP_BUF_SIZ + 16];
+        char *eptr = path + sizeof(path) - 1;
+        char *pbuf;
+        HPDF_FILEP fp;
+        int fd;
+
+        pbuf = (char *)HPDF_StrCpy (path, budget->tmp_dir, eptr);
+        HPDF_StrCpy (pbuf, "/hpdfXXXXXX", eptr);
+
+        fd = mkstemp (path);
+        if (fd < 0)
+            return NULL;
+
+        /* the file is removed as soon as it is closed. */
+        unlink (path);
+
+        fp = fdopen (fd, "w+b");
+        if (!fp)
+            close (fd);
+
+        return fp;
+    }
+#else
+    HPDF_UNUSED (budget);
+#endif
+
+    return HPDF_TMPFILE ();
+}
+
+
+static HPDF_STATUS
+MemStream_Spill  (HPDF_Stream  stream)
+{
+    HPDF_MemStreamAttr attr = (HPDF_MemStreamAttr)stream->attr;
+    HPDF_FILEP fp;
+    HPDF_UINT i;
+
+    HPDF_PTRACE((" MemStream_Spill\n"));
+
+    fp = MemStream_OpenSpillFile (attr->budget);
+    if (!fp)
+        return HPDF_FILE_OPEN_ERROR;
+
+    for (i = 0; i < attr->buf->count; i++) {
+        HPDF_UINT len = (attr->buf->count - 1 == i) ? attr->w_pos :
+                attr->buf_siz;
+
+        if (HPDF_FWRITE (HPDF_List_ItemAt (attr->buf, i), 1, len, fp) != len) {
+            HPDF_FCLOSE (fp);
+            return HPDF_FILE_IO_ERROR;
+        }
+    }
+
+    MemStream_BudgetUnlink (stream);
+    MemStream_FreeBuffers (stream);
+
+    attr->spill_fp = fp;
+    attr->spill_at_end = HPDF_TRUE;
+
+    return HPDF_OK;
+}
+
+
+void
+HPDF_MemStream_CheckBudget  (HPDF_StreamBudget  budget)
+{
+    HPDF_PTRACE((" HPDF_MemStream_CheckBudget\n"));
+
+    while (budget->limit > 0 && budget->used > budget->limit &&
+            budget->tail) {
+        if (MemStream_Spill (budget->tail) != HPDF_OK) {
+            /* temporary files are not available. keep the remaining
+             * streams in memory rather than failing the document. */
+            budget->limit = 0;
+            break;
+        }
+    }
+}
+
+
+void
+HPDF_MemStream_SetBudget  (HPDF_Stream        stream,
+                           HPDF_StreamBudget  budget)
+{
+    HPDF_MemStreamAttr attr;
+
+    HPDF_PTRACE((" HPDF_MemStream_SetBudget\n"));
+
+    if (!stream || stream->type != HPDF_STREAM_MEMORY)
+        return;
+
+    attr = (HPDF_MemStreamAttr)stream->attr;
+    if (attr->budget || attr->spill_fp)
+        return;
+
+    attr->budget = budget;
+    budget->used += attr->buf->count * attr->buf_siz;
+    if (attr->buf->count > 0)
+        MemStream_BudgetTouch (stream);
+}
+
+
+HPDF_BOOL
+HPDF_MemStream_IsSpilled  (HPDF_Stream  stream)
+{
+    if (!stream || stream->type != HPDF_STREAM_MEMORY)
+        return HPDF_FALSE;
+
+    return (((HPDF_MemStreamAttr)stream->attr)->spill_fp != NULL);
+}
+
+
 HPDF_STATUS
 HPDF_MemStream_InWrite  (HPDF_Stream      stream,
                          const HPDF_BYTE  **ptr,
@@ -1036,6 +1461,9 @@ HPDF_MemStream_InWrite  (HPDF_Stream      stream,
             return HPDF_Error_GetCode (stream->error);
         }
         attr->w_pos = 0;
+
+        if (attr->budget)
+            attr->budget->used += attr->buf_siz;
     }
     return HPDF_OK;
 }
@@ -1046,6 +1474,7 @@ HPDF_MemStream_WriteFunc  (HPDF_Stream      stream,
                            const HPDF_BYTE  *ptr,
                            HPDF_UINT        siz)
 {
+    HPDF_MemStreamAttr attr = (HPDF_MemStreamAttr)stream->attr;
     HPDF_UINT wsiz = siz;
 
     HPDF_PTRACE((" HPDF_MemStream_WriteFunc\n"));
@@ -1053,32 +1482,56 @@ HPDF_MemStream_WriteFunc  (HPDF_Stream      stream,
     if (HPDF_Error_GetCode (stream->error) != 0)
         return HPDF_THIS_FUNC_WAS_SKIPPED;
 
+    if (attr->spill_fp) {
+        /* seeking flushes the buffer of the file, so it is only done
+         * when a read has moved the position. */
+        if (!attr->spill_at_end) {
+            if (HPDF_FSEEK (attr->spill_fp, 0, SEEK_END) != 0)
+                return HPDF_SetError (stream->error, HPDF_FILE_IO_ERROR,
+                        HPDF_FERROR (attr->spill_fp));
+
+            attr->spill_at_end = HPDF_TRUE;
+        }
+
+        if (HPDF_FWRITE (ptr, 1, siz, attr->spill_fp) != siz)
+            return HPDF_SetError (stream->error, HPDF_FILE_IO_ERROR,
+                    HPDF_FERROR (attr->spill_fp));
+
+        return HPDF_OK;
+    }
+
+    if (attr->budget && siz > 0)
+        MemStream_BudgetTouch (stream);
+
     while (wsiz > 0) {
         HPDF_STATUS ret = HPDF_MemStream_InWrite (stream, &ptr, &wsiz);
         if (ret != HPDF_OK)
             return ret;
     }
 
+    if (attr->budget)
+        HPDF_MemStream_CheckBudget (attr->budget);
+
     return HPDF_OK;
 }
 
 
-HPDF_INT32
+HPDF_INT64
 HPDF_MemStream_TellFunc  (HPDF_Stream  stream)
 {
-    HPDF_INT32 ret;
+    HPDF_INT64 ret;
     HPDF_MemStreamAttr attr = (HPDF_MemStreamAttr)stream->attr;
 
     HPDF_PTRACE((" HPDF_MemStream_TellFunc\n"));
 
-    ret = attr->r_ptr_idx * attr->buf_siz;
+    ret = (HPDF_INT64)attr->r_ptr_idx * attr->buf_siz;
     ret += attr->r_pos;
 
     return ret;
 }
 
 
-HPDF_UINT32
+HPDF_UINT64
 HPDF_MemStream_SizeFunc  (HPDF_Stream  stream)
 {
     HPDF_PTRACE((" HPDF_MemStream_SizeFunc\n"));
@@ -1088,7 +1541,7 @@ HPDF_MemStream_SizeFunc  (HPDF_Stream  stream)
 
 HPDF_STATUS
 HPDF_MemStream_SeekFunc  (HPDF_Stream      stream,
-                          HPDF_INT         pos,
+                          HPDF_INT64       pos,
                           HPDF_WhenceMode  mode)
 {
     HPDF_MemStreamAttr attr = (HPDF_MemStreamAttr)stream->attr;
@@ -1096,12 +1549,12 @@ HPDF_MemStream_SeekFunc  (HPDF_Stream      stream,
     HPDF_PTRACE((" HPDF_MemStream_SeekFunc\n"));
 
     if (mode == HPDF_SEEK_CUR) {
-        pos += (attr->r_ptr_idx * attr->buf_siz);
+        pos += ((HPDF_INT64)attr->r_ptr_idx * attr->buf_siz);
         pos += attr->r_pos;
     } else if (mode == HPDF_SEEK_END)
         pos = stream->size - pos;
 
-    if (pos > (HPDF_INT)stream->size) {
+    if (pos > (HPDF_INT64)stream->size) {
         return HPDF_SetError (stream->error, HPDF_STREAM_EOF, 0);
     }
 
@@ -1109,8 +1562,12 @@ HPDF_MemStream_SeekFunc  (HPDF_Stream      stream,
         return HPDF_OK;
     }
 
-    attr->r_ptr_idx = pos / attr->buf_siz;
-    attr->r_pos = pos % attr->buf_siz;
+    attr->r_ptr_idx = (HPDF_UINT)(pos / attr->buf_siz);
+    attr->r_pos = (HPDF_UINT)(pos % attr->buf_siz);
+
+    if (attr->spill_fp)
+        return HPDF_OK;
+
     attr->r_ptr = (HPDF_BYTE*)HPDF_List_ItemAt (attr->buf, attr->r_ptr_idx);
     if (attr->r_ptr == NULL) {
         HPDF_SetError (stream->error, HPDF_INVALID_OBJECT, 0);
@@ -1139,6 +1596,12 @@ HPDF_MemStream_GetBufPtr  (HPDF_Stream  stream,
 
     attr = (HPDF_MemStreamAttr)stream->attr;
 
+    if (attr->spill_fp) {
+        HPDF_SetError (stream->error, HPDF_INVALID_OPERATION, 0);
+        *length = 0;
+        return NULL;
+    }
+
     ret = (HPDF_BYTE *)HPDF_List_ItemAt (attr->buf, index);
     if (ret == NULL) {
         HPDF_SetError (stream->error, HPDF_INVALID_PARAMETER, 0);
@@ -1155,7 +1618,6 @@ void
 HPDF_MemStream_FreeData  (HPDF_Stream  stream)
 {
     HPDF_MemStreamAttr attr;
-    HPDF_UINT i;
 
     HPDF_PTRACE((" HPDF_MemStream_FreeData\n"));
 
@@ -1164,14 +1626,17 @@ HPDF_MemStream_FreeData  (HPDF_Stream  stream)
 
     attr = (HPDF_MemStreamAttr)stream->attr;
 
-    for (i = 0; i < attr->buf->count; i++)
-        HPDF_FreeMem (stream->mmgr, HPDF_List_ItemAt (attr->buf, i));
+    if (attr->spill_fp) {
+        HPDF_FCLOSE (attr->spill_fp);
+        attr->spill_fp = NULL;
+    }
 
-    HPDF_List_Clear(attr->buf);
+    if (attr->budget)
+        MemStream_BudgetUnlink (stream);
+
+    MemStream_FreeBuffers (stream);
 
     stream->size = 0;
-    attr->w_pos = attr->buf_siz;
-    attr->w_ptr = NULL;
     attr->r_ptr_idx = 0;
     attr->r_pos = 0;
 }
@@ -1223,6 +1688,7 @@ HPDF_MemStream_New  (HPDF_MMgr  mmgr,
 
         stream->sig_bytes = HPDF_STREAM_SIG_BYTES;
         stream->type = HPDF_STREAM_MEMORY;
+        stream->real_precision = HPDF_DEF_REAL_PRECISION;
         stream->error = mmgr->error;
         stream->mmgr = mmgr;
         stream->attr = attr;
@@ -1281,6 +1747,36 @@ HPDF_MemStream_ReadFunc  (HPDF_Stream  stream,
 
     *size = 0;
 
+    if (attr->spill_fp) {
+        HPDF_INT64 offset = (HPDF_INT64)attr->r_ptr_idx * attr->buf_siz +
+                attr->r_pos;
+
+        if ((HPDF_INT64)(HPDF_FOFF)offset != offset)
+            return HPDF_SetError (stream->error,
+                    HPDF_STREAM_OFFSET_OUT_OF_RANGE, 0);
+
+        attr->spill_at_end = HPDF_FALSE;
+
+        if (HPDF_FSEEK (attr->spill_fp, (HPDF_FOFF)offset, SEEK_SET) != 0)
+            return HPDF_SetError (stream->error, HPDF_FILE_IO_ERROR,
+                    HPDF_FERROR (attr->spill_fp));
+
+        *size = HPDF_FREAD (buf, 1, rlen, attr->spill_fp);
+        offset += *size;
+        attr->r_ptr_idx = (HPDF_UINT)(offset / attr->buf_siz);
+        attr->r_pos = (HPDF_UINT)(offset % attr->buf_siz);
+
+        if (*size != rlen) {
+            if (HPDF_FEOF (attr->spill_fp))
+                return HPDF_STREAM_EOF;
+
+            return HPDF_SetError (stream->error, HPDF_FILE_IO_ERROR,
+                    HPDF_FERROR (attr->spill_fp));
+        }
+
+        return HPDF_OK;
+    }
+
     while (rlen > 0) {
         HPDF_UINT tmp_len;
 
@@ -1337,6 +1833,9 @@ HPDF_MemStream_Rewrite  (HPDF_Stream  stream,
 
     HPDF_PTRACE((" HPDF_MemStream_Rewrite\n"));
 
+    if (attr->spill_fp)
+        return HPDF_SetError (stream->error, HPDF_INVALID_OPERATION, 0);
+
     while (rlen > 0) {
         HPDF_UINT tmp_len;
 
@@ -1413,6 +1912,7 @@ HPDF_CallbackReader_New  (HPDF_MMgr              mmgr,
         stream->size_fn = size_fn;
         stream->attr = data;
         stream->type = HPDF_STREAM_CALLBACK;
+        stream->real_precision = HPDF_DEF_REAL_PRECISION;
     }
 
     return stream;
@@ -1452,6 +1952,7 @@ HPDF_CallbackWriter_New (HPDF_MMgr               mmgr,
         stream->write_fn = write_fn;
         stream->attr = data;
         stream->type = HPDF_STREAM_CALLBACK;
+        stream->real_precision = HPDF_DEF_REAL_PRECISION;
     }
 
     return stream;
@@ -16,6 +16,7 @@
  */
 
 #include <stdlib.h>
+#include <string.h>
 #include "hpdf_utils.h"
 #include "hpdf_consts.h"
 
@@ -113,37 +114,125 @@ HPDF_AToF  (const char  *s)
 }
 
 
+/*
+ *  Digits are produced two at a time from this table, which halves the
+ *  number of divisions compared to a "% 10" loop.
+ */
+static const char HPDF_DIGIT_PAIRS[] =
+    "00010203040506070809"
+    "10111213141516171819"
+    "20212223242526272829"
+    "30313233343536373839"
+    "40414243444546474849"
+    "50515253545556575859"
+    "60616263646566676869"
+    "70717273747576777879"
+    "80818283848586878889"
+    "90919293949596979899";
+
+
+static HPDF_UINT
+CountDigits  (HPDF_UINT64  val)
+{
+    HPDF_UINT len = 1;
+
+    while (val >= 100) {
+        val /= 100;
+        len += 2;
+    }
+
+    if (val >= 10)
+        len++;
+
+    return len;
+}
+
+
+/* writes exactly 'len' digits of 'val' (the lowest ones, zero padded) */
+static char*
+WriteDigits  (char         *s,
+              HPDF_UINT32   val,
+              HPDF_UINT     len)
+{
+    char *t = s + len;
+
+    while (t - s >= 2) {
+        HPDF_UINT32 q = val / 100;
+        const char *d = HPDF_DIGIT_PAIRS + (val - q * 100) * 2;
+
+        t -= 2;
+        t[0] = d[0];
+        t[1] = d[1];
+        val = q;
+    }
+
+    if (t > s)
+        *s = (char)((char)(val % 10) + '0');
+
+    return s + len;
+}
+
+
+static char*
+WriteDigits64  (char         *s,
+                HPDF_UINT64   val,
+                HPDF_UINT     len)
+{
+    char *t = s + len;
+
+    /* use 64-bit division only until the rest fits in 32 bits */
+    while (val > 0xFFFFFFFF) {
+        HPDF_UINT64 q = val / 100000000;
+        HPDF_UINT32 r = (HPDF_UINT32)(val - q * 100000000);
+
+        if (t - s <= 8) {
+            val = r;
+            break;
+        }
+
+        t -= 8;
+        WriteDigits (t, r, 8);
+        val = q;
+    }
+
+    WriteDigits (s, (HPDF_UINT32)val, (HPDF_UINT)(t - s));
+
+    return s + len;
+}
+
+
 char*
 HPDF_IToA  (char        *s,
             HPDF_INT32   val,
             char        *eptr)
 {
-    char* t;
-    char buf[HPDF_INT_LEN + 1];
+    HPDF_UINT32 uval;
+
+    if (eptr - s < HPDF_INT_LEN) {
+        /* not enough room for the longest value; format it aside */
+        char buf[HPDF_INT_LEN + 1];
+        char *t = buf;
+
+        HPDF_IToA (buf, val, buf + HPDF_INT_LEN);
+
+        while (s < eptr && *t != 0)
+            *s++ = *t++;
+        *s = 0;
+
+        return s;
+    }
 
     if (val < 0) {
         if (val < HPDF_LIMIT_MIN_INT)
             val = HPDF_LIMIT_MIN_INT;
         *s++ = '-';
-        val = -val;
+        uval = (HPDF_UINT32)-val;
     } else if (val > HPDF_LIMIT_MAX_INT) {
-        val = HPDF_LIMIT_MAX_INT;
-    } else if (val == 0) {
-        *s++ = '0';
-    }
-
-    t = buf + HPDF_INT_LEN;
-    *t-- = 0;
+        uval = HPDF_LIMIT_MAX_INT;
+    } else
+        uval = (HPDF_UINT32)val;
 
-    while (val > 0) {
-        *t = (char)((char)(val % 10) + '0');
-        val /= 10;
-        t--;
-    }
-
-    t++;
-    while (s < eptr && *t != 0)
-      *s++ = *t++;
+    s = WriteDigits (s, uval, CountDigits (uval));
     *s = 0;
 
     return s;
@@ -152,28 +241,43 @@ HPDF_IToA  (char        *s,
 
 char*
 HPDF_IToA2  (char         *s,
-             HPDF_UINT32   val,
+             HPDF_UINT64   val,
              HPDF_UINT     len)
 {
-    char* t;
     char* u;
 
-    if (val > HPDF_LIMIT_MAX_INT)
-        val = HPDF_LIMIT_MAX_INT;
-
-    u = s + len - 1;
+    u = WriteDigits64 (s, val, len - 1);
     *u = 0;
-    t = u - 1;
-    while (val > 0 && t >= s) {
-        *t = (char)((char)(val % 10) + '0');
-        val /= 10;
-        t--;
+
+    return u;
+}
+
+
+char*
+HPDF_UInt64ToA  (char         *s,
+                 HPDF_UINT64   val,
+                 char         *eptr)
+{
+    HPDF_UINT len = CountDigits (val);
+    char buf[HPDF_INT64_LEN + 1];
+    char* t;
+
+    if ((HPDF_UINT)(eptr - s) >= len) {
+        s = WriteDigits64 (s, val, len);
+        *s = 0;
+
+        return s;
     }
 
-    while (s <= t)
-        *t-- = '0';
+    t = buf;
+    WriteDigits64 (buf, val, len);
+    buf[len] = 0;
+
+    while (s < eptr && *t != 0)
+      *s++ = *t++;
+    *s = 0;
 
-    return s + len - 1;
+    return s;
 }
 
 
@@ -182,12 +286,39 @@ HPDF_FToA  (char       *s,
             HPDF_REAL   val,
             char       *eptr)
 {
+    return HPDF_FToA2 (s, val, HPDF_DEF_REAL_PRECISION, eptr);
+}
+
+
+char*
+HPDF_FToA2  (char       *s,
+             HPDF_REAL   val,
+             HPDF_UINT   precision,
+             char       *eptr)
+{
+    static const HPDF_DOUBLE round_val[] =
+        { 0.5, 0.05, 0.005, 0.0005, 0.00005, 0.000005 };
+    static const HPDF_INT32 scale[] = { 1, 10, 100, 1000, 10000, 100000 };
     HPDF_INT32 int_val;
     HPDF_INT32 fpart_val;
-    char buf[HPDF_REAL_LEN + 1];
-    char* sptr = s;
-    char* t;
-    HPDF_UINT32 i;
+    HPDF_UINT fpart_len;
+
+    if (eptr - s < HPDF_REAL_LEN) {
+        /* not enough room for the longest value; format it aside */
+        char buf[HPDF_REAL_LEN + 2];
+        char *t = buf;
+        char *e = HPDF_FToA2 (buf, val, precision, buf + HPDF_REAL_LEN + 1);
+
+        while (s <= eptr && t < e)
+            *s++ = *t++;
+        if (s <= eptr)
+            *s = 0;
+
+        return s;
+    }
+
+    if (precision > HPDF_MAX_REAL_PRECISION)
+        precision = HPDF_MAX_REAL_PRECISION;
 
     if (val > HPDF_LIMIT_MAX_REAL)
         val = HPDF_LIMIT_MAX_REAL;
@@ -195,55 +326,36 @@ HPDF_FToA  (char       *s,
     if (val < HPDF_LIMIT_MIN_REAL)
         val = HPDF_LIMIT_MIN_REAL;
 
-    t = buf + HPDF_REAL_LEN;
-    *t-- = 0;
-
     if (val < 0) {
         *s++ = '-';
         val = -val;
     }
 
     /* separate an integer part and a decimal part. */
-    int_val = (HPDF_INT32)(val + 0.000005);
-    fpart_val = (HPDF_INT32)((HPDF_REAL)(val - int_val + 0.000005) * 100000);
-
-    /* process decimal part */
-    for (i = 0; i < 5; i++) {
-        *t = (char)((char)(fpart_val % 10) + '0');
-        fpart_val /= 10;
-        t--;
-    }
-
-    /* process integer part */
-    *t-- = '.';
-    *t = '0';
-    if (int_val == 0)
-        t--;
-
-    while (int_val > 0) {
-        *t = (char)((char)(int_val % 10) + '0');
-        int_val /= 10;
-        t--;
-    }
+    int_val = (HPDF_INT32)(val + round_val[precision]);
+    fpart_val = (HPDF_INT32)((HPDF_REAL)(val - int_val + round_val[precision]) *
+            scale[precision]);
+    if (fpart_val >= scale[precision])
+        fpart_val -= scale[precision];
 
-    t++;
-    while (s <= eptr && *t != 0)
-        *s++ = *t++;
-    s--;
+    s = WriteDigits (s, (HPDF_UINT32)int_val, CountDigits (int_val));
 
     /* delete an excessive decimal portion. */
-    while (s > sptr) {
-        if (*s == '0')
-            *s = 0;
-        else {
-            if (*s == '.')
-                *s = 0;
-            break;
+    if (fpart_val > 0) {
+        fpart_len = precision;
+        while (fpart_val % 10 == 0) {
+            fpart_val /= 10;
+            fpart_len--;
         }
-        s--;
+
+        *s++ = '.';
+        s = WriteDigits (s, (HPDF_UINT32)fpart_val, fpart_len);
     }
 
-    return (*s == 0) ? s : ++s;
+    if (s <= eptr)
+        *s = 0;
+
+    return s;
 }
 
 
@@ -252,12 +364,12 @@ HPDF_MemCpy  (HPDF_BYTE*         out,
               const HPDF_BYTE   *in,
               HPDF_UINT          n)
 {
-    while (n > 0) {
-        *out++ = *in++;
-        n--;
-    }
+    /* memmove keeps the result of the former byte-by-byte copy when a
+     * buffer is shifted onto itself (see hpdf_fontdef_type1.c).
+     */
+    memmove (out, in, n);
 
-    return out;
+    return out + n;
 }
 
 
@@ -24,6 +24,12 @@ WriteTrailer  (HPDF_Xref     xref,
                HPDF_Stream   stream);
 
 
+static HPDF_STATUS
+WriteEntries  (HPDF_Xref     xref,
+               HPDF_Stream   stream,
+               HPDF_Encrypt  e);
+
+
 HPDF_Xref
 HPDF_Xref_New  (HPDF_MMgr     mmgr,
                 HPDF_UINT32   offset)
@@ -66,6 +72,10 @@ HPDF_Xref_New  (HPDF_MMgr     mmgr,
         new_entry->byte_offset = 0;
         new_entry->gen_no = HPDF_MAX_GENERATION_NUM;
         new_entry->obj = NULL;
+        new_entry->cache = NULL;
+        new_entry->cache_len = 0;
+        new_entry->shared = HPDF_FALSE;
+        new_entry->cache_stream_size = 0;
     }
 
     xref->trailer = HPDF_Dict_New (mmgr);
@@ -99,8 +109,12 @@ HPDF_Xref_Free  (HPDF_Xref  xref)
         if (xref->entries) {
             for (i = 0; i < xref->entries->count; i++) {
                 entry = HPDF_Xref_GetEntry (xref, i);
-                if (entry->obj)
-                    HPDF_Obj_ForceFree (xref->mmgr, entry->obj);
+                if (!entry->shared) {
+                    if (entry->obj)
+                        HPDF_Obj_ForceFree (xref->mmgr, entry->obj);
+                    if (entry->cache)
+                        HPDF_FreeMem (xref->mmgr, entry->cache);
+                }
                 HPDF_FreeMem (xref->mmgr, entry);
             }
 
@@ -162,6 +176,10 @@ HPDF_Xref_Add  (HPDF_Xref  xref,
     entry->byte_offset = 0;
     entry->gen_no = 0;
     entry->obj = obj;
+    entry->cache = NULL;
+    entry->cache_len = 0;
+    entry->shared = HPDF_FALSE;
+    entry->cache_stream_size = 0;
     header->obj_id = xref->start_offset + xref->entries->count - 1 +
                     HPDF_OTYPE_INDIRECT;
 
@@ -174,6 +192,256 @@ Fail:
     return HPDF_Error_GetCode (xref->error);
 }
 
+
+/*
+ *  HPDF_Xref_AddShared
+ *
+ *  Adds an entry which borrows the object and the serialized bytes of
+ *  src, an entry of the xref of a template. The template must be freed
+ *  after xref.
+ */
+HPDF_STATUS
+HPDF_Xref_AddShared  (HPDF_Xref       xref,
+                      HPDF_XrefEntry  src)
+{
+    HPDF_XrefEntry entry;
+
+    HPDF_PTRACE((" HPDF_Xref_AddShared\n"));
+
+    if (xref->entries->count >= HPDF_LIMIT_MAX_XREF_ELEMENT)
+        return HPDF_SetError (xref->error, HPDF_XREF_COUNT_ERR, 0);
+
+    entry = (HPDF_XrefEntry)HPDF_GetMem (xref->mmgr,
+            sizeof(HPDF_XrefEntry_Rec));
+    if (entry == NULL)
+        return HPDF_Error_GetCode (xref->error);
+
+    if (HPDF_List_Add (xref->entries, entry) != HPDF_OK) {
+        HPDF_FreeMem (xref->mmgr, entry);
+        return HPDF_Error_GetCode (xref->error);
+    }
+
+    entry->entry_typ = HPDF_IN_USE_ENTRY;
+    entry->byte_offset = 0;
+    entry->gen_no = src->gen_no;
+    entry->obj = src->obj;
+    entry->cache = src->cache;
+    entry->cache_len = src->cache_len;
+    entry->shared = HPDF_TRUE;
+    entry->cache_stream_size = src->cache_stream_size;
+
+    return HPDF_OK;
+}
+
+
+/*
+ *  HPDF_Xref_Append
+ *
+ *  Moves the objects of src, an xref of a single section which starts at
+ *  0, to the end of xref and numbers them after the objects of xref. The
+ *  objects refer to each other by pointer, so only their identifiers
+ *  change; serialized bytes, which contain the old ones, are discarded.
+ *  The objects stay allocated from the memory manager of src, which must
+ *  be freed after xref. Objects which could not be moved are left in src.
+ */
+HPDF_STATUS
+HPDF_Xref_Append  (HPDF_Xref  xref,
+                   HPDF_Xref  src)
+{
+    HPDF_STATUS ret = HPDF_OK;
+    HPDF_UINT count = src->entries->count;
+    HPDF_UINT i;
+    HPDF_UINT j;
+
+    HPDF_PTRACE((" HPDF_Xref_Append\n"));
+
+    if (xref->entries->count + count - 1 > HPDF_LIMIT_MAX_XREF_ELEMENT)
+        return HPDF_SetError (xref->error, HPDF_XREF_COUNT_ERR, 0);
+
+    for (i = 1; i < count; i++) {
+        HPDF_XrefEntry entry = HPDF_Xref_GetEntry (src, i);
+        HPDF_Obj_Header *header = (HPDF_Obj_Header *)entry->obj;
+        HPDF_Dict dict = (HPDF_Dict)entry->obj;
+
+        if ((ret = HPDF_List_Add (xref->entries, entry)) != HPDF_OK)
+            break;
+
+        header->obj_id = (header->obj_id & 0xFF000000) |
+                (xref->start_offset + xref->entries->count - 1);
+
+        if (entry->cache) {
+            HPDF_FreeMem (src->mmgr, entry->cache);
+            entry->cache = NULL;
+            entry->cache_len = 0;
+        }
+
+        if ((header->obj_class & HPDF_OCLASS_ANY) == HPDF_OCLASS_DICT &&
+                dict->stream && xref->stream_budget)
+            HPDF_MemStream_SetBudget (dict->stream, xref->stream_budget);
+    }
+
+    /* the entries which were moved belong to xref now. */
+    for (j = i; j < count; j++)
+        src->entries->obj[j - i + 1] = src->entries->obj[j];
+    src->entries->count = count - i + 1;
+
+    if (xref->stream_budget)
+        HPDF_MemStream_CheckBudget (xref->stream_budget);
+
+    return ret;
+}
+
+
+/*
+ *  HPDF_Xref_CacheEntry
+ *
+ *  Serializes the object of entry, using the memory-stream tmp, and keeps
+ *  the bytes in the entry. HPDF_Xref_WriteToStream writes them instead of
+ *  the object from then on, so the object must not be changed any more.
+ *  When e is not NULL, the bytes are encrypted with it.
+ */
+HPDF_STATUS
+HPDF_Xref_CacheEntry  (HPDF_Xref       xref,
+                       HPDF_XrefEntry  entry,
+                       HPDF_Stream     tmp,
+                       HPDF_Encrypt    e)
+{
+    HPDF_Obj_Header *header = (HPDF_Obj_Header *)entry->obj;
+    HPDF_Dict dict = (HPDF_Dict)entry->obj;
+    HPDF_STATUS ret;
+    HPDF_BYTE *cache;
+    HPDF_UINT len = 0;
+    HPDF_UINT i;
+
+    HPDF_PTRACE((" HPDF_Xref_CacheEntry\n"));
+
+    HPDF_MemStream_FreeData (tmp);
+
+    if (e)
+        HPDF_Encrypt_InitKey (e, header->obj_id & 0x00FFFFFF, entry->gen_no);
+
+    if ((ret = HPDF_Obj_WriteValue (entry->obj, tmp, e)) != HPDF_OK)
+        return ret;
+
+    cache = (HPDF_BYTE *)HPDF_GetMem (xref->mmgr, (HPDF_UINT)tmp->size);
+    if (!cache)
+        return HPDF_Error_GetCode (xref->error);
+
+    for (i = 0; i < HPDF_MemStream_GetBufCount (tmp); i++) {
+        HPDF_UINT size;
+        HPDF_BYTE *buf = HPDF_MemStream_GetBufPtr (tmp, i, &size);
+
+        HPDF_MemCpy (cache + len, buf, size);
+        len += size;
+    }
+
+    if (entry->cache && !entry->shared)
+        HPDF_FreeMem (xref->mmgr, entry->cache);
+
+    entry->cache = cache;
+    entry->cache_len = len;
+    entry->shared = HPDF_FALSE;
+
+    if ((header->obj_class & HPDF_OCLASS_ANY) == HPDF_OCLASS_DICT &&
+            dict->stream)
+        entry->cache_stream_size = dict->stream->size;
+    else
+        entry->cache_stream_size = 0;
+
+    return HPDF_OK;
+}
+
+
+/*
+ *  IsCacheValid
+ *
+ *  Whether the serialized bytes of entry still match its object.
+ */
+static HPDF_BOOL
+IsCacheValid  (HPDF_XrefEntry  entry)
+{
+    HPDF_Obj_Header *header = (HPDF_Obj_Header *)entry->obj;
+    HPDF_Dict dict = (HPDF_Dict)entry->obj;
+
+    if (entry->shared)
+        return HPDF_TRUE;
+
+    if (!(header->obj_id & HPDF_OTYPE_FINAL))
+        return HPDF_FALSE;
+
+    if ((header->obj_class & HPDF_OCLASS_ANY) == HPDF_OCLASS_DICT &&
+            dict->stream && dict->stream->size != entry->cache_stream_size)
+        return HPDF_FALSE;
+
+    return HPDF_TRUE;
+}
+
+
+/*
+ *  IsCacheable
+ *
+ *  Whether the serialized bytes of entry may be kept. The data of file
+ *  backed and lazily loaded streams is only read while they are written,
+ *  and keeping their bytes would hold it in memory after all.
+ */
+static HPDF_BOOL
+IsCacheable  (HPDF_XrefEntry  entry)
+{
+    HPDF_Obj_Header *header = (HPDF_Obj_Header *)entry->obj;
+    HPDF_Dict dict = (HPDF_Dict)entry->obj;
+
+    if (!(header->obj_id & HPDF_OTYPE_FINAL))
+        return HPDF_FALSE;
+
+    if ((header->obj_class & HPDF_OCLASS_ANY) == HPDF_OCLASS_DICT) {
+        if (dict->before_write_fn)
+            return HPDF_FALSE;
+
+        if (dict->stream && (dict->stream->type != HPDF_STREAM_MEMORY ||
+                HPDF_MemStream_IsSpilled (dict->stream)))
+            return HPDF_FALSE;
+    }
+
+    return HPDF_TRUE;
+}
+
+
+/*
+ *  SetCacheKey
+ *
+ *  Discards the serialized bytes of the entries of xref when they were
+ *  not encrypted with the same key as e, which changes with the file
+ *  identifier of each save.
+ */
+static void
+SetCacheKey  (HPDF_Xref     xref,
+              HPDF_Encrypt  e)
+{
+    HPDF_UINT key_len = e ? e->key_len : 0;
+    HPDF_Xref tmp_xref;
+    HPDF_UINT i;
+
+    if (key_len == xref->cache_key_len && (key_len == 0 ||
+            HPDF_MemCmp (xref->cache_key, e->encryption_key, key_len) == 0))
+        return;
+
+    for (tmp_xref = xref; tmp_xref; tmp_xref = tmp_xref->prev) {
+        for (i = 0; i < tmp_xref->entries->count; i++) {
+            HPDF_XrefEntry entry = HPDF_Xref_GetEntry (tmp_xref, i);
+
+            if (entry->cache && !entry->shared) {
+                HPDF_FreeMem (xref->mmgr, entry->cache);
+                entry->cache = NULL;
+                entry->cache_len = 0;
+            }
+        }
+    }
+
+    if (key_len)
+        HPDF_MemCpy (xref->cache_key, e->encryption_key, key_len);
+    xref->cache_key_len = key_len;
+}
+
 HPDF_XrefEntry
 HPDF_Xref_GetEntry  (HPDF_Xref  xref,
                      HPDF_UINT  index)
@@ -227,49 +495,14 @@ HPDF_Xref_WriteToStream  (HPDF_Xref    xref,
     char buf[HPDF_SHORT_BUF_SIZ];
     char* pbuf;
     char* eptr = buf + HPDF_SHORT_BUF_SIZ - 1;
-    HPDF_UINT str_idx;
-    HPDF_Xref tmp_xref = xref;
+    HPDF_Xref tmp_xref;
 
     /* write each objects of xref to the specified stream */
 
     HPDF_PTRACE((" HPDF_Xref_WriteToStream\n"));
 
-    while (tmp_xref) {
-        if (tmp_xref->start_offset == 0)
-            str_idx = 1;
-        else
-            str_idx = 0;
-
-        for (i = str_idx; i < tmp_xref->entries->count; i++) {
-            HPDF_XrefEntry  entry =
-                        (HPDF_XrefEntry)HPDF_List_ItemAt (tmp_xref->entries, i);
-            HPDF_UINT obj_id = tmp_xref->start_offset + i;
-            HPDF_UINT16 gen_no = entry->gen_no;
-
-            entry->byte_offset = stream->size;
-
-            pbuf = buf;
-            pbuf = HPDF_IToA (pbuf, obj_id, eptr);
-            *pbuf++ = ' ';
-            pbuf = HPDF_IToA (pbuf, gen_no, eptr);
-            HPDF_StrCpy(pbuf, " obj\012", eptr);
-
-            if ((ret = HPDF_Stream_WriteStr (stream, buf)) != HPDF_OK)
-               return ret;
-
-            if (e)
-                HPDF_Encrypt_InitKey (e, obj_id, gen_no);
-
-            if ((ret = HPDF_Obj_WriteValue (entry->obj, stream, e)) != HPDF_OK)
-                return ret;
-
-            if ((ret = HPDF_Stream_WriteStr (stream, "\012endobj\012"))
-                    != HPDF_OK)
-                return ret;
-       }
-
-       tmp_xref = tmp_xref->prev;
-    }
+    if ((ret = WriteEntries (xref, stream, e)) != HPDF_OK)
+        return ret;
 
     /* start to write cross-reference table */
 
@@ -291,6 +524,11 @@ HPDF_Xref_WriteToStream  (HPDF_Xref    xref,
         for (i = 0; i < tmp_xref->entries->count; i++) {
             HPDF_XrefEntry entry = HPDF_Xref_GetEntry(tmp_xref, i);
 
+            /* the cross-reference table has no room for more digits */
+            if (entry->byte_offset > HPDF_LIMIT_MAX_BYTE_OFFSET)
+                return HPDF_SetError (xref->error,
+                        HPDF_STREAM_OFFSET_OUT_OF_RANGE, 0);
+
             pbuf = buf;
             pbuf = HPDF_IToA2 (pbuf, entry->byte_offset, HPDF_BYTE_OFFSET_LEN +
                     1);
@@ -313,12 +551,109 @@ HPDF_Xref_WriteToStream  (HPDF_Xref    xref,
     return ret;
 }
 
+/*
+ *  WriteEntries
+ *
+ *  Writes the objects of xref. The serialized bytes kept for an object
+ *  are written in its place, and those of a final object are kept the
+ *  first time it is written, so that saving the document again copies
+ *  them instead of compressing (and encrypting) the object again.
+ */
+static HPDF_STATUS
+WriteEntries  (HPDF_Xref     xref,
+               HPDF_Stream   stream,
+               HPDF_Encrypt  e)
+{
+    HPDF_STATUS ret = HPDF_OK;
+    HPDF_UINT i;
+    char buf[HPDF_SHORT_BUF_SIZ];
+    char* pbuf;
+    char* eptr = buf + HPDF_SHORT_BUF_SIZ - 1;
+    HPDF_UINT str_idx;
+    HPDF_Xref tmp_xref = xref;
+    HPDF_Stream tmp = NULL;
+
+    SetCacheKey (xref, e);
+
+    while (tmp_xref && ret == HPDF_OK) {
+        if (tmp_xref->start_offset == 0)
+            str_idx = 1;
+        else
+            str_idx = 0;
+
+        for (i = str_idx; i < tmp_xref->entries->count; i++) {
+            HPDF_XrefEntry  entry =
+                        (HPDF_XrefEntry)HPDF_List_ItemAt (tmp_xref->entries, i);
+            HPDF_UINT obj_id = tmp_xref->start_offset + i;
+            HPDF_UINT16 gen_no = entry->gen_no;
+
+            entry->byte_offset = stream->size;
+
+            pbuf = buf;
+            pbuf = HPDF_IToA (pbuf, obj_id, eptr);
+            *pbuf++ = ' ';
+            pbuf = HPDF_IToA (pbuf, gen_no, eptr);
+            HPDF_StrCpy(pbuf, " obj\012", eptr);
+
+            if ((ret = HPDF_Stream_WriteStr (stream, buf)) != HPDF_OK)
+               break;
+
+            if (entry->cache && !IsCacheValid (entry)) {
+                HPDF_FreeMem (xref->mmgr, entry->cache);
+                entry->cache = NULL;
+                entry->cache_len = 0;
+            }
+
+            if (!entry->cache && xref->cache_objects && IsCacheable (entry)) {
+                if (!tmp) {
+                    tmp = HPDF_MemStream_New (xref->mmgr,
+                            HPDF_STREAM_BUF_SIZ);
+                    if (!tmp) {
+                        ret = HPDF_Error_GetCode (xref->error);
+                        break;
+                    }
+                }
+
+                if ((ret = HPDF_Xref_CacheEntry (xref, entry, tmp, e))
+                        != HPDF_OK)
+                    break;
+            }
+
+            if (entry->cache) {
+                ret = HPDF_Stream_Write (stream, entry->cache,
+                        entry->cache_len);
+            } else {
+                if (e)
+                    HPDF_Encrypt_InitKey (e, obj_id, gen_no);
+
+                ret = HPDF_Obj_WriteValue (entry->obj, stream, e);
+            }
+
+            if (ret != HPDF_OK)
+                break;
+
+            if ((ret = HPDF_Stream_WriteStr (stream, "\012endobj\012"))
+                    != HPDF_OK)
+                break;
+       }
+
+       tmp_xref = tmp_xref->prev;
+    }
+
+    if (tmp)
+        HPDF_Stream_Free (tmp);
+
+    return ret;
+}
+
+
 static HPDF_STATUS
 WriteTrailer  (HPDF_Xref     xref,
                HPDF_Stream   stream)
 {
     HPDF_UINT max_obj_id = xref->entries->count + xref->start_offset;
     HPDF_STATUS ret;
+    char buf[HPDF_SHORT_BUF_SIZ];
 
     HPDF_PTRACE ((" WriteTrailer\n"));
 
@@ -326,10 +661,15 @@ WriteTrailer  (HPDF_Xref     xref,
             != HPDF_OK)
         return ret;
 
-    if (xref->prev)
+    if (xref->prev) {
+        if (xref->prev->addr > HPDF_LIMIT_MAX_INT)
+            return HPDF_SetError (xref->error,
+                    HPDF_STREAM_OFFSET_OUT_OF_RANGE, 0);
+
         if ((ret = HPDF_Dict_AddNumber (xref->trailer, "Prev",
-                xref->prev->addr)) != HPDF_OK)
+                (HPDF_INT32)xref->prev->addr)) != HPDF_OK)
             return ret;
+    }
 
     if ((ret = HPDF_Stream_WriteStr (stream, "trailer\012")) != HPDF_OK)
         return ret;
@@ -340,7 +680,8 @@ WriteTrailer  (HPDF_Xref     xref,
     if ((ret = HPDF_Stream_WriteStr (stream, "\012startxref\012")) != HPDF_OK)
         return ret;
 
-    if ((ret = HPDF_Stream_WriteUInt (stream, xref->addr)) != HPDF_OK)
+    HPDF_UInt64ToA (buf, xref->addr, buf + HPDF_SHORT_BUF_SIZ - 1);
+    if ((ret = HPDF_Stream_WriteStr (stream, buf)) != HPDF_OK)
         return ret;
 
     if ((ret = HPDF_Stream_WriteStr (stream, "\012%%EOF\012")) != HPDF_OK)
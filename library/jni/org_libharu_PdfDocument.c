@@ -16,6 +16,7 @@
 
 #include "org_libharu_PdfDocument.h"
 #include "hpdf.h"
+#include <stdint.h>
 #include <stdio.h>
 
 // for __android_log_print(ANDROID_LOG_INFO, "YourApp", "formatted message");
@@ -35,7 +36,7 @@ jfieldID mHPDFDocPointer;
  */
 JNIEXPORT void JNICALL
 Java_org_libharu_PdfDocument_initIDs(JNIEnv *env, jclass cls) {
-    mHPDFDocPointer = (*env)->GetFieldID(env, cls, "mHPDFDocPointer", "I");
+    mHPDFDocPointer = (*env)->GetFieldID(env, cls, "mHPDFDocPointer", "J");
     if (mHPDFDocPointer == NULL) {
         LOGE("Failed to find the field 'mHPDFDocPointer'");
     }
@@ -57,20 +58,41 @@ Java_org_libharu_PdfDocument_create__(JNIEnv *env, jobject obj) {
     }
 
     /* Set mHPDFDocPointer */
-    (*env)->SetIntField(env, obj, mHPDFDocPointer, (jint) pdf);
+    (*env)->SetLongField(env, obj, mHPDFDocPointer, (jlong) (intptr_t) pdf);
 
     return JNI_TRUE;
 }
 
 /*
  * Class:     org_libharu_PdfDocument
- * Method:    create
+ * Method:    createPooled
  * Signature: (I)Z
  */
 JNIEXPORT jboolean JNICALL
-Java_org_libharu_PdfDocument_create__I(JNIEnv *env, jclass cls, jint pdf) {
+Java_org_libharu_PdfDocument_createPooled(JNIEnv *env, jobject obj, jint blockSize) {
+    HPDF_Doc pdf;
+    /* Create the new document with a memory pool */
+    pdf = HPDF_NewEx(NULL, NULL, NULL, (HPDF_UINT) blockSize, NULL);
+    if (!pdf) {
+        LOGE("Failed to create pdf object");
+        return JNI_FALSE;
+    }
+
+    /* Set mHPDFDocPointer */
+    (*env)->SetLongField(env, obj, mHPDFDocPointer, (jlong) (intptr_t) pdf);
+
+    return JNI_TRUE;
+}
+
+/*
+ * Class:     org_libharu_PdfDocument
+ * Method:    create
+ * Signature: (J)Z
+ */
+JNIEXPORT jboolean JNICALL
+Java_org_libharu_PdfDocument_create__J(JNIEnv *env, jclass cls, jlong pdf) {
     HPDF_STATUS status;
-    status = HPDF_NewDoc((HPDF_Doc) pdf);
+    status = HPDF_NewDoc((HPDF_Doc) (intptr_t) pdf);
     if (status != HPDF_OK) {
         return JNI_FALSE;
     }
@@ -85,33 +107,33 @@ Java_org_libharu_PdfDocument_create__I(JNIEnv *env, jclass cls, jint pdf) {
  */
 JNIEXPORT void JNICALL
 Java_org_libharu_PdfDocument_free(JNIEnv *env, jobject obj) {
-    jint pdf;
+    jlong pdf;
     /* Get mHPDFDocPointer */
-    pdf = (*env)->GetIntField(env, obj, mHPDFDocPointer);
+    pdf = (*env)->GetLongField(env, obj, mHPDFDocPointer);
     /* Free the document */
-    HPDF_Free((HPDF_Doc) pdf);
+    HPDF_Free((HPDF_Doc) (intptr_t) pdf);
 }
 
 /*
  * Class:     org_libharu_PdfDocument
  * Method:    freeDoc
- * Signature: (I)V
+ * Signature: (J)V
  */
 JNIEXPORT void JNICALL
-Java_org_libharu_PdfDocument_freeDoc(JNIEnv *env, jclass cls, jint pdf) {
+Java_org_libharu_PdfDocument_freeDoc(JNIEnv *env, jclass cls, jlong pdf) {
     /* Free the provided document */
-    HPDF_FreeDoc((HPDF_Doc) pdf);
+    HPDF_FreeDoc((HPDF_Doc) (intptr_t) pdf);
 }
 
 /*
  * Class:     org_libharu_PdfDocument
  * Method:    freeDocAll
- * Signature: (I)V
+ * Signature: (J)V
  */
 JNIEXPORT void JNICALL
-Java_org_libharu_PdfDocument_freeDocAll(JNIEnv *env, jclass cls, jint pdf) {
+Java_org_libharu_PdfDocument_freeDocAll(JNIEnv *env, jclass cls, jlong pdf) {
     /* Free the provided document */
-    HPDF_FreeDocAll((HPDF_Doc) pdf);
+    HPDF_FreeDocAll((HPDF_Doc) (intptr_t) pdf);
 }
 
 /*
@@ -124,13 +146,13 @@ Java_org_libharu_PdfDocument_saveToFile(JNIEnv *env, jobject obj, jstring filena
     jboolean success = JNI_FALSE;
 
     /* Get mHPDFDocPointer */
-    jint pdf = (*env)->GetIntField(env, obj, mHPDFDocPointer);
+    jlong pdf = (*env)->GetLongField(env, obj, mHPDFDocPointer);
 
     /* Get filename */
     const char *name = (*env)->GetStringUTFChars(env, filename, NULL);
 
     /* Save to file */
-    HPDF_STATUS status = HPDF_SaveToFile((HPDF_Doc) pdf, name);
+    HPDF_STATUS status = HPDF_SaveToFile((HPDF_Doc) (intptr_t) pdf, name);
     if (status == HPDF_OK) {
         success = JNI_TRUE;
     } else {
@@ -152,11 +174,11 @@ Java_org_libharu_PdfDocument_saveToFile(JNIEnv *env, jobject obj, jstring filena
 /*
  * Class:     org_libharu_PdfDocument
  * Method:    hasDoc
- * Signature: (I)Z
+ * Signature: (J)Z
  */
 JNIEXPORT jboolean JNICALL
-Java_org_libharu_PdfDocument_hasDoc(JNIEnv *env, jclass cls, jint pdf) {
-    if (HPDF_HasDoc((HPDF_Doc) pdf)) {
+Java_org_libharu_PdfDocument_hasDoc(JNIEnv *env, jclass cls, jlong pdf) {
+    if (HPDF_HasDoc((HPDF_Doc) (intptr_t) pdf)) {
         return JNI_TRUE;
     }
     return JNI_FALSE;
@@ -170,7 +192,122 @@ Java_org_libharu_PdfDocument_hasDoc(JNIEnv *env, jclass cls, jint pdf) {
 JNIEXPORT void JNICALL
 Java_org_libharu_PdfDocument_setCompressionMode(JNIEnv *env, jobject obj, jint mode) {
     /* Get mHPDFDocPointer */
-    jint pdf = (*env)->GetIntField(env, obj, mHPDFDocPointer);
+    jlong pdf = (*env)->GetLongField(env, obj, mHPDFDocPointer);
+
+    HPDF_SetCompressionMode((HPDF_Doc) (intptr_t) pdf, (HPDF_UINT) mode);
+}
+
+/*
+ * Class:     org_libharu_PdfDocument
+ * Method:    setMemoryBudget
+ * Signature: (ILjava/lang/String;)V
+ */
+JNIEXPORT void JNICALL
+Java_org_libharu_PdfDocument_setMemoryBudget(JNIEnv *env, jobject obj, jint limit,
+        jstring tempDir) {
+    const char *dir = NULL;
+
+    /* Get mHPDFDocPointer */
+    jlong pdf = (*env)->GetLongField(env, obj, mHPDFDocPointer);
 
-    HPDF_SetCompressionMode((HPDF_Doc) pdf, (HPDF_UINT) mode);
+    /* Get the directory for temporary files */
+    if (tempDir != NULL) {
+        dir = (*env)->GetStringUTFChars(env, tempDir, NULL);
+    }
+
+    if (HPDF_SetMemoryBudget((HPDF_Doc) (intptr_t) pdf, (HPDF_UINT32) limit, dir) != HPDF_OK) {
+        LOGE("Failed to set memory budget of %d bytes", limit);
+    }
+
+    /* Release the native char array */
+    if (dir != NULL) {
+        (*env)->ReleaseStringUTFChars(env, tempDir, dir);
+    }
+}
+
+/*
+ * Class:     org_libharu_PdfDocument
+ * Method:    setRealPrecision
+ * Signature: (I)V
+ */
+JNIEXPORT void JNICALL
+Java_org_libharu_PdfDocument_setRealPrecision(JNIEnv *env, jobject obj, jint precision) {
+    /* Get mHPDFDocPointer */
+    jlong pdf = (*env)->GetLongField(env, obj, mHPDFDocPointer);
+
+    if (HPDF_SetRealPrecision((HPDF_Doc) (intptr_t) pdf, (HPDF_UINT) precision) != HPDF_OK) {
+        LOGE("Invalid real precision %d", precision);
+    }
+}
+
+/*
+ * Class:     org_libharu_PdfDocument
+ * Method:    setOptimizeContent
+ * Signature: (Z)V
+ */
+JNIEXPORT void JNICALL
+Java_org_libharu_PdfDocument_setOptimizeContent(JNIEnv *env, jobject obj, jboolean optimize) {
+    /* Get mHPDFDocPointer */
+    jlong pdf = (*env)->GetLongField(env, obj, mHPDFDocPointer);
+
+    HPDF_SetOptimizeContent((HPDF_Doc) (intptr_t) pdf, optimize ? HPDF_TRUE : HPDF_FALSE);
+}
+
+/*
+ * Class:     org_libharu_PdfDocument
+ * Method:    setShareResources
+ * Signature: (Z)V
+ */
+JNIEXPORT void JNICALL
+Java_org_libharu_PdfDocument_setShareResources(JNIEnv *env, jobject obj, jboolean share) {
+    /* Get mHPDFDocPointer */
+    jlong pdf = (*env)->GetLongField(env, obj, mHPDFDocPointer);
+
+    HPDF_SetShareResources((HPDF_Doc) (intptr_t) pdf, share ? HPDF_TRUE : HPDF_FALSE);
+}
+
+/*
+ * Class:     org_libharu_PdfDocument
+ * Method:    setCacheObjects
+ * Signature: (Z)V
+ */
+JNIEXPORT void JNICALL
+Java_org_libharu_PdfDocument_setCacheObjects(JNIEnv *env, jobject obj, jboolean cache) {
+    /* Get mHPDFDocPointer */
+    jlong pdf = (*env)->GetLongField(env, obj, mHPDFDocPointer);
+
+    HPDF_SetCacheObjects((HPDF_Doc) (intptr_t) pdf, cache ? HPDF_TRUE : HPDF_FALSE);
+}
+
+/*
+ * Class:     org_libharu_PdfDocument
+ * Method:    setImageResolution
+ * Signature: (F)V
+ */
+JNIEXPORT void JNICALL
+Java_org_libharu_PdfDocument_setImageResolution(JNIEnv *env, jobject obj, jfloat dpi) {
+    /* Get mHPDFDocPointer */
+    jlong pdf = (*env)->GetLongField(env, obj, mHPDFDocPointer);
+
+    if (HPDF_SetImageResolution((HPDF_Doc) (intptr_t) pdf, (HPDF_REAL) dpi) != HPDF_OK) {
+        LOGE("Invalid image resolution %f", dpi);
+    }
+}
+
+/*
+ * Class:     org_libharu_PdfDocument
+ * Method:    freezeTemplate
+ * Signature: ()Z
+ */
+JNIEXPORT jboolean JNICALL
+Java_org_libharu_PdfDocument_freezeTemplate(JNIEnv *env, jobject obj) {
+    /* Get mHPDFDocPointer */
+    jlong pdf = (*env)->GetLongField(env, obj, mHPDFDocPointer);
+
+    if (HPDF_SetTemplate((HPDF_Doc) (intptr_t) pdf) != HPDF_OK) {
+        LOGE("Failed to set the document as template");
+        return JNI_FALSE;
+    }
+
+    return JNI_TRUE;
 }
@@ -35,11 +35,19 @@ JNIEXPORT jboolean JNICALL Java_org_libharu_PdfDocument_create__
 
 /*
  * Class:     org_libharu_PdfDocument
- * Method:    create
+ * Method:    createPooled
  * Signature: (I)Z
  */
-JNIEXPORT jboolean JNICALL Java_org_libharu_PdfDocument_create__I
-  (JNIEnv *, jclass, jint);
+JNIEXPORT jboolean JNICALL Java_org_libharu_PdfDocument_createPooled
+  (JNIEnv *, jobject, jint);
+
+/*
+ * Class:     org_libharu_PdfDocument
+ * Method:    create
+ * Signature: (J)Z
+ */
+JNIEXPORT jboolean JNICALL Java_org_libharu_PdfDocument_create__J
+  (JNIEnv *, jclass, jlong);
 
 /*
  * Class:     org_libharu_PdfDocument
@@ -52,18 +60,18 @@ JNIEXPORT void JNICALL Java_org_libharu_PdfDocument_free
 /*
  * Class:     org_libharu_PdfDocument
  * Method:    freeDoc
- * Signature: (I)V
+ * Signature: (J)V
  */
 JNIEXPORT void JNICALL Java_org_libharu_PdfDocument_freeDoc
-  (JNIEnv *, jclass, jint);
+  (JNIEnv *, jclass, jlong);
 
 /*
  * Class:     org_libharu_PdfDocument
  * Method:    freeDocAll
- * Signature: (I)V
+ * Signature: (J)V
  */
 JNIEXPORT void JNICALL Java_org_libharu_PdfDocument_freeDocAll
-  (JNIEnv *, jclass, jint);
+  (JNIEnv *, jclass, jlong);
 
 /*
  * Class:     org_libharu_PdfDocument
@@ -76,10 +84,10 @@ JNIEXPORT jboolean JNICALL Java_org_libharu_PdfDocument_saveToFile
 /*
  * Class:     org_libharu_PdfDocument
  * Method:    hasDoc
- * Signature: (I)Z
+ * Signature: (J)Z
  */
 JNIEXPORT jboolean JNICALL Java_org_libharu_PdfDocument_hasDoc
-  (JNIEnv *, jclass, jint);
+  (JNIEnv *, jclass, jlong);
 
 /*
  * Class:     org_libharu_PdfDocument
@@ -89,6 +97,62 @@ JNIEXPORT jboolean JNICALL Java_org_libharu_PdfDocument_hasDoc
 JNIEXPORT void JNICALL Java_org_libharu_PdfDocument_setCompressionMode
   (JNIEnv *, jobject, jint);
 
+/*
+ * Class:     org_libharu_PdfDocument
+ * Method:    setMemoryBudget
+ * Signature: (ILjava/lang/String;)V
+ */
+JNIEXPORT void JNICALL Java_org_libharu_PdfDocument_setMemoryBudget
+  (JNIEnv *, jobject, jint, jstring);
+
+/*
+ * Class:     org_libharu_PdfDocument
+ * Method:    setRealPrecision
+ * Signature: (I)V
+ */
+JNIEXPORT void JNICALL Java_org_libharu_PdfDocument_setRealPrecision
+  (JNIEnv *, jobject, jint);
+
+/*
+ * Class:     org_libharu_PdfDocument
+ * Method:    setOptimizeContent
+ * Signature: (Z)V
+ */
+JNIEXPORT void JNICALL Java_org_libharu_PdfDocument_setOptimizeContent
+  (JNIEnv *, jobject, jboolean);
+
+/*
+ * Class:     org_libharu_PdfDocument
+ * Method:    setShareResources
+ * Signature: (Z)V
+ */
+JNIEXPORT void JNICALL Java_org_libharu_PdfDocument_setShareResources
+  (JNIEnv *, jobject, jboolean);
+
+/*
+ * Class:     org_libharu_PdfDocument
+ * Method:    setCacheObjects
+ * Signature: (Z)V
+ */
+JNIEXPORT void JNICALL Java_org_libharu_PdfDocument_setCacheObjects
+  (JNIEnv *, jobject, jboolean);
+
+/*
+ * Class:     org_libharu_PdfDocument
+ * Method:    setImageResolution
+ * Signature: (F)V
+ */
+JNIEXPORT void JNICALL Java_org_libharu_PdfDocument_setImageResolution
+  (JNIEnv *, jobject, jfloat);
+
+/*
+ * Class:     org_libharu_PdfDocument
+ * Method:    freezeTemplate
+ * Signature: ()Z
+ */
+JNIEXPORT jboolean JNICALL Java_org_libharu_PdfDocument_freezeTemplate
+  (JNIEnv *, jobject);
+
 #ifdef __cplusplus
 }
 #endif
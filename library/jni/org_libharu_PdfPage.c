@@ -16,14 +16,22 @@
 
 #include "org_libharu_PdfPage.h"
 #include "hpdf.h"
+#include <stdint.h>
 #include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
 
 // for __android_log_print(ANDROID_LOG_INFO, "YourApp", "formatted message");
+#include <android/bitmap.h>
 #include <android/log.h>
 #define TAG "Page"
 #define LOGD(...) ((void)__android_log_print(ANDROID_LOG_DEBUG, TAG, __VA_ARGS__))
 #define LOGE(...) ((void)__android_log_print(ANDROID_LOG_ERROR, TAG, __VA_ARGS__))
 
+/* AndroidBitmapInfo.flags alpha values; only newer NDK headers name them */
+#define BITMAP_FLAGS_ALPHA_MASK 0x3
+#define BITMAP_FLAGS_ALPHA_UNPREMUL 0x2
+
 /* Page enum values from Java */
 
 typedef enum _Size {
@@ -76,6 +84,86 @@ typedef enum _TextAlign {
     TEXT_ALIGN_JUSTIFY
 } TextAlign;
 
+typedef enum _BlendMode {
+    BLEND_MODE_NORMAL = 0,
+    BLEND_MODE_MULTIPLY,
+    BLEND_MODE_SCREEN,
+    BLEND_MODE_OVERLAY,
+    BLEND_MODE_DARKEN,
+    BLEND_MODE_LIGHTEN,
+    BLEND_MODE_COLOR_DODGE,
+    BLEND_MODE_COLOR_BURN,
+    BLEND_MODE_HARD_LIGHT,
+    BLEND_MODE_SOFT_LIGHT,
+    BLEND_MODE_DIFFERENCE,
+    BLEND_MODE_EXCLUSION
+} BlendMode;
+
+/* Command opcodes from PdfCommandBuffer */
+
+typedef enum _Command {
+    CMD_MOVE_TO = 1,
+    CMD_LINE_TO,
+    CMD_CURVE_TO,
+    CMD_CURVE_TO2,
+    CMD_CURVE_TO3,
+    CMD_RECTANGLE,
+    CMD_CIRCLE,
+    CMD_ELLIPSE,
+    CMD_ARC,
+    CMD_CLOSE_PATH,
+    CMD_END_PATH,
+    CMD_STROKE,
+    CMD_CLOSE_PATH_STROKE,
+    CMD_FILL,
+    CMD_EOFILL,
+    CMD_FILL_STROKE,
+    CMD_EOFILL_STROKE,
+    CMD_CLOSE_PATH_FILL_STROKE,
+    CMD_CLOSE_PATH_EOFILL_STROKE,
+    CMD_CLIP,
+    CMD_EOCLIP,
+    CMD_GSAVE,
+    CMD_GRESTORE,
+    CMD_CONCAT,
+    CMD_SET_LINE_WIDTH,
+    CMD_SET_LINE_CAP,
+    CMD_SET_LINE_JOIN,
+    CMD_SET_MITER_LIMIT,
+    CMD_SET_GRAY_FILL,
+    CMD_SET_GRAY_STROKE,
+    CMD_SET_RGB_FILL,
+    CMD_SET_RGB_STROKE,
+    CMD_SET_CMYK_FILL,
+    CMD_SET_CMYK_STROKE,
+    CMD_BEGIN_TEXT,
+    CMD_END_TEXT,
+    CMD_MOVE_TEXT_POS,
+    CMD_MOVE_TO_NEXT_LINE,
+    CMD_SHOW_TEXT,
+    CMD_SHOW_TEXT_NEXT_LINE,
+    CMD_TEXT_OUT,
+    CMD_SET_CHAR_SPACE,
+    CMD_SET_WORD_SPACE,
+    CMD_SET_TEXT_LEADING,
+    CMD_SET_HORIZONTAL_SCALING,
+    CMD_SET_TEXT_RISE,
+    CMD_SET_TEXT_RENDERING_MODE,
+    CMD_COUNT
+} Command;
+
+/* Number of 4 byte operands following each opcode */
+static const unsigned char commandOperands[CMD_COUNT] = {
+    0,                              /* unused */
+    2, 2, 6, 4, 4, 4, 3, 4, 5,      /* MOVE_TO .. ARC */
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,   /* CLOSE_PATH .. CLOSE_PATH_EOFILL_STROKE */
+    0, 0, 0, 0, 6,                  /* CLIP .. CONCAT */
+    1, 1, 1, 1,                     /* SET_LINE_WIDTH .. SET_MITER_LIMIT */
+    1, 1, 3, 3, 4, 4,               /* SET_GRAY_FILL .. SET_CMYK_STROKE */
+    0, 0, 2, 0, 1, 1, 3,            /* BEGIN_TEXT .. TEXT_OUT */
+    1, 1, 1, 1, 1, 1                /* SET_CHAR_SPACE .. SET_TEXT_RENDERING_MODE */
+};
+
 /* Helper functions to map Java enum values to native HPDF enum values */
 
 HPDF_PageSizes getHPDFPageSize(jint size) {
@@ -179,6 +267,39 @@ HPDF_TextRenderingMode getHPDFTextRenderingMode(jint mode) {
     return HPDF_FILL;
 }
 
+HPDF_BlendMode getHPDFBlendMode(jint mode) {
+    switch (mode) {
+        case BLEND_MODE_NORMAL:
+            return HPDF_BM_NORMAL;
+        case BLEND_MODE_MULTIPLY:
+            return HPDF_BM_MULTIPLY;
+        case BLEND_MODE_SCREEN:
+            return HPDF_BM_SCREEN;
+        case BLEND_MODE_OVERLAY:
+            return HPDF_BM_OVERLAY;
+        case BLEND_MODE_DARKEN:
+            return HPDF_BM_DARKEN;
+        case BLEND_MODE_LIGHTEN:
+            return HPDF_BM_LIGHTEN;
+        case BLEND_MODE_COLOR_DODGE:
+            return HPDF_BM_COLOR_DODGE;
+        case BLEND_MODE_COLOR_BURN:
+            return HPDF_BM_COLOR_BUM;
+        case BLEND_MODE_HARD_LIGHT:
+            return HPDF_BM_HARD_LIGHT;
+        case BLEND_MODE_SOFT_LIGHT:
+            return HPDF_BM_SOFT_LIGHT;
+        case BLEND_MODE_DIFFERENCE:
+            return HPDF_BM_DIFFERENCE;
+        case BLEND_MODE_EXCLUSION:
+            return HPDF_BM_EXCLUSHON;
+        default:
+            LOGE("Failed to match blend mode: %d", mode);
+            break;
+    }
+    return HPDF_BM_NORMAL;
+}
+
 HPDF_TextAlignment getHPDFTextAlign(jint align) {
     switch (align) {
         case TEXT_ALIGN_LEFT:
@@ -196,6 +317,16 @@ HPDF_TextAlignment getHPDFTextAlign(jint align) {
     return HPDF_TALIGN_LEFT;
 }
 
+/* Reduce an image to the document's image resolution for the size it is drawn at */
+void downsampleImage(jlong pdf, HPDF_Image image, jfloat width, jfloat height) {
+    HPDF_REAL dpi = HPDF_GetImageResolution((HPDF_Doc) (intptr_t) pdf);
+
+    if (image && dpi > 0) {
+        HPDF_Image_Downsample(image, (HPDF_REAL) (width < 0 ? -width : width),
+                (HPDF_REAL) (height < 0 ? -height : height), dpi);
+    }
+}
+
 /* Cached Page Fields */
 
 jfieldID mHPDFPagePointer;
@@ -210,12 +341,12 @@ JNIEXPORT void JNICALL
 Java_org_libharu_PdfPage_initIDs(JNIEnv *env, jclass cls) {
     jfieldID fid;
 
-    mHPDFPagePointer = (*env)->GetFieldID(env, cls, "mHPDFPagePointer", "I");
+    mHPDFPagePointer = (*env)->GetFieldID(env, cls, "mHPDFPagePointer", "J");
     if (mHPDFPagePointer == NULL) {
         LOGE("Failed to find the field 'mHPDFPagePointer'");
     }
 
-    mParentHPDFDocPointer = (*env)->GetFieldID(env, cls, "mParentHPDFDocPointer", "I");
+    mParentHPDFDocPointer = (*env)->GetFieldID(env, cls, "mParentHPDFDocPointer", "J");
     if (mParentHPDFDocPointer == NULL) {
         LOGE("Failed to find the field 'mParentHPDFDocPointer'");
     }
@@ -224,41 +355,61 @@ Java_org_libharu_PdfPage_initIDs(JNIEnv *env, jclass cls) {
 /*
  * Class:     org_libharu_PdfPage
  * Method:    create
- * Signature: (I)V
+ * Signature: (J)V
  */
 JNIEXPORT void JNICALL
-Java_org_libharu_PdfPage_create(JNIEnv *env, jobject obj, jint pdf) {
+Java_org_libharu_PdfPage_create(JNIEnv *env, jobject obj, jlong pdf) {
     HPDF_Page page;
     /* Create and add the new page */
-    page = HPDF_AddPage((HPDF_Doc) pdf);
+    page = HPDF_AddPage((HPDF_Doc) (intptr_t) pdf);
     if (page == NULL) {
         LOGE("Failed to create new page");
         return;
     }
     /* Set mHPDFPagePointer */
-    (*env)->SetIntField(env, obj, mHPDFPagePointer, (jint) page);
+    (*env)->SetLongField(env, obj, mHPDFPagePointer, (jlong) (intptr_t) page);
     /* Set mParentHPDFDocPointer*/
-    (*env)->SetIntField(env, obj, mParentHPDFDocPointer, pdf);
+    (*env)->SetLongField(env, obj, mParentHPDFDocPointer, pdf);
 }
 
 /*
  * Class:     org_libharu_PdfPage
  * Method:    insertPage
- * Signature: (II)V
+ * Signature: (JJ)V
  */
 JNIEXPORT void JNICALL
-Java_org_libharu_PdfPage_insertPage(JNIEnv *env, jobject obj, jint pdf, jint target) {
+Java_org_libharu_PdfPage_insertPage(JNIEnv *env, jobject obj, jlong pdf, jlong target) {
     HPDF_Page page;
     /* Create and insert the new page before the target page */
-    page = HPDF_InsertPage((HPDF_Doc) pdf, (HPDF_Page) target);
+    page = HPDF_InsertPage((HPDF_Doc) (intptr_t) pdf, (HPDF_Page) (intptr_t) target);
     if (page == NULL) {
         LOGE("Failed to create new page");
         return;
     }
     /* Set mHPDFPagePointer */
-    (*env)->SetIntField(env, obj, mHPDFPagePointer, (jint) page);
+    (*env)->SetLongField(env, obj, mHPDFPagePointer, (jlong) (intptr_t) page);
+    /* Set mParentHPDFDocPointer*/
+    (*env)->SetLongField(env, obj, mParentHPDFDocPointer, pdf);
+}
+
+/*
+ * Class:     org_libharu_PdfPage
+ * Method:    getPage
+ * Signature: (JI)V
+ */
+JNIEXPORT void JNICALL
+Java_org_libharu_PdfPage_getPage(JNIEnv *env, jobject obj, jlong pdf, jint index) {
+    HPDF_Page page;
+    /* Get the existing page */
+    page = HPDF_GetPageByIndex((HPDF_Doc) (intptr_t) pdf, (HPDF_UINT) index);
+    if (page == NULL) {
+        LOGE("Failed to get page %d", index);
+        return;
+    }
+    /* Set mHPDFPagePointer */
+    (*env)->SetLongField(env, obj, mHPDFPagePointer, (jlong) (intptr_t) page);
     /* Set mParentHPDFDocPointer*/
-    (*env)->SetIntField(env, obj, mParentHPDFDocPointer, pdf);
+    (*env)->SetLongField(env, obj, mParentHPDFDocPointer, pdf);
 }
 
 /*
@@ -268,11 +419,11 @@ Java_org_libharu_PdfPage_insertPage(JNIEnv *env, jobject obj, jint pdf, jint tar
  */
 JNIEXPORT void JNICALL
 Java_org_libharu_PdfPage_setSize(JNIEnv *env, jobject obj, jint size, jint direction) {
-    jint page;
+    jlong page;
     /* Get mHPDFPagePointer */
-    page = (*env)->GetIntField(env, obj, mHPDFPagePointer);
+    page = (*env)->GetLongField(env, obj, mHPDFPagePointer);
     /* Set page size */
-    HPDF_Page_SetSize((HPDF_Page) page, getHPDFPageSize(size), getHPDFPageDirection(direction));
+    HPDF_Page_SetSize((HPDF_Page) (intptr_t) page, getHPDFPageSize(size), getHPDFPageDirection(direction));
 }
 
 /*
@@ -282,11 +433,11 @@ Java_org_libharu_PdfPage_setSize(JNIEnv *env, jobject obj, jint size, jint direc
  */
 JNIEXPORT void JNICALL
 Java_org_libharu_PdfPage_setWidth(JNIEnv *env, jobject obj, jfloat width) {
-    jint page;
+    jlong page;
     /* Get mHPDFPagePointer */
-    page = (*env)->GetIntField(env, obj, mHPDFPagePointer);
+    page = (*env)->GetLongField(env, obj, mHPDFPagePointer);
     /* Set page size */
-    HPDF_Page_SetWidth((HPDF_Page) page, (HPDF_REAL) width);
+    HPDF_Page_SetWidth((HPDF_Page) (intptr_t) page, (HPDF_REAL) width);
 }
 
 /*
@@ -296,11 +447,11 @@ Java_org_libharu_PdfPage_setWidth(JNIEnv *env, jobject obj, jfloat width) {
  */
 JNIEXPORT void JNICALL
 Java_org_libharu_PdfPage_setHeight(JNIEnv *env, jobject obj, jfloat height) {
-    jint page;
+    jlong page;
     /* Get mHPDFPagePointer */
-    page = (*env)->GetIntField(env, obj, mHPDFPagePointer);
+    page = (*env)->GetLongField(env, obj, mHPDFPagePointer);
     /* Set page size */
-    HPDF_Page_SetHeight((HPDF_Page) page, (HPDF_REAL) height);
+    HPDF_Page_SetHeight((HPDF_Page) (intptr_t) page, (HPDF_REAL) height);
 }
 
 /*
@@ -310,10 +461,10 @@ Java_org_libharu_PdfPage_setHeight(JNIEnv *env, jobject obj, jfloat height) {
  */
 JNIEXPORT jfloat JNICALL
 Java_org_libharu_PdfPage_getWidth(JNIEnv *env, jobject obj) {
-    jint page;
+    jlong page;
     /* Get mHPDFPagePointer */
-    page = (*env)->GetIntField(env, obj, mHPDFPagePointer);
-    return HPDF_Page_GetWidth((HPDF_Page) page);
+    page = (*env)->GetLongField(env, obj, mHPDFPagePointer);
+    return HPDF_Page_GetWidth((HPDF_Page) (intptr_t) page);
 }
 
 /*
@@ -323,10 +474,10 @@ Java_org_libharu_PdfPage_getWidth(JNIEnv *env, jobject obj) {
  */
 JNIEXPORT jfloat JNICALL
 Java_org_libharu_PdfPage_getHeight(JNIEnv *env, jobject obj) {
-    jint page;
+    jlong page;
     /* Get mHPDFPagePointer */
-    page = (*env)->GetIntField(env, obj, mHPDFPagePointer);
-    return HPDF_Page_GetHeight((HPDF_Page) page);
+    page = (*env)->GetLongField(env, obj, mHPDFPagePointer);
+    return HPDF_Page_GetHeight((HPDF_Page) (intptr_t) page);
 }
 
 /*
@@ -336,10 +487,10 @@ Java_org_libharu_PdfPage_getHeight(JNIEnv *env, jobject obj) {
  */
 JNIEXPORT jfloat JNICALL
 Java_org_libharu_PdfPage_getLineWidth(JNIEnv *env, jobject obj) {
-    jint page;
+    jlong page;
     /* Get mHPDFPagePointer */
-    page = (*env)->GetIntField(env, obj, mHPDFPagePointer);
-    return HPDF_Page_GetLineWidth((HPDF_Page) page);
+    page = (*env)->GetLongField(env, obj, mHPDFPagePointer);
+    return HPDF_Page_GetLineWidth((HPDF_Page) (intptr_t) page);
 }
 
 /*
@@ -350,10 +501,10 @@ Java_org_libharu_PdfPage_getLineWidth(JNIEnv *env, jobject obj) {
 JNIEXPORT void JNICALL
 Java_org_libharu_PdfPage_arc(JNIEnv *env, jobject obj, jfloat x, jfloat y, jfloat radius,
         jfloat startAngle, jfloat endAngle) {
-    jint page;
+    jlong page;
     /* Get mHPDFPagePointer */
-    page = (*env)->GetIntField(env, obj, mHPDFPagePointer);
-    HPDF_Page_Arc((HPDF_Page) page, (HPDF_REAL) x, (HPDF_REAL) y, (HPDF_REAL) radius,
+    page = (*env)->GetLongField(env, obj, mHPDFPagePointer);
+    HPDF_Page_Arc((HPDF_Page) (intptr_t) page, (HPDF_REAL) x, (HPDF_REAL) y, (HPDF_REAL) radius,
             (HPDF_REAL) startAngle, (HPDF_REAL) endAngle);
 }
 
@@ -364,10 +515,10 @@ Java_org_libharu_PdfPage_arc(JNIEnv *env, jobject obj, jfloat x, jfloat y, jfloa
  */
 JNIEXPORT void JNICALL
 Java_org_libharu_PdfPage_beginText(JNIEnv *env, jobject obj) {
-    jint page;
+    jlong page;
     /* Get mHPDFPagePointer */
-    page = (*env)->GetIntField(env, obj, mHPDFPagePointer);
-    HPDF_Page_BeginText((HPDF_Page) page);
+    page = (*env)->GetLongField(env, obj, mHPDFPagePointer);
+    HPDF_Page_BeginText((HPDF_Page) (intptr_t) page);
 }
 
 /*
@@ -377,10 +528,10 @@ Java_org_libharu_PdfPage_beginText(JNIEnv *env, jobject obj) {
  */
 JNIEXPORT void JNICALL
 Java_org_libharu_PdfPage_circle(JNIEnv *env, jobject obj, jfloat x, jfloat y, jfloat radius) {
-    jint page;
+    jlong page;
     /* Get mHPDFPagePointer */
-    page = (*env)->GetIntField(env, obj, mHPDFPagePointer);
-    HPDF_Page_Circle((HPDF_Page) page, (HPDF_REAL) x, (HPDF_REAL) y, (HPDF_REAL) radius);
+    page = (*env)->GetLongField(env, obj, mHPDFPagePointer);
+    HPDF_Page_Circle((HPDF_Page) (intptr_t) page, (HPDF_REAL) x, (HPDF_REAL) y, (HPDF_REAL) radius);
 }
 
 /*
@@ -390,10 +541,10 @@ Java_org_libharu_PdfPage_circle(JNIEnv *env, jobject obj, jfloat x, jfloat y, jf
  */
 JNIEXPORT void JNICALL
 Java_org_libharu_PdfPage_clip(JNIEnv *env, jobject obj) {
-    jint page;
+    jlong page;
     /* Get mHPDFPagePointer */
-    page = (*env)->GetIntField(env, obj, mHPDFPagePointer);
-    HPDF_Page_Clip((HPDF_Page) page);
+    page = (*env)->GetLongField(env, obj, mHPDFPagePointer);
+    HPDF_Page_Clip((HPDF_Page) (intptr_t) page);
 }
 
 /*
@@ -403,10 +554,10 @@ Java_org_libharu_PdfPage_clip(JNIEnv *env, jobject obj) {
  */
 JNIEXPORT void JNICALL
 Java_org_libharu_PdfPage_closePath(JNIEnv *env, jobject obj) {
-    jint page;
+    jlong page;
     /* Get mHPDFPagePointer */
-    page = (*env)->GetIntField(env, obj, mHPDFPagePointer);
-    HPDF_Page_ClosePath((HPDF_Page) page);
+    page = (*env)->GetLongField(env, obj, mHPDFPagePointer);
+    HPDF_Page_ClosePath((HPDF_Page) (intptr_t) page);
 }
 
 /*
@@ -416,10 +567,10 @@ Java_org_libharu_PdfPage_closePath(JNIEnv *env, jobject obj) {
  */
 JNIEXPORT void JNICALL
 Java_org_libharu_PdfPage_closePathStroke(JNIEnv *env, jobject obj) {
-    jint page;
+    jlong page;
     /* Get mHPDFPagePointer */
-    page = (*env)->GetIntField(env, obj, mHPDFPagePointer);
-    HPDF_Page_ClosePathStroke((HPDF_Page) page);
+    page = (*env)->GetLongField(env, obj, mHPDFPagePointer);
+    HPDF_Page_ClosePathStroke((HPDF_Page) (intptr_t) page);
 }
 
 /*
@@ -429,10 +580,10 @@ Java_org_libharu_PdfPage_closePathStroke(JNIEnv *env, jobject obj) {
  */
 JNIEXPORT void JNICALL
 Java_org_libharu_PdfPage_closePathEofillStroke(JNIEnv *env, jobject obj) {
-    jint page;
+    jlong page;
     /* Get mHPDFPagePointer */
-    page = (*env)->GetIntField(env, obj, mHPDFPagePointer);
-    HPDF_Page_ClosePathEofillStroke((HPDF_Page) page);
+    page = (*env)->GetLongField(env, obj, mHPDFPagePointer);
+    HPDF_Page_ClosePathEofillStroke((HPDF_Page) (intptr_t) page);
 }
 
 /*
@@ -442,10 +593,10 @@ Java_org_libharu_PdfPage_closePathEofillStroke(JNIEnv *env, jobject obj) {
  */
 JNIEXPORT void JNICALL
 Java_org_libharu_PdfPage_closePathFillStroke(JNIEnv *env, jobject obj) {
-    jint page;
+    jlong page;
     /* Get mHPDFPagePointer */
-    page = (*env)->GetIntField(env, obj, mHPDFPagePointer);
-    HPDF_Page_ClosePathFillStroke((HPDF_Page) page);
+    page = (*env)->GetLongField(env, obj, mHPDFPagePointer);
+    HPDF_Page_ClosePathFillStroke((HPDF_Page) (intptr_t) page);
 }
 
 /*
@@ -456,10 +607,10 @@ Java_org_libharu_PdfPage_closePathFillStroke(JNIEnv *env, jobject obj) {
 JNIEXPORT void JNICALL
 Java_org_libharu_PdfPage_concat(JNIEnv *env, jobject obj, jfloat a, jfloat b, jfloat c, jfloat d,
         jfloat x, jfloat y) {
-    jint page;
+    jlong page;
     /* Get mHPDFPagePointer */
-    page = (*env)->GetIntField(env, obj, mHPDFPagePointer);
-    HPDF_Page_Concat((HPDF_Page) page, (HPDF_REAL) a, (HPDF_REAL) b, (HPDF_REAL) c, (HPDF_REAL) d,
+    page = (*env)->GetLongField(env, obj, mHPDFPagePointer);
+    HPDF_Page_Concat((HPDF_Page) (intptr_t) page, (HPDF_REAL) a, (HPDF_REAL) b, (HPDF_REAL) c, (HPDF_REAL) d,
             (HPDF_REAL) x, (HPDF_REAL) y);
 }
 
@@ -471,10 +622,10 @@ Java_org_libharu_PdfPage_concat(JNIEnv *env, jobject obj, jfloat a, jfloat b, jf
 JNIEXPORT void JNICALL
 Java_org_libharu_PdfPage_curveTo(JNIEnv *env, jobject obj, jfloat x1, jfloat y1, jfloat x2,
         jfloat y2, jfloat x3, jfloat y3) {
-    jint page;
+    jlong page;
     /* Get mHPDFPagePointer */
-    page = (*env)->GetIntField(env, obj, mHPDFPagePointer);
-    HPDF_Page_CurveTo((HPDF_Page) page, (HPDF_REAL) x1, (HPDF_REAL) y1, (HPDF_REAL) x2,
+    page = (*env)->GetLongField(env, obj, mHPDFPagePointer);
+    HPDF_Page_CurveTo((HPDF_Page) (intptr_t) page, (HPDF_REAL) x1, (HPDF_REAL) y1, (HPDF_REAL) x2,
             (HPDF_REAL) y2, (HPDF_REAL) x3, (HPDF_REAL) y3);
 }
 
@@ -486,10 +637,10 @@ Java_org_libharu_PdfPage_curveTo(JNIEnv *env, jobject obj, jfloat x1, jfloat y1,
 JNIEXPORT void JNICALL
 Java_org_libharu_PdfPage_curveTo2(JNIEnv *env, jobject obj, jfloat x2, jfloat y2, jfloat x3,
         jfloat y3) {
-    jint page;
+    jlong page;
     /* Get mHPDFPagePointer */
-    page = (*env)->GetIntField(env, obj, mHPDFPagePointer);
-    HPDF_Page_CurveTo2((HPDF_Page) page, (HPDF_REAL) x2, (HPDF_REAL) y2, (HPDF_REAL) x3,
+    page = (*env)->GetLongField(env, obj, mHPDFPagePointer);
+    HPDF_Page_CurveTo2((HPDF_Page) (intptr_t) page, (HPDF_REAL) x2, (HPDF_REAL) y2, (HPDF_REAL) x3,
             (HPDF_REAL) y3);
 }
 
@@ -501,10 +652,10 @@ Java_org_libharu_PdfPage_curveTo2(JNIEnv *env, jobject obj, jfloat x2, jfloat y2
 JNIEXPORT void JNICALL
 Java_org_libharu_PdfPage_curveTo3(JNIEnv *env, jobject obj, jfloat x1, jfloat y1, jfloat x3,
         jfloat y3) {
-    jint page;
+    jlong page;
     /* Get mHPDFPagePointer */
-    page = (*env)->GetIntField(env, obj, mHPDFPagePointer);
-    HPDF_Page_CurveTo3((HPDF_Page) page, (HPDF_REAL) x1, (HPDF_REAL) y1, (HPDF_REAL) x3,
+    page = (*env)->GetLongField(env, obj, mHPDFPagePointer);
+    HPDF_Page_CurveTo3((HPDF_Page) (intptr_t) page, (HPDF_REAL) x1, (HPDF_REAL) y1, (HPDF_REAL) x3,
             (HPDF_REAL) y3);
 }
 
@@ -516,14 +667,14 @@ Java_org_libharu_PdfPage_curveTo3(JNIEnv *env, jobject obj, jfloat x1, jfloat y1
 JNIEXPORT void JNICALL
 Java_org_libharu_PdfPage_drawJpegImage(JNIEnv *env, jobject obj, jbyteArray imageData, jfloat x,
         jfloat y, jfloat width, jfloat height) {
-    jint page, pdf;
+    jlong page, pdf;
     jbyte* buffer; /* The image data as a jbyte[] (really signed char[]) */
     jsize len; /* The number of elements in the image byte array */
 
     /* Get mHPDFPagePointer */
-    page = (*env)->GetIntField(env, obj, mHPDFPagePointer);
+    page = (*env)->GetLongField(env, obj, mHPDFPagePointer);
     /* Get mParentHPDFDocPointer */
-    pdf = (*env)->GetIntField(env, obj, mParentHPDFDocPointer);
+    pdf = (*env)->GetLongField(env, obj, mParentHPDFDocPointer);
 
     /* Get the image data as a native byte array */
     buffer = (*env)->GetByteArrayElements(env, imageData, NULL);
@@ -531,11 +682,11 @@ Java_org_libharu_PdfPage_drawJpegImage(JNIEnv *env, jobject obj, jbyteArray imag
     len = (*env)->GetArrayLength(env, imageData);
 
     /* Load an HPDF_Image from the image byte array */
-    HPDF_Image image = HPDF_LoadJpegImageFromMem((HPDF_Doc) pdf, (HPDF_BYTE*) buffer,
+    HPDF_Image image = HPDF_LoadJpegImageFromMem((HPDF_Doc) (intptr_t) pdf, (HPDF_BYTE*) buffer,
             (HPDF_UINT) (len * sizeof(jbyte)));
 
     /* Actually draw the image */
-    HPDF_Page_DrawImage((HPDF_Page) page, image, (HPDF_REAL) x, (HPDF_REAL) y, (HPDF_REAL) width,
+    HPDF_Page_DrawImage((HPDF_Page) (intptr_t) page, image, (HPDF_REAL) x, (HPDF_REAL) y, (HPDF_REAL) width,
             (HPDF_REAL) height);
 
     /* Release (free) the native byte array */
@@ -550,22 +701,22 @@ Java_org_libharu_PdfPage_drawJpegImage(JNIEnv *env, jobject obj, jbyteArray imag
 JNIEXPORT void JNICALL
 Java_org_libharu_PdfPage_drawJpegImageFromFile(JNIEnv *env, jobject obj, jstring path, jfloat x,
         jfloat y, jfloat width, jfloat height) {
-    jint page, pdf;
+    jlong page, pdf;
     const char* filename; /* The path of the file to load the image from */
 
     /* Get mHPDFPagePointer */
-    page = (*env)->GetIntField(env, obj, mHPDFPagePointer);
+    page = (*env)->GetLongField(env, obj, mHPDFPagePointer);
     /* Get mParentHPDFDocPointer */
-    pdf = (*env)->GetIntField(env, obj, mParentHPDFDocPointer);
+    pdf = (*env)->GetLongField(env, obj, mParentHPDFDocPointer);
 
     /* Get the filename as a native char array */
     filename = (*env)->GetStringUTFChars(env, path, NULL);
 
     /* Load an HPDF_Image from the file */
-    HPDF_Image image = HPDF_LoadJpegImageFromFile((HPDF_Doc) pdf, filename);
+    HPDF_Image image = HPDF_LoadJpegImageFromFile((HPDF_Doc) (intptr_t) pdf, filename);
 
     /* Actually draw the image */
-    HPDF_Page_DrawImage((HPDF_Page) page, image, (HPDF_REAL) x, (HPDF_REAL) y, (HPDF_REAL) width,
+    HPDF_Page_DrawImage((HPDF_Page) (intptr_t) page, image, (HPDF_REAL) x, (HPDF_REAL) y, (HPDF_REAL) width,
             (HPDF_REAL) height);
 
     /* Release (free) the native char array */
@@ -580,14 +731,14 @@ Java_org_libharu_PdfPage_drawJpegImageFromFile(JNIEnv *env, jobject obj, jstring
 JNIEXPORT void JNICALL
 Java_org_libharu_PdfPage_drawPngImage(JNIEnv *env, jobject obj, jbyteArray imageData, jfloat x,
         jfloat y, jfloat width, jfloat height) {
-    jint page, pdf;
+    jlong page, pdf;
     jbyte* buffer; /* The image data as a jbyte[] (really signed char[]) */
     jsize len; /* The number of elements in the image byte array */
 
     /* Get mHPDFPagePointer */
-    page = (*env)->GetIntField(env, obj, mHPDFPagePointer);
+    page = (*env)->GetLongField(env, obj, mHPDFPagePointer);
     /* Get mParentHPDFDocPointer */
-    pdf = (*env)->GetIntField(env, obj, mParentHPDFDocPointer);
+    pdf = (*env)->GetLongField(env, obj, mParentHPDFDocPointer);
 
     /* Get the image data as a native byte array */
     buffer = (*env)->GetByteArrayElements(env, imageData, NULL);
@@ -595,11 +746,12 @@ Java_org_libharu_PdfPage_drawPngImage(JNIEnv *env, jobject obj, jbyteArray image
     len = (*env)->GetArrayLength(env, imageData);
 
     /* Load an HPDF_Image from the image byte array */
-    HPDF_Image image = HPDF_LoadPngImageFromMem((HPDF_Doc) pdf, (HPDF_BYTE*) buffer,
+    HPDF_Image image = HPDF_LoadPngImageFromMem((HPDF_Doc) (intptr_t) pdf, (HPDF_BYTE*) buffer,
             (HPDF_UINT) (len * sizeof(jbyte)));
+    downsampleImage(pdf, image, width, height);
 
     /* Actually draw the image */
-    HPDF_Page_DrawImage((HPDF_Page) page, image, (HPDF_REAL) x, (HPDF_REAL) y, (HPDF_REAL) width,
+    HPDF_Page_DrawImage((HPDF_Page) (intptr_t) page, image, (HPDF_REAL) x, (HPDF_REAL) y, (HPDF_REAL) width,
             (HPDF_REAL) height);
 
     /* Release (free) the native byte array */
@@ -614,28 +766,87 @@ Java_org_libharu_PdfPage_drawPngImage(JNIEnv *env, jobject obj, jbyteArray image
 JNIEXPORT void JNICALL
 Java_org_libharu_PdfPage_drawPngImageFromFile(JNIEnv *env, jobject obj, jstring path, jfloat x,
         jfloat y, jfloat width, jfloat height) {
-    jint page, pdf;
+    jlong page, pdf;
     const char* filename; /* The path of the file to load the image from */
 
     /* Get mHPDFPagePointer */
-    page = (*env)->GetIntField(env, obj, mHPDFPagePointer);
+    page = (*env)->GetLongField(env, obj, mHPDFPagePointer);
     /* Get mParentHPDFDocPointer */
-    pdf = (*env)->GetIntField(env, obj, mParentHPDFDocPointer);
+    pdf = (*env)->GetLongField(env, obj, mParentHPDFDocPointer);
 
     /* Get the filename as a native char array */
     filename = (*env)->GetStringUTFChars(env, path, NULL);
 
     /* Load an HPDF_Image from the file */
-    HPDF_Image image = HPDF_LoadPngImageFromFile((HPDF_Doc) pdf, filename);
+    HPDF_Image image = HPDF_LoadPngImageFromFile((HPDF_Doc) (intptr_t) pdf, filename);
+    downsampleImage(pdf, image, width, height);
 
     /* Actually draw the image */
-    HPDF_Page_DrawImage((HPDF_Page) page, image, (HPDF_REAL) x, (HPDF_REAL) y, (HPDF_REAL) width,
+    HPDF_Page_DrawImage((HPDF_Page) (intptr_t) page, image, (HPDF_REAL) x, (HPDF_REAL) y, (HPDF_REAL) width,
             (HPDF_REAL) height);
 
     /* Release (free) the native char array */
     (*env)->ReleaseStringUTFChars(env, path, filename);
 }
 
+/*
+ * Class:     org_libharu_PdfPage
+ * Method:    drawBitmap
+ * Signature: (Landroid/graphics/Bitmap;FFFF)V
+ */
+JNIEXPORT void JNICALL
+Java_org_libharu_PdfPage_drawBitmap(JNIEnv *env, jobject obj, jobject bitmap, jfloat x,
+        jfloat y, jfloat width, jfloat height) {
+    jlong page, pdf;
+    AndroidBitmapInfo info;
+    HPDF_PixelFormat format;
+    void* pixels;
+    HPDF_Image image;
+
+    /* Get mHPDFPagePointer */
+    page = (*env)->GetLongField(env, obj, mHPDFPagePointer);
+    /* Get mParentHPDFDocPointer */
+    pdf = (*env)->GetLongField(env, obj, mParentHPDFDocPointer);
+
+    if (AndroidBitmap_getInfo(env, bitmap, &info) != ANDROID_BITMAP_RESULT_SUCCESS) {
+        LOGE("Failed to get the bitmap info");
+        return;
+    }
+
+    switch (info.format) {
+    case ANDROID_BITMAP_FORMAT_RGBA_8888:
+        /* Bitmap pixels are premultiplied unless the bitmap says otherwise */
+        format = HPDF_PIXEL_RGBA8888_PREMUL;
+        if ((info.flags & BITMAP_FLAGS_ALPHA_MASK) == BITMAP_FLAGS_ALPHA_UNPREMUL) {
+            format = HPDF_PIXEL_RGBA8888;
+        }
+        break;
+    case ANDROID_BITMAP_FORMAT_RGB_565:
+        format = HPDF_PIXEL_RGB565;
+        break;
+    default:
+        LOGE("Unsupported bitmap format: %d", info.format);
+        return;
+    }
+
+    /* Lock the pixels so they can be converted in place, without compressing the bitmap */
+    if (AndroidBitmap_lockPixels(env, bitmap, &pixels) != ANDROID_BITMAP_RESULT_SUCCESS) {
+        LOGE("Failed to lock the bitmap pixels");
+        return;
+    }
+
+    /* Load an HPDF_Image from the pixels */
+    image = HPDF_LoadPixelImageFromMem((HPDF_Doc) (intptr_t) pdf, (const HPDF_BYTE*) pixels,
+            (HPDF_UINT) info.width, (HPDF_UINT) info.height, (HPDF_UINT) info.stride, format);
+
+    AndroidBitmap_unlockPixels(env, bitmap);
+    downsampleImage(pdf, image, width, height);
+
+    /* Actually draw the image */
+    HPDF_Page_DrawImage((HPDF_Page) (intptr_t) page, image, (HPDF_REAL) x, (HPDF_REAL) y, (HPDF_REAL) width,
+            (HPDF_REAL) height);
+}
+
 /*
  * Class:     org_libharu_PdfPage
  * Method:    ellipse
@@ -644,10 +855,10 @@ Java_org_libharu_PdfPage_drawPngImageFromFile(JNIEnv *env, jobject obj, jstring
 JNIEXPORT void JNICALL
 Java_org_libharu_PdfPage_ellipse(JNIEnv *env, jobject obj, jfloat x, jfloat y, jfloat radiusX,
         jfloat radiusY) {
-    jint page;
+    jlong page;
     /* Get mHPDFPagePointer */
-    page = (*env)->GetIntField(env, obj, mHPDFPagePointer);
-    HPDF_Page_Ellipse((HPDF_Page) page, (HPDF_REAL) x, (HPDF_REAL) y, (HPDF_REAL) radiusX,
+    page = (*env)->GetLongField(env, obj, mHPDFPagePointer);
+    HPDF_Page_Ellipse((HPDF_Page) (intptr_t) page, (HPDF_REAL) x, (HPDF_REAL) y, (HPDF_REAL) radiusX,
             (HPDF_REAL) radiusY);
 }
 
@@ -658,10 +869,10 @@ Java_org_libharu_PdfPage_ellipse(JNIEnv *env, jobject obj, jfloat x, jfloat y, j
  */
 JNIEXPORT void JNICALL
 Java_org_libharu_PdfPage_endPath(JNIEnv *env, jobject obj) {
-    jint page;
+    jlong page;
     /* Get mHPDFPagePointer */
-    page = (*env)->GetIntField(env, obj, mHPDFPagePointer);
-    HPDF_Page_EndPath((HPDF_Page) page);
+    page = (*env)->GetLongField(env, obj, mHPDFPagePointer);
+    HPDF_Page_EndPath((HPDF_Page) (intptr_t) page);
 }
 
 /*
@@ -671,10 +882,10 @@ Java_org_libharu_PdfPage_endPath(JNIEnv *env, jobject obj) {
  */
 JNIEXPORT void JNICALL
 Java_org_libharu_PdfPage_endText(JNIEnv *env, jobject obj) {
-    jint page;
+    jlong page;
     /* Get mHPDFPagePointer */
-    page = (*env)->GetIntField(env, obj, mHPDFPagePointer);
-    HPDF_Page_EndText((HPDF_Page) page);
+    page = (*env)->GetLongField(env, obj, mHPDFPagePointer);
+    HPDF_Page_EndText((HPDF_Page) (intptr_t) page);
 }
 
 /*
@@ -684,10 +895,10 @@ Java_org_libharu_PdfPage_endText(JNIEnv *env, jobject obj) {
  */
 JNIEXPORT void JNICALL
 Java_org_libharu_PdfPage_eoclip(JNIEnv *env, jobject obj) {
-    jint page;
+    jlong page;
     /* Get mHPDFPagePointer */
-    page = (*env)->GetIntField(env, obj, mHPDFPagePointer);
-    HPDF_Page_Eoclip((HPDF_Page) page);
+    page = (*env)->GetLongField(env, obj, mHPDFPagePointer);
+    HPDF_Page_Eoclip((HPDF_Page) (intptr_t) page);
 }
 
 /*
@@ -697,10 +908,10 @@ Java_org_libharu_PdfPage_eoclip(JNIEnv *env, jobject obj) {
  */
 JNIEXPORT void JNICALL
 Java_org_libharu_PdfPage_eofill(JNIEnv *env, jobject obj) {
-    jint page;
+    jlong page;
     /* Get mHPDFPagePointer */
-    page = (*env)->GetIntField(env, obj, mHPDFPagePointer);
-    HPDF_Page_Eofill((HPDF_Page) page);
+    page = (*env)->GetLongField(env, obj, mHPDFPagePointer);
+    HPDF_Page_Eofill((HPDF_Page) (intptr_t) page);
 }
 
 /*
@@ -710,10 +921,10 @@ Java_org_libharu_PdfPage_eofill(JNIEnv *env, jobject obj) {
  */
 JNIEXPORT void JNICALL
 Java_org_libharu_PdfPage_eofillStroke(JNIEnv *env, jobject obj) {
-    jint page;
+    jlong page;
     /* Get mHPDFPagePointer */
-    page = (*env)->GetIntField(env, obj, mHPDFPagePointer);
-    HPDF_Page_EofillStroke((HPDF_Page) page);
+    page = (*env)->GetLongField(env, obj, mHPDFPagePointer);
+    HPDF_Page_EofillStroke((HPDF_Page) (intptr_t) page);
 }
 
 /*
@@ -723,10 +934,10 @@ Java_org_libharu_PdfPage_eofillStroke(JNIEnv *env, jobject obj) {
  */
 JNIEXPORT void JNICALL
 Java_org_libharu_PdfPage_fill(JNIEnv *env, jobject obj) {
-    jint page;
+    jlong page;
     /* Get mHPDFPagePointer */
-    page = (*env)->GetIntField(env, obj, mHPDFPagePointer);
-    HPDF_Page_Fill((HPDF_Page) page);
+    page = (*env)->GetLongField(env, obj, mHPDFPagePointer);
+    HPDF_Page_Fill((HPDF_Page) (intptr_t) page);
 }
 
 /*
@@ -736,10 +947,10 @@ Java_org_libharu_PdfPage_fill(JNIEnv *env, jobject obj) {
  */
 JNIEXPORT void JNICALL
 Java_org_libharu_PdfPage_fillStroke(JNIEnv *env, jobject obj) {
-    jint page;
+    jlong page;
     /* Get mHPDFPagePointer */
-    page = (*env)->GetIntField(env, obj, mHPDFPagePointer);
-    HPDF_Page_FillStroke((HPDF_Page) page);
+    page = (*env)->GetLongField(env, obj, mHPDFPagePointer);
+    HPDF_Page_FillStroke((HPDF_Page) (intptr_t) page);
 }
 
 /*
@@ -749,10 +960,10 @@ Java_org_libharu_PdfPage_fillStroke(JNIEnv *env, jobject obj) {
  */
 JNIEXPORT void JNICALL
 Java_org_libharu_PdfPage_gRestore(JNIEnv *env, jobject obj) {
-    jint page;
+    jlong page;
     /* Get mHPDFPagePointer */
-    page = (*env)->GetIntField(env, obj, mHPDFPagePointer);
-    HPDF_Page_GRestore((HPDF_Page) page);
+    page = (*env)->GetLongField(env, obj, mHPDFPagePointer);
+    HPDF_Page_GRestore((HPDF_Page) (intptr_t) page);
 }
 
 /*
@@ -762,10 +973,10 @@ Java_org_libharu_PdfPage_gRestore(JNIEnv *env, jobject obj) {
  */
 JNIEXPORT void JNICALL
 Java_org_libharu_PdfPage_gSave(JNIEnv *env, jobject obj) {
-    jint page;
+    jlong page;
     /* Get mHPDFPagePointer */
-    page = (*env)->GetIntField(env, obj, mHPDFPagePointer);
-    HPDF_Page_GSave((HPDF_Page) page);
+    page = (*env)->GetLongField(env, obj, mHPDFPagePointer);
+    HPDF_Page_GSave((HPDF_Page) (intptr_t) page);
 }
 
 /*
@@ -775,10 +986,10 @@ Java_org_libharu_PdfPage_gSave(JNIEnv *env, jobject obj) {
  */
 JNIEXPORT void JNICALL
 Java_org_libharu_PdfPage_lineTo(JNIEnv *env, jobject obj, jfloat x, jfloat y) {
-    jint page;
+    jlong page;
     /* Get mHPDFPagePointer */
-    page = (*env)->GetIntField(env, obj, mHPDFPagePointer);
-    HPDF_Page_LineTo((HPDF_Page) page, (HPDF_REAL) x, (HPDF_REAL) y);
+    page = (*env)->GetLongField(env, obj, mHPDFPagePointer);
+    HPDF_Page_LineTo((HPDF_Page) (intptr_t) page, (HPDF_REAL) x, (HPDF_REAL) y);
 }
 
 /*
@@ -788,10 +999,10 @@ Java_org_libharu_PdfPage_lineTo(JNIEnv *env, jobject obj, jfloat x, jfloat y) {
  */
 JNIEXPORT void JNICALL
 Java_org_libharu_PdfPage_moveTextPos(JNIEnv *env, jobject obj, jfloat x, jfloat y) {
-    jint page;
+    jlong page;
     /* Get mHPDFPagePointer */
-    page = (*env)->GetIntField(env, obj, mHPDFPagePointer);
-    HPDF_Page_MoveTextPos((HPDF_Page) page, (HPDF_REAL) x, (HPDF_REAL) y);
+    page = (*env)->GetLongField(env, obj, mHPDFPagePointer);
+    HPDF_Page_MoveTextPos((HPDF_Page) (intptr_t) page, (HPDF_REAL) x, (HPDF_REAL) y);
 }
 
 /*
@@ -801,10 +1012,10 @@ Java_org_libharu_PdfPage_moveTextPos(JNIEnv *env, jobject obj, jfloat x, jfloat
  */
 JNIEXPORT void JNICALL
 Java_org_libharu_PdfPage_moveTextPos2(JNIEnv *env, jobject obj, jfloat x, jfloat y) {
-    jint page;
+    jlong page;
     /* Get mHPDFPagePointer */
-    page = (*env)->GetIntField(env, obj, mHPDFPagePointer);
-    HPDF_Page_MoveTextPos2((HPDF_Page) page, (HPDF_REAL) x, (HPDF_REAL) y);
+    page = (*env)->GetLongField(env, obj, mHPDFPagePointer);
+    HPDF_Page_MoveTextPos2((HPDF_Page) (intptr_t) page, (HPDF_REAL) x, (HPDF_REAL) y);
 }
 
 /*
@@ -814,10 +1025,10 @@ Java_org_libharu_PdfPage_moveTextPos2(JNIEnv *env, jobject obj, jfloat x, jfloat
  */
 JNIEXPORT void JNICALL
 Java_org_libharu_PdfPage_moveTo(JNIEnv *env, jobject obj, jfloat x, jfloat y) {
-    jint page;
+    jlong page;
     /* Get mHPDFPagePointer */
-    page = (*env)->GetIntField(env, obj, mHPDFPagePointer);
-    HPDF_Page_MoveTo((HPDF_Page) page, (HPDF_REAL) x, (HPDF_REAL) y);
+    page = (*env)->GetLongField(env, obj, mHPDFPagePointer);
+    HPDF_Page_MoveTo((HPDF_Page) (intptr_t) page, (HPDF_REAL) x, (HPDF_REAL) y);
 }
 
 /*
@@ -827,10 +1038,79 @@ Java_org_libharu_PdfPage_moveTo(JNIEnv *env, jobject obj, jfloat x, jfloat y) {
  */
 JNIEXPORT void JNICALL
 Java_org_libharu_PdfPage_moveToNextLine(JNIEnv *env, jobject obj) {
-    jint page;
+    jlong page;
+    /* Get mHPDFPagePointer */
+    page = (*env)->GetLongField(env, obj, mHPDFPagePointer);
+    HPDF_Page_MoveToNextLine((HPDF_Page) (intptr_t) page);
+}
+
+/*
+ * Class:     org_libharu_PdfPage
+ * Method:    path
+ * Signature: (Ljava/lang/String;[F)V
+ */
+JNIEXPORT void JNICALL
+Java_org_libharu_PdfPage_path(JNIEnv *env, jobject obj, jstring ops, jfloatArray coords) {
+    jlong page;
+    const char *opsChars;
+    jfloat *coordElems = NULL;
+    jsize numCoords = 0;
+    /* Get mHPDFPagePointer */
+    page = (*env)->GetLongField(env, obj, mHPDFPagePointer);
+
+    opsChars = (*env)->GetStringUTFChars(env, ops, 0);
+    if (coords != NULL) {
+        numCoords = (*env)->GetArrayLength(env, coords);
+        coordElems = (*env)->GetFloatArrayElements(env, coords, NULL);
+    }
+
+    HPDF_Page_PathFromArrays((HPDF_Page) (intptr_t) page, opsChars, (HPDF_UINT) strlen(opsChars),
+            (const HPDF_REAL *) coordElems, (HPDF_UINT) numCoords);
+
+    if (coordElems != NULL) {
+        (*env)->ReleaseFloatArrayElements(env, coords, coordElems, JNI_ABORT);
+    }
+    (*env)->ReleaseStringUTFChars(env, ops, opsChars);
+}
+
+/*
+ * Class:     org_libharu_PdfPage
+ * Method:    polygon
+ * Signature: ([F)V
+ */
+JNIEXPORT void JNICALL
+Java_org_libharu_PdfPage_polygon(JNIEnv *env, jobject obj, jfloatArray xy) {
+    jlong page;
+    jfloat *points;
+    jsize length;
+    /* Get mHPDFPagePointer */
+    page = (*env)->GetLongField(env, obj, mHPDFPagePointer);
+
+    length = (*env)->GetArrayLength(env, xy);
+    points = (*env)->GetFloatArrayElements(env, xy, NULL);
+    /* The interleaved coordinates have the layout of an HPDF_Point array */
+    HPDF_Page_Polygon((HPDF_Page) (intptr_t) page, (const HPDF_Point *) points, (HPDF_UINT) (length / 2));
+    (*env)->ReleaseFloatArrayElements(env, xy, points, JNI_ABORT);
+}
+
+/*
+ * Class:     org_libharu_PdfPage
+ * Method:    polyline
+ * Signature: ([F)V
+ */
+JNIEXPORT void JNICALL
+Java_org_libharu_PdfPage_polyline(JNIEnv *env, jobject obj, jfloatArray xy) {
+    jlong page;
+    jfloat *points;
+    jsize length;
     /* Get mHPDFPagePointer */
-    page = (*env)->GetIntField(env, obj, mHPDFPagePointer);
-    HPDF_Page_MoveToNextLine((HPDF_Page) page);
+    page = (*env)->GetLongField(env, obj, mHPDFPagePointer);
+
+    length = (*env)->GetArrayLength(env, xy);
+    points = (*env)->GetFloatArrayElements(env, xy, NULL);
+    /* The interleaved coordinates have the layout of an HPDF_Point array */
+    HPDF_Page_Polyline((HPDF_Page) (intptr_t) page, (const HPDF_Point *) points, (HPDF_UINT) (length / 2));
+    (*env)->ReleaseFloatArrayElements(env, xy, points, JNI_ABORT);
 }
 
 /*
@@ -841,10 +1121,10 @@ Java_org_libharu_PdfPage_moveToNextLine(JNIEnv *env, jobject obj) {
 JNIEXPORT void JNICALL
 Java_org_libharu_PdfPage_rectangle(JNIEnv *env, jobject obj, jfloat x, jfloat y, jfloat width,
         jfloat height) {
-    jint page;
+    jlong page;
     /* Get mHPDFPagePointer */
-    page = (*env)->GetIntField(env, obj, mHPDFPagePointer);
-    HPDF_Page_Rectangle((HPDF_Page) page, (HPDF_REAL) x, (HPDF_REAL) y, (HPDF_REAL) width,
+    page = (*env)->GetLongField(env, obj, mHPDFPagePointer);
+    HPDF_Page_Rectangle((HPDF_Page) (intptr_t) page, (HPDF_REAL) x, (HPDF_REAL) y, (HPDF_REAL) width,
             (HPDF_REAL) height);
 }
 
@@ -855,10 +1135,10 @@ Java_org_libharu_PdfPage_rectangle(JNIEnv *env, jobject obj, jfloat x, jfloat y,
  */
 JNIEXPORT void JNICALL
 Java_org_libharu_PdfPage_setCharSpace(JNIEnv *env, jobject obj, jfloat value) {
-    jint page;
+    jlong page;
     /* Get mHPDFPagePointer */
-    page = (*env)->GetIntField(env, obj, mHPDFPagePointer);
-    HPDF_Page_SetCharSpace((HPDF_Page) page, (HPDF_REAL) value);
+    page = (*env)->GetLongField(env, obj, mHPDFPagePointer);
+    HPDF_Page_SetCharSpace((HPDF_Page) (intptr_t) page, (HPDF_REAL) value);
 }
 
 /*
@@ -869,10 +1149,10 @@ Java_org_libharu_PdfPage_setCharSpace(JNIEnv *env, jobject obj, jfloat value) {
 JNIEXPORT void JNICALL
 Java_org_libharu_PdfPage_setCMYKFill(JNIEnv *env, jobject obj, jfloat c, jfloat m, jfloat y,
         jfloat k) {
-    jint page;
+    jlong page;
     /* Get mHPDFPagePointer */
-    page = (*env)->GetIntField(env, obj, mHPDFPagePointer);
-    HPDF_Page_SetCMYKFill((HPDF_Page) page, (HPDF_REAL) c, (HPDF_REAL) m, (HPDF_REAL) y,
+    page = (*env)->GetLongField(env, obj, mHPDFPagePointer);
+    HPDF_Page_SetCMYKFill((HPDF_Page) (intptr_t) page, (HPDF_REAL) c, (HPDF_REAL) m, (HPDF_REAL) y,
             (HPDF_REAL) k);
 }
 
@@ -884,13 +1164,36 @@ Java_org_libharu_PdfPage_setCMYKFill(JNIEnv *env, jobject obj, jfloat c, jfloat
 JNIEXPORT void JNICALL
 Java_org_libharu_PdfPage_setCMYKStroke(JNIEnv *env, jobject obj, jfloat c, jfloat m, jfloat y,
         jfloat k) {
-    jint page;
+    jlong page;
     /* Get mHPDFPagePointer */
-    page = (*env)->GetIntField(env, obj, mHPDFPagePointer);
-    HPDF_Page_SetCMYKStroke((HPDF_Page) page, (HPDF_REAL) c, (HPDF_REAL) m, (HPDF_REAL) y,
+    page = (*env)->GetLongField(env, obj, mHPDFPagePointer);
+    HPDF_Page_SetCMYKStroke((HPDF_Page) (intptr_t) page, (HPDF_REAL) c, (HPDF_REAL) m, (HPDF_REAL) y,
             (HPDF_REAL) k);
 }
 
+/*
+ * Class:     org_libharu_PdfPage
+ * Method:    setExtGState
+ * Signature: (FFI)V
+ */
+JNIEXPORT void JNICALL
+Java_org_libharu_PdfPage_setExtGState(JNIEnv *env, jobject obj, jfloat alphaStroke,
+        jfloat alphaFill, jint blendMode) {
+    jlong page, pdf;
+    HPDF_ExtGState gstate;
+
+    /* Get mHPDFPagePointer */
+    page = (*env)->GetLongField(env, obj, mHPDFPagePointer);
+    /* Get mParentHPDFDocPointer */
+    pdf = (*env)->GetLongField(env, obj, mParentHPDFDocPointer);
+
+    gstate = HPDF_GetExtGState((HPDF_Doc) (intptr_t) pdf, (HPDF_REAL) alphaStroke, (HPDF_REAL) alphaFill,
+            getHPDFBlendMode(blendMode));
+    if (gstate) {
+        HPDF_Page_SetExtGState((HPDF_Page) (intptr_t) page, gstate);
+    }
+}
+
 /*
  * Class:     org_libharu_PdfPage
  * Method:    setGrayFill
@@ -898,10 +1201,10 @@ Java_org_libharu_PdfPage_setCMYKStroke(JNIEnv *env, jobject obj, jfloat c, jfloa
  */
 JNIEXPORT void JNICALL
 Java_org_libharu_PdfPage_setGrayFill(JNIEnv *env, jobject obj, jfloat gray) {
-    jint page;
+    jlong page;
     /* Get mHPDFPagePointer */
-    page = (*env)->GetIntField(env, obj, mHPDFPagePointer);
-    HPDF_Page_SetGrayFill((HPDF_Page) page, (HPDF_REAL) gray);
+    page = (*env)->GetLongField(env, obj, mHPDFPagePointer);
+    HPDF_Page_SetGrayFill((HPDF_Page) (intptr_t) page, (HPDF_REAL) gray);
 }
 
 /*
@@ -911,10 +1214,10 @@ Java_org_libharu_PdfPage_setGrayFill(JNIEnv *env, jobject obj, jfloat gray) {
  */
 JNIEXPORT void JNICALL
 Java_org_libharu_PdfPage_setGrayStroke(JNIEnv *env, jobject obj, jfloat gray) {
-    jint page;
+    jlong page;
     /* Get mHPDFPagePointer */
-    page = (*env)->GetIntField(env, obj, mHPDFPagePointer);
-    HPDF_Page_SetGrayStroke((HPDF_Page) page, (HPDF_REAL) gray);
+    page = (*env)->GetLongField(env, obj, mHPDFPagePointer);
+    HPDF_Page_SetGrayStroke((HPDF_Page) (intptr_t) page, (HPDF_REAL) gray);
 }
 
 /*
@@ -924,10 +1227,10 @@ Java_org_libharu_PdfPage_setGrayStroke(JNIEnv *env, jobject obj, jfloat gray) {
  */
 JNIEXPORT void JNICALL
 Java_org_libharu_PdfPage_setHorizontalScaling(JNIEnv *env, jobject obj, jfloat value) {
-    jint page;
+    jlong page;
     /* Get mHPDFPagePointer */
-    page = (*env)->GetIntField(env, obj, mHPDFPagePointer);
-    HPDF_Page_SetHorizontalScalling((HPDF_Page) page, (HPDF_REAL) value);
+    page = (*env)->GetLongField(env, obj, mHPDFPagePointer);
+    HPDF_Page_SetHorizontalScalling((HPDF_Page) (intptr_t) page, (HPDF_REAL) value);
 }
 
 /*
@@ -937,10 +1240,10 @@ Java_org_libharu_PdfPage_setHorizontalScaling(JNIEnv *env, jobject obj, jfloat v
  */
 JNIEXPORT void JNICALL
 Java_org_libharu_PdfPage_setLineCap(JNIEnv *env, jobject obj, jint lineCap) {
-    jint page;
+    jlong page;
     /* Get mHPDFPagePointer */
-    page = (*env)->GetIntField(env, obj, mHPDFPagePointer);
-    HPDF_Page_SetLineCap((HPDF_Page) page, getHPDFLineCap(lineCap));
+    page = (*env)->GetLongField(env, obj, mHPDFPagePointer);
+    HPDF_Page_SetLineCap((HPDF_Page) (intptr_t) page, getHPDFLineCap(lineCap));
 }
 
 /*
@@ -950,10 +1253,10 @@ Java_org_libharu_PdfPage_setLineCap(JNIEnv *env, jobject obj, jint lineCap) {
  */
 JNIEXPORT void JNICALL
 Java_org_libharu_PdfPage_setLineJoin(JNIEnv *env, jobject obj, jint lineJoin) {
-    jint page;
+    jlong page;
     /* Get mHPDFPagePointer */
-    page = (*env)->GetIntField(env, obj, mHPDFPagePointer);
-    HPDF_Page_SetLineJoin((HPDF_Page) page, getHPDFLineJoin(lineJoin));
+    page = (*env)->GetLongField(env, obj, mHPDFPagePointer);
+    HPDF_Page_SetLineJoin((HPDF_Page) (intptr_t) page, getHPDFLineJoin(lineJoin));
 }
 
 /*
@@ -963,10 +1266,10 @@ Java_org_libharu_PdfPage_setLineJoin(JNIEnv *env, jobject obj, jint lineJoin) {
  */
 JNIEXPORT void JNICALL
 Java_org_libharu_PdfPage_setLineWidth(JNIEnv *env, jobject obj, jfloat lineWidth) {
-    jint page;
+    jlong page;
     /* Get mHPDFPagePointer */
-    page = (*env)->GetIntField(env, obj, mHPDFPagePointer);
-    HPDF_Page_SetLineWidth((HPDF_Page) page, (HPDF_REAL) lineWidth);
+    page = (*env)->GetLongField(env, obj, mHPDFPagePointer);
+    HPDF_Page_SetLineWidth((HPDF_Page) (intptr_t) page, (HPDF_REAL) lineWidth);
 }
 
 /*
@@ -976,10 +1279,10 @@ Java_org_libharu_PdfPage_setLineWidth(JNIEnv *env, jobject obj, jfloat lineWidth
  */
 JNIEXPORT void JNICALL
 Java_org_libharu_PdfPage_setMiterLimit(JNIEnv *env, jobject obj, jfloat miterLimit) {
-    jint page;
+    jlong page;
     /* Get mHPDFPagePointer */
-    page = (*env)->GetIntField(env, obj, mHPDFPagePointer);
-    HPDF_Page_SetMiterLimit((HPDF_Page) page, (HPDF_REAL) miterLimit);
+    page = (*env)->GetLongField(env, obj, mHPDFPagePointer);
+    HPDF_Page_SetMiterLimit((HPDF_Page) (intptr_t) page, (HPDF_REAL) miterLimit);
 }
 
 /*
@@ -989,10 +1292,10 @@ Java_org_libharu_PdfPage_setMiterLimit(JNIEnv *env, jobject obj, jfloat miterLim
  */
 JNIEXPORT void JNICALL
 Java_org_libharu_PdfPage_setRGBFill(JNIEnv *env, jobject obj, jfloat red, jfloat green, jfloat blue) {
-    jint page;
+    jlong page;
     /* Get mHPDFPagePointer */
-    page = (*env)->GetIntField(env, obj, mHPDFPagePointer);
-    HPDF_Page_SetRGBFill((HPDF_Page) page, (HPDF_REAL) red, (HPDF_REAL) green, (HPDF_REAL) blue);
+    page = (*env)->GetLongField(env, obj, mHPDFPagePointer);
+    HPDF_Page_SetRGBFill((HPDF_Page) (intptr_t) page, (HPDF_REAL) red, (HPDF_REAL) green, (HPDF_REAL) blue);
 }
 
 /*
@@ -1003,10 +1306,10 @@ Java_org_libharu_PdfPage_setRGBFill(JNIEnv *env, jobject obj, jfloat red, jfloat
 JNIEXPORT void JNICALL
 Java_org_libharu_PdfPage_setRGBStroke(JNIEnv *env, jobject obj, jfloat red, jfloat green,
         jfloat blue) {
-    jint page;
+    jlong page;
     /* Get mHPDFPagePointer */
-    page = (*env)->GetIntField(env, obj, mHPDFPagePointer);
-    HPDF_Page_SetRGBStroke((HPDF_Page) page, (HPDF_REAL) red, (HPDF_REAL) green, (HPDF_REAL) blue);
+    page = (*env)->GetLongField(env, obj, mHPDFPagePointer);
+    HPDF_Page_SetRGBStroke((HPDF_Page) (intptr_t) page, (HPDF_REAL) red, (HPDF_REAL) green, (HPDF_REAL) blue);
 }
 
 /*
@@ -1016,10 +1319,10 @@ Java_org_libharu_PdfPage_setRGBStroke(JNIEnv *env, jobject obj, jfloat red, jflo
  */
 JNIEXPORT void JNICALL
 Java_org_libharu_PdfPage_setTextLeading(JNIEnv *env, jobject obj, jfloat value) {
-    jint page;
+    jlong page;
     /* Get mHPDFPagePointer */
-    page = (*env)->GetIntField(env, obj, mHPDFPagePointer);
-    HPDF_Page_SetTextLeading((HPDF_Page) page, (HPDF_REAL) value);
+    page = (*env)->GetLongField(env, obj, mHPDFPagePointer);
+    HPDF_Page_SetTextLeading((HPDF_Page) (intptr_t) page, (HPDF_REAL) value);
 }
 
 /*
@@ -1029,10 +1332,10 @@ Java_org_libharu_PdfPage_setTextLeading(JNIEnv *env, jobject obj, jfloat value)
  */
 JNIEXPORT void JNICALL
 Java_org_libharu_PdfPage_setTextRenderingMode(JNIEnv *env, jobject obj, jint mode) {
-    jint page;
+    jlong page;
     /* Get mHPDFPagePointer */
-    page = (*env)->GetIntField(env, obj, mHPDFPagePointer);
-    HPDF_Page_SetTextRenderingMode((HPDF_Page) page, getHPDFTextRenderingMode(mode));
+    page = (*env)->GetLongField(env, obj, mHPDFPagePointer);
+    HPDF_Page_SetTextRenderingMode((HPDF_Page) (intptr_t) page, getHPDFTextRenderingMode(mode));
 }
 
 /*
@@ -1042,10 +1345,10 @@ Java_org_libharu_PdfPage_setTextRenderingMode(JNIEnv *env, jobject obj, jint mod
  */
 JNIEXPORT void JNICALL
 Java_org_libharu_PdfPage_setTextRise(JNIEnv *env, jobject obj, jfloat value) {
-    jint page;
+    jlong page;
     /* Get mHPDFPagePointer */
-    page = (*env)->GetIntField(env, obj, mHPDFPagePointer);
-    HPDF_Page_SetTextRise((HPDF_Page) page, (HPDF_REAL) value);
+    page = (*env)->GetLongField(env, obj, mHPDFPagePointer);
+    HPDF_Page_SetTextRise((HPDF_Page) (intptr_t) page, (HPDF_REAL) value);
 }
 
 /*
@@ -1055,10 +1358,10 @@ Java_org_libharu_PdfPage_setTextRise(JNIEnv *env, jobject obj, jfloat value) {
  */
 JNIEXPORT void JNICALL
 Java_org_libharu_PdfPage_setTextWordSpace(JNIEnv *env, jobject obj, jfloat value) {
-    jint page;
+    jlong page;
     /* Get mHPDFPagePointer */
-    page = (*env)->GetIntField(env, obj, mHPDFPagePointer);
-    HPDF_Page_SetWordSpace((HPDF_Page) page, (HPDF_REAL) value);
+    page = (*env)->GetLongField(env, obj, mHPDFPagePointer);
+    HPDF_Page_SetWordSpace((HPDF_Page) (intptr_t) page, (HPDF_REAL) value);
 }
 
 /*
@@ -1068,16 +1371,16 @@ Java_org_libharu_PdfPage_setTextWordSpace(JNIEnv *env, jobject obj, jfloat value
  */
 JNIEXPORT void JNICALL
 Java_org_libharu_PdfPage_showText(JNIEnv *env, jobject obj, jstring textString) {
-    jint page;
+    jlong page;
     const char* text;
 
     /* Get mHPDFPagePointer */
-    page = (*env)->GetIntField(env, obj, mHPDFPagePointer);
+    page = (*env)->GetLongField(env, obj, mHPDFPagePointer);
 
     /* Get the text as a native char array */
     text = (*env)->GetStringUTFChars(env, textString, NULL);
 
-    HPDF_Page_ShowText((HPDF_Page) page, text);
+    HPDF_Page_ShowText((HPDF_Page) (intptr_t) page, text);
 
     /* Release (free) the native char array */
     (*env)->ReleaseStringUTFChars(env, textString, text);
@@ -1090,16 +1393,16 @@ Java_org_libharu_PdfPage_showText(JNIEnv *env, jobject obj, jstring textString)
  */
 JNIEXPORT void JNICALL
 Java_org_libharu_PdfPage_showTextNextLine(JNIEnv *env, jobject obj, jstring textString) {
-    jint page;
+    jlong page;
     const char* text;
 
     /* Get mHPDFPagePointer */
-    page = (*env)->GetIntField(env, obj, mHPDFPagePointer);
+    page = (*env)->GetLongField(env, obj, mHPDFPagePointer);
 
     /* Get the text as a native char array */
     text = (*env)->GetStringUTFChars(env, textString, NULL);
 
-    HPDF_Page_ShowTextNextLine((HPDF_Page) page, text);
+    HPDF_Page_ShowTextNextLine((HPDF_Page) (intptr_t) page, text);
 
     /* Release (free) the native char array */
     (*env)->ReleaseStringUTFChars(env, textString, text);
@@ -1113,16 +1416,16 @@ Java_org_libharu_PdfPage_showTextNextLine(JNIEnv *env, jobject obj, jstring text
 JNIEXPORT void JNICALL
 Java_org_libharu_PdfPage_showTextNextLineEx(JNIEnv *env, jobject obj, jfloat wordSpace,
         jfloat charSpace, jstring textString) {
-    jint page;
+    jlong page;
     const char* text;
 
     /* Get mHPDFPagePointer */
-    page = (*env)->GetIntField(env, obj, mHPDFPagePointer);
+    page = (*env)->GetLongField(env, obj, mHPDFPagePointer);
 
     /* Get the text as a native char array */
     text = (*env)->GetStringUTFChars(env, textString, NULL);
 
-    HPDF_Page_ShowTextNextLineEx((HPDF_Page) page, (HPDF_REAL) wordSpace, (HPDF_REAL) charSpace,
+    HPDF_Page_ShowTextNextLineEx((HPDF_Page) (intptr_t) page, (HPDF_REAL) wordSpace, (HPDF_REAL) charSpace,
             text);
 
     /* Release (free) the native char array */
@@ -1136,10 +1439,10 @@ Java_org_libharu_PdfPage_showTextNextLineEx(JNIEnv *env, jobject obj, jfloat wor
  */
 JNIEXPORT void JNICALL
 Java_org_libharu_PdfPage_stroke(JNIEnv *env, jobject obj) {
-    jint page;
+    jlong page;
     /* Get mHPDFPagePointer */
-    page = (*env)->GetIntField(env, obj, mHPDFPagePointer);
-    HPDF_Page_Stroke((HPDF_Page) page);
+    page = (*env)->GetLongField(env, obj, mHPDFPagePointer);
+    HPDF_Page_Stroke((HPDF_Page) (intptr_t) page);
 }
 
 /*
@@ -1149,16 +1452,16 @@ Java_org_libharu_PdfPage_stroke(JNIEnv *env, jobject obj) {
  */
 JNIEXPORT void JNICALL
 Java_org_libharu_PdfPage_textOut(JNIEnv *env, jobject obj, jfloat x, jfloat y, jstring textString) {
-    jint page;
+    jlong page;
     const char* text;
 
     /* Get mHPDFPagePointer */
-    page = (*env)->GetIntField(env, obj, mHPDFPagePointer);
+    page = (*env)->GetLongField(env, obj, mHPDFPagePointer);
 
     /* Get the text as a native char array */
     text = (*env)->GetStringUTFChars(env, textString, NULL);
 
-    HPDF_Page_TextOut((HPDF_Page) page, (HPDF_REAL) x, (HPDF_REAL) y, text);
+    HPDF_Page_TextOut((HPDF_Page) (intptr_t) page, (HPDF_REAL) x, (HPDF_REAL) y, text);
 
     /* Release (free) the native char array */
     (*env)->ReleaseStringUTFChars(env, textString, text);
@@ -1172,18 +1475,335 @@ Java_org_libharu_PdfPage_textOut(JNIEnv *env, jobject obj, jfloat x, jfloat y, j
 JNIEXPORT void JNICALL
 Java_org_libharu_PdfPage_textRect(JNIEnv *env, jobject obj, jfloat l, jfloat t, jfloat r, jfloat b,
         jstring textString, jint align) {
-    jint page;
+    jlong page;
     const char* text;
 
     /* Get mHPDFPagePointer */
-    page = (*env)->GetIntField(env, obj, mHPDFPagePointer);
+    page = (*env)->GetLongField(env, obj, mHPDFPagePointer);
 
     /* Get the text as a native char array */
     text = (*env)->GetStringUTFChars(env, textString, NULL);
 
-    HPDF_Page_TextRect((HPDF_Page) page, (HPDF_REAL) l, (HPDF_REAL) t, (HPDF_REAL) r, (HPDF_REAL) b,
+    HPDF_Page_TextRect((HPDF_Page) (intptr_t) page, (HPDF_REAL) l, (HPDF_REAL) t, (HPDF_REAL) r, (HPDF_REAL) b,
             text, getHPDFTextAlign(align), NULL);
 
     /* Release (free) the native char array */
     (*env)->ReleaseStringUTFChars(env, textString, text);
 }
+
+/*
+ * Class:     org_libharu_PdfPage
+ * Method:    createTextLayout
+ * Signature: (Ljava/lang/String;F)J
+ */
+JNIEXPORT jlong JNICALL
+Java_org_libharu_PdfPage_createTextLayout(JNIEnv *env, jobject obj, jstring textString,
+        jfloat width) {
+    jlong page;
+    const char* text;
+    HPDF_TextLayout layout;
+
+    /* Get mHPDFPagePointer */
+    page = (*env)->GetLongField(env, obj, mHPDFPagePointer);
+
+    /* Get the text as a native char array; the layout keeps its own copy */
+    text = (*env)->GetStringUTFChars(env, textString, NULL);
+
+    layout = HPDF_Page_LayoutText((HPDF_Page) (intptr_t) page, text, (HPDF_UINT) strlen(text),
+            (HPDF_REAL) width);
+    if (!layout) {
+        LOGE("Failed to lay out text");
+    }
+
+    /* Release (free) the native char array */
+    (*env)->ReleaseStringUTFChars(env, textString, text);
+
+    return (jlong) (intptr_t) layout;
+}
+
+/*
+ * Class:     org_libharu_PdfPage
+ * Method:    showTextLayout
+ * Signature: (JIFFFFI)I
+ */
+JNIEXPORT jint JNICALL
+Java_org_libharu_PdfPage_showTextLayout(JNIEnv *env, jobject obj, jlong layout, jint firstLine,
+        jfloat l, jfloat t, jfloat r, jfloat b, jint align) {
+    jlong page;
+    HPDF_UINT nextLine = (HPDF_UINT) firstLine;
+
+    /* Get mHPDFPagePointer */
+    page = (*env)->GetLongField(env, obj, mHPDFPagePointer);
+
+    HPDF_Page_ShowTextLayout((HPDF_Page) (intptr_t) page, (HPDF_TextLayout) (intptr_t) layout, (HPDF_UINT) firstLine,
+            (HPDF_REAL) l, (HPDF_REAL) t, (HPDF_REAL) r, (HPDF_REAL) b, getHPDFTextAlign(align),
+            &nextLine);
+
+    return (jint) nextLine;
+}
+
+/*
+ * Helper to get a string of the command batch as a native char array.
+ * The local reference is dropped right away, since a batch can use more
+ * distinct strings than the local reference table holds.
+ */
+
+static const char *getCommandString(JNIEnv *env, jobjectArray strings, const char **chars,
+        jint count, jint index) {
+    jstring ref;
+
+    if (index < 0 || index >= count) {
+        LOGE("Invalid string index in command buffer: %d", index);
+        return NULL;
+    }
+    if (chars[index] == NULL) {
+        ref = (jstring) (*env)->GetObjectArrayElement(env, strings, index);
+        if (ref != NULL) {
+            chars[index] = (*env)->GetStringUTFChars(env, ref, NULL);
+            (*env)->DeleteLocalRef(env, ref);
+        }
+    }
+    return chars[index];
+}
+
+/*
+ * Class:     org_libharu_PdfPage
+ * Method:    replayCommands
+ * Signature: (Ljava/nio/ByteBuffer;I[Ljava/lang/String;)V
+ */
+JNIEXPORT void JNICALL
+Java_org_libharu_PdfPage_replayCommands(JNIEnv *env, jobject obj, jobject commands, jint length,
+        jobjectArray strings) {
+    jlong page;
+    const jbyte *ptr;
+    const jbyte *end;
+    jint count = 0;
+    const char **chars = NULL;
+    jstring ref;
+    jint i;
+
+    /* Get mHPDFPagePointer once for the whole batch */
+    page = (*env)->GetLongField(env, obj, mHPDFPagePointer);
+
+    ptr = (const jbyte *) (*env)->GetDirectBufferAddress(env, commands);
+    if (ptr == NULL) {
+        LOGE("Command buffer is not a direct buffer");
+        return;
+    }
+    if (length < 0 || length > (*env)->GetDirectBufferCapacity(env, commands)) {
+        LOGE("Invalid command buffer length: %d", length);
+        return;
+    }
+    end = ptr + length;
+
+    /* The strings are converted on first use and released after the batch */
+    if (strings != NULL) {
+        count = (*env)->GetArrayLength(env, strings);
+    }
+    if (count > 0) {
+        chars = (const char **) calloc(count, sizeof(const char *));
+        if (chars == NULL) {
+            LOGE("Failed to allocate the string table of the command buffer");
+            return;
+        }
+    }
+
+    while (ptr < end) {
+        jint command = (unsigned char) *ptr++;
+        union {
+            jfloat f;
+            jint i;
+        } arg[6];
+        const char *text;
+        HPDF_STATUS status;
+
+        if (command <= 0 || command >= CMD_COUNT) {
+            LOGE("Invalid command in command buffer: %d", command);
+            break;
+        }
+        if (end - ptr < commandOperands[command] * 4) {
+            LOGE("Truncated command in command buffer: %d", command);
+            break;
+        }
+
+        /* The operands are not aligned; copy them out of the buffer */
+        memcpy(arg, ptr, commandOperands[command] * 4);
+        ptr += commandOperands[command] * 4;
+
+        switch (command) {
+            case CMD_MOVE_TO:
+                status = HPDF_Page_MoveTo((HPDF_Page) (intptr_t) page, arg[0].f, arg[1].f);
+                break;
+            case CMD_LINE_TO:
+                status = HPDF_Page_LineTo((HPDF_Page) (intptr_t) page, arg[0].f, arg[1].f);
+                break;
+            case CMD_CURVE_TO:
+                status = HPDF_Page_CurveTo((HPDF_Page) (intptr_t) page, arg[0].f, arg[1].f, arg[2].f,
+                        arg[3].f, arg[4].f, arg[5].f);
+                break;
+            case CMD_CURVE_TO2:
+                status = HPDF_Page_CurveTo2((HPDF_Page) (intptr_t) page, arg[0].f, arg[1].f, arg[2].f,
+                        arg[3].f);
+                break;
+            case CMD_CURVE_TO3:
+                status = HPDF_Page_CurveTo3((HPDF_Page) (intptr_t) page, arg[0].f, arg[1].f, arg[2].f,
+                        arg[3].f);
+                break;
+            case CMD_RECTANGLE:
+                status = HPDF_Page_Rectangle((HPDF_Page) (intptr_t) page, arg[0].f, arg[1].f, arg[2].f,
+                        arg[3].f);
+                break;
+            case CMD_CIRCLE:
+                status = HPDF_Page_Circle((HPDF_Page) (intptr_t) page, arg[0].f, arg[1].f, arg[2].f);
+                break;
+            case CMD_ELLIPSE:
+                status = HPDF_Page_Ellipse((HPDF_Page) (intptr_t) page, arg[0].f, arg[1].f, arg[2].f,
+                        arg[3].f);
+                break;
+            case CMD_ARC:
+                status = HPDF_Page_Arc((HPDF_Page) (intptr_t) page, arg[0].f, arg[1].f, arg[2].f, arg[3].f,
+                        arg[4].f);
+                break;
+            case CMD_CLOSE_PATH:
+                status = HPDF_Page_ClosePath((HPDF_Page) (intptr_t) page);
+                break;
+            case CMD_END_PATH:
+                status = HPDF_Page_EndPath((HPDF_Page) (intptr_t) page);
+                break;
+            case CMD_STROKE:
+                status = HPDF_Page_Stroke((HPDF_Page) (intptr_t) page);
+                break;
+            case CMD_CLOSE_PATH_STROKE:
+                status = HPDF_Page_ClosePathStroke((HPDF_Page) (intptr_t) page);
+                break;
+            case CMD_FILL:
+                status = HPDF_Page_Fill((HPDF_Page) (intptr_t) page);
+                break;
+            case CMD_EOFILL:
+                status = HPDF_Page_Eofill((HPDF_Page) (intptr_t) page);
+                break;
+            case CMD_FILL_STROKE:
+                status = HPDF_Page_FillStroke((HPDF_Page) (intptr_t) page);
+                break;
+            case CMD_EOFILL_STROKE:
+                status = HPDF_Page_EofillStroke((HPDF_Page) (intptr_t) page);
+                break;
+            case CMD_CLOSE_PATH_FILL_STROKE:
+                status = HPDF_Page_ClosePathFillStroke((HPDF_Page) (intptr_t) page);
+                break;
+            case CMD_CLOSE_PATH_EOFILL_STROKE:
+                status = HPDF_Page_ClosePathEofillStroke((HPDF_Page) (intptr_t) page);
+                break;
+            case CMD_CLIP:
+                status = HPDF_Page_Clip((HPDF_Page) (intptr_t) page);
+                break;
+            case CMD_EOCLIP:
+                status = HPDF_Page_Eoclip((HPDF_Page) (intptr_t) page);
+                break;
+            case CMD_GSAVE:
+                status = HPDF_Page_GSave((HPDF_Page) (intptr_t) page);
+                break;
+            case CMD_GRESTORE:
+                status = HPDF_Page_GRestore((HPDF_Page) (intptr_t) page);
+                break;
+            case CMD_CONCAT:
+                status = HPDF_Page_Concat((HPDF_Page) (intptr_t) page, arg[0].f, arg[1].f, arg[2].f,
+                        arg[3].f, arg[4].f, arg[5].f);
+                break;
+            case CMD_SET_LINE_WIDTH:
+                status = HPDF_Page_SetLineWidth((HPDF_Page) (intptr_t) page, arg[0].f);
+                break;
+            case CMD_SET_LINE_CAP:
+                status = HPDF_Page_SetLineCap((HPDF_Page) (intptr_t) page, getHPDFLineCap(arg[0].i));
+                break;
+            case CMD_SET_LINE_JOIN:
+                status = HPDF_Page_SetLineJoin((HPDF_Page) (intptr_t) page, getHPDFLineJoin(arg[0].i));
+                break;
+            case CMD_SET_MITER_LIMIT:
+                status = HPDF_Page_SetMiterLimit((HPDF_Page) (intptr_t) page, arg[0].f);
+                break;
+            case CMD_SET_GRAY_FILL:
+                status = HPDF_Page_SetGrayFill((HPDF_Page) (intptr_t) page, arg[0].f);
+                break;
+            case CMD_SET_GRAY_STROKE:
+                status = HPDF_Page_SetGrayStroke((HPDF_Page) (intptr_t) page, arg[0].f);
+                break;
+            case CMD_SET_RGB_FILL:
+                status = HPDF_Page_SetRGBFill((HPDF_Page) (intptr_t) page, arg[0].f, arg[1].f, arg[2].f);
+                break;
+            case CMD_SET_RGB_STROKE:
+                status = HPDF_Page_SetRGBStroke((HPDF_Page) (intptr_t) page, arg[0].f, arg[1].f, arg[2].f);
+                break;
+            case CMD_SET_CMYK_FILL:
+                status = HPDF_Page_SetCMYKFill((HPDF_Page) (intptr_t) page, arg[0].f, arg[1].f, arg[2].f,
+                        arg[3].f);
+                break;
+            case CMD_SET_CMYK_STROKE:
+                status = HPDF_Page_SetCMYKStroke((HPDF_Page) (intptr_t) page, arg[0].f, arg[1].f, arg[2].f,
+                        arg[3].f);
+                break;
+            case CMD_BEGIN_TEXT:
+                status = HPDF_Page_BeginText((HPDF_Page) (intptr_t) page);
+                break;
+            case CMD_END_TEXT:
+                status = HPDF_Page_EndText((HPDF_Page) (intptr_t) page);
+                break;
+            case CMD_MOVE_TEXT_POS:
+                status = HPDF_Page_MoveTextPos((HPDF_Page) (intptr_t) page, arg[0].f, arg[1].f);
+                break;
+            case CMD_MOVE_TO_NEXT_LINE:
+                status = HPDF_Page_MoveToNextLine((HPDF_Page) (intptr_t) page);
+                break;
+            case CMD_SHOW_TEXT:
+                text = getCommandString(env, strings, chars, count, arg[0].i);
+                status = HPDF_Page_ShowText((HPDF_Page) (intptr_t) page, text);
+                break;
+            case CMD_SHOW_TEXT_NEXT_LINE:
+                text = getCommandString(env, strings, chars, count, arg[0].i);
+                status = HPDF_Page_ShowTextNextLine((HPDF_Page) (intptr_t) page, text);
+                break;
+            case CMD_TEXT_OUT:
+                text = getCommandString(env, strings, chars, count, arg[2].i);
+                status = HPDF_Page_TextOut((HPDF_Page) (intptr_t) page, arg[0].f, arg[1].f, text);
+                break;
+            case CMD_SET_CHAR_SPACE:
+                status = HPDF_Page_SetCharSpace((HPDF_Page) (intptr_t) page, arg[0].f);
+                break;
+            case CMD_SET_WORD_SPACE:
+                status = HPDF_Page_SetWordSpace((HPDF_Page) (intptr_t) page, arg[0].f);
+                break;
+            case CMD_SET_TEXT_LEADING:
+                status = HPDF_Page_SetTextLeading((HPDF_Page) (intptr_t) page, arg[0].f);
+                break;
+            case CMD_SET_HORIZONTAL_SCALING:
+                status = HPDF_Page_SetHorizontalScalling((HPDF_Page) (intptr_t) page, arg[0].f);
+                break;
+            case CMD_SET_TEXT_RISE:
+                status = HPDF_Page_SetTextRise((HPDF_Page) (intptr_t) page, arg[0].f);
+                break;
+            case CMD_SET_TEXT_RENDERING_MODE:
+                status = HPDF_Page_SetTextRenderingMode((HPDF_Page) (intptr_t) page,
+                        getHPDFTextRenderingMode(arg[0].i));
+                break;
+            default:
+                status = HPDF_OK;
+                break;
+        }
+
+        /* Once the page is in error every further operator is skipped */
+        if (status != HPDF_OK) {
+            LOGE("Failed to replay command %d: 0x%04X", command, (unsigned int) status);
+            break;
+        }
+    }
+
+    /* Release (free) the native char arrays, one local reference at a time */
+    for (i = 0; i < count; i++) {
+        if (chars[i] != NULL) {
+            ref = (jstring) (*env)->GetObjectArrayElement(env, strings, i);
+            (*env)->ReleaseStringUTFChars(env, ref, chars[i]);
+            (*env)->DeleteLocalRef(env, ref);
+        }
+    }
+    free(chars);
+}
@@ -18,18 +18,26 @@ JNIEXPORT void JNICALL Java_org_libharu_PdfPage_initIDs
 /*
  * Class:     org_libharu_PdfPage
  * Method:    create
- * Signature: (I)V
+ * Signature: (J)V
  */
 JNIEXPORT void JNICALL Java_org_libharu_PdfPage_create
-  (JNIEnv *, jobject, jint);
+  (JNIEnv *, jobject, jlong);
 
 /*
  * Class:     org_libharu_PdfPage
  * Method:    insertPage
- * Signature: (II)V
+ * Signature: (JJ)V
  */
 JNIEXPORT void JNICALL Java_org_libharu_PdfPage_insertPage
-  (JNIEnv *, jobject, jint, jint);
+  (JNIEnv *, jobject, jlong, jlong);
+
+/*
+ * Class:     org_libharu_PdfPage
+ * Method:    getPage
+ * Signature: (JI)V
+ */
+JNIEXPORT void JNICALL Java_org_libharu_PdfPage_getPage
+  (JNIEnv *, jobject, jlong, jint);
 
 /*
  * Class:     org_libharu_PdfPage
@@ -207,6 +215,14 @@ JNIEXPORT void JNICALL Java_org_libharu_PdfPage_drawPngImage
 JNIEXPORT void JNICALL Java_org_libharu_PdfPage_drawPngImageFromFile
   (JNIEnv *, jobject, jstring, jfloat, jfloat, jfloat, jfloat);
 
+/*
+ * Class:     org_libharu_PdfPage
+ * Method:    drawBitmap
+ * Signature: (Landroid/graphics/Bitmap;FFFF)V
+ */
+JNIEXPORT void JNICALL Java_org_libharu_PdfPage_drawBitmap
+  (JNIEnv *, jobject, jobject, jfloat, jfloat, jfloat, jfloat);
+
 /*
  * Class:     org_libharu_PdfPage
  * Method:    ellipse
@@ -327,6 +343,30 @@ JNIEXPORT void JNICALL Java_org_libharu_PdfPage_moveTo
 JNIEXPORT void JNICALL Java_org_libharu_PdfPage_moveToNextLine
   (JNIEnv *, jobject);
 
+/*
+ * Class:     org_libharu_PdfPage
+ * Method:    path
+ * Signature: (Ljava/lang/String;[F)V
+ */
+JNIEXPORT void JNICALL Java_org_libharu_PdfPage_path
+  (JNIEnv *, jobject, jstring, jfloatArray);
+
+/*
+ * Class:     org_libharu_PdfPage
+ * Method:    polygon
+ * Signature: ([F)V
+ */
+JNIEXPORT void JNICALL Java_org_libharu_PdfPage_polygon
+  (JNIEnv *, jobject, jfloatArray);
+
+/*
+ * Class:     org_libharu_PdfPage
+ * Method:    polyline
+ * Signature: ([F)V
+ */
+JNIEXPORT void JNICALL Java_org_libharu_PdfPage_polyline
+  (JNIEnv *, jobject, jfloatArray);
+
 /*
  * Class:     org_libharu_PdfPage
  * Method:    rectangle
@@ -359,6 +399,14 @@ JNIEXPORT void JNICALL Java_org_libharu_PdfPage_setCMYKFill
 JNIEXPORT void JNICALL Java_org_libharu_PdfPage_setCMYKStroke
   (JNIEnv *, jobject, jfloat, jfloat, jfloat, jfloat);
 
+/*
+ * Class:     org_libharu_PdfPage
+ * Method:    setExtGState
+ * Signature: (FFI)V
+ */
+JNIEXPORT void JNICALL Java_org_libharu_PdfPage_setExtGState
+  (JNIEnv *, jobject, jfloat, jfloat, jint);
+
 /*
  * Class:     org_libharu_PdfPage
  * Method:    setGrayFill
@@ -511,6 +559,30 @@ JNIEXPORT void JNICALL Java_org_libharu_PdfPage_textOut
 JNIEXPORT void JNICALL Java_org_libharu_PdfPage_textRect
   (JNIEnv *, jobject, jfloat, jfloat, jfloat, jfloat, jstring, jint);
 
+/*
+ * Class:     org_libharu_PdfPage
+ * Method:    createTextLayout
+ * Signature: (Ljava/lang/String;F)J
+ */
+JNIEXPORT jlong JNICALL Java_org_libharu_PdfPage_createTextLayout
+  (JNIEnv *, jobject, jstring, jfloat);
+
+/*
+ * Class:     org_libharu_PdfPage
+ * Method:    showTextLayout
+ * Signature: (JIFFFFI)I
+ */
+JNIEXPORT jint JNICALL Java_org_libharu_PdfPage_showTextLayout
+  (JNIEnv *, jobject, jlong, jint, jfloat, jfloat, jfloat, jfloat, jint);
+
+/*
+ * Class:     org_libharu_PdfPage
+ * Method:    replayCommands
+ * Signature: (Ljava/nio/ByteBuffer;I[Ljava/lang/String;)V
+ */
+JNIEXPORT void JNICALL Java_org_libharu_PdfPage_replayCommands
+  (JNIEnv *, jobject, jobject, jint, jobjectArray);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,94 @@
+/*
+ * Copyright (C) 2012 Andrew Hughes <ashughes@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "org_libharu_PdfTextLayout.h"
+#include "hpdf.h"
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+// for __android_log_print(ANDROID_LOG_INFO, "YourApp", "formatted message");
+#include <android/log.h>
+#define TAG "TextLayout"
+#define LOGD(...) ((void)__android_log_print(ANDROID_LOG_DEBUG, TAG, __VA_ARGS__))
+#define LOGE(...) ((void)__android_log_print(ANDROID_LOG_ERROR, TAG, __VA_ARGS__))
+
+/*
+ * Class:     org_libharu_PdfTextLayout
+ * Method:    free
+ * Signature: (J)V
+ */
+JNIEXPORT void JNICALL
+Java_org_libharu_PdfTextLayout_free(JNIEnv *env, jclass cls, jlong layout) {
+    HPDF_TextLayout_Free((HPDF_TextLayout) (intptr_t) layout);
+}
+
+/*
+ * Class:     org_libharu_PdfTextLayout
+ * Method:    getLineCount
+ * Signature: (J)I
+ */
+JNIEXPORT jint JNICALL
+Java_org_libharu_PdfTextLayout_getLineCount(JNIEnv *env, jclass cls, jlong layout) {
+    return (jint) HPDF_TextLayout_GetLineCount((HPDF_TextLayout) (intptr_t) layout);
+}
+
+/*
+ * Class:     org_libharu_PdfTextLayout
+ * Method:    getLineWidth
+ * Signature: (JI)F
+ */
+JNIEXPORT jfloat JNICALL
+Java_org_libharu_PdfTextLayout_getLineWidth(JNIEnv *env, jclass cls, jlong layout, jint index) {
+    HPDF_TextLine line = HPDF_TextLayout_GetLine((HPDF_TextLayout) (intptr_t) layout, (HPDF_UINT) index);
+
+    return (jfloat) line.width;
+}
+
+/*
+ * Class:     org_libharu_PdfTextLayout
+ * Method:    getLineText
+ * Signature: (JI)Ljava/lang/String;
+ */
+JNIEXPORT jstring JNICALL
+Java_org_libharu_PdfTextLayout_getLineText(JNIEnv *env, jclass cls, jlong layout, jint index) {
+    HPDF_TextLine line;
+    const char *text;
+    char *lineText;
+    jstring result;
+
+    if (index < 0 || (HPDF_UINT) index >= HPDF_TextLayout_GetLineCount((HPDF_TextLayout) (intptr_t) layout)) {
+        LOGE("Invalid line index: %d", index);
+        return NULL;
+    }
+
+    line = HPDF_TextLayout_GetLine((HPDF_TextLayout) (intptr_t) layout, (HPDF_UINT) index);
+    text = HPDF_TextLayout_GetText((HPDF_TextLayout) (intptr_t) layout);
+
+    /* NewStringUTF needs a terminated copy of the line */
+    lineText = (char *) malloc(line.len + 1);
+    if (lineText == NULL) {
+        LOGE("Failed to allocate the text of line %d", index);
+        return NULL;
+    }
+    memcpy(lineText, text + line.start, line.len);
+    lineText[line.len] = 0;
+
+    result = (*env)->NewStringUTF(env, lineText);
+    free(lineText);
+
+    return result;
+}
@@ -0,0 +1,45 @@
+/* DO NOT EDIT THIS FILE - it is machine generated */
+#include <jni.h>
+/* Header for class org_libharu_PdfTextLayout */
+
+#ifndef _Included_org_libharu_PdfTextLayout
+#define _Included_org_libharu_PdfTextLayout
+#ifdef __cplusplus
+extern "C" {
+#endif
+/*
+ * Class:     org_libharu_PdfTextLayout
+ * Method:    free
+ * Signature: (J)V
+ */
+JNIEXPORT void JNICALL Java_org_libharu_PdfTextLayout_free
+  (JNIEnv *, jclass, jlong);
+
+/*
+ * Class:     org_libharu_PdfTextLayout
+ * Method:    getLineCount
+ * Signature: (J)I
+ */
+JNIEXPORT jint JNICALL Java_org_libharu_PdfTextLayout_getLineCount
+  (JNIEnv *, jclass, jlong);
+
+/*
+ * Class:     org_libharu_PdfTextLayout
+ * Method:    getLineWidth
+ * Signature: (JI)F
+ */
+JNIEXPORT jfloat JNICALL Java_org_libharu_PdfTextLayout_getLineWidth
+  (JNIEnv *, jclass, jlong, jint);
+
+/*
+ * Class:     org_libharu_PdfTextLayout
+ * Method:    getLineText
+ * Signature: (JI)Ljava/lang/String;
+ */
+JNIEXPORT jstring JNICALL Java_org_libharu_PdfTextLayout_getLineText
+  (JNIEnv *, jclass, jlong, jint);
+
+#ifdef __cplusplus
+}
+#endif
+#endif
@@ -0,0 +1,427 @@
+/*
+ * Copyright (C) 2012 Andrew Hughes <ashughes@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package org.libharu;
+
+import java.nio.ByteBuffer;
+import java.nio.ByteOrder;
+import java.util.ArrayList;
+import java.util.HashMap;
+
+/**
+ * Records drawing operations for a {@link PdfPage} and replays them in a single native call.
+ * <p>
+ * Each call to a drawing method of {@link PdfPage} crosses into native code. When drawing
+ * thousands of path segments, record them here instead and call {@link #flush()} when done. The
+ * buffer is flushed automatically when it fills up. Operations are applied to the page in the
+ * order they are recorded, but only once they have been flushed.
+ */
+public class PdfCommandBuffer {
+
+    /** Default size of the command buffer in bytes */
+    public static final int DEFAULT_CAPACITY = 64 * 1024;
+
+    /*
+     * Command opcodes. Each opcode is followed by its operands, each 4 bytes in native byte order.
+     * These values must match the Command enum in org_libharu_PdfPage.c.
+     */
+
+    static final byte CMD_MOVE_TO = 1;
+    static final byte CMD_LINE_TO = 2;
+    static final byte CMD_CURVE_TO = 3;
+    static final byte CMD_CURVE_TO2 = 4;
+    static final byte CMD_CURVE_TO3 = 5;
+    static final byte CMD_RECTANGLE = 6;
+    static final byte CMD_CIRCLE = 7;
+    static final byte CMD_ELLIPSE = 8;
+    static final byte CMD_ARC = 9;
+    static final byte CMD_CLOSE_PATH = 10;
+    static final byte CMD_END_PATH = 11;
+    static final byte CMD_STROKE = 12;
+    static final byte CMD_CLOSE_PATH_STROKE = 13;
+    static final byte CMD_FILL = 14;
+    static final byte CMD_EOFILL = 15;
+    static final byte CMD_FILL_STROKE = 16;
+    static final byte CMD_EOFILL_STROKE = 17;
+    static final byte CMD_CLOSE_PATH_FILL_STROKE = 18;
+    static final byte CMD_CLOSE_PATH_EOFILL_STROKE = 19;
+    static final byte CMD_CLIP = 20;
+    static final byte CMD_EOCLIP = 21;
+    static final byte CMD_GSAVE = 22;
+    static final byte CMD_GRESTORE = 23;
+    static final byte CMD_CONCAT = 24;
+    static final byte CMD_SET_LINE_WIDTH = 25;
+    static final byte CMD_SET_LINE_CAP = 26;
+    static final byte CMD_SET_LINE_JOIN = 27;
+    static final byte CMD_SET_MITER_LIMIT = 28;
+    static final byte CMD_SET_GRAY_FILL = 29;
+    static final byte CMD_SET_GRAY_STROKE = 30;
+    static final byte CMD_SET_RGB_FILL = 31;
+    static final byte CMD_SET_RGB_STROKE = 32;
+    static final byte CMD_SET_CMYK_FILL = 33;
+    static final byte CMD_SET_CMYK_STROKE = 34;
+    static final byte CMD_BEGIN_TEXT = 35;
+    static final byte CMD_END_TEXT = 36;
+    static final byte CMD_MOVE_TEXT_POS = 37;
+    static final byte CMD_MOVE_TO_NEXT_LINE = 38;
+    static final byte CMD_SHOW_TEXT = 39;
+    static final byte CMD_SHOW_TEXT_NEXT_LINE = 40;
+    static final byte CMD_TEXT_OUT = 41;
+    static final byte CMD_SET_CHAR_SPACE = 42;
+    static final byte CMD_SET_WORD_SPACE = 43;
+    static final byte CMD_SET_TEXT_LEADING = 44;
+    static final byte CMD_SET_HORIZONTAL_SCALING = 45;
+    static final byte CMD_SET_TEXT_RISE = 46;
+    static final byte CMD_SET_TEXT_RENDERING_MODE = 47;
+
+    /** Size of the largest command (opcode and six operands) */
+    private static final int MAX_COMMAND_SIZE = 1 + 6 * 4;
+
+    /** The page that the commands are replayed on */
+    private final PdfPage mPage;
+
+    /** The encoded commands */
+    private final ByteBuffer mBuffer;
+
+    /** The strings referenced by the commands of the current batch */
+    private final ArrayList<String> mStrings = new ArrayList<String>();
+    private final HashMap<String, Integer> mStringIndex = new HashMap<String, Integer>();
+
+    /**
+     * Create a command buffer of {@link #DEFAULT_CAPACITY} bytes for the provided page.
+     *
+     * @param page The page to replay the recorded commands on.
+     */
+    public PdfCommandBuffer(PdfPage page) {
+        this(page, DEFAULT_CAPACITY);
+    }
+
+    /**
+     * Create a command buffer for the provided page.
+     *
+     * @param page The page to replay the recorded commands on.
+     * @param capacity The size of the buffer in bytes. The buffer is flushed when it is full.
+     */
+    public PdfCommandBuffer(PdfPage page, int capacity) {
+        mPage = page;
+        mBuffer = ByteBuffer.allocateDirect(Math.max(capacity, MAX_COMMAND_SIZE));
+        mBuffer.order(ByteOrder.nativeOrder());
+    }
+
+    /**
+     * Replay all recorded commands on the page and empty the buffer.
+     */
+    public void flush() {
+        if (mBuffer.position() > 0) {
+            String[] strings = mStrings.toArray(new String[mStrings.size()]);
+            mPage.replayCommands(mBuffer, mBuffer.position(), strings);
+        }
+        mBuffer.clear();
+        mStrings.clear();
+        mStringIndex.clear();
+    }
+
+    /** @see PdfPage#moveTo(float, float) */
+    public void moveTo(float x, float y) {
+        put(CMD_MOVE_TO, x, y);
+    }
+
+    /** @see PdfPage#lineTo(float, float) */
+    public void lineTo(float x, float y) {
+        put(CMD_LINE_TO, x, y);
+    }
+
+    /** @see PdfPage#curveTo(float, float, float, float, float, float) */
+    public void curveTo(float x1, float y1, float x2, float y2, float x3, float y3) {
+        begin(CMD_CURVE_TO, 6);
+        mBuffer.putFloat(x1).putFloat(y1).putFloat(x2).putFloat(y2).putFloat(x3).putFloat(y3);
+    }
+
+    /** @see PdfPage#curveTo2(float, float, float, float) */
+    public void curveTo2(float x2, float y2, float x3, float y3) {
+        put(CMD_CURVE_TO2, x2, y2, x3, y3);
+    }
+
+    /** @see PdfPage#curveTo3(float, float, float, float) */
+    public void curveTo3(float x1, float y1, float x3, float y3) {
+        put(CMD_CURVE_TO3, x1, y1, x3, y3);
+    }
+
+    /** @see PdfPage#rectangle(float, float, float, float) */
+    public void rectangle(float x, float y, float width, float height) {
+        put(CMD_RECTANGLE, x, y, width, height);
+    }
+
+    /** @see PdfPage#circle(float, float, float) */
+    public void circle(float x, float y, float radius) {
+        put(CMD_CIRCLE, x, y, radius);
+    }
+
+    /** @see PdfPage#ellipse(float, float, float, float) */
+    public void ellipse(float x, float y, float radiusX, float radiusY) {
+        put(CMD_ELLIPSE, x, y, radiusX, radiusY);
+    }
+
+    /** @see PdfPage#arc(float, float, float, float, float) */
+    public void arc(float x, float y, float radius, float startAngle, float endAngle) {
+        begin(CMD_ARC, 5);
+        mBuffer.putFloat(x).putFloat(y).putFloat(radius).putFloat(startAngle).putFloat(endAngle);
+    }
+
+    /** @see PdfPage#closePath() */
+    public void closePath() {
+        begin(CMD_CLOSE_PATH, 0);
+    }
+
+    /** @see PdfPage#endPath() */
+    public void endPath() {
+        begin(CMD_END_PATH, 0);
+    }
+
+    /** @see PdfPage#stroke() */
+    public void stroke() {
+        begin(CMD_STROKE, 0);
+    }
+
+    /** @see PdfPage#closePathStroke() */
+    public void closePathStroke() {
+        begin(CMD_CLOSE_PATH_STROKE, 0);
+    }
+
+    /** @see PdfPage#fill() */
+    public void fill() {
+        begin(CMD_FILL, 0);
+    }
+
+    /** @see PdfPage#eofill() */
+    public void eofill() {
+        begin(CMD_EOFILL, 0);
+    }
+
+    /** @see PdfPage#fillStroke() */
+    public void fillStroke() {
+        begin(CMD_FILL_STROKE, 0);
+    }
+
+    /** @see PdfPage#eofillStroke() */
+    public void eofillStroke() {
+        begin(CMD_EOFILL_STROKE, 0);
+    }
+
+    /** @see PdfPage#closePathFillStroke() */
+    public void closePathFillStroke() {
+        begin(CMD_CLOSE_PATH_FILL_STROKE, 0);
+    }
+
+    /** @see PdfPage#closePathEofillStroke() */
+    public void closePathEofillStroke() {
+        begin(CMD_CLOSE_PATH_EOFILL_STROKE, 0);
+    }
+
+    /** @see PdfPage#clip() */
+    public void clip() {
+        begin(CMD_CLIP, 0);
+    }
+
+    /** @see PdfPage#eoclip() */
+    public void eoclip() {
+        begin(CMD_EOCLIP, 0);
+    }
+
+    /** @see PdfPage#gSave() */
+    public void gSave() {
+        begin(CMD_GSAVE, 0);
+    }
+
+    /** @see PdfPage#gRestore() */
+    public void gRestore() {
+        begin(CMD_GRESTORE, 0);
+    }
+
+    /** @see PdfPage#concat(float, float, float, float, float, float) */
+    public void concat(float a, float b, float c, float d, float x, float y) {
+        begin(CMD_CONCAT, 6);
+        mBuffer.putFloat(a).putFloat(b).putFloat(c).putFloat(d).putFloat(x).putFloat(y);
+    }
+
+    /** @see PdfPage#setLineWidth(float) */
+    public void setLineWidth(float lineWidth) {
+        put(CMD_SET_LINE_WIDTH, lineWidth);
+    }
+
+    /** @see PdfPage#setLineCap(PdfPage.LineCap) */
+    public void setLineCap(PdfPage.LineCap lineCap) {
+        begin(CMD_SET_LINE_CAP, 1);
+        mBuffer.putInt(lineCap.ordinal());
+    }
+
+    /** @see PdfPage#setLineJoin(PdfPage.LineJoin) */
+    public void setLineJoin(PdfPage.LineJoin lineJoin) {
+        begin(CMD_SET_LINE_JOIN, 1);
+        mBuffer.putInt(lineJoin.ordinal());
+    }
+
+    /** @see PdfPage#setMiterLimit(float) */
+    public void setMiterLimit(float miterLimit) {
+        put(CMD_SET_MITER_LIMIT, miterLimit);
+    }
+
+    /** @see PdfPage#setGrayFill(float) */
+    public void setGrayFill(float gray) {
+        put(CMD_SET_GRAY_FILL, gray);
+    }
+
+    /** @see PdfPage#setGrayStroke(float) */
+    public void setGrayStroke(float gray) {
+        put(CMD_SET_GRAY_STROKE, gray);
+    }
+
+    /** @see PdfPage#setRGBFill(float, float, float) */
+    public void setRGBFill(float red, float green, float blue) {
+        put(CMD_SET_RGB_FILL, red, green, blue);
+    }
+
+    /** @see PdfPage#setRGBStroke(float, float, float) */
+    public void setRGBStroke(float red, float green, float blue) {
+        put(CMD_SET_RGB_STROKE, red, green, blue);
+    }
+
+    /** @see PdfPage#setCMYKFill(float, float, float, float) */
+    public void setCMYKFill(float c, float m, float y, float k) {
+        put(CMD_SET_CMYK_FILL, c, m, y, k);
+    }
+
+    /** @see PdfPage#setCMYKStroke(float, float, float, float) */
+    public void setCMYKStroke(float c, float m, float y, float k) {
+        put(CMD_SET_CMYK_STROKE, c, m, y, k);
+    }
+
+    /** @see PdfPage#beginText() */
+    public void beginText() {
+        begin(CMD_BEGIN_TEXT, 0);
+    }
+
+    /** @see PdfPage#endText() */
+    public void endText() {
+        begin(CMD_END_TEXT, 0);
+    }
+
+    /** @see PdfPage#moveTextPos(float, float) */
+    public void moveTextPos(float x, float y) {
+        put(CMD_MOVE_TEXT_POS, x, y);
+    }
+
+    /** @see PdfPage#moveToNextLine() */
+    public void moveToNextLine() {
+        begin(CMD_MOVE_TO_NEXT_LINE, 0);
+    }
+
+    /** @see PdfPage#showText(String) */
+    public void showText(String text) {
+        begin(CMD_SHOW_TEXT, 1);
+        mBuffer.putInt(intern(text));
+    }
+
+    /** @see PdfPage#showTextNextLine(String) */
+    public void showTextNextLine(String text) {
+        begin(CMD_SHOW_TEXT_NEXT_LINE, 1);
+        mBuffer.putInt(intern(text));
+    }
+
+    /** @see PdfPage#textOut(float, float, String) */
+    public void textOut(float x, float y, String text) {
+        begin(CMD_TEXT_OUT, 3);
+        mBuffer.putFloat(x).putFloat(y).putInt(intern(text));
+    }
+
+    /** @see PdfPage#setCharSpace(float) */
+    public void setCharSpace(float value) {
+        put(CMD_SET_CHAR_SPACE, value);
+    }
+
+    /** @see PdfPage#setTextWordSpace(float) */
+    public void setTextWordSpace(float value) {
+        put(CMD_SET_WORD_SPACE, value);
+    }
+
+    /** @see PdfPage#setTextLeading(float) */
+    public void setTextLeading(float value) {
+        put(CMD_SET_TEXT_LEADING, value);
+    }
+
+    /** @see PdfPage#setHorizontalScaling(float) */
+    public void setHorizontalScaling(float value) {
+        put(CMD_SET_HORIZONTAL_SCALING, value);
+    }
+
+    /** @see PdfPage#setTextRise(float) */
+    public void setTextRise(float value) {
+        put(CMD_SET_TEXT_RISE, value);
+    }
+
+    /** @see PdfPage#setTextRenderingMode(PdfPage.TextRenderingMode) */
+    public void setTextRenderingMode(PdfPage.TextRenderingMode mode) {
+        begin(CMD_SET_TEXT_RENDERING_MODE, 1);
+        mBuffer.putInt(mode.ordinal());
+    }
+
+    /**
+     * Start a new command, flushing the buffer first if the command does not fit.
+     *
+     * @param command The opcode of the command.
+     * @param operands The number of 4 byte operands that follow the opcode.
+     */
+    private void begin(byte command, int operands) {
+        if (mBuffer.remaining() < 1 + operands * 4) {
+            flush();
+        }
+        mBuffer.put(command);
+    }
+
+    private void put(byte command, float a) {
+        begin(command, 1);
+        mBuffer.putFloat(a);
+    }
+
+    private void put(byte command, float a, float b) {
+        begin(command, 2);
+        mBuffer.putFloat(a).putFloat(b);
+    }
+
+    private void put(byte command, float a, float b, float c) {
+        begin(command, 3);
+        mBuffer.putFloat(a).putFloat(b).putFloat(c);
+    }
+
+    private void put(byte command, float a, float b, float c, float d) {
+        begin(command, 4);
+        mBuffer.putFloat(a).putFloat(b).putFloat(c).putFloat(d);
+    }
+
+    /**
+     * Get the index of a string in the string table of the current batch, adding it if needed.
+     * Must be called after {@link #begin(byte, int)} so a flush does not reset the table.
+     */
+    private int intern(String text) {
+        Integer index = mStringIndex.get(text);
+        if (index == null) {
+            index = mStrings.size();
+            mStrings.add(text);
+            mStringIndex.put(text, index);
+        }
+        return index;
+    }
+}
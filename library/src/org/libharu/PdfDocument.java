@@ -46,8 +46,11 @@ public class PdfDocument {
     /** The pages that make up this document */
     private LinkedList<PdfPage> mPages = new LinkedList<PdfPage>();
 
+    /** The number of pages that new documents copy from the template */
+    private int mTemplatePageCount = 0;
+
     /** Handle to the document. */
-    protected int mHPDFDocPointer;
+    protected long mHPDFDocPointer;
 
     private PdfDocument() {
     }
@@ -68,6 +71,27 @@ public class PdfDocument {
         return null;
     }
 
+    /**
+     * Create a new PDF document whose native memory is allocated from blocks of the given size and
+     * only released when the document is closed. Recycling the document with
+     * {@link #createPdf(PdfDocument)} then reuses the blocks of the previous document instead of
+     * freeing its objects one by one, while loaded fonts and encodings are kept. This suits
+     * generating many small documents in a loop.
+     * <p>
+     * NOTE: When finished with the document, you MUST call {@link #close()} to free the document in
+     * native memory.
+     * 
+     * @param blockSize The size in bytes of the memory blocks, such as 65536.
+     * @return The new PDF document on success, <code>null</code> on failure.
+     */
+    public static PdfDocument createPdf(int blockSize) {
+        PdfDocument pdf = new PdfDocument();
+        if (pdf.createPooled(blockSize)) {
+            return pdf;
+        }
+        return null;
+    }
+
     /**
      * Create a new PDF document from an existing document. If the existing document hasn't been
      * destroyed, it is first destroyed and then replaced by a new document.
@@ -79,13 +103,54 @@ public class PdfDocument {
      * @return True on success, otherwise false.
      */
     public static boolean createPdf(PdfDocument pdf) {
+        pdf.mPages.clear();
         if (create(pdf.mHPDFDocPointer)) {
             pdf.mClosed = false;
+            pdf.addTemplatePages();
             return true;
         }
         return false;
     }
 
+    /**
+     * Make the current contents of the document the template of the documents created from it
+     * afterwards with {@link #createPdf(PdfDocument)}, and start the first of them. The fonts,
+     * images and page contents of the template are serialized once and shared by every new
+     * document, which only copies the catalog, the page tree and the outlines. The pages of the
+     * template can still be drawn on and new pages added after them.
+     * <p>
+     * NOTE: The {@link PdfPage} objects obtained before this call belong to the template and must
+     * not be used any more; get the pages of the new document with {@link #getPage(int)}. A
+     * template can not be encrypted.
+     * 
+     * @return True on success, otherwise false.
+     */
+    public boolean setTemplate() {
+        if (!freezeTemplate()) {
+            return false;
+        }
+        mTemplatePageCount = mPages.size();
+        mPages.clear();
+        addTemplatePages();
+        return true;
+    }
+
+    /**
+     * Get a page of the document.
+     * 
+     * @param pageNum The index of the page, starting at 0.
+     * @return The page at the given index.
+     */
+    public PdfPage getPage(int pageNum) {
+        return mPages.get(pageNum);
+    }
+
+    private void addTemplatePages() {
+        for (int i = 0; i < mTemplatePageCount; i++) {
+            mPages.add(new PdfPage(this, i));
+        }
+    }
+
     /**
      * Close the document. This frees all native memory. Once this has been called, the document is
      * no longer valid and should not be accessed. TODO: Can a document be used again after freeing?
@@ -152,6 +217,14 @@ public class PdfDocument {
      */
     private native boolean create();
 
+    /**
+     * Create a new document which allocates its memory from a memory pool and initialize it.
+     * 
+     * @param blockSize The size in bytes of the blocks of the memory pool.
+     * @return True if created successfully, otherwise false.
+     */
+    private native boolean createPooled(int blockSize);
+
     /**
      * Create new document using the provided HPDF_Doc. If HPDF_Doc already has a document, the
      * current document is revoked.
@@ -159,7 +232,7 @@ public class PdfDocument {
      * @param pdf The handle of an HPDF_Doc document object.
      * @return True if created successfully, otherwise false.
      */
-    private static native boolean create(int pdf);
+    private static native boolean create(long pdf);
 
     /**
      * Revoke the current document object and all resources.
@@ -172,14 +245,14 @@ public class PdfDocument {
      * 
      * @param pdf The handle of an HPDF_Doc document object.
      */
-    private static native void freeDoc(int pdf);
+    private static native void freeDoc(long pdf);
 
     /**
      * Revoke the document in the provided HPDF_Doc handle along with all the resources.
      * 
      * @param pdf The handle of an HPDF_Doc document object.
      */
-    private static native void freeDocAll(int pdf);
+    private static native void freeDocAll(long pdf);
 
     /**
      * Save the current document to a file.
@@ -197,7 +270,7 @@ public class PdfDocument {
      * @param pdf The handle of an HPDF_Doc document object.
      * @return True if the provided document is valid, otherwise false.
      */
-    private static native boolean hasDoc(int pdf);
+    private static native boolean hasDoc(long pdf);
 
     // setErrorHandler/getError/resetError
 
@@ -227,4 +300,74 @@ public class PdfDocument {
      *            {@link #HPDF_COMP_ALL}
      */
     public native void setCompressionMode(int mode);
+
+    /**
+     * Limit the memory used by the stream data (page contents, images, fonts) of the document.
+     * When the limit is exceeded, the least recently written streams are moved into temporary
+     * files until the document is saved.
+     * 
+     * @param limit The maximum number of bytes to keep in memory, or 0 for no limit (the default).
+     * @param tempDir The directory to create the temporary files in, such as
+     *            <code>Context.getCacheDir().getPath()</code>. If <code>null</code>, the system
+     *            default is used.
+     */
+    public native void setMemoryBudget(int limit, String tempDir);
+
+    /**
+     * Set the number of decimal places written for coordinates and other real values in the
+     * contents of pages added after this call. Fewer decimal places make smaller files; 2 is
+     * enough for documents that are only displayed on screen.
+     * 
+     * @param precision The number of decimal places, from 0 to 5 (the default).
+     */
+    public native void setRealPrecision(int precision);
+
+    /**
+     * Leave out of the contents of pages added after this call the operators that set a color,
+     * line style or text state parameter to the value it already has, such as a table that sets
+     * the same fill color and font for every cell. The output looks the same, but is smaller and
+     * faster for viewers to parse.
+     * 
+     * @param optimize <code>true</code> to leave out redundant operators; <code>false</code>
+     *            (the default) to write every operator.
+     */
+    public native void setOptimizeContent(boolean optimize);
+
+    /**
+     * Let pages added after this call share one resource dictionary, kept by the document, instead
+     * of each listing the fonts and images it uses. A long document that uses the same few fonts
+     * on every page then writes that list once rather than once per page.
+     * 
+     * @param share <code>true</code> to share the resources of new pages; <code>false</code> (the
+     *            default) to give each page its own.
+     */
+    public native void setShareResources(boolean share);
+
+    /**
+     * Keep the compressed images, fonts and finished pages written by a save, so that saving the
+     * document again only writes them out instead of compressing them anew. This holds that data
+     * in memory until the document is freed, so it only pays off for documents that are saved more
+     * than once. Images read from their files when they are saved are never kept.
+     * 
+     * @param cache <code>true</code> to keep the written objects; <code>false</code> (the default)
+     *            to write them again on every save.
+     */
+    public native void setCacheObjects(boolean cache);
+
+    /**
+     * Set the resolution that PNG images and bitmaps are reduced to for the size they are drawn at,
+     * so that large photos placed in small regions do not embed all of their pixels. Each image is
+     * reduced when it is drawn, so it should only be drawn once. JPEG images are not affected.
+     * 
+     * @param dpi The maximum number of pixels per inch, or 0 to keep images at their full
+     *            resolution (the default).
+     */
+    public native void setImageResolution(float dpi);
+
+    /**
+     * Make the current document the template of the documents created afterwards.
+     * 
+     * @return True on success, otherwise false.
+     */
+    private native boolean freezeTemplate();
 }
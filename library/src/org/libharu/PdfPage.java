@@ -16,6 +16,10 @@
 
 package org.libharu;
 
+import android.graphics.Bitmap;
+
+import java.nio.ByteBuffer;
+
 public class PdfPage {
     static {
         System.loadLibrary("hpdf");
@@ -64,10 +68,18 @@ public class PdfPage {
         LEFT, RIGHT, CENTER, JUSTIFY
     }
 
+    /**
+     * The blend mode used to composite painted objects.
+     */
+    public enum BlendMode {
+        NORMAL, MULTIPLY, SCREEN, OVERLAY, DARKEN, LIGHTEN, COLOR_DODGE, COLOR_BURN, HARD_LIGHT,
+        SOFT_LIGHT, DIFFERENCE, EXCLUSION
+    }
+
     /** Handle to the page. */
-    protected int mHPDFPagePointer;
+    protected long mHPDFPagePointer;
     /** Handle to the page's parent document. */
-    protected int mParentHPDFDocPointer;
+    protected long mParentHPDFDocPointer;
 
     /**
      * Create a new PDF page at the end of the provided PDF document.
@@ -89,6 +101,17 @@ public class PdfPage {
         insertPage(pdf.mHPDFDocPointer, target.mHPDFPagePointer);
     }
 
+    /**
+     * Wrap a page that the provided PDF document already has, such as a page copied from its
+     * template.
+     * 
+     * @param pdf The PDF document containing the page.
+     * @param index The index of the page, starting at 0.
+     */
+    protected PdfPage(PdfDocument pdf, int index) {
+        getPage(pdf.mHPDFDocPointer, index);
+    }
+
     /**
      * Change the size and direction of the page to a predefined size.
      * 
@@ -127,6 +150,18 @@ public class PdfPage {
         setTextRenderingMode(mode.ordinal());
     }
 
+    /**
+     * Sets the stroking alpha, the filling alpha and the blend mode. The document keeps one
+     * graphics state object for each combination of values, which is shared by all pages using it.
+     * 
+     * @param alphaStroke The alpha of stroking operations between 0 and 1.
+     * @param alphaFill The alpha of filling operations between 0 and 1.
+     * @param blendMode The blend mode.
+     */
+    public void setExtGState(float alphaStroke, float alphaFill, BlendMode blendMode) {
+        setExtGState(alphaStroke, alphaFill, blendMode.ordinal());
+    }
+
     /**
      * Prints the text inside the specified region.
      * 
@@ -141,6 +176,46 @@ public class PdfPage {
         textRect(l, t, r, b, text, align.ordinal());
     }
 
+    /**
+     * Breaks the text into lines of the specified width with the current font, font size, character
+     * spacing and word spacing. The text is measured once; the lines can then be shown with
+     * {@link #showTextLayout} on as many regions or pages as needed without measuring it again.
+     * <p>
+     * NOTE: When finished with the layout, you MUST call {@link PdfTextLayout#close()} to free it in
+     * native memory.
+     * 
+     * @param text The text to lay out.
+     * @param width The width of the lines.
+     * @return The layout on success, <code>null</code> on failure.
+     */
+    public PdfTextLayout layoutText(String text, float width) {
+        long layout = createTextLayout(text, width);
+        if (layout != 0) {
+            return new PdfTextLayout(layout);
+        }
+        return null;
+    }
+
+    /**
+     * Prints the lines of a text layout inside the specified region, starting at the specified line.
+     * The font, font size and spacing are set to the ones the layout was measured with.
+     * 
+     * @param layout The layout to print.
+     * @param firstLine The index of the first line to print.
+     * @param l The left side of the region to output text.
+     * @param t The top side of the region to output text.
+     * @param r The right side of the region to output text.
+     * @param b The bottom side of the region to output text.
+     * @param align The alignment of the text.
+     * @return The index of the first line which did not fit in the region, or
+     *         {@link PdfTextLayout#getLineCount()} if all lines were printed.
+     */
+    public int showTextLayout(PdfTextLayout layout, int firstLine, float l, float t, float r,
+            float b, TextAlign align) {
+        return showTextLayout(layout.mHPDFTextLayoutPointer, firstLine, l, t, r, b,
+                align.ordinal());
+    }
+
     /**
      * Cache the field IDs that will be accessed.
      */
@@ -151,7 +226,7 @@ public class PdfPage {
      * 
      * @param pdf The handle of an HPDF_Doc document object.
      */
-    private native void create(int pdf);
+    private native void create(long pdf);
 
     /**
      * Create a new page and insert it just before the specified page.
@@ -159,7 +234,15 @@ public class PdfPage {
      * @param pdf The handle of an HPDF_Doc document object.
      * @param page The handle of an HPDF_Page page object. Insert new page just before.
      */
-    private native void insertPage(int pdf, int page);
+    private native void insertPage(long pdf, long page);
+
+    /**
+     * Get a page of a document by its index.
+     * 
+     * @param pdf The handle of an HPDF_Doc document object.
+     * @param index The index of the page, starting at 0.
+     */
+    private native void getPage(long pdf, int index);
 
     /**
      * Change the size and direction of the page to a predefined size.
@@ -330,7 +413,9 @@ public class PdfPage {
     public native void drawJpegImage(byte[] image, float x, float y, float width, float height);
 
     /**
-     * Draws a JPEG image.
+     * Draws a JPEG image. Only the header of the file is read here; the image data is read from
+     * the file when the document is saved. The file must therefore stay in place and unchanged
+     * until the document has been saved, or saving fails.
      * 
      * @param path The file path to a JPEG image.
      * @param x The x coordinate of the lower-left point of the region where image is displayed.
@@ -363,6 +448,20 @@ public class PdfPage {
      */
     public native void drawPngImageFromFile(String path, float x, float y, float width, float height);
 
+    /**
+     * Draws a bitmap. The pixels are converted directly into the PDF image, so there is no need
+     * to compress the bitmap first. Only {@link Bitmap.Config#ARGB_8888} and
+     * {@link Bitmap.Config#RGB_565} bitmaps are supported; transparent pixels are kept with a soft
+     * mask.
+     * 
+     * @param bitmap The bitmap to draw.
+     * @param x The x coordinate of the lower-left point of the region where image is displayed.
+     * @param y The y coordinate of the lower-left point of the region where image is displayed.
+     * @param width The width of the region where image is displayed.
+     * @param height The height of the region where image is displayed.
+     */
+    public native void drawBitmap(Bitmap bitmap, float x, float y, float width, float height);
+
     /**
      * Appends an ellipse to the current path.
      * 
@@ -484,6 +583,31 @@ public class PdfPage {
      */
     public native void moveToNextLine();
 
+    /**
+     * Appends a path built from a sequence of path construction operators in a single call.
+     * 
+     * @param ops The operators, one character each: 'm' (move to), 'l' (line to), 'c', 'v' and 'y'
+     *            (Bezier curves) and 'h' (close path).
+     * @param coords The coordinates consumed by the operators in order: 2 for 'm' and 'l', 6 for
+     *            'c', 4 for 'v' and 'y' and none for 'h'.
+     */
+    public native void path(String ops, float[] coords);
+
+    /**
+     * Appends a closed subpath through the specified points to the current path.
+     * 
+     * @param xy The points of the polygon as interleaved x and y coordinates.
+     */
+    public native void polygon(float[] xy);
+
+    /**
+     * Appends an open subpath through the specified points to the current path. The first point
+     * becomes the start point and the last point becomes the current point.
+     * 
+     * @param xy The points of the polyline as interleaved x and y coordinates.
+     */
+    public native void polyline(float[] xy);
+
     /**
      * Appends a rectangle to the current path.
      * 
@@ -523,7 +647,14 @@ public class PdfPage {
 
     // setDash
 
-    // setExtGState
+    /**
+     * Sets the stroking alpha, the filling alpha and the blend mode.
+     * 
+     * @param alphaStroke The alpha of stroking operations between 0 and 1.
+     * @param alphaFill The alpha of filling operations between 0 and 1.
+     * @param blendMode The blend mode.
+     */
+    private native void setExtGState(float alphaStroke, float alphaFill, int blendMode);
 
     // setFontAndSize
 
@@ -676,4 +807,37 @@ public class PdfPage {
      * @param align The alignment of the text.
      */
     private native void textRect(float l, float t, float r, float b, String text, int align);
+
+    /**
+     * Breaks the text into lines of the specified width.
+     * 
+     * @param text The text to lay out.
+     * @param width The width of the lines.
+     * @return The handle to the layout, or 0 on failure.
+     */
+    private native long createTextLayout(String text, float width);
+
+    /**
+     * Prints the lines of a text layout inside the specified region.
+     * 
+     * @param layout The handle to the layout.
+     * @param firstLine The index of the first line to print.
+     * @param l The left side of the region to output text.
+     * @param t The top side of the region to output text.
+     * @param r The right side of the region to output text.
+     * @param b The bottom side of the region to output text.
+     * @param align The alignment of the text.
+     * @return The index of the first line which was not printed.
+     */
+    private native int showTextLayout(long layout, int firstLine, float l, float t, float r,
+            float b, int align);
+
+    /**
+     * Replays the commands recorded by a {@link PdfCommandBuffer} on this page.
+     * 
+     * @param commands The direct buffer holding the encoded commands.
+     * @param length The number of bytes of commands in the buffer.
+     * @param strings The strings referenced by index from the commands.
+     */
+    native void replayCommands(ByteBuffer commands, int length, String[] strings);
 }
@@ -0,0 +1,83 @@
+/*
+ * Copyright (C) 2012 Andrew Hughes <ashughes@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package org.libharu;
+
+/**
+ * The result of breaking text into lines with {@link PdfPage#layoutText(String, float)}. The
+ * lines keep their measurements, so they can be printed with
+ * {@link PdfPage#showTextLayout(PdfTextLayout, int, float, float, float, float, PdfPage.TextAlign)}
+ * on one or more regions or pages without measuring the text again.
+ */
+public class PdfTextLayout {
+    static {
+        System.loadLibrary("hpdf");
+    }
+
+    /** Handle to the layout. */
+    protected long mHPDFTextLayoutPointer;
+
+    PdfTextLayout(long layout) {
+        mHPDFTextLayoutPointer = layout;
+    }
+
+    /**
+     * Frees the layout in native memory. The layout cannot be used afterwards.
+     */
+    public void close() {
+        if (mHPDFTextLayoutPointer != 0) {
+            free(mHPDFTextLayoutPointer);
+            mHPDFTextLayoutPointer = 0;
+        }
+    }
+
+    /**
+     * Gets the number of lines of the layout.
+     * 
+     * @return The number of lines.
+     */
+    public int getLineCount() {
+        return getLineCount(mHPDFTextLayoutPointer);
+    }
+
+    /**
+     * Gets the width of the text of a line, without trailing white space.
+     * 
+     * @param index The index of the line.
+     * @return The width of the line.
+     */
+    public float getLineWidth(int index) {
+        return getLineWidth(mHPDFTextLayoutPointer, index);
+    }
+
+    /**
+     * Gets the text of a line, without trailing white space.
+     * 
+     * @param index The index of the line.
+     * @return The text of the line.
+     */
+    public String getLineText(int index) {
+        return getLineText(mHPDFTextLayoutPointer, index);
+    }
+
+    private static native void free(long layout);
+
+    private static native int getLineCount(long layout);
+
+    private static native float getLineWidth(long layout, int index);
+
+    private static native String getLineText(long layout, int index);
+}